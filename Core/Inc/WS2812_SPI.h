@@ -8,9 +8,12 @@
 #ifndef INC_WS2812_SPI_H_
 #define INC_WS2812_SPI_H_
 
+#include "led_conf.h"
 
 #define NUM_LED 144
 
+void ws2812_spi (int, int, int);
 void WS2812_Send (void);
+void WS2812_Send_Data (rgb_color *, uint16_t);
 
 #endif /* INC_WS2812_SPI_H_ */
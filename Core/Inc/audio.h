@@ -0,0 +1,41 @@
+#ifndef _AUDIO_H_
+#define _AUDIO_H_
+
+#include "main.h"
+#include "led_conf.h"
+#include "led_spectrum.h"
+
+
+// ============= Audio input ===============
+//  TIM3 update (8 kHz) triggers one ADC conversion of PA0 (ADC_IN0); DMA1
+//  channel 1 writes them into a circular buffer of two SPECTRUM_LEN halves.
+//  The half / full transfer interrupts only mark a half as ready, the FFT
+//  and the rendering run from audio_poll() in the main loop. A half that is
+//  not taken before DMA comes back to it counts as an overrun.
+//
+//  Input: line level, AC coupled and biased to VDDA / 2.
+
+#define AUDIO_BLOCK_MS      (SPECTRUM_LEN * 1000 / SPECTRUM_RATE)
+
+
+typedef struct
+{
+	uint32_t ulBlocks;                        // Blocks processed
+	uint32_t ulOverrun;                       // Blocks overwritten before they were processed
+	uint32_t ulClkLast;                       // Core clocks of the last spectrum_process() + render
+	uint32_t ulClkMax;                        // Worst case of ulClkLast
+} AudioStatDef;
+
+
+// =============== Audio functions declaration ======================
+
+void        audio_init              (void);
+void        audio_set_mode          (uint8_t);
+SpectrumMode audio_mode             (void);
+uint8_t     audio_poll              (rgb_color *, const LedTypeDef *, uint8_t);
+
+extern AudioStatDef sAudioStat;
+
+
+
+#endif
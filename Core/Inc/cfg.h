@@ -0,0 +1,93 @@
+#ifndef _CFG_H_
+#define _CFG_H_
+
+#include "main.h"
+#include "led_conf.h"
+#include "stream.h"
+
+
+// ============= Flash layout ===============
+//  The last two 1 KB pages hold an append-only log of key/value records. One
+//  page is active, the other is kept erased as the compaction target. The
+//  linker ROM region ends at CFG_PAGE0_ADDR (K3NA.uvprojx, IROM1 size 0xF800).
+//
+//  Page   : MAGIC SEQ RECORD...           (SEQ + 1 on every compaction)
+//  Record : KEY LEN CHECK DATA[LEN] (pad)  KEY/LEN/CHECK are halfword aligned
+//  CHECK  = ~(16 bit sum of the KEY|LEN<<8 halfword and all DATA halfwords)
+//
+//  KEY|LEN is programmed first and CHECK last, so a record torn by a reset
+//  fails its check and is skipped. The newest valid record of a key wins.
+
+#define CFG_PAGE0_ADDR      0x0800F800
+#define CFG_PAGE1_ADDR      0x0800FC00
+#define CFG_PAGE_SIZE       FLASH_PAGE_SIZE
+#define CFG_PAGE_HDR        4
+#define CFG_REC_HDR         4
+#define CFG_MAGIC           0x4B33            // "3K"
+
+#define CFG_KEY_MAX         8
+#define CFG_VALUE_MAX       12
+
+// ============= Background timing ===============
+//  A page erase stalls every flash fetch (code and vectors) for up to 40 ms, a
+//  record program for about 50 us per halfword. cfg_poll() only starts a job
+//  that fits in the idle window the caller hands it.
+//
+//  No interrupt runs during an erase: USART1 bytes pile up unparsed in the
+//  STREAM_RX_MS ring and SysTick drops ticks, which shifts the network clock
+//  and key timing. So the caller also says whether an erase may run: only
+//  once the link has been quiet for CFG_QUIET_MS, no key is moving and no
+//  clock is shared over sync. Until then records keep being appended and
+//  compaction waits; cfg_init() erases the spare page at the next boot anyway.
+#define CFG_ERASE_MS        40
+#define CFG_COMPACT_MS      5
+#define CFG_WRITE_MS        1
+#define CFG_QUIET_MS        100               // Link silence before an erase, far past STREAM_RX_MS and a 10 fps frame gap
+
+#if CFG_QUIET_MS <= STREAM_RX_MS
+#error "CFG_QUIET_MS must exceed the time the USART1 ring takes to fill"
+#endif
+
+// ============= Keys ===============
+#define CFG_KEY_BRIGHT      0x00              // u8 brightness, 0..100 %
+#define CFG_KEY_SEG0        0x01              // CfgSegDef, segment 0..2
+#define CFG_KEY_SEG1        0x02
+#define CFG_KEY_SEG2        0x03
+#define CFG_KEY_SYNC        0x04              // u8 time sync role, 1 = master, else follower
+#define CFG_KEY_AUDIO       0x05              // u8 SpectrumMode, audio.h
+
+
+typedef struct
+{
+	uint16_t  wStart;                         // First LED of the segment
+	uint16_t  wEnd;                           // Last LED of the segment
+	uint8_t   ucDir;                          // StateDir
+	rgb_color rColorOri;                      // Original color
+	rgb_color rColorFill;                     // Filled color
+} CfgSegDef;
+
+
+typedef struct
+{
+	uint32_t ulWrites;                        // Records programmed
+	uint32_t ulCompact;                       // Compactions
+	uint32_t ulErase;                         // Page erases
+	uint32_t ulFail;                          // Failed program / erase operations
+	uint16_t wUsed;                           // Bytes used in the active page
+	uint16_t wSeq;                            // Sequence number of the active page
+} CfgStatDef;
+
+
+// =============== Config functions declaration ======================
+
+void     cfg_init                (void);
+uint8_t  cfg_get                 (uint8_t, void *, uint8_t);
+uint8_t  cfg_set                 (uint8_t, const void *, uint8_t);
+uint16_t cfg_changes             (void);
+void     cfg_poll                (uint32_t, uint8_t);
+
+extern CfgStatDef sCfgStat;
+
+
+
+#endif
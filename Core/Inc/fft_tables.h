@@ -0,0 +1,12 @@
+// Generated by Tools/fft_tables.py rfft_q15:128, do not edit
+
+#ifndef _FFT_TABLES_H_
+#define _FFT_TABLES_H_
+
+#include "arm_math.h"
+
+extern const arm_cfft_instance_q15 fft_cfft_q15_len64;
+extern const arm_rfft_instance_q15 fft_rfft_q15_len128;
+extern const arm_rfft_instance_q15 fft_rifft_q15_len128;
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef _KEY_H_
+#define _KEY_H_
+
+#include "main.h"
+
+
+// ============= Key Name ===============
+#define KEY_MODE            0                 // PA1 - Switch mode
+#define KEY_GASO            1                 // PA2 - Push Button TPS
+#define MAX_KEYS            2
+
+// ============= Key Timing (ms) ===============
+#define KEY_DEBOUNCE_MS     5                 // Settle time after last edge
+#define KEY_LONG_MS         1000              // Hold time for long press
+
+#define KEY_QUEUE_SIZE      8                 // Must be power of two
+#define KEY_PRESSED_LEVEL   GPIO_PIN_RESET    // Button pulls line to ground
+
+// ============= Modes cycled by KEY_MODE ===============
+#define KEY_MODE_AUTO       0                 // Host frames, host text, spectrum, segments as they come
+#define KEY_MODE_LOCAL      1                 // Host frames and text wait, spectrum and segments run
+#define KEY_MODE_SEGMENT    2                 // Segment animation only, sampling stops
+#define KEY_MODE_SPARK      3                 // Particle sparks over the whole strip, sampling stops
+#define KEY_MODE_MAX        4
+
+
+typedef enum
+{
+	KEY_EV_PRESS,
+	KEY_EV_RELEASE,
+	KEY_EV_LONG
+} KeyEventType;
+
+typedef struct
+{
+	uint8_t      ucKey;                       // KEY_MODE / KEY_GASO
+	KeyEventType eType;
+} KeyEventDef;
+
+
+// =============== Key functions declaration ======================
+
+void    key_init                (void);
+void    update_keys             (void);
+void    key_exti                (uint16_t);
+uint8_t key_get_event           (KeyEventDef *);
+uint8_t key_idle                (void);
+
+
+
+#endif
@@ -12,6 +12,11 @@
 
 #define NUM_COR     0
 
+// ================================ Panel, MATRIX_WIDTH * MATRIX_HEIGHT <= MAX_NUMB
+#define MATRIX_WIDTH     10
+#define MATRIX_HEIGHT    8
+#define MATRIX_WIRING    MATRIX_SERPENTINE
+
 // ================================ PORT DEFINE
 
 
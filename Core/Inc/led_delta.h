@@ -0,0 +1,45 @@
+#ifndef _LED_DELTA_H_
+#define _LED_DELTA_H_
+
+#include "main.h"
+#include "led_conf.h"
+
+
+// ============= Delta opcodes ===============
+//  The payload is a list of ops applied at a pixel cursor that starts at 0.
+//  n = low bits + 1, so one op covers 1..64 pixels (1..32 for DELTA_OP_PAL).
+//
+//  00nnnnnn                SKIP   cursor += n, pixels keep their color
+//  01nnnnnn R G B          FILL   n pixels of one color
+//  10nnnnnn {R G B} x n    COPY   n literal pixels
+//  110nnnnn IDX            PAL    n pixels of palette[IDX]
+//  11100000 POS_L POS_H    SEEK   cursor = POS
+//  11100001 IDX R G B      PALSET palette[IDX] = R G B, cursor unchanged
+
+#define DELTA_OP_SKIP       0x00
+#define DELTA_OP_FILL       0x40
+#define DELTA_OP_COPY       0x80
+#define DELTA_OP_PAL        0xC0
+#define DELTA_OP_SEEK       0xE0
+#define DELTA_OP_PALSET     0xE1
+
+#define DELTA_RUN_MASK      0x3F
+#define DELTA_PAL_MASK      0x1F
+
+#define DELTA_PAL_SIZE      16
+
+
+typedef struct
+{
+	rgb_color rPalette[DELTA_PAL_SIZE];       // Set by DELTA_OP_PALSET, kept between packets
+} DeltaTypeDef;
+
+
+// =============== Delta functions declaration ======================
+
+void    led_delta_init          (DeltaTypeDef *);
+uint8_t led_delta_decode        (DeltaTypeDef *, rgb_color *, uint16_t, const uint8_t *, uint16_t);
+
+
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef _LED_MATRIX_H_
+#define _LED_MATRIX_H_
+
+#include "main.h"
+#include "led_conf.h"
+
+
+// ============= Panel layouts ===============
+//  (0, 0) is the top left pixel. The layout tells where the strip runs:
+//
+//  MATRIX_ROWS          every row left to right
+//  MATRIX_SERPENTINE    rows zig-zag: even rows left to right, odd rows back
+//  MATRIX_COLUMNS       every column top to bottom
+//  MATRIX_COL_SERPENTINE columns zig-zag: even columns down, odd columns up
+//  MATRIX_CUSTOM        caller fills the table (wiring that fits no pattern)
+//
+//  matrix_init() resolves the layout once into a table of strip indices,
+//  pMap[y * ucWidth + x], so drawing never does coordinate math per pixel.
+
+typedef enum
+{
+	MATRIX_ROWS,
+	MATRIX_SERPENTINE,
+	MATRIX_COLUMNS,
+	MATRIX_COL_SERPENTINE,
+	MATRIX_CUSTOM
+} MatrixLayout;
+
+typedef struct
+{
+	uint8_t   ucWidth;
+	uint8_t   ucHeight;
+	uint16_t *pMap;                 // ucWidth * ucHeight strip indices, row by row
+} MatrixTypeDef;
+
+typedef struct
+{
+	uint8_t          ucWidth;
+	uint8_t          ucHeight;
+	const rgb_color *pData;         // ucWidth * ucHeight pixels, row by row
+	FlagStatus       fKey;          // SET: pixels equal to rKey are not drawn
+	rgb_color        rKey;
+} MatrixSpriteDef;
+
+
+// =============== Matrix functions declaration ======================
+
+void      matrix_init            (MatrixTypeDef *, uint16_t *, uint8_t, uint8_t, MatrixLayout, uint16_t);
+uint16_t  matrix_index           (MatrixTypeDef *, uint8_t, uint8_t);
+
+void      matrix_fill            (rgb_color *, MatrixTypeDef *, rgb_color);
+void      matrix_fill_row        (rgb_color *, MatrixTypeDef *, uint8_t, rgb_color);
+void      matrix_fill_col        (rgb_color *, MatrixTypeDef *, uint8_t, rgb_color);
+void      matrix_fill_rect       (rgb_color *, MatrixTypeDef *, int16_t, int16_t, uint8_t, uint8_t, rgb_color);
+void      matrix_set_col         (rgb_color *, MatrixTypeDef *, uint8_t, const rgb_color *);
+void      matrix_set_col_mask    (rgb_color *, MatrixTypeDef *, uint8_t, uint32_t, rgb_color, rgb_color);
+void      matrix_blit            (rgb_color *, MatrixTypeDef *, int16_t, int16_t, const MatrixSpriteDef *);
+
+void      matrix_scroll_left     (rgb_color *, MatrixTypeDef *, rgb_color);
+void      matrix_scroll_right    (rgb_color *, MatrixTypeDef *, rgb_color);
+void      matrix_scroll_up       (rgb_color *, MatrixTypeDef *, rgb_color);
+void      matrix_scroll_down     (rgb_color *, MatrixTypeDef *, rgb_color);
+
+
+
+#endif
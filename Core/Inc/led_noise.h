@@ -0,0 +1,39 @@
+#ifndef _LED_NOISE_H_
+#define _LED_NOISE_H_
+
+#include "main.h"
+
+
+// ============= Gradient noise ===============
+//  Coordinates are 8.8 fixed point: the high byte picks the lattice cell,
+//  the low byte is the position inside it, so one unit of noise detail is
+//  256 steps and the pattern repeats every 65536. Results are 0..255 with
+//  128 as the mean, ready for a palette or a brightness.
+//
+//  Everything is integer and table driven (permutation, gradients, quintic
+//  fade), with no division and no 64 bit math.
+//
+//  The noise_fill_*() functions sample a row along x with y and z fixed.
+//  Along such a row the y/z part of every cell is linear in x, so it is
+//  reduced once per cell and each sample costs about as much as 1D noise
+//  per octave, whatever the dimension. Per sample costs are measured by the
+//  noise_* cases of Sim/Src/bench_main.c (host ns) and Tools/bench_qemu.py
+//  (ARM instructions).
+
+#define NOISE_OCT_MAX       8
+
+
+// =============== Noise functions declaration ======================
+
+uint8_t  noise_1d              (uint16_t);
+uint8_t  noise_2d              (uint16_t, uint16_t);
+uint8_t  noise_3d              (uint16_t, uint16_t, uint16_t);
+uint8_t  noise_fbm_3d          (uint16_t, uint16_t, uint16_t, uint8_t);
+
+void     noise_fill_1d         (uint8_t *, uint16_t, uint16_t, uint16_t, uint8_t);
+void     noise_fill_2d         (uint8_t *, uint16_t, uint16_t, uint16_t, uint16_t, uint8_t);
+void     noise_fill_3d         (uint8_t *, uint16_t, uint16_t, uint16_t, uint16_t, uint16_t, uint8_t);
+
+
+
+#endif
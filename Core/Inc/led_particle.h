@@ -0,0 +1,72 @@
+#ifndef _LED_PARTICLE_H_
+#define _LED_PARTICLE_H_
+
+#include "main.h"
+#include "led_conf.h"
+
+
+// ============= Particle pool ===============
+//  Particles live on the strip, positions and speeds are fixed point with
+//  PARTICLE_FRAC fraction bits (1/64 pixel), so a strip can be up to 1024
+//  pixels long. The pool is a static array of 6 byte particles, the live
+//  ones packed at its start: the color is an index into the palette given to
+//  particle_render() and acceleration is one constant per effect, given to
+//  particle_update(). 256 particles take 1.5 KB of the 8 KB RAM.
+
+#ifndef PARTICLE_MAX
+#define PARTICLE_MAX        256
+#endif
+
+#define PARTICLE_FRAC       6
+#define PARTICLE_ONE        (1 << PARTICLE_FRAC)
+#define PARTICLE_POS(x)     ((uint16_t)((x) << PARTICLE_FRAC))    // Pixel to position
+#define PARTICLE_NONE       0xFFFF
+
+#define PARTICLE_VEL_MAX    127               // Speed limit, just under 2 pixels per step
+
+typedef struct
+{
+	uint16_t  wPos;                           // Position, pixel << PARTICLE_FRAC
+	int8_t    cVel;                           // Added to wPos every step
+	uint8_t   ucLife;                         // Brightness, 255 = full palette color
+	uint8_t   ucFade;                         // Taken from ucLife every step, 0 = lives until it leaves
+	uint8_t   ucColor;                        // Palette index
+} ParticleDef;
+
+
+// ============= Spark effect ===============
+//  particle_spark() draws one frame: bursts of sparks fly out of a random
+//  pixel, slow down and burn out just as they stop, trails fade behind.
+
+#define SPARK_CHANCE        8                 // One burst per SPARK_CHANCE frames on average, power of two
+#define SPARK_BURST         5                 // Sparks per burst
+#define SPARK_DRAG          2                 // Speed lost per frame, 1/64 pixel
+#define SPARK_KEEP          176               // Trail brightness kept per frame, /256
+#define SPARK_COLORS        8                 // Palette size, power of two
+
+extern const rgb_color rSparkPal[SPARK_COLORS];
+
+typedef struct
+{
+	uint32_t ulFrames;                        // Frames drawn by particle_spark()
+	uint32_t ulClkLast;                       // Core clocks of the last frame
+	uint32_t ulClkMax;                        // Worst case of ulClkLast
+} ParticleStatDef;
+
+extern ParticleStatDef sParticleStat;
+
+
+// =============== Particle functions declaration ======================
+
+void      particle_init          (void);
+uint16_t  particle_spawn         (uint16_t, int8_t, uint8_t, uint8_t, uint8_t);
+void      particle_update        (uint16_t, int8_t);
+void      particle_render        (rgb_color *, uint16_t, const rgb_color *);
+void      particle_dim           (rgb_color *, uint16_t, uint8_t);
+uint16_t  particle_count         (void);
+uint16_t  particle_rand          (void);
+void      particle_spark         (rgb_color *, uint16_t);
+
+
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef _LED_SPECTRUM_H_
+#define _LED_SPECTRUM_H_
+
+#include "main.h"
+#include "led_conf.h"
+#include "arm_math.h"
+
+
+// ============= Audio spectrum ===============
+//  One block is SPECTRUM_LEN ADC samples at SPECTRUM_RATE. spectrum_process()
+//  removes the DC level, applies a Hann window and runs arm_rfft_q15, then
+//  sums bin power into SPECTRUM_BANDS log spaced bands (62.5 Hz .. 4 kHz,
+//  3/4 octave each) and takes log2 of every band. Levels are 0..255 over
+//  the 48 dB below an automatic reference that follows the loudest band,
+//  so quiet and loud sources both fill the bars.
+//
+//  The RFFT instance is fft_rfft_q15_len128 from fft_tables.c, whose tables
+//  Tools/fft_tables.py cuts down to SPECTRUM_LEN (1 KB); arm_rfft_init_q15()
+//  would link 32 KB of real coefficients alone. Everything is fixed point. The
+//  same functions run in Sim/Src/audio_main.c on synthetic or WAV input.
+
+#define SPECTRUM_LEN        128               // Samples per block, Tools/fft_tables.py length
+#define SPECTRUM_RATE       8000              // Hz, sample trigger
+#define SPECTRUM_BANDS      8
+#define SPECTRUM_ADC_SHIFT  3                 // 12 bit ADC codes to q15
+
+#define SPECTRUM_RANGE_SH   3                 // Levels show 256 << 3 log2 Q8 below the reference (48 dB)
+#define SPECTRUM_REF_MIN    (10 * 256)        // Lowest reference, keeps silence dark
+#define SPECTRUM_REF_FALL   2                 // Reference decay per block, log2 Q8 (0.75 dB/s)
+#define SPECTRUM_FALL       6                 // Level decay per block
+#define SPECTRUM_HOLD       30                // Blocks a peak stays before it falls
+
+typedef enum
+{
+	SPECTRUM_OFF,
+	SPECTRUM_BARS,                            // Segment n shows band group n as a bar
+	SPECTRUM_VU                               // Every segment shows the total level
+} SpectrumMode;
+
+typedef struct
+{
+	const arm_rfft_instance_q15 *pRfft;       // Pruned tables of fft_tables.c, any SPECTRUM_LEN instance works
+	q15_t    qIn[SPECTRUM_LEN];               // Windowed block, the FFT works in place
+	q15_t    qOut[SPECTRUM_LEN * 2];          // Complex spectrum, both halves
+
+	uint16_t wLog[SPECTRUM_BANDS + 1];        // Band power, log2 Q8, last = all bands
+	uint16_t wRef[2];                         // Automatic gain reference of the bands and of the total, log2 Q8
+	uint8_t  ucLevel[SPECTRUM_BANDS + 1];     // Shown level 0..255, fast attack, slow fall
+	uint8_t  ucPeak[SPECTRUM_BANDS + 1];
+	uint8_t  ucHold[SPECTRUM_BANDS + 1];      // Blocks left until ucPeak falls
+	uint32_t ulBlocks;
+} SpectrumTypeDef;
+
+
+// =============== Spectrum functions declaration ======================
+
+void     spectrum_init           (SpectrumTypeDef *);
+void     spectrum_process        (SpectrumTypeDef *, const uint16_t *);
+void     spectrum_bar            (SpectrumTypeDef *, rgb_color *, const LedTypeDef *, uint8_t, uint8_t);
+void     spectrum_vu             (SpectrumTypeDef *, rgb_color *, const LedTypeDef *);
+void     spectrum_render         (SpectrumTypeDef *, rgb_color *, const LedTypeDef *, uint8_t, SpectrumMode);
+uint16_t spectrum_log2           (uint32_t);
+
+
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef _LED_TEXT_H_
+#define _LED_TEXT_H_
+
+#include "main.h"
+#include "led_conf.h"
+#include "led_matrix.h"
+
+
+// ============= Font ===============
+//  5 x 7 glyphs for ASCII 0x20..0x7E, one byte per column, bit 0 = top row.
+//  Other characters are drawn as '?'.
+
+#define TEXT_GLYPH_W        5
+#define TEXT_GLYPH_H        7
+#define TEXT_SPACING        1                 // Blank columns after every glyph
+#define TEXT_FIRST          0x20
+#define TEXT_LAST           0x7E
+
+#define TEXT_MAX            64                // Longest message
+#define TEXT_STEP_MS        60                // Scroll period used by main.c
+
+
+// =============== Text functions declaration ======================
+
+void     text_init             (MatrixTypeDef *, uint8_t, rgb_color);
+uint8_t  text_set              (const uint8_t *, uint8_t, rgb_color);
+uint8_t  text_active           (void);
+void     text_step             (rgb_color *);
+
+
+
+#endif
@@ -33,6 +33,7 @@ extern "C" {
 #include "led_conf.h"
 #include "otimers.h"
 #include "led_move.h"
+#include "key.h"
 /* USER CODE END Includes */
 
 /* Exported types ------------------------------------------------------------*/
@@ -8,6 +8,8 @@
 
 
 
+#define MAX_TIMERS        	5
+
 // ============= Timer Name ===============
 //#define TIMER_SER			0
 
@@ -36,9 +38,15 @@ typedef enum
 
 // =============== Timers functions declaration ======================
 
+void update_timer_block       (timers *, uint8_t);
+void load_timer_block         (timers *, uint8_t, uint32_t);
+char check_timer_block        (timers *, uint8_t);
+uint32_t read_timer_block     (timers *, uint8_t);
+
 void update_timers            (void);
 void load_timer               (uint8_t, uint32_t);
 char check_timer              (uint8_t);
+uint32_t read_timer           (uint8_t);
 void start_timer              (uint8_t);
 void stop_timer               (uint8_t);
 void reset_timer              (uint8_t);
@@ -0,0 +1,82 @@
+#ifndef _STREAM_H_
+#define _STREAM_H_
+
+#include "main.h"
+#include "WS2812_SPI.h"
+
+
+// ============= Packet layout ===============
+//  SYNC0 SYNC1 TYPE LEN_L LEN_H PAYLOAD[LEN] CRC32[4]
+//  CRC32 is the standard (zlib) CRC-32 of TYPE..PAYLOAD, sent little endian.
+//  Frame and delta payloads start with the 16 bit number of the image they
+//  make, a delta also names the image it patches and is rejected on any other.
+
+#define STREAM_SYNC0        0xA5
+#define STREAM_SYNC1        0x5A
+
+#define STREAM_HDR_LEN      3                 // TYPE + LEN_L + LEN_H
+#define STREAM_CRC_LEN      4
+#define STREAM_SEQ_LEN      2                 // Image number ahead of frame and delta payloads
+#define STREAM_DELTA_HDR    (2 * STREAM_SEQ_LEN)
+#define STREAM_SEQ_NONE     0x10000UL         // Buffer image number before any frame, matches no BASE
+
+// ============= Packet type ===============
+#define STREAM_TYPE_FRAME   0x01              // Payload = SEQ_L SEQ_H + N x {R, G, B}, N <= STREAM_MAX_LED
+#define STREAM_TYPE_DELTA   0x02              // Payload = SEQ_L SEQ_H BASE_L BASE_H + led_delta.h ops applied to image BASE
+#define STREAM_TYPE_CONFIG  0x03              // Payload = KEY VALUE[1..CFG_VALUE_MAX], see cfg.h
+#define STREAM_TYPE_TEXT    0x04              // Payload = R G B TEXT[0..TEXT_MAX], empty text ends the ticker
+#define STREAM_TYPE_SYNC    0x05              // Payload = master network time, see sync.h
+
+#define STREAM_MAX_LED      NUM_LED
+#define STREAM_DELTA_MAX    256               // Largest delta payload, header included
+#define STREAM_TIMEOUT_MS   500               // Back to local animation after this long without frames
+
+// ============= Receive ring ===============
+//  Packets are parsed in the USART1 / DMA interrupt at each half, full or IDLE
+//  event, so the main loop never drains the ring. Once an event fires, its
+//  half must be parsed before the DMA has filled the other half. Until then
+//  the interrupt may wait on PRIMASK sections, a flash halfword program
+//  (~50 us) and its own parse (frame CRC, delta copy and decode, ulDecodeMax).
+//  Page erases are not in the budget: they wait for a quiet link (cfg_poll).
+#define STREAM_BAUD         1000000           // USART1, MX_USART1_UART_Init()
+#define STREAM_BYTE_US      (10 * 1000000 / STREAM_BAUD)
+#define STREAM_STALL_US     2000              // Longest wait of the RX event
+#define STREAM_RX_SIZE      512               // DMA ring, 2.56 ms per half at 1 Mbaud
+#define STREAM_RX_MS        ((STREAM_RX_SIZE * STREAM_BYTE_US + 999) / 1000)    // Whole ring, 6 ms
+
+#if STREAM_RX_SIZE / 2 * STREAM_BYTE_US < STREAM_STALL_US
+#error "STREAM_RX_SIZE: half the ring does not cover STREAM_STALL_US at STREAM_BAUD"
+#endif
+
+
+typedef struct
+{
+	uint32_t ulFrames;                        // Packets received with a good CRC
+	uint32_t ulCrcErr;                        // Packets rejected by CRC
+	uint32_t ulDropped;                       // Good frames or patched copies overwritten before they were shown
+	uint32_t ulSyncErr;                       // Bytes discarded while hunting for a header
+	uint32_t ulRxBytes;                       // All bytes received, framing included
+
+	uint32_t ulDeltaFrames;                   // Delta packets applied
+	uint32_t ulDeltaErr;                      // Delta packets rejected, base not the newest image or bad ops: send a full frame
+	uint32_t ulDeltaBytes;                    // Wire bytes of all delta packets
+	uint16_t wDeltaLast;                      // Wire bytes of the last delta packet
+	uint32_t ulDecodeLast;                    // Core clocks spent copying and decoding the last delta packet
+	uint32_t ulDecodeMax;                     // Worst case of ulDecodeLast
+} StreamStatDef;
+
+
+// =============== Stream functions declaration ======================
+
+void        stream_init             (void);
+void        stream_rx_event         (uint16_t);
+uint8_t     stream_active           (void);
+uint32_t    stream_quiet            (void);
+uint8_t     stream_swap             (void);
+rgb_color * stream_front            (uint16_t *);
+
+extern StreamStatDef sStreamStat;
+
+
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef _STREAM_PARSE_H_
+#define _STREAM_PARSE_H_
+
+#include "main.h"
+#include "stream.h"
+#include "led_delta.h"
+
+
+// ============= Packet parser ===============
+//  Everything one packet stream needs lives in a StreamTypeDef, so the same
+//  code serves the USART1 ring of the firmware (stream.c) and any number of
+//  virtual controllers on the host (Sim/Src/fleet_main.c).
+//
+//  Frames land in a double buffer and are taken with stream_parse_swap().
+//  Delta packets patch the newest image: the back buffer if it still waits to
+//  be shown, otherwise a copy of the front one made in the back buffer, so the
+//  render loop only ever reads a buffer the interrupt is done with. A delta
+//  whose BASE is not the number of that image, because its frame or an earlier
+//  delta failed the CRC, is counted in ulDeltaErr and dropped. Packet
+//  types the parser does not render are handed to pOther after the CRC check.
+
+typedef enum
+{
+	ST_SYNC0,
+	ST_SYNC1,
+	ST_HEADER,
+	ST_PAYLOAD,
+	ST_CRC
+} StreamState;
+
+typedef void (*StreamOtherFunc)(uint8_t, const uint8_t *, uint16_t);
+
+typedef struct
+{
+	rgb_color          rFrame[2][STREAM_MAX_LED];  // Double buffered frames
+	uint16_t           wFrameNum[2];               // Pixels held by each buffer
+	uint32_t           ulSeq[2];                   // Image number of each buffer, STREAM_SEQ_NONE before a frame
+	volatile uint8_t   ucFront;                    // Buffer owned by the render loop
+	volatile uint8_t   ucReady;                    // Back buffer holds a complete frame or patched copy
+	volatile uint32_t  ulLastFrame;                // Time of the last good frame
+	uint8_t            ucDelta[STREAM_DELTA_MAX];  // Delta / config / text payload, used once the CRC passes
+
+	StreamState        sState;
+	uint8_t            ucHdr[STREAM_HDR_LEN];
+	uint8_t            ucCrc[STREAM_CRC_LEN];
+	uint8_t            ucSeq[STREAM_SEQ_LEN];      // Image number of a frame, ahead of its pixels
+	uint8_t            ucPre;                      // Payload bytes that go to ucSeq
+	uint16_t           wLen;                       // Payload length of current packet
+	uint16_t           wIdx;                       // Bytes received in current state
+	uint8_t           *pPayload;                   // Where the payload after ucPre bytes is written
+
+	DeltaTypeDef       dDelta;
+	CRC_HandleTypeDef *pCrc;                       // CRC unit set up for the zlib CRC-32 (MX_CRC_Init)
+	StreamStatDef     *pStat;
+	StreamOtherFunc    fOther;                     // Config / text / sync packets, may be NULL
+} StreamTypeDef;
+
+
+// =============== Stream parser functions declaration ======================
+
+void        stream_parse_init       (StreamTypeDef *, uint16_t, CRC_HandleTypeDef *, StreamStatDef *, StreamOtherFunc);
+void        stream_parse            (StreamTypeDef *, const uint8_t *, uint16_t, uint32_t);
+uint8_t     stream_parse_active     (StreamTypeDef *, uint32_t);
+uint8_t     stream_parse_swap       (StreamTypeDef *);
+rgb_color * stream_parse_front      (StreamTypeDef *, uint16_t *);
+
+
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef _SYNC_H_
+#define _SYNC_H_
+
+#include "main.h"
+#include "sync_clock.h"
+
+
+// ============= Time sync over USART1 ===============
+//  The master's TX feeds the RX of every follower. Every SYNC_PERIOD_MS the
+//  master sends its network time as a STREAM_TYPE_SYNC packet, queued only
+//  while the telemetry DMA is idle so the stamp is taken right before the
+//  first byte leaves. Telemetry written after it waits for an idle gap
+//  (tlog_raw), so the follower's IDLE event comes right after the packet and
+//  SYNC_LATENCY_US holds. Followers add the wire time and steer their SysTick
+//  (sync_clock.h). Animations that reload their timers with sync_until()
+//  step on the same network ms on every board.
+//
+//  Payload: MS[4] US[2], little endian, US = 0..999 into that ms.
+
+#define SYNC_PAYLOAD_LEN    6
+#define SYNC_WIRE_BYTES     (2 + 3 + SYNC_PAYLOAD_LEN + 4)          // SYNC0 SYNC1 HDR PAYLOAD CRC
+
+// 10 bits per byte at 1 Mbaud, one idle frame before the IDLE event, then
+// the DMA / parser path up to sync_rx()
+#define SYNC_LATENCY_US     (SYNC_WIRE_BYTES * 10 + 10 + 20)
+
+
+// =============== Sync functions declaration ======================
+
+void      sync_init              (void);
+void      sync_tick              (void);
+uint32_t  sync_now               (void);
+uint32_t  sync_until             (uint32_t);
+void      sync_rx                (const uint8_t *);
+void      sync_poll              (void);
+void      sync_set_master        (uint8_t);
+uint8_t   sync_stepped           (void);
+uint8_t   sync_shared            (void);
+
+extern SyncClockDef sSync;
+
+
+
+#endif
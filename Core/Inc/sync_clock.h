@@ -0,0 +1,73 @@
+#ifndef _SYNC_CLOCK_H_
+#define _SYNC_CLOCK_H_
+
+#include "main.h"
+
+
+// ============= Disciplined network clock ===============
+//  Counts network time in 1 ms ticks. A follower steers the length of each
+//  tick (SysTick LOAD) from the offsets it sees against the master:
+//
+//    first sample, or offset > SYNC_STEP_US   jump the ms count
+//    otherwise                                PI loop on the tick length
+//
+//  The P part takes SYNC_GAIN_P / 256 of the offset out over the next
+//  SYNC_PERIOD_MS ticks, the I part learns the rate error of the local HSI.
+//  Trims are Q8 core clocks per tick and dithered, so one step is 1/256 clock
+//  (0.1 ppm at 40 MHz).
+//
+//  No hardware access: sync.c feeds it on the board, Sim/Src/sync_main.c runs
+//  the same code against simulated clocks and a simulated bus.
+
+#define SYNC_PERIOD_MS      250               // Master timestamp period
+#define SYNC_STEP_US        20000             // Larger offsets are stepped
+#define SYNC_LOCK_US        250               // Locked after SYNC_LOCK_COUNT offsets inside
+#define SYNC_LOCK_COUNT     4
+#define SYNC_OUTLIER_US     1000              // Locked: one larger offset is ignored, two drop the lock
+#define SYNC_HOLD_MS        3000              // Free running (holdover) after this long without samples
+#define SYNC_TRIM_PCT       2                 // Rate trim range, HSI is +-1 %
+
+#define SYNC_GAIN_P         128               // Q8, share of the offset removed per period
+#define SYNC_GAIN_I         32                // Q8, share of the offset taken into the rate
+
+typedef enum
+{
+	SYNC_FREE,                                // No master, the rate trim is held
+	SYNC_ACQUIRE,
+	SYNC_LOCKED
+} SyncState;
+
+typedef struct
+{
+	volatile uint32_t ulMs;                   // Network time
+	uint32_t  ulClkMs;                        // Nominal core clocks per tick
+	uint32_t  ulCurLen;                       // Core clocks of the running tick
+	uint32_t  ulNextLen;                      // Core clocks of the tick after it
+	int32_t   lFreq;                          // Q8 clocks per tick, rate (I part)
+	int32_t   lPhase;                         // Q8 clocks per tick, offset (P part)
+	uint16_t  wPhaseLeft;                     // Ticks lPhase still applies
+	uint8_t   ucAcc;                          // Trim fraction not applied yet
+	uint32_t  ulIdleMs;                       // Ticks since the previous sample
+	SyncState sState;
+	uint8_t   ucGood;                         // Offsets in a row inside SYNC_LOCK_US
+	uint8_t   ucOutlier;                      // Outliers in a row while locked
+	uint8_t   ucStepped;                      // ulMs jumped, see sync_clock_stepped()
+
+	uint32_t  ulSamples;
+	uint32_t  ulSteps;
+	uint32_t  ulOutliers;
+	int32_t   lOffset;                        // Last offset, us, + = master ahead
+} SyncClockDef;
+
+
+// =============== Sync clock functions declaration ======================
+
+void      sync_clock_init        (SyncClockDef *, uint32_t);
+uint32_t  sync_clock_tick        (SyncClockDef *);
+void      sync_clock_sample      (SyncClockDef *, uint32_t, int32_t, uint32_t, int32_t);
+uint8_t   sync_clock_stepped     (SyncClockDef *);
+int32_t   sync_clock_ppm         (SyncClockDef *);
+
+
+
+#endif
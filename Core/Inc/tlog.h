@@ -0,0 +1,61 @@
+#ifndef _TLOG_H_
+#define _TLOG_H_
+
+#include "main.h"
+
+
+// ============= Record layout ===============
+//  SYNC ID LEN TS_L TS_H DATA[LEN] SUM
+//  TS   = HAL_GetTick() & 0xFFFF (ms)
+//  SUM  = 8 bit sum of ID..DATA
+//  Decoded on the host by Tools/tlog_decode.py
+
+#define TLOG_SYNC           0xC3
+#define TLOG_REC_OVERHEAD   6
+#define TLOG_MAX_DATA       16
+
+#define TLOG_BUF_SIZE       256               // Must be power of two
+
+// ============= Raw packets ===============
+//  Other packets on the TX line (sync.c) go out through tlog_raw() with the
+//  stream framing: STREAM_SYNC0 STREAM_SYNC1 TYPE LEN_L LEN_H PAYLOAD CRC[4].
+//  They are only queued into an empty ring, so they sit between whole
+//  records, and no record starts with STREAM_SYNC0. The host decoder steps
+//  over them by their length. The line is then kept idle for TLOG_GAP_MS so
+//  receivers see the IDLE event right after the packet, not after the
+//  records queued behind it.
+
+#define TLOG_GAP_MS         2                 // 1..2 ms of idle line, the tick decides
+
+// ============= Record ID ===============
+#define TLOG_ID_DROP        0x00              // DATA = u32 records lost since the last DROP record
+#define TLOG_ID_BOOT        0x01              // DATA = u32 SystemCoreClock
+#define TLOG_ID_KEY         0x02              // DATA = u8 key, u8 KeyEventType, u8 gucKeyMode
+#define TLOG_ID_STREAM      0x03              // DATA = u32 packets, u32 CRC errors, u32 dropped frames
+#define TLOG_ID_CFG         0x04              // DATA = u16 page SEQ, u16 bytes used, sent after a compaction
+#define TLOG_ID_SYNC        0x05              // DATA = u8 SyncState, i32 last offset us, i32 rate trim ppm
+#define TLOG_ID_AUDIO       0x06              // DATA = u32 blocks, u32 overruns, u32 worst core clocks per block
+#define TLOG_ID_SPARK       0x07              // DATA = u32 frames, u32 last and u32 worst core clocks per frame
+
+
+typedef struct
+{
+	uint32_t ulRecords;                       // Records queued
+	uint32_t ulDropped;                       // Records lost to a full buffer
+	uint32_t ulBytes;                         // Bytes handed to the DMA
+} TlogStatDef;
+
+
+// =============== Telemetry functions declaration ======================
+
+void    tlog_init               (void);
+uint8_t tlog_write              (uint8_t, const void *, uint8_t);
+uint8_t tlog_raw                (const void *, uint8_t);
+uint8_t tlog_idle               (void);
+void    tlog_poll               (void);
+
+extern TlogStatDef sTlogStat;
+
+
+
+#endif
@@ -51,12 +51,17 @@ void ws2812_spi (int GREEN, int RED, int BLUE)
 
 
 
-void WS2812_Send  (void)
+void WS2812_Send_Data (rgb_color *rLed, uint16_t wNum)
 {
-	for (int i=0; i<MAX_NUMB; i++)
+	for (int i=0; i<wNum; i++)
 	{
-		ws2812_spi(rLed_Data[i].green, rLed_Data[i].red, rLed_Data[i].blue);
+		ws2812_spi(rLed[i].green, rLed[i].red, rLed[i].blue);
 	}
 	HAL_Delay (1);
 }
 
+void WS2812_Send  (void)
+{
+	WS2812_Send_Data(rLed_Data, MAX_NUMB);
+}
+
@@ -0,0 +1,112 @@
+#include "main.h"
+#include "audio.h"
+#include "adc.h"
+#include "tim.h"
+
+
+static uint16_t        wAdcBuf[SPECTRUM_LEN * 2];     // Circular DMA target, two blocks
+static volatile uint8_t ucReady;                      // Half ready for audio_poll(), 1 = first, 2 = second
+static SpectrumTypeDef sSpec;
+static SpectrumMode    sMode = SPECTRUM_OFF;
+
+AudioStatDef sAudioStat;
+
+
+// ==================================================================================
+void audio_init(void)
+{
+	spectrum_init(&sSpec);
+	ucReady = 0;
+	sMode   = SPECTRUM_OFF;
+}
+
+// ==================================================================================
+/**
+ * @brief  Starts or stops sampling
+ * @details Sampling only runs while a mode is set, the ADC and TIM3 stay
+ *          off otherwise. Unknown modes count as SPECTRUM_OFF.
+ */
+void audio_set_mode(uint8_t ucMode)
+{
+	SpectrumMode sNew = SPECTRUM_OFF;
+
+	if (ucMode == SPECTRUM_BARS || ucMode == SPECTRUM_VU)
+		sNew = (SpectrumMode)ucMode;
+
+	if (sNew != SPECTRUM_OFF && sMode == SPECTRUM_OFF)
+	{
+		spectrum_init(&sSpec);
+		ucReady = 0;
+		HAL_ADCEx_Calibration_Start(&hadc);
+		HAL_ADC_Start_DMA(&hadc, (uint32_t *)wAdcBuf, SPECTRUM_LEN * 2);
+		HAL_TIM_Base_Start(&htim3);
+	}
+	else if (sNew == SPECTRUM_OFF && sMode != SPECTRUM_OFF)
+	{
+		HAL_TIM_Base_Stop(&htim3);
+		HAL_ADC_Stop_DMA(&hadc);
+	}
+	sMode = sNew;
+}
+
+// ==================================================================================
+SpectrumMode audio_mode(void)
+{
+	return sMode;
+}
+
+// ==================================================================================
+/**
+ * @brief  Processes the next ready block and draws it into rLed
+ * @note   The time is taken with SysTick VAL and the ms count, a block
+ *         takes longer than one tick.
+ *
+ * @return 1 if rLed changed
+ */
+uint8_t audio_poll(rgb_color *rLed, const LedTypeDef *lSeg, uint8_t ucSegNum)
+{
+	uint32_t ulStart, ulEnd, ulTick, ulClk;
+	uint8_t  ucHalf;
+
+	if (sMode == SPECTRUM_OFF || !ucReady)
+		return 0;
+
+	__disable_irq();
+	ucHalf  = ucReady;
+	ucReady = 0;
+	__enable_irq();
+
+	ulTick  = HAL_GetTick();
+	ulStart = SysTick->VAL;
+	spectrum_process(&sSpec, &wAdcBuf[(ucHalf - 1) * SPECTRUM_LEN]);
+	spectrum_render(&sSpec, rLed, lSeg, ucSegNum, sMode);
+	ulEnd   = SysTick->VAL;
+	ulTick  = HAL_GetTick() - ulTick;
+
+	ulClk = ulTick * (SysTick->LOAD + 1) + ulStart - ulEnd;
+	sAudioStat.ulBlocks++;
+	sAudioStat.ulClkLast = ulClk;
+	if (ulClk > sAudioStat.ulClkMax)
+		sAudioStat.ulClkMax = ulClk;
+	return 1;
+}
+
+// ==================================================================================
+static void audio_half(uint8_t ucHalf)
+{
+	if (ucReady)
+		sAudioStat.ulOverrun++;
+	ucReady = ucHalf;
+}
+
+// ==================================================================================
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *adcHandle)
+{
+	audio_half(1);
+}
+
+// ==================================================================================
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *adcHandle)
+{
+	audio_half(2);
+}
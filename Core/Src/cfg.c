@@ -0,0 +1,396 @@
+#include <string.h>
+#include "main.h"
+#include "cfg.h"
+#include "tlog.h"
+
+#define CFG_ERASED          0xFFFF
+#define CFG_REC_SIZE(len)   (CFG_REC_HDR + (((len) + 1) & ~1))
+
+static const uint32_t ulPageAddr[2] = { CFG_PAGE0_ADDR, CFG_PAGE1_ADDR };
+
+static uint8_t           ucValue[CFG_KEY_MAX][CFG_VALUE_MAX];  // RAM copy of the newest value of each key
+static uint8_t           ucLen[CFG_KEY_MAX];                   // Value length, 0 = never set
+static volatile uint16_t wDirty;                               // Keys not yet written to flash
+static volatile uint16_t wChanged;                             // Keys changed since cfg_changes()
+
+static uint8_t  ucActive;                             // Page holding the log
+static uint16_t wEnd;                                 // Next free byte in the active page
+static uint8_t  ucSpareDirty;                         // Other page must be erased before use
+
+CfgStatDef sCfgStat;
+
+
+// ==================================================================================
+static uint16_t cfg_read16(uint32_t ulAddr)
+{
+	return *(__IO uint16_t *)ulAddr;
+}
+
+// ==================================================================================
+/**
+ * @brief  Sums the KEY|LEN halfword and the data as flash stores it
+ */
+static uint16_t cfg_check(uint16_t wKeyLen, const uint8_t *pData, uint8_t ucNum)
+{
+	uint16_t wSum = wKeyLen;
+	uint8_t  i;
+
+	for (i = 0; i < ucNum; i += 2)
+		wSum += pData[i] | ((i + 1 < ucNum ? pData[i + 1] : 0xFF) << 8);
+	return ~wSum;
+}
+
+// ==================================================================================
+static uint8_t cfg_erased(uint8_t ucPage)
+{
+	uint32_t ulAddr;
+
+	for (ulAddr = ulPageAddr[ucPage]; ulAddr < ulPageAddr[ucPage] + CFG_PAGE_SIZE; ulAddr += 4)
+	{
+		if (*(__IO uint32_t *)ulAddr != 0xFFFFFFFF)
+			return 0;
+	}
+	return 1;
+}
+
+// ==================================================================================
+static uint8_t cfg_erase(uint8_t ucPage)
+{
+	FLASH_EraseInitTypeDef fErase;
+	uint32_t ulError;
+	HAL_StatusTypeDef hOut;
+
+	fErase.TypeErase   = FLASH_TYPEERASE_PAGES;
+	fErase.PageAddress = ulPageAddr[ucPage];
+	fErase.NbPages     = 1;
+
+	HAL_FLASH_Unlock();
+	hOut = HAL_FLASHEx_Erase(&fErase, &ulError);
+	HAL_FLASH_Lock();
+
+	sCfgStat.ulErase++;
+	if (hOut != HAL_OK)
+	{
+		sCfgStat.ulFail++;
+		return 0;
+	}
+	return 1;
+}
+
+// ==================================================================================
+/**
+ * @brief  Programs one record at ulAddr, flash must be unlocked
+ * @return 1 if written, 0 on a program error
+ */
+static uint8_t cfg_program(uint32_t ulAddr, uint8_t ucKey, const uint8_t *pData, uint8_t ucNum)
+{
+	uint16_t wKeyLen = ucKey | (ucNum << 8);
+	uint16_t wData;
+	uint8_t  i;
+
+	if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, ulAddr, wKeyLen) != HAL_OK)
+		return 0;
+
+	for (i = 0; i < ucNum; i += 2)
+	{
+		wData = pData[i] | ((i + 1 < ucNum ? pData[i + 1] : 0xFF) << 8);
+		if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, ulAddr + CFG_REC_HDR + i, wData) != HAL_OK)
+			return 0;
+	}
+
+	if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, ulAddr + 2, cfg_check(wKeyLen, pData, ucNum)) != HAL_OK)
+		return 0;
+
+	sCfgStat.ulWrites++;
+	return 1;
+}
+
+// ==================================================================================
+/**
+ * @brief  Copies the value of ucKey out of the RAM table and clears its dirty bit
+ * @note   cfg_set() may run from the stream interrupt, so this is done with IRQs off.
+ */
+static uint8_t cfg_take(uint8_t ucKey, uint8_t *pData)
+{
+	uint32_t ulPrimask;
+	uint8_t  ucNum;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();
+	ucNum = ucLen[ucKey];
+	memcpy(pData, ucValue[ucKey], ucNum);
+	wDirty &= ~(1 << ucKey);
+	__set_PRIMASK(ulPrimask);
+
+	return ucNum;
+}
+
+// ==================================================================================
+static void cfg_mark_dirty(uint16_t wKeys)
+{
+	uint32_t ulPrimask;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();
+	wDirty |= wKeys;
+	__set_PRIMASK(ulPrimask);
+}
+
+// ==================================================================================
+/**
+ * @brief  Reads the active page once, newest record of each key wins
+ * @details Stops at the first erased KEY|LEN halfword. A record that cannot be
+ *          walked over (bad key or length) ends the scan and marks the page
+ *          full, so the next write compacts into the spare page.
+ */
+static void cfg_scan(void)
+{
+	uint32_t ulBase = ulPageAddr[ucActive];
+	uint16_t wOff   = CFG_PAGE_HDR;
+	uint16_t wKeyLen;
+	uint8_t  ucKey, ucNum;
+
+	while (wOff + CFG_REC_HDR <= CFG_PAGE_SIZE)
+	{
+		wKeyLen = cfg_read16(ulBase + wOff);
+		if (wKeyLen == CFG_ERASED)
+			break;
+
+		ucKey = wKeyLen & 0xFF;
+		ucNum = wKeyLen >> 8;
+		if (ucKey >= CFG_KEY_MAX || !ucNum || ucNum > CFG_VALUE_MAX || wOff + CFG_REC_SIZE(ucNum) > CFG_PAGE_SIZE)
+		{
+			wOff = CFG_PAGE_SIZE;
+			break;
+		}
+
+		if (cfg_read16(ulBase + wOff + 2) == cfg_check(wKeyLen, (const uint8_t *)(ulBase + wOff + CFG_REC_HDR), ucNum))
+		{
+			memcpy(ucValue[ucKey], (const uint8_t *)(ulBase + wOff + CFG_REC_HDR), ucNum);
+			ucLen[ucKey] = ucNum;
+		}
+		wOff += CFG_REC_SIZE(ucNum);
+	}
+	wEnd = wOff;
+}
+
+// ==================================================================================
+/**
+ * @brief  Rewrites every key into the (erased) spare page and makes it active
+ * @details The page header is programmed last, so a reset during compaction
+ *          leaves the old page in charge. The old page is erased later by
+ *          cfg_poll() once an erase is allowed, or by cfg_init() at boot.
+ */
+static void cfg_compact(void)
+{
+	uint8_t  ucNew = ucActive ^ 1;
+	uint32_t ulBase = ulPageAddr[ucNew];
+	uint16_t wOff = CFG_PAGE_HDR;
+	uint16_t wTaken = 0;
+	uint16_t wSeq, wRec[2];
+	uint8_t  ucData[CFG_VALUE_MAX];
+	uint8_t  ucKey, ucNum, uOk = 1;
+
+	HAL_FLASH_Unlock();
+	for (ucKey = 0; ucKey < CFG_KEY_MAX && uOk; ucKey++)
+	{
+		if (!ucLen[ucKey])
+			continue;
+		ucNum = cfg_take(ucKey, ucData);
+		wTaken |= 1 << ucKey;
+		uOk = cfg_program(ulBase + wOff, ucKey, ucData, ucNum);
+		wOff += CFG_REC_SIZE(ucNum);
+	}
+
+	wSeq = sCfgStat.wSeq + 1;
+	if (uOk)
+		uOk = HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, ulBase + 2, wSeq) == HAL_OK &&
+		      HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, ulBase, CFG_MAGIC) == HAL_OK;
+	HAL_FLASH_Lock();
+
+	ucSpareDirty = 1;                                 // Either the failed new page or the old one
+	if (!uOk)
+	{
+		sCfgStat.ulFail++;
+		cfg_mark_dirty(wTaken);
+		return;
+	}
+
+	ucActive = ucNew;
+	wEnd     = wOff;
+	sCfgStat.wSeq  = wSeq;
+	sCfgStat.wUsed = wEnd;
+	sCfgStat.ulCompact++;
+	wRec[0] = wSeq;
+	wRec[1] = wEnd;
+	tlog_write(TLOG_ID_CFG, wRec, sizeof(wRec));
+}
+
+// ==================================================================================
+/**
+ * @brief  Restores all settings from flash
+ * @details Picks the page with a valid header and the newer sequence number,
+ *          then rebuilds the RAM table with one pass over its records. Only a
+ *          blank or damaged store is erased here, before rendering starts.
+ */
+void cfg_init(void)
+{
+	uint16_t wMagic[2], wSeq[2];
+	uint8_t  loop;
+
+	memset(ucLen, 0, sizeof(ucLen));
+	wDirty = wChanged = 0;
+	memset(&sCfgStat, 0, sizeof(sCfgStat));
+
+	for (loop = 0; loop < 2; loop++)
+	{
+		wMagic[loop] = cfg_read16(ulPageAddr[loop]);
+		wSeq[loop]   = cfg_read16(ulPageAddr[loop] + 2);
+	}
+
+	if (wMagic[0] == CFG_MAGIC && wMagic[1] == CFG_MAGIC)
+		ucActive = (int16_t)(wSeq[1] - wSeq[0]) > 0;
+	else if (wMagic[0] == CFG_MAGIC || wMagic[1] == CFG_MAGIC)
+		ucActive = wMagic[1] == CFG_MAGIC;
+	else
+	{
+		ucActive = 0;                                 // Blank store, start at page 0 with SEQ 0
+		if (!cfg_erased(0))
+			cfg_erase(0);
+		HAL_FLASH_Unlock();
+		HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, ulPageAddr[0] + 2, 0);
+		HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, ulPageAddr[0], CFG_MAGIC);
+		HAL_FLASH_Lock();
+		wSeq[0] = 0;
+	}
+
+	sCfgStat.wSeq = wSeq[ucActive];
+	cfg_scan();
+	sCfgStat.wUsed = wEnd;
+
+	if (!cfg_erased(ucActive ^ 1))
+		cfg_erase(ucActive ^ 1);
+	ucSpareDirty = 0;
+}
+
+// ==================================================================================
+/**
+ * @brief  Copies a setting out of the RAM table
+ * @return Bytes copied, 0 if the key was never set or does not fit ucMax
+ */
+uint8_t cfg_get(uint8_t ucKey, void *pData, uint8_t ucMax)
+{
+	uint8_t ucNum;
+
+	if (ucKey >= CFG_KEY_MAX)
+		return 0;
+
+	ucNum = ucLen[ucKey];
+	if (!ucNum || ucNum > ucMax)
+		return 0;
+
+	memcpy(pData, ucValue[ucKey], ucNum);
+	return ucNum;
+}
+
+// ==================================================================================
+/**
+ * @brief  Changes a setting in RAM and queues it for flash
+ * @details Never touches flash, so it is safe from interrupts and during
+ *          rendering. Writing the value already stored is a no-op.
+ *
+ * @return 1 if accepted, 0 for a bad key or length
+ */
+uint8_t cfg_set(uint8_t ucKey, const void *pData, uint8_t ucNum)
+{
+	uint32_t ulPrimask;
+
+	if (ucKey >= CFG_KEY_MAX || !ucNum || ucNum > CFG_VALUE_MAX)
+		return 0;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();
+	if (ucLen[ucKey] != ucNum || memcmp(ucValue[ucKey], pData, ucNum))
+	{
+		memcpy(ucValue[ucKey], pData, ucNum);
+		ucLen[ucKey] = ucNum;
+		wDirty   |= 1 << ucKey;
+		wChanged |= 1 << ucKey;
+	}
+	__set_PRIMASK(ulPrimask);
+	return 1;
+}
+
+// ==================================================================================
+/**
+ * @brief  Returns (and clears) the keys changed by cfg_set() since the last call
+ * @return Bit n set = key n changed
+ */
+uint16_t cfg_changes(void)
+{
+	uint32_t ulPrimask;
+	uint16_t wOut;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();
+	wOut = wChanged;
+	wChanged = 0;
+	__set_PRIMASK(ulPrimask);
+	return wOut;
+}
+
+// ==================================================================================
+/**
+ * @brief  Background flash work, call from the main loop
+ * @details Does at most one job per call and only if it fits in ulIdle:
+ *          erase the spare page (CFG_ERASE_MS, only with ucErase), compact a
+ *          full page into the erased spare one (CFG_COMPACT_MS) or append one
+ *          dirty key (CFG_WRITE_MS). Pending values stay in RAM and take
+ *          effect at once either way.
+ *
+ * @param  ulIdle   ms until the caller next has to render
+ * @param  ucErase  1 if flash fetches may stop for CFG_ERASE_MS, see cfg.h
+ */
+void cfg_poll(uint32_t ulIdle, uint8_t ucErase)
+{
+	uint8_t ucData[CFG_VALUE_MAX];
+	uint8_t ucKey, ucNum, uOk;
+
+	if (ucSpareDirty && ucErase && ulIdle >= CFG_ERASE_MS)
+	{
+		if (cfg_erase(ucActive ^ 1))
+			ucSpareDirty = 0;
+		return;
+	}
+
+	if (!wDirty || ulIdle < CFG_WRITE_MS)
+		return;
+
+	for (ucKey = 0; !(wDirty & (1 << ucKey)); ucKey++)
+		;
+
+	ucNum = cfg_take(ucKey, ucData);
+	if (wEnd + CFG_REC_SIZE(ucNum) > CFG_PAGE_SIZE)
+	{
+		cfg_mark_dirty(1 << ucKey);
+		if (!ucSpareDirty && ulIdle >= CFG_COMPACT_MS)
+			cfg_compact();
+		return;
+	}
+
+	HAL_FLASH_Unlock();
+	uOk = cfg_program(ulPageAddr[ucActive] + wEnd, ucKey, ucData, ucNum);
+	HAL_FLASH_Lock();
+
+	if (uOk)
+	{
+		wEnd += CFG_REC_SIZE(ucNum);
+	}
+	else
+	{
+		sCfgStat.ulFail++;
+		wEnd = CFG_PAGE_SIZE;                         // Never program over a failed spot, compact instead
+		cfg_mark_dirty(1 << ucKey);
+	}
+	sCfgStat.wUsed = wEnd;
+}
@@ -0,0 +1,76 @@
+// Generated by Tools/fft_tables.py rfft_q15:128, do not edit
+
+#include "fft_tables.h"
+
+static const q15_t qTwiddle64[96] = {
+	(q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7F62, (q15_t)0x0C8B, (q15_t)0x7D8A, (q15_t)0x18F8, (q15_t)0x7A7D, (q15_t)0x2528,
+	(q15_t)0x7641, (q15_t)0x30FB, (q15_t)0x70E2, (q15_t)0x3C56, (q15_t)0x6A6D, (q15_t)0x471C, (q15_t)0x62F2, (q15_t)0x5133,
+	(q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x5133, (q15_t)0x62F2, (q15_t)0x471C, (q15_t)0x6A6D, (q15_t)0x3C56, (q15_t)0x70E2,
+	(q15_t)0x30FB, (q15_t)0x7641, (q15_t)0x2528, (q15_t)0x7A7D, (q15_t)0x18F8, (q15_t)0x7D8A, (q15_t)0x0C8B, (q15_t)0x7F62,
+	(q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0xF374, (q15_t)0x7F62, (q15_t)0xE707, (q15_t)0x7D8A, (q15_t)0xDAD7, (q15_t)0x7A7D,
+	(q15_t)0xCF04, (q15_t)0x7641, (q15_t)0xC3A9, (q15_t)0x70E2, (q15_t)0xB8E3, (q15_t)0x6A6D, (q15_t)0xAECC, (q15_t)0x62F2,
+	(q15_t)0xA57D, (q15_t)0x5A82, (q15_t)0x9D0D, (q15_t)0x5133, (q15_t)0x9592, (q15_t)0x471C, (q15_t)0x8F1D, (q15_t)0x3C56,
+	(q15_t)0x89BE, (q15_t)0x30FB, (q15_t)0x8582, (q15_t)0x2528, (q15_t)0x8275, (q15_t)0x18F8, (q15_t)0x809D, (q15_t)0x0C8B,
+	(q15_t)0x8000, (q15_t)0x0000, (q15_t)0x809D, (q15_t)0xF374, (q15_t)0x8275, (q15_t)0xE707, (q15_t)0x8582, (q15_t)0xDAD7,
+	(q15_t)0x89BE, (q15_t)0xCF04, (q15_t)0x8F1D, (q15_t)0xC3A9, (q15_t)0x9592, (q15_t)0xB8E3, (q15_t)0x9D0D, (q15_t)0xAECC,
+	(q15_t)0xA57D, (q15_t)0xA57D, (q15_t)0xAECC, (q15_t)0x9D0D, (q15_t)0xB8E3, (q15_t)0x9592, (q15_t)0xC3A9, (q15_t)0x8F1D,
+	(q15_t)0xCF04, (q15_t)0x89BE, (q15_t)0xDAD7, (q15_t)0x8582, (q15_t)0xE707, (q15_t)0x8275, (q15_t)0xF374, (q15_t)0x809D,
+};
+
+static const uint16_t wBitRevFixed64[56] = {
+	8, 256, 16, 128, 24, 384, 32, 64, 40, 320, 48, 192,
+	56, 448, 72, 288, 80, 160, 88, 416, 104, 352, 112, 224,
+	120, 480, 136, 272, 152, 400, 168, 336, 176, 208, 184, 464,
+	200, 304, 216, 432, 232, 368, 248, 496, 280, 392, 296, 328,
+	312, 456, 344, 424, 376, 488, 440, 472,
+};
+
+static const q15_t qRealA128[128] = {
+	(q15_t)0x4000, (q15_t)0xC000, (q15_t)0x3CDC, (q15_t)0xC014, (q15_t)0x39BA, (q15_t)0xC04F, (q15_t)0x369C, (q15_t)0xC0B1,
+	(q15_t)0x3384, (q15_t)0xC13B, (q15_t)0x3073, (q15_t)0xC1EB, (q15_t)0x2D6C, (q15_t)0xC2C1, (q15_t)0x2A70, (q15_t)0xC3BE,
+	(q15_t)0x2782, (q15_t)0xC4DF, (q15_t)0x24A3, (q15_t)0xC625, (q15_t)0x21D5, (q15_t)0xC78F, (q15_t)0x1F19, (q15_t)0xC91B,
+	(q15_t)0x1C72, (q15_t)0xCAC9, (q15_t)0x19E0, (q15_t)0xCC98, (q15_t)0x1766, (q15_t)0xCE87, (q15_t)0x1505, (q15_t)0xD094,
+	(q15_t)0x12BF, (q15_t)0xD2BF, (q15_t)0x1094, (q15_t)0xD505, (q15_t)0x0E87, (q15_t)0xD766, (q15_t)0x0C98, (q15_t)0xD9E0,
+	(q15_t)0x0AC9, (q15_t)0xDC72, (q15_t)0x091B, (q15_t)0xDF19, (q15_t)0x078F, (q15_t)0xE1D5, (q15_t)0x0625, (q15_t)0xE4A3,
+	(q15_t)0x04DF, (q15_t)0xE782, (q15_t)0x03BE, (q15_t)0xEA70, (q15_t)0x02C1, (q15_t)0xED6C, (q15_t)0x01EB, (q15_t)0xF073,
+	(q15_t)0x013B, (q15_t)0xF384, (q15_t)0x00B1, (q15_t)0xF69C, (q15_t)0x004F, (q15_t)0xF9BA, (q15_t)0x0014, (q15_t)0xFCDC,
+	(q15_t)0x0000, (q15_t)0x0000, (q15_t)0x0014, (q15_t)0x0324, (q15_t)0x004F, (q15_t)0x0646, (q15_t)0x00B1, (q15_t)0x0964,
+	(q15_t)0x013B, (q15_t)0x0C7C, (q15_t)0x01EB, (q15_t)0x0F8D, (q15_t)0x02C1, (q15_t)0x1294, (q15_t)0x03BE, (q15_t)0x1590,
+	(q15_t)0x04DF, (q15_t)0x187E, (q15_t)0x0625, (q15_t)0x1B5D, (q15_t)0x078F, (q15_t)0x1E2B, (q15_t)0x091B, (q15_t)0x20E7,
+	(q15_t)0x0AC9, (q15_t)0x238E, (q15_t)0x0C98, (q15_t)0x2620, (q15_t)0x0E87, (q15_t)0x289A, (q15_t)0x1094, (q15_t)0x2AFB,
+	(q15_t)0x12BF, (q15_t)0x2D41, (q15_t)0x1505, (q15_t)0x2F6C, (q15_t)0x1766, (q15_t)0x3179, (q15_t)0x19E0, (q15_t)0x3368,
+	(q15_t)0x1C72, (q15_t)0x3537, (q15_t)0x1F19, (q15_t)0x36E5, (q15_t)0x21D5, (q15_t)0x3871, (q15_t)0x24A3, (q15_t)0x39DB,
+	(q15_t)0x2782, (q15_t)0x3B21, (q15_t)0x2A70, (q15_t)0x3C42, (q15_t)0x2D6C, (q15_t)0x3D3F, (q15_t)0x3073, (q15_t)0x3E15,
+	(q15_t)0x3384, (q15_t)0x3EC5, (q15_t)0x369C, (q15_t)0x3F4F, (q15_t)0x39BA, (q15_t)0x3FB1, (q15_t)0x3CDC, (q15_t)0x3FEC,
+};
+
+static const q15_t qRealB128[128] = {
+	(q15_t)0x4000, (q15_t)0x4000, (q15_t)0x4324, (q15_t)0x3FEC, (q15_t)0x4646, (q15_t)0x3FB1, (q15_t)0x4964, (q15_t)0x3F4F,
+	(q15_t)0x4C7C, (q15_t)0x3EC5, (q15_t)0x4F8D, (q15_t)0x3E15, (q15_t)0x5294, (q15_t)0x3D3F, (q15_t)0x5590, (q15_t)0x3C42,
+	(q15_t)0x587E, (q15_t)0x3B21, (q15_t)0x5B5D, (q15_t)0x39DB, (q15_t)0x5E2B, (q15_t)0x3871, (q15_t)0x60E7, (q15_t)0x36E5,
+	(q15_t)0x638E, (q15_t)0x3537, (q15_t)0x6620, (q15_t)0x3368, (q15_t)0x689A, (q15_t)0x3179, (q15_t)0x6AFB, (q15_t)0x2F6C,
+	(q15_t)0x6D41, (q15_t)0x2D41, (q15_t)0x6F6C, (q15_t)0x2AFB, (q15_t)0x7179, (q15_t)0x289A, (q15_t)0x7368, (q15_t)0x2620,
+	(q15_t)0x7537, (q15_t)0x238E, (q15_t)0x76E5, (q15_t)0x20E7, (q15_t)0x7871, (q15_t)0x1E2B, (q15_t)0x79DB, (q15_t)0x1B5D,
+	(q15_t)0x7B21, (q15_t)0x187E, (q15_t)0x7C42, (q15_t)0x1590, (q15_t)0x7D3F, (q15_t)0x1294, (q15_t)0x7E15, (q15_t)0x0F8D,
+	(q15_t)0x7EC5, (q15_t)0x0C7C, (q15_t)0x7F4F, (q15_t)0x0964, (q15_t)0x7FB1, (q15_t)0x0646, (q15_t)0x7FEC, (q15_t)0x0324,
+	(q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FEC, (q15_t)0xFCDC, (q15_t)0x7FB1, (q15_t)0xF9BA, (q15_t)0x7F4F, (q15_t)0xF69C,
+	(q15_t)0x7EC5, (q15_t)0xF384, (q15_t)0x7E15, (q15_t)0xF073, (q15_t)0x7D3F, (q15_t)0xED6C, (q15_t)0x7C42, (q15_t)0xEA70,
+	(q15_t)0x7B21, (q15_t)0xE782, (q15_t)0x79DB, (q15_t)0xE4A3, (q15_t)0x7871, (q15_t)0xE1D5, (q15_t)0x76E5, (q15_t)0xDF19,
+	(q15_t)0x7537, (q15_t)0xDC72, (q15_t)0x7368, (q15_t)0xD9E0, (q15_t)0x7179, (q15_t)0xD766, (q15_t)0x6F6C, (q15_t)0xD505,
+	(q15_t)0x6D41, (q15_t)0xD2BF, (q15_t)0x6AFB, (q15_t)0xD094, (q15_t)0x689A, (q15_t)0xCE87, (q15_t)0x6620, (q15_t)0xCC98,
+	(q15_t)0x638E, (q15_t)0xCAC9, (q15_t)0x60E7, (q15_t)0xC91B, (q15_t)0x5E2B, (q15_t)0xC78F, (q15_t)0x5B5D, (q15_t)0xC625,
+	(q15_t)0x587E, (q15_t)0xC4DF, (q15_t)0x5590, (q15_t)0xC3BE, (q15_t)0x5294, (q15_t)0xC2C1, (q15_t)0x4F8D, (q15_t)0xC1EB,
+	(q15_t)0x4C7C, (q15_t)0xC13B, (q15_t)0x4964, (q15_t)0xC0B1, (q15_t)0x4646, (q15_t)0xC04F, (q15_t)0x4324, (q15_t)0xC014,
+};
+
+const arm_cfft_instance_q15 fft_cfft_q15_len64 = {
+	64, qTwiddle64, wBitRevFixed64, 56
+};
+
+const arm_rfft_instance_q15 fft_rfft_q15_len128 = {
+	128, 0, 1, 1, (q15_t *)qRealA128, (q15_t *)qRealB128, &fft_cfft_q15_len64
+};
+
+const arm_rfft_instance_q15 fft_rifft_q15_len128 = {
+	128, 1, 1, 1, (q15_t *)qRealA128, (q15_t *)qRealB128, &fft_cfft_q15_len64
+};
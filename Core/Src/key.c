@@ -0,0 +1,215 @@
+#include "main.h"
+#include "key.h"
+#include "tlog.h"
+
+typedef struct
+{
+	GPIO_TypeDef *pPort;
+	uint16_t      wPin;
+} KeyPinDef;
+
+typedef struct
+{
+	volatile uint8_t ucDebounce;    // ms left until the line is sampled, 0 = idle
+	uint8_t          ucState;       // Debounced state, 1 = pressed
+	uint8_t          ucLongSent;    // Long press already reported for this hold
+	uint16_t         wHold;         // ms the key has been held
+} KeyStateDef;
+
+static const KeyPinDef kPin[MAX_KEYS] = {
+	{ GPIOA, GPIO_PIN_1 },          // KEY_MODE
+	{ GPIOA, GPIO_PIN_2 },          // KEY_GASO
+};
+
+static KeyStateDef kState[MAX_KEYS];
+
+static KeyEventDef       kQueue[KEY_QUEUE_SIZE];
+static volatile uint8_t  ucQueueHead;                 // Written by SysTick only
+static volatile uint8_t  ucQueueTail;                 // Written by main loop only
+
+volatile uint8_t gucKeyMode,                          // Switch mode
+                 gucKeyGaso;                          // Push Button TPS
+
+
+static void key_push(uint8_t ucKey, KeyEventType eType)
+{
+	uint8_t ucNext = (ucQueueHead + 1) & (KEY_QUEUE_SIZE - 1);
+
+	if (ucNext == ucQueueTail)                        // Queue full, drop the event
+		return;
+
+	kQueue[ucQueueHead].ucKey = ucKey;
+	kQueue[ucQueueHead].eType = eType;
+	ucQueueHead = ucNext;
+}
+
+static uint8_t key_read_pin(uint8_t ucKey)
+{
+	return (HAL_GPIO_ReadPin(kPin[ucKey].pPort, kPin[ucKey].wPin) == KEY_PRESSED_LEVEL);
+}
+
+// ==================================================================================
+/**
+ * @brief  Seeds the debounced state from the current pin levels
+ * @note   Call after MX_GPIO_Init() so a key held at power-up is not reported as a press.
+ */
+void key_init(void)
+{
+	uint8_t loop;
+
+	for (loop = 0; loop < MAX_KEYS; loop++)
+	{
+		kState[loop].ucDebounce = 0;
+		kState[loop].ucState    = key_read_pin(loop);
+		kState[loop].ucLongSent = kState[loop].ucState;
+		kState[loop].wHold      = 0;
+	}
+	ucQueueHead = ucQueueTail = 0;
+}
+
+// ==================================================================================
+/**
+ * @brief  Restarts the debounce window of the key on the given pin
+ * @details Called from the EXTI callback on every edge. Bouncing contacts keep
+ *          pushing the window out, so the line is only sampled once it has been
+ *          quiet for KEY_DEBOUNCE_MS.
+ */
+void key_exti(uint16_t wPin)
+{
+	uint8_t loop;
+
+	for (loop = 0; loop < MAX_KEYS; loop++)
+	{
+		if (kPin[loop].wPin == wPin)
+			kState[loop].ucDebounce = KEY_DEBOUNCE_MS;
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  1 ms key tick, called from SysTick next to update_timers()
+ * @details Samples a key only when its debounce window expires and queues
+ *          KEY_EV_PRESS / KEY_EV_RELEASE on a state change. While a key stays
+ *          pressed the hold time is counted and KEY_EV_LONG is queued once.
+ */
+void update_keys(void)
+{
+	uint8_t loop, ucLevel;
+	KeyStateDef *kKey;
+
+	for (loop = 0; loop < MAX_KEYS; loop++)
+	{
+		kKey = &kState[loop];
+
+		if (kKey->ucDebounce)
+		{
+			if (!--kKey->ucDebounce)
+			{
+				ucLevel = key_read_pin(loop);
+				if (ucLevel != kKey->ucState)
+				{
+					kKey->ucState    = ucLevel;
+					kKey->ucLongSent = 0;
+					kKey->wHold      = 0;
+					key_push(loop, ucLevel ? KEY_EV_PRESS : KEY_EV_RELEASE);
+				}
+			}
+		}
+
+		if (kKey->ucState && !kKey->ucLongSent)
+		{
+			if (++kKey->wHold >= KEY_LONG_MS)
+			{
+				kKey->ucLongSent = 1;
+				key_push(loop, KEY_EV_LONG);
+			}
+		}
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Reports whether every key is released and settled
+ * @return 1 if no debounce window or hold time is running
+ */
+uint8_t key_idle(void)
+{
+	uint8_t loop;
+
+	for (loop = 0; loop < MAX_KEYS; loop++)
+	{
+		if (kState[loop].ucDebounce || kState[loop].ucState)
+			return 0;
+	}
+	return 1;
+}
+
+// ==================================================================================
+/**
+ * @brief  Takes the oldest event from the key queue
+ * @return 1 if an event was copied to kEvent, 0 if the queue is empty
+ */
+uint8_t key_get_event(KeyEventDef *kEvent)
+{
+	if (ucQueueTail == ucQueueHead)
+		return 0;
+
+	*kEvent = kQueue[ucQueueTail];
+	ucQueueTail = (ucQueueTail + 1) & (KEY_QUEUE_SIZE - 1);
+	return 1;
+}
+
+// ==================================================================================
+/**
+ * @brief  Applies queued key events to gucKeyMode / gucKeyGaso
+ * @details KEY_MODE: a short press (release without long press) steps to the next
+ *          mode, a long press returns to KEY_MODE_AUTO. The main loop picks what
+ *          drives the strip from gucKeyMode.
+ *          KEY_GASO: gucKeyGaso follows the debounced button state.
+ *          Call from the main loop; it never touches GPIO itself.
+ */
+void read_key(void)
+{
+	static uint8_t ucModeLong = 0;
+	KeyEventDef kEvent;
+	uint8_t ucRec[3];
+
+	while (key_get_event(&kEvent))
+	{
+		if (kEvent.ucKey == KEY_MODE)
+		{
+			switch (kEvent.eType)
+			{
+				case KEY_EV_PRESS:
+					ucModeLong = 0;
+					break;
+				case KEY_EV_LONG:
+					ucModeLong = 1;
+					gucKeyMode = 0;
+					break;
+				case KEY_EV_RELEASE:
+					if (!ucModeLong)
+						gucKeyMode = (gucKeyMode + 1) % KEY_MODE_MAX;
+					break;
+			}
+		}
+		else if (kEvent.ucKey == KEY_GASO)
+		{
+			if (kEvent.eType == KEY_EV_PRESS)
+				gucKeyGaso = 1;
+			else if (kEvent.eType == KEY_EV_RELEASE)
+				gucKeyGaso = 0;
+		}
+
+		ucRec[0] = kEvent.ucKey;
+		ucRec[1] = kEvent.eType;
+		ucRec[2] = gucKeyMode;
+		tlog_write(TLOG_ID_KEY, ucRec, sizeof(ucRec));
+	}
+}
+
+// ==================================================================================
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+	key_exti(GPIO_Pin);
+}
@@ -0,0 +1,114 @@
+#include <string.h>
+#include "main.h"
+#include "led_conf.h"
+#include "led_delta.h"
+
+
+// ==================================================================================
+/**
+ * @brief  Loads the default palette from the led_conf.h color table
+ */
+void led_delta_init(DeltaTypeDef *dDelta)
+{
+	const rgb_color rDefault[DELTA_PAL_SIZE] = {
+		COLOR_BLANK,  COLOR_RED,    COLOR_GREEN,   COLOR_BLUE,
+		COLOR_ORANGE, COLOR_WHITE,  COLOR_CYAN,    COLOR_PURPLE,
+		COLOR_RED1,   COLOR_GREEN1, COLOR_BLUE1,   COLOR_ORANGE1,
+		COLOR_SOFT,   COLOR_YELLOW, COLOR_BLANK,   COLOR_BLANK
+	};
+
+	memcpy(dDelta->rPalette, rDefault, sizeof(dDelta->rPalette));
+}
+
+// ==================================================================================
+/**
+ * @brief  Applies a delta packet to an LED buffer in place
+ * @details Ops are decoded straight into rLed, so a sparse update (a segment
+ *          moving by one pixel) costs a SEEK and a short PAL/FILL per edge
+ *          instead of a full frame. See led_delta.h for the op encoding.
+ *
+ * @param  dDelta Decoder state (palette) of this stream
+ * @param  rLed   LED buffer to update
+ * @param  wNum   Number of pixels in rLed
+ * @param  pData  Packet payload
+ * @param  wLen   Payload length in bytes
+ *
+ * @return 1 if the whole payload was applied, 0 if it was truncated or ran past
+ *         wNum. Ops before the bad one have already been applied.
+ */
+uint8_t led_delta_decode(DeltaTypeDef *dDelta, rgb_color *rLed, uint16_t wNum, const uint8_t *pData, uint16_t wLen)
+{
+	const uint8_t *pEnd = pData + wLen;
+	uint16_t wPos = 0;
+	uint8_t  ucOp, ucRun, i;
+	rgb_color *rPalette = dDelta->rPalette;
+	rgb_color rColor;
+
+	while (pData < pEnd)
+	{
+		ucOp = *pData++;
+
+		if (ucOp == DELTA_OP_SEEK)
+		{
+			if (pEnd - pData < 2)
+				return 0;
+			wPos = pData[0] | (pData[1] << 8);
+			pData += 2;
+			continue;
+		}
+		if (ucOp == DELTA_OP_PALSET)
+		{
+			if (pEnd - pData < 4 || pData[0] >= DELTA_PAL_SIZE)
+				return 0;
+			rPalette[pData[0]].red   = pData[1];
+			rPalette[pData[0]].green = pData[2];
+			rPalette[pData[0]].blue  = pData[3];
+			pData += 4;
+			continue;
+		}
+
+		if ((ucOp & 0xE0) == DELTA_OP_PAL)
+			ucRun = (ucOp & DELTA_PAL_MASK) + 1;
+		else if ((ucOp & 0xE0) == 0xE0)                               // Reserved 111xxxxx
+			return 0;
+		else
+			ucRun = (ucOp & DELTA_RUN_MASK) + 1;
+
+		if (wPos + ucRun > wNum)
+			return 0;
+
+		switch (ucOp & 0xC0)
+		{
+			case DELTA_OP_SKIP:
+				break;
+
+			case DELTA_OP_FILL:
+				if (pEnd - pData < 3)
+					return 0;
+				rColor.red   = pData[0];
+				rColor.green = pData[1];
+				rColor.blue  = pData[2];
+				pData += 3;
+				for (i = 0; i < ucRun; i++)
+					rLed[wPos + i] = rColor;
+				break;
+
+			case DELTA_OP_COPY:
+				if (pEnd - pData < ucRun * 3)
+					return 0;
+				memcpy(&rLed[wPos], pData, ucRun * 3);
+				pData += ucRun * 3;
+				break;
+
+			default:                                                  // DELTA_OP_PAL
+				if (pData >= pEnd || *pData >= DELTA_PAL_SIZE)
+					return 0;
+				rColor = rPalette[*pData++];
+				for (i = 0; i < ucRun; i++)
+					rLed[wPos + i] = rColor;
+				break;
+		}
+		wPos += ucRun;
+	}
+	return 1;
+}
@@ -0,0 +1,274 @@
+#include "main.h"
+#include "led_matrix.h"
+
+
+// ==================================================================================
+/**
+ * @brief  Builds the index table of a panel
+ * @details For MATRIX_CUSTOM the table is left as it is, the caller fills
+ *          pMap[y * ucWidth + x] with the strip index of (x, y).
+ *
+ * @param   mMat      Matrix to set up
+ * @param   pMap      Table of ucWidth * ucHeight entries, owned by the caller
+ * @param   ucWidth   Columns
+ * @param   ucHeight  Rows
+ * @param   mLayout   How the strip runs through the panel
+ * @param   wOffset   Strip index of the first panel pixel (panels behind other LEDs)
+ */
+void matrix_init(MatrixTypeDef *mMat, uint16_t *pMap, uint8_t ucWidth, uint8_t ucHeight, MatrixLayout mLayout, uint16_t wOffset)
+{
+	uint16_t *pOut = pMap;
+	uint8_t   x, y;
+
+	mMat->ucWidth  = ucWidth;
+	mMat->ucHeight = ucHeight;
+	mMat->pMap     = pMap;
+
+	if (mLayout == MATRIX_CUSTOM)
+		return;
+
+	for (y = 0; y < ucHeight; y++)
+	{
+		for (x = 0; x < ucWidth; x++)
+		{
+			switch (mLayout)
+			{
+				case MATRIX_SERPENTINE:
+					*pOut++ = wOffset + y * ucWidth + ((y & 1) ? ucWidth - 1 - x : x);
+					break;
+				case MATRIX_COLUMNS:
+					*pOut++ = wOffset + x * ucHeight + y;
+					break;
+				case MATRIX_COL_SERPENTINE:
+					*pOut++ = wOffset + x * ucHeight + ((x & 1) ? ucHeight - 1 - y : y);
+					break;
+				default:
+					*pOut++ = wOffset + y * ucWidth + x;
+					break;
+			}
+		}
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Strip index of (x, y), no range check
+ */
+uint16_t matrix_index(MatrixTypeDef *mMat, uint8_t ucX, uint8_t ucY)
+{
+	return mMat->pMap[ucY * mMat->ucWidth + ucX];
+}
+
+// ==================================================================================
+void matrix_fill(rgb_color *rLed, MatrixTypeDef *mMat, rgb_color rColor)
+{
+	const uint16_t *pIdx = mMat->pMap;
+	uint16_t i = mMat->ucWidth * mMat->ucHeight;
+
+	while (i--)
+		rLed[*pIdx++] = rColor;
+}
+
+// ==================================================================================
+void matrix_fill_row(rgb_color *rLed, MatrixTypeDef *mMat, uint8_t ucY, rgb_color rColor)
+{
+	const uint16_t *pIdx = &mMat->pMap[ucY * mMat->ucWidth];
+	uint8_t i = mMat->ucWidth;
+
+	if (ucY >= mMat->ucHeight)
+		return;
+
+	while (i--)
+		rLed[*pIdx++] = rColor;
+}
+
+// ==================================================================================
+void matrix_fill_col(rgb_color *rLed, MatrixTypeDef *mMat, uint8_t ucX, rgb_color rColor)
+{
+	const uint16_t *pIdx = &mMat->pMap[ucX];
+	uint8_t i = mMat->ucHeight;
+
+	if (ucX >= mMat->ucWidth)
+		return;
+
+	for (; i--; pIdx += mMat->ucWidth)
+		rLed[*pIdx] = rColor;
+}
+
+// ==================================================================================
+/**
+ * @brief  Fills a rectangle, clipped to the panel
+ * @param   sX, sY    Top left corner, may be outside the panel
+ * @param   ucW, ucH  Size of the rectangle
+ */
+void matrix_fill_rect(rgb_color *rLed, MatrixTypeDef *mMat, int16_t sX, int16_t sY, uint8_t ucW, uint8_t ucH, rgb_color rColor)
+{
+	const uint16_t *pRow, *pIdx;
+	int16_t sX1 = sX + ucW, sY1 = sY + ucH;
+	uint8_t i;
+
+	if (sX < 0)
+		sX = 0;
+	if (sY < 0)
+		sY = 0;
+	if (sX1 > mMat->ucWidth)
+		sX1 = mMat->ucWidth;
+	if (sY1 > mMat->ucHeight)
+		sY1 = mMat->ucHeight;
+	if (sX >= sX1 || sY >= sY1)
+		return;
+
+	for (pRow = &mMat->pMap[sY * mMat->ucWidth + sX]; sY < sY1; sY++, pRow += mMat->ucWidth)
+	{
+		for (pIdx = pRow, i = sX1 - sX; i--; )
+			rLed[*pIdx++] = rColor;
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Writes a whole column, pColor holds ucHeight pixels from the top
+ */
+void matrix_set_col(rgb_color *rLed, MatrixTypeDef *mMat, uint8_t ucX, const rgb_color *pColor)
+{
+	const uint16_t *pIdx = &mMat->pMap[ucX];
+	uint8_t i = mMat->ucHeight;
+
+	if (ucX >= mMat->ucWidth)
+		return;
+
+	for (; i--; pIdx += mMat->ucWidth)
+		rLed[*pIdx] = *pColor++;
+}
+
+// ==================================================================================
+/**
+ * @brief  Writes a whole column from a bit mask, bit n selects the color of row n
+ * @details Rows from 32 down always get rOff. Used for 1 bit glyph columns.
+ */
+void matrix_set_col_mask(rgb_color *rLed, MatrixTypeDef *mMat, uint8_t ucX, uint32_t ulMask, rgb_color rOn, rgb_color rOff)
+{
+	const uint16_t *pIdx = &mMat->pMap[ucX];
+	uint8_t i = mMat->ucHeight;
+
+	if (ucX >= mMat->ucWidth)
+		return;
+
+	for (; i--; pIdx += mMat->ucWidth, ulMask >>= 1)
+		rLed[*pIdx] = (ulMask & 1) ? rOn : rOff;
+}
+
+// ==================================================================================
+/**
+ * @brief  Draws a sprite with its top left corner at (sX, sY), clipped to the panel
+ * @details With fKey set, sprite pixels equal to rKey leave the panel untouched.
+ */
+void matrix_blit(rgb_color *rLed, MatrixTypeDef *mMat, int16_t sX, int16_t sY, const MatrixSpriteDef *sSpr)
+{
+	const rgb_color *pSrc, *pSrcRow;
+	const uint16_t  *pIdx, *pRow;
+	int16_t  sX0 = 0, sY0 = 0, sW = sSpr->ucWidth, sH = sSpr->ucHeight;
+	int16_t  i, j;
+	rgb_color rKey = sSpr->rKey;
+
+	if (sX < 0)                                       // Clip the sprite to the panel
+		sX0 = -sX;
+	if (sY < 0)
+		sY0 = -sY;
+	if (sX + sW > mMat->ucWidth)
+		sW = mMat->ucWidth - sX;
+	if (sY + sH > mMat->ucHeight)
+		sH = mMat->ucHeight - sY;
+	if (sX0 >= sW || sY0 >= sH)
+		return;
+
+	pSrcRow = &sSpr->pData[sY0 * sSpr->ucWidth + sX0];
+	pRow    = &mMat->pMap[(sY + sY0) * mMat->ucWidth + sX + sX0];
+
+	for (j = sY0; j < sH; j++, pSrcRow += sSpr->ucWidth, pRow += mMat->ucWidth)
+	{
+		pSrc = pSrcRow;
+		pIdx = pRow;
+		if (sSpr->fKey == SET)
+		{
+			for (i = sX0; i < sW; i++, pSrc++, pIdx++)
+			{
+				if (pSrc->red != rKey.red || pSrc->green != rKey.green || pSrc->blue != rKey.blue)
+					rLed[*pIdx] = *pSrc;
+			}
+		}
+		else
+		{
+			for (i = sX0; i < sW; i++)
+				rLed[*pIdx++] = *pSrc++;
+		}
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Moves the picture one column to the left, rColor enters on the right
+ */
+void matrix_scroll_left(rgb_color *rLed, MatrixTypeDef *mMat, rgb_color rColor)
+{
+	const uint16_t *pIdx = mMat->pMap;
+	uint8_t x, y;
+
+	for (y = 0; y < mMat->ucHeight; y++, pIdx++)
+	{
+		for (x = 1; x < mMat->ucWidth; x++, pIdx++)
+			rLed[pIdx[0]] = rLed[pIdx[1]];
+		rLed[*pIdx] = rColor;
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Moves the picture one column to the right, rColor enters on the left
+ */
+void matrix_scroll_right(rgb_color *rLed, MatrixTypeDef *mMat, rgb_color rColor)
+{
+	const uint16_t *pIdx = &mMat->pMap[mMat->ucWidth * mMat->ucHeight - 1];
+	uint8_t x, y;
+
+	for (y = 0; y < mMat->ucHeight; y++, pIdx--)
+	{
+		for (x = 1; x < mMat->ucWidth; x++, pIdx--)
+			rLed[pIdx[0]] = rLed[pIdx[-1]];
+		rLed[*pIdx] = rColor;
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Moves the picture one row up, rColor enters at the bottom
+ */
+void matrix_scroll_up(rgb_color *rLed, MatrixTypeDef *mMat, rgb_color rColor)
+{
+	const uint16_t *pIdx = mMat->pMap;
+	uint16_t i = mMat->ucWidth * (mMat->ucHeight - 1);
+
+	if (!mMat->ucHeight)
+		return;
+
+	for (; i--; pIdx++)
+		rLed[pIdx[0]] = rLed[pIdx[mMat->ucWidth]];
+	matrix_fill_row(rLed, mMat, mMat->ucHeight - 1, rColor);
+}
+
+// ==================================================================================
+/**
+ * @brief  Moves the picture one row down, rColor enters at the top
+ */
+void matrix_scroll_down(rgb_color *rLed, MatrixTypeDef *mMat, rgb_color rColor)
+{
+	const uint16_t *pIdx;
+	uint16_t i = mMat->ucWidth * (mMat->ucHeight - 1);
+
+	if (!mMat->ucHeight)
+		return;
+
+	for (pIdx = &mMat->pMap[mMat->ucWidth * mMat->ucHeight - 1]; i--; pIdx--)
+		rLed[pIdx[0]] = rLed[pIdx[-(int16_t)mMat->ucWidth]];
+	matrix_fill_row(rLed, mMat, 0, rColor);
+}
@@ -0,0 +1,253 @@
+#include "main.h"
+#include "led_noise.h"
+
+
+typedef enum
+{
+	NOISE_DIM_1,
+	NOISE_DIM_2,
+	NOISE_DIM_3
+} NoiseDim;
+
+typedef struct
+{
+	uint16_t wX;                              // Cell the edge terms belong to, 0xFFFF = none
+	uint8_t  ucY, ucZ;                        // Lattice row and layer
+	uint8_t  ucV, ucW;                        // Faded y and z fraction
+	int16_t  sDy, sDz;                        // y and z fraction, 0..255
+	int16_t  sSA, sKA;                        // Low x edge:  sSA * dx / 256 + sKA
+	int16_t  sSB, sKB;                        // High x edge
+	const int8_t (*pGrad)[3];
+} NoiseCellDef;
+
+// Fixed shuffle of 0..255, indices wrap at 8 bits so 256 entries are enough
+static const uint8_t ucPerm[256] = {
+	 70, 214, 226,  75,  76,  56,  92,  84, 199,  97,   6, 173, 123, 129, 125, 114,
+	183, 105, 209, 159,  14,  98,  96, 190, 174,  53,  27, 103, 141,  17,  83, 116,
+	150, 254,  28,  16, 234, 156, 127, 217, 241,  71, 152,  44, 228,  69, 149, 109,
+	143, 206,  85, 119,  93, 232,  86, 108, 222,  31,  24,  39,  22,   2,  51, 238,
+	106,  35, 124, 166, 154, 145,  87,  29,  10,   5, 227, 176,  73, 135,  40, 132,
+	165, 128,  13, 146, 236, 224, 118, 216,  77, 148, 207, 157, 197, 244,  72,  62,
+	  8, 171,  42, 160,  19,  68, 144,  11, 255, 249, 221,  59,  32,  38, 111, 155,
+	 18,  61, 158, 175, 192, 220, 151, 252,  48, 120, 140, 187, 110, 167,  49, 186,
+	139,  15,  89, 142, 164,  43, 112, 170,  41, 211, 198, 202, 136,  63,   7, 168,
+	147, 184, 117, 246, 189, 229,  64, 134, 250, 242, 205, 233, 178,  33,  45, 172,
+	212, 182, 138, 121,  21, 196, 126, 230, 194, 248, 203,  99,  46,   4, 153, 237,
+	 80, 163, 251, 102,  47,  34, 188,   9, 131, 180, 253, 113,  65, 107, 122, 245,
+	213, 133, 115,  54, 181, 247,  90,  67, 200,  78, 191,  52,  57,  12, 210,  79,
+	231,  91, 193, 240,  23, 169,  82,  50, 177, 218,  37, 215, 100,  36,  66, 179,
+	101, 130, 185, 162,  95,   0,  81, 219,  30, 204, 243,  60, 104,  25, 225, 161,
+	 94,   1,  58,  74, 235,  26, 239, 201, 223,  20,   3,  88, 208, 137,  55, 195,
+};
+
+// 6t^5 - 15t^4 + 10t^3 for t = i / 256, scaled to 255
+static const uint8_t ucFade[256] = {
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   3,   3,   3,   3,   4,
+	  4,   4,   5,   5,   6,   6,   7,   7,   8,   8,   9,   9,  10,  10,  11,  12,
+	 12,  13,  14,  15,  15,  16,  17,  18,  19,  20,  20,  21,  22,  23,  24,  25,
+	 26,  27,  29,  30,  31,  32,  33,  34,  35,  37,  38,  39,  41,  42,  43,  45,
+	 46,  47,  49,  50,  52,  53,  55,  56,  58,  59,  61,  62,  64,  65,  67,  69,
+	 70,  72,  73,  75,  77,  79,  80,  82,  84,  85,  87,  89,  91,  93,  94,  96,
+	 98, 100, 102, 103, 105, 107, 109, 111, 113, 114, 116, 118, 120, 122, 124, 126,
+	128, 129, 131, 133, 135, 137, 139, 141, 142, 144, 146, 148, 150, 152, 153, 155,
+	157, 159, 161, 162, 164, 166, 168, 170, 171, 173, 175, 176, 178, 180, 182, 183,
+	185, 186, 188, 190, 191, 193, 194, 196, 197, 199, 200, 202, 203, 205, 206, 208,
+	209, 210, 212, 213, 214, 216, 217, 218, 220, 221, 222, 223, 224, 225, 226, 228,
+	229, 230, 231, 232, 233, 234, 235, 235, 236, 237, 238, 239, 240, 240, 241, 242,
+	243, 243, 244, 245, 245, 246, 246, 247, 247, 248, 248, 249, 249, 250, 250, 251,
+	251, 251, 252, 252, 252, 252, 253, 253, 253, 253, 254, 254, 254, 254, 254, 254,
+	254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+};
+
+// Gradients by dimension, picked with the low 4 bits of the corner hash
+static const int8_t cGrad[3][16][3] = {
+	{ { 1, 0, 0}, {-1, 0, 0}, { 2, 0, 0}, {-2, 0, 0}, { 3, 0, 0}, {-3, 0, 0}, { 4, 0, 0}, {-4, 0, 0},
+	  { 1, 0, 0}, {-1, 0, 0}, { 2, 0, 0}, {-2, 0, 0}, { 3, 0, 0}, {-3, 0, 0}, { 4, 0, 0}, {-4, 0, 0} },
+	{ { 1, 1, 0}, {-1, 1, 0}, { 1,-1, 0}, {-1,-1, 0}, { 1, 0, 0}, {-1, 0, 0}, { 0, 1, 0}, { 0,-1, 0},
+	  { 1, 1, 0}, {-1, 1, 0}, { 1,-1, 0}, {-1,-1, 0}, { 1, 0, 0}, {-1, 0, 0}, { 0, 1, 0}, { 0,-1, 0} },
+	{ { 1, 1, 0}, {-1, 1, 0}, { 1,-1, 0}, {-1,-1, 0}, { 1, 0, 1}, {-1, 0, 1}, { 1, 0,-1}, {-1, 0,-1},
+	  { 0, 1, 1}, { 0,-1, 1}, { 0, 1,-1}, { 0,-1,-1}, { 1, 1, 0}, { 0,-1, 1}, {-1, 1, 0}, { 0,-1,-1} },
+};
+
+// Raw noise to a spread of about 44 around 128 for one octave, Q8, measured per dimension
+static const uint16_t wScale[3] = { 63, 167, 170 };
+
+// 2^(n-1) / (2^n - 1) in Q8: keeps the octave sum in the range of one octave
+static const uint16_t wOctNorm[NOISE_OCT_MAX] = { 256, 171, 146, 137, 132, 130, 129, 128 };
+
+
+// ==================================================================================
+static int16_t noise_lerp(int16_t sA, int16_t sB, uint8_t ucT)
+{
+	return sA + (((int32_t)(sB - sA) * ucT) >> 8);
+}
+
+// ==================================================================================
+/**
+ * @brief  Reduces the four corners at lattice x ucX to one linear term in dx
+ * @details A corner contributes gx * dx + gy * dy + gz * dz. With y and z
+ *          fixed only gx * dx varies, so the y/z blend of the four corners
+ *          is a slope *pS (Q8) and an offset *pK.
+ */
+static void noise_edge(const NoiseCellDef *c, uint8_t ucX, int16_t *pS, int16_t *pK)
+{
+	const int8_t *g;
+	uint8_t ucH, ucHy[2];
+	int16_t sS[4], sK[4];
+	uint8_t i;
+
+	ucH     = ucPerm[ucX];
+	ucHy[0] = ucPerm[(uint8_t)(ucH + c->ucY)];
+	ucHy[1] = ucPerm[(uint8_t)(ucH + c->ucY + 1)];
+
+	for (i = 0; i < 4; i++)                         // Corners y0z0, y1z0, y0z1, y1z1
+	{
+		g = c->pGrad[ucPerm[(uint8_t)(ucHy[i & 1] + c->ucZ + (i >> 1))] & 0x0F];
+		sS[i] = g[0] * 256;
+		sK[i] = g[1] * (c->sDy - ((i & 1) << 8)) + g[2] * (c->sDz - ((i >> 1) << 8));
+	}
+
+	*pS = noise_lerp(noise_lerp(sS[0], sS[1], c->ucV), noise_lerp(sS[2], sS[3], c->ucV), c->ucW);
+	*pK = noise_lerp(noise_lerp(sK[0], sK[1], c->ucV), noise_lerp(sK[2], sK[3], c->ucV), c->ucW);
+}
+
+// ==================================================================================
+static void noise_setup(NoiseCellDef *c, NoiseDim eDim, uint16_t y, uint16_t z)
+{
+	c->wX    = 0xFFFF;
+	c->ucY   = y >> 8;
+	c->ucZ   = z >> 8;
+	c->sDy   = y & 0xFF;
+	c->sDz   = z & 0xFF;
+	c->ucV   = ucFade[c->sDy];
+	c->ucW   = ucFade[c->sDz];
+	c->pGrad = cGrad[eDim];
+}
+
+// ==================================================================================
+/**
+ * @brief  Raw noise at x, rebuilds the edge terms only when x enters a new cell
+ */
+static int16_t noise_sample(NoiseCellDef *c, uint16_t x)
+{
+	uint8_t ucDx = x & 0xFF;
+	int16_t sA, sB;
+
+	if ((x >> 8) != c->wX)
+	{
+		c->wX = x >> 8;
+		noise_edge(c, c->wX, &c->sSA, &c->sKA);
+		noise_edge(c, c->wX + 1, &c->sSB, &c->sKB);
+	}
+
+	sA = ((c->sSA * ucDx) >> 8) + c->sKA;
+	sB = ((c->sSB * (ucDx - 256)) >> 8) + c->sKB;
+	return noise_lerp(sA, sB, ucFade[ucDx]);
+}
+
+// ==================================================================================
+/**
+ * @brief  Samples wNum points from x on, wStep apart, with y and z fixed
+ * @details Octave k samples (x, y, z) << k at 1 / 2^k of the amplitude. Its
+ *          y is moved by k * 29 cells so the octaves do not share a lattice.
+ */
+static void noise_fill(NoiseDim eDim, uint8_t *pOut, uint16_t wNum, uint16_t x, uint16_t wStep,
+                       uint16_t y, uint16_t z, uint8_t ucOct)
+{
+	NoiseCellDef c[NOISE_OCT_MAX];
+	uint32_t     ulMul;
+	int32_t      lSum;
+	uint8_t      k;
+
+	if (!ucOct)
+		ucOct = 1;
+	if (ucOct > NOISE_OCT_MAX)
+		ucOct = NOISE_OCT_MAX;
+
+	for (k = 0; k < ucOct; k++)
+		noise_setup(&c[k], eDim, (uint16_t)((y << k) + k * 0x1D00), (uint16_t)(z << k));
+	ulMul = (wOctNorm[ucOct - 1] * wScale[eDim]) >> 8;
+
+	while (wNum--)
+	{
+		lSum = noise_sample(&c[0], x);
+		for (k = 1; k < ucOct; k++)
+			lSum += noise_sample(&c[k], (uint16_t)(x << k)) >> k;
+
+		lSum = 128 + ((lSum * (int32_t)ulMul) >> 8);
+		*pOut++ = (lSum < 0) ? 0 : (lSum > 0xFF) ? 0xFF : lSum;
+		x += wStep;
+	}
+}
+
+// ==================================================================================
+uint8_t noise_1d(uint16_t x)
+{
+	uint8_t ucOut;
+
+	noise_fill(NOISE_DIM_1, &ucOut, 1, x, 0, 0, 0, 1);
+	return ucOut;
+}
+
+// ==================================================================================
+uint8_t noise_2d(uint16_t x, uint16_t y)
+{
+	uint8_t ucOut;
+
+	noise_fill(NOISE_DIM_2, &ucOut, 1, x, 0, y, 0, 1);
+	return ucOut;
+}
+
+// ==================================================================================
+uint8_t noise_3d(uint16_t x, uint16_t y, uint16_t z)
+{
+	uint8_t ucOut;
+
+	noise_fill(NOISE_DIM_3, &ucOut, 1, x, 0, y, z, 1);
+	return ucOut;
+}
+
+// ==================================================================================
+/**
+ * @brief  Fractal 3D noise, ucOct octaves (1..NOISE_OCT_MAX)
+ */
+uint8_t noise_fbm_3d(uint16_t x, uint16_t y, uint16_t z, uint8_t ucOct)
+{
+	uint8_t ucOut;
+
+	noise_fill(NOISE_DIM_3, &ucOut, 1, x, 0, y, z, ucOct);
+	return ucOut;
+}
+
+// ==================================================================================
+/**
+ * @brief  Fills a segment with 1D noise
+ *
+ * @param   pOut   wNum results
+ * @param   x      Coordinate of the first pixel, 8.8
+ * @param   wStep  Coordinate step per pixel, 256 = one cell per pixel
+ * @param   ucOct  Octaves, 1 = plain noise
+ */
+void noise_fill_1d(uint8_t *pOut, uint16_t wNum, uint16_t x, uint16_t wStep, uint8_t ucOct)
+{
+	noise_fill(NOISE_DIM_1, pOut, wNum, x, wStep, 0, 0, ucOct);
+}
+
+// ==================================================================================
+/**
+ * @brief  Fills a segment with a row of 2D noise, y is usually time
+ */
+void noise_fill_2d(uint8_t *pOut, uint16_t wNum, uint16_t x, uint16_t wStep, uint16_t y, uint8_t ucOct)
+{
+	noise_fill(NOISE_DIM_2, pOut, wNum, x, wStep, y, 0, ucOct);
+}
+
+// ==================================================================================
+/**
+ * @brief  Fills a segment with a row of 3D noise, e.g. panel row y at time z
+ */
+void noise_fill_3d(uint8_t *pOut, uint16_t wNum, uint16_t x, uint16_t wStep, uint16_t y, uint16_t z, uint8_t ucOct)
+{
+	noise_fill(NOISE_DIM_3, pOut, wNum, x, wStep, y, z, ucOct);
+}
@@ -0,0 +1,234 @@
+#include "main.h"
+#include "led_particle.h"
+
+
+static ParticleDef pPool[PARTICLE_MAX];       // Live particles are pPool[0..wCount-1]
+static uint16_t    wCount;
+static uint16_t    wSeed = 0xACE1;
+
+ParticleStatDef sParticleStat;
+
+// Red to yellow, the colors of the old random sparks
+const rgb_color rSparkPal[SPARK_COLORS] =
+{
+	{ .red = 0xFF, .green = 0x60, .blue = 0x00 },
+	{ .red = 0xFF, .green = 0x70, .blue = 0x20 },
+	{ .red = 0xFF, .green = 0x80, .blue = 0x00 },
+	{ .red = 0xFF, .green = 0x90, .blue = 0x40 },
+	{ .red = 0xFF, .green = 0xA0, .blue = 0x20 },
+	{ .red = 0xFF, .green = 0xB0, .blue = 0x00 },
+	{ .red = 0xFF, .green = 0xC0, .blue = 0x60 },
+	{ .red = 0xFF, .green = 0xD0, .blue = 0x40 },
+};
+
+
+// ==================================================================================
+/**
+ * @brief  Adds rColor scaled by (wScale + 1) / 256 to a pixel, saturating
+ */
+static void particle_add(rgb_color *pLed, rgb_color rColor, uint16_t wScale)
+{
+	uint16_t w;
+
+	wScale++;
+	w = pLed->red   + ((rColor.red   * wScale) >> 8);
+	pLed->red   = (w > 0xFF) ? 0xFF : w;
+	w = pLed->green + ((rColor.green * wScale) >> 8);
+	pLed->green = (w > 0xFF) ? 0xFF : w;
+	w = pLed->blue  + ((rColor.blue  * wScale) >> 8);
+	pLed->blue  = (w > 0xFF) ? 0xFF : w;
+}
+
+// ==================================================================================
+/**
+ * @brief  Empties the pool
+ */
+void particle_init(void)
+{
+	wCount = 0;
+}
+
+// ==================================================================================
+/**
+ * @brief  Appends a particle to the live ones
+ *
+ * @param   wPos     Position, PARTICLE_POS(pixel) + fraction
+ * @param   cVel     Speed in 1/64 pixel per step, negative runs to pixel 0
+ * @param   ucColor  Palette index, full life color
+ * @param   ucLife   Start brightness
+ * @param   ucFade   Brightness lost per step
+ * @return  Pool index, PARTICLE_NONE if the pool is exhausted
+ */
+uint16_t particle_spawn(uint16_t wPos, int8_t cVel, uint8_t ucColor, uint8_t ucLife, uint8_t ucFade)
+{
+	ParticleDef *p;
+
+	if (wCount >= PARTICLE_MAX)
+		return PARTICLE_NONE;
+
+	p = &pPool[wCount];
+	p->wPos    = wPos;
+	p->cVel    = cVel;
+	p->ucLife  = ucLife;
+	p->ucFade  = ucFade;
+	p->ucColor = ucColor;
+	return wCount++;
+}
+
+// ==================================================================================
+/**
+ * @brief  Moves and ages every live particle by one step
+ * @details Particles that burn out or leave pixel 0..wNum-1 are replaced by
+ *          the last live one in the same pass, so indexes do not stay valid
+ *          across calls. cDrag is the same for the whole effect: a positive
+ *          one slows every particle down to a stop, a negative one speeds it
+ *          up to PARTICLE_VEL_MAX in the direction it runs.
+ *
+ * @param   wNum   Strip length in pixels
+ * @param   cDrag  Speed lost per step, 1/64 pixel
+ */
+void particle_update(uint16_t wNum, int8_t cDrag)
+{
+	uint32_t     ulEnd = (uint32_t)wNum << PARTICLE_FRAC;
+	ParticleDef *p = pPool;
+	uint16_t     wIdx = 0;
+	int32_t      lPos;
+	int16_t      sVel;
+
+	while (wIdx < wCount)
+	{
+		lPos = (int32_t)p->wPos + p->cVel;
+
+		if (p->ucLife <= p->ucFade || lPos < 0 || (uint32_t)lPos >= ulEnd)
+		{
+			*p = pPool[--wCount];                     // Same slot is checked again
+			continue;
+		}
+
+		sVel = p->cVel;
+		if (sVel > 0)
+		{
+			sVel -= cDrag;
+			sVel  = (sVel < 0) ? 0 : (sVel > PARTICLE_VEL_MAX) ? PARTICLE_VEL_MAX : sVel;
+		}
+		else if (sVel < 0)
+		{
+			sVel += cDrag;
+			sVel  = (sVel > 0) ? 0 : (sVel < -PARTICLE_VEL_MAX) ? -PARTICLE_VEL_MAX : sVel;
+		}
+
+		p->wPos    = lPos;
+		p->cVel    = sVel;
+		p->ucLife -= p->ucFade;
+		p++;
+		wIdx++;
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Adds every live particle to the framebuffer
+ * @details A particle between two pixels is split over both by its position
+ *          fraction, so slow particles glide instead of jumping.
+ *
+ * @param   pPal  Palette the particle color indexes point into
+ */
+void particle_render(rgb_color *rLed, uint16_t wNum, const rgb_color *pPal)
+{
+	ParticleDef *p = pPool;
+	uint16_t     wIdx, wPix, wHi;
+	rgb_color    rColor;
+
+	for (wIdx = 0; wIdx < wCount; wIdx++, p++)
+	{
+		wPix = p->wPos >> PARTICLE_FRAC;
+		wHi  = (p->ucLife * (p->wPos & (PARTICLE_ONE - 1))) >> PARTICLE_FRAC;
+
+		if (wPix >= wNum)
+			continue;
+		rColor = pPal[p->ucColor];
+		particle_add(&rLed[wPix], rColor, p->ucLife - wHi);
+		if (wHi && wPix + 1 < wNum)
+			particle_add(&rLed[wPix + 1], rColor, wHi);
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Scales the framebuffer by (ucKeep + 1) / 256, leaves trails behind
+ *         particles when called before particle_render()
+ */
+void particle_dim(rgb_color *rLed, uint16_t wNum, uint8_t ucKeep)
+{
+	uint16_t wScale = ucKeep + 1;
+
+	while (wNum--)
+	{
+		rLed->red   = (rLed->red   * wScale) >> 8;
+		rLed->green = (rLed->green * wScale) >> 8;
+		rLed->blue  = (rLed->blue  * wScale) >> 8;
+		rLed++;
+	}
+}
+
+// ==================================================================================
+uint16_t particle_count(void)
+{
+	return wCount;
+}
+
+// ==================================================================================
+/**
+ * @brief  16 bit xorshift, cheap randomness for emitters
+ */
+uint16_t particle_rand(void)
+{
+	wSeed ^= wSeed << 7;
+	wSeed ^= wSeed >> 9;
+	wSeed ^= wSeed << 8;
+	return wSeed;
+}
+
+// ==================================================================================
+/**
+ * @brief  Draws one frame of the spark effect into rLed
+ * @details Dims the frame for the trails, maybe starts a burst, then moves and
+ *          adds every spark. Sparks run at 1/4 to 1.2 pixels per frame, lose
+ *          SPARK_DRAG per frame and fade so they are dark when they stop.
+ * @note   The time is taken with SysTick VAL and the ms count, like
+ *         audio_poll(); it lands in sParticleStat.
+ */
+void particle_spark(rgb_color *rLed, uint16_t wNum)
+{
+	uint32_t  ulStart, ulEnd, ulTick, ulClk;
+	uint16_t  wPos, wRand;
+	uint8_t   ucVel, ucColor, i;
+
+	ulTick  = HAL_GetTick();
+	ulStart = SysTick->VAL;
+
+	particle_dim(rLed, wNum, SPARK_KEEP);
+	if (wNum && !(particle_rand() & (SPARK_CHANCE - 1)))
+	{
+		wPos = PARTICLE_POS(particle_rand() % wNum) + PARTICLE_ONE / 2;
+		for (i = 0; i < SPARK_BURST; i++)
+		{
+			wRand   = particle_rand();                // Speed, color, direction
+			ucVel   = 16 + (wRand & 0x3F);
+			ucColor = (wRand >> 6) & (SPARK_COLORS - 1);
+			particle_spawn(wPos, (wRand & 0x8000) ? -(int8_t)ucVel : (int8_t)ucVel, ucColor,
+			               0xFF, 0xFF * SPARK_DRAG / ucVel + 1);
+		}
+	}
+	particle_update(wNum, SPARK_DRAG);
+	particle_render(rLed, wNum, rSparkPal);
+
+	ulEnd  = SysTick->VAL;
+	ulTick = HAL_GetTick() - ulTick;
+
+	ulClk = ulTick * (SysTick->LOAD + 1) + ulStart - ulEnd;
+	sParticleStat.ulFrames++;
+	sParticleStat.ulClkLast = ulClk;
+	if (ulClk > sParticleStat.ulClkMax)
+		sParticleStat.ulClkMax = ulClk;
+}
@@ -0,0 +1,260 @@
+#include <string.h>
+#include "main.h"
+#include "led_spectrum.h"
+#include "fft_tables.h"
+
+// fft_tables.c holds the RFFT of this length, the window is written out for it
+#if SPECTRUM_LEN != 128
+#error "Run Tools/fft_tables.py rfft_q15:SPECTRUM_LEN and redo qWindow"
+#endif
+
+// First half of a 128 point Hann window, q15
+static const q15_t qWindow[SPECTRUM_LEN / 2] = {
+	    0,    20,    80,   180,   320,   499,   717,   973,
+	 1267,  1597,  1965,  2367,  2803,  3273,  3775,  4308,
+	 4870,  5461,  6078,  6721,  7387,  8075,  8784,  9511,
+	10254, 11013, 11785, 12569, 13361, 14161, 14967, 15776,
+	16586, 17396, 18203, 19006, 19803, 20591, 21369, 22135,
+	22886, 23622, 24340, 25039, 25716, 26371, 27001, 27605,
+	28181, 28729, 29247, 29733, 30186, 30606, 30990, 31340,
+	31652, 31927, 32164, 32363, 32522, 32642, 32722, 32762,
+};
+
+// First bin of every band, bins are SPECTRUM_RATE / SPECTRUM_LEN = 62.5 Hz wide
+static const uint8_t ucEdge[SPECTRUM_BANDS + 1] = { 1, 2, 3, 5, 8, 13, 22, 38, 64 };
+
+
+// ==================================================================================
+/**
+ * @brief  log2 of ulX in Q8, the fraction is the linear mantissa (error < 0.09)
+ * @return 0 for 0 and 1, 31 * 256 + 255 at most
+ */
+uint16_t spectrum_log2(uint32_t ulX)
+{
+	uint16_t wMsb = 31;
+
+	if (ulX < 2)
+		return 0;
+	while (!(ulX & 0x80000000))
+	{
+		ulX <<= 1;
+		wMsb--;
+	}
+	return (wMsb << 8) | ((ulX >> 23) & 0xFF);
+}
+
+// ==================================================================================
+/**
+ * @brief  Moves a shown level towards ucNew, with peak hold
+ */
+static void spectrum_level(SpectrumTypeDef *s, uint8_t i, uint8_t ucNew)
+{
+	if (ucNew >= s->ucLevel[i])
+		s->ucLevel[i] = ucNew;
+	else
+		s->ucLevel[i] = (s->ucLevel[i] - ucNew > SPECTRUM_FALL) ? s->ucLevel[i] - SPECTRUM_FALL : ucNew;
+
+	if (s->ucLevel[i] >= s->ucPeak[i])
+	{
+		s->ucPeak[i] = s->ucLevel[i];
+		s->ucHold[i] = SPECTRUM_HOLD;
+	}
+	else if (s->ucHold[i])
+	{
+		s->ucHold[i]--;
+	}
+	else
+	{
+		s->ucPeak[i] = (s->ucPeak[i] - s->ucLevel[i] > SPECTRUM_FALL) ? s->ucPeak[i] - SPECTRUM_FALL : s->ucLevel[i];
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Maps a band power to 0..255 below a reference that follows the loudest
+ * @param  ucRef  0 = band reference, 1 = total reference
+ */
+static void spectrum_gain(SpectrumTypeDef *s, uint8_t ucRef, uint8_t ucFirst, uint8_t ucNum)
+{
+	uint16_t wMax = 0, wRef = s->wRef[ucRef];
+	int32_t  lLvl;
+	uint8_t  i;
+
+	for (i = ucFirst; i < ucFirst + ucNum; i++)
+		if (s->wLog[i] > wMax)
+			wMax = s->wLog[i];
+
+	wRef = (wRef > SPECTRUM_REF_MIN + SPECTRUM_REF_FALL) ? wRef - SPECTRUM_REF_FALL : SPECTRUM_REF_MIN;
+	if (wMax > wRef)
+		wRef = wMax;
+	s->wRef[ucRef] = wRef;
+
+	for (i = ucFirst; i < ucFirst + ucNum; i++)
+	{
+		lLvl = ((int32_t)s->wLog[i] - wRef + (256 << SPECTRUM_RANGE_SH)) >> SPECTRUM_RANGE_SH;
+		spectrum_level(s, i, lLvl < 0 ? 0 : (lLvl > 255 ? 255 : lLvl));
+	}
+}
+
+// ==================================================================================
+void spectrum_init(SpectrumTypeDef *s)
+{
+	memset(s, 0, sizeof(*s));
+	s->pRfft = &fft_rfft_q15_len128;
+	s->wRef[0] = s->wRef[1] = SPECTRUM_REF_MIN;
+}
+
+// ==================================================================================
+/**
+ * @brief  Analyses one block of ADC samples
+ * @details pAdc is only read at the start (DC level and window), the caller
+ *          may hand the buffer back to the DMA as soon as this returns.
+ *
+ * @param  pAdc  SPECTRUM_LEN right aligned 12 bit samples
+ */
+void spectrum_process(SpectrumTypeDef *s, const uint16_t *pAdc)
+{
+	uint32_t ulSum = 0, ulPow, ulAll = 0;
+	int32_t  lMean, lRe, lIm;
+	uint16_t i, k;
+
+	for (i = 0; i < SPECTRUM_LEN; i++)
+		ulSum += pAdc[i];
+	lMean = ulSum / SPECTRUM_LEN;
+
+	// The window is symmetric, one coefficient serves both ends
+	for (i = 0; i < SPECTRUM_LEN / 2; i++)
+	{
+		s->qIn[i]                    = (((pAdc[i] - lMean) << SPECTRUM_ADC_SHIFT) * qWindow[i]) >> 15;
+		s->qIn[SPECTRUM_LEN - 1 - i] = (((pAdc[SPECTRUM_LEN - 1 - i] - lMean) << SPECTRUM_ADC_SHIFT) * qWindow[i]) >> 15;
+	}
+
+	arm_rfft_q15(s->pRfft, s->qIn, s->qOut);
+
+	// Bin power fits 31 bits, >> 6 leaves room for the 63 bins of the total
+	for (i = 0; i < SPECTRUM_BANDS; i++)
+	{
+		ulPow = 0;
+		for (k = ucEdge[i]; k < ucEdge[i + 1]; k++)
+		{
+			lRe = s->qOut[2 * k];
+			lIm = s->qOut[2 * k + 1];
+			ulPow += ((uint32_t)(lRe * lRe) + (uint32_t)(lIm * lIm)) >> 6;
+		}
+		s->wLog[i] = spectrum_log2(ulPow);
+		ulAll += ulPow;
+	}
+	s->wLog[SPECTRUM_BANDS] = spectrum_log2(ulAll);
+
+	spectrum_gain(s, 0, 0, SPECTRUM_BANDS);
+	spectrum_gain(s, 1, SPECTRUM_BANDS, 1);
+	s->ulBlocks++;
+}
+
+// ==================================================================================
+static rgb_color spectrum_scale(rgb_color rColor, uint8_t ucScale)
+{
+	rColor.red   = (rColor.red   * ucScale) >> 8;
+	rColor.green = (rColor.green * ucScale) >> 8;
+	rColor.blue  = (rColor.blue  * ucScale) >> 8;
+	return rColor;
+}
+
+// ==================================================================================
+/**
+ * @brief  Pixel i of a segment, counted from where its animation starts
+ */
+static uint16_t spectrum_pixel(const LedTypeDef *lSeg, uint16_t i)
+{
+	return (lSeg->sDir == SHIFT_RIGHT) ? lSeg->wPosEnd - i : lSeg->wPosStart + i;
+}
+
+// ==================================================================================
+/**
+ * @brief  Draws the loudest of bands ucFirst .. ucFirst + ucNum - 1 as a bar
+ * @details The bar grows from the end the segment animation starts at, in
+ *          rColorOri with a partly lit top pixel; the peak is a rColorFill dot.
+ */
+void spectrum_bar(SpectrumTypeDef *s, rgb_color *rLed, const LedTypeDef *lSeg, uint8_t ucFirst, uint8_t ucNum)
+{
+	uint16_t wLen = lSeg->wPosEnd - lSeg->wPosStart + 1;
+	uint8_t  ucLvl = 0, ucPeak = 0, i;
+	uint32_t ulLit;
+	uint16_t wPeak, k;
+
+	for (i = ucFirst; i < ucFirst + ucNum; i++)
+	{
+		if (s->ucLevel[i] > ucLvl)
+			ucLvl = s->ucLevel[i];
+		if (s->ucPeak[i] > ucPeak)
+			ucPeak = s->ucPeak[i];
+	}
+
+	ulLit = (uint32_t)ucLvl * wLen;                 // Lit pixels, Q8
+	wPeak = ((uint32_t)ucPeak * wLen) >> 8;
+	if (wPeak >= wLen)
+		wPeak = wLen - 1;
+
+	for (k = 0; k < wLen; k++)
+	{
+		if (k < (ulLit >> 8))
+			rLed[spectrum_pixel(lSeg, k)] = lSeg->rColorOri;
+		else if (k == (ulLit >> 8))
+			rLed[spectrum_pixel(lSeg, k)] = spectrum_scale(lSeg->rColorOri, ulLit & 0xFF);
+		else
+			rLed[spectrum_pixel(lSeg, k)] = COLOR_BLANK;
+	}
+	if (ucPeak)
+		rLed[spectrum_pixel(lSeg, wPeak)] = lSeg->rColorFill;
+}
+
+// ==================================================================================
+/**
+ * @brief  Draws the total level as a green, yellow and red meter
+ */
+void spectrum_vu(SpectrumTypeDef *s, rgb_color *rLed, const LedTypeDef *lSeg)
+{
+	uint16_t wLen    = lSeg->wPosEnd - lSeg->wPosStart + 1;
+	uint16_t wLit    = ((uint32_t)s->ucLevel[SPECTRUM_BANDS] * wLen + 128) >> 8;
+	uint16_t wPeak   = ((uint32_t)s->ucPeak[SPECTRUM_BANDS] * wLen) >> 8;
+	uint16_t wYellow = ((uint32_t)wLen * 154) >> 8;                // 60 %
+	uint16_t wRed    = ((uint32_t)wLen * 218) >> 8;                // 85 %
+	rgb_color rColor;
+	uint16_t k;
+
+	if (wPeak >= wLen)
+		wPeak = wLen - 1;
+
+	for (k = 0; k < wLen; k++)
+	{
+		rColor = (k < wYellow) ? COLOR_GREEN : ((k < wRed) ? COLOR_YELLOW : COLOR_RED);
+		if (k < wLit || (k == wPeak && s->ucPeak[SPECTRUM_BANDS]))
+			rLed[spectrum_pixel(lSeg, k)] = rColor;
+		else
+			rLed[spectrum_pixel(lSeg, k)] = COLOR_BLANK;
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Draws the last analysed block on ucSegNum segments
+ * @details In SPECTRUM_BARS the bands are split evenly over the segments,
+ *          segment 0 gets the lowest.
+ */
+void spectrum_render(SpectrumTypeDef *s, rgb_color *rLed, const LedTypeDef *lSeg, uint8_t ucSegNum, SpectrumMode eMode)
+{
+	uint8_t i, ucFirst;
+
+	for (i = 0; i < ucSegNum; i++)
+	{
+		if (eMode == SPECTRUM_BARS)
+		{
+			ucFirst = (i * SPECTRUM_BANDS) / ucSegNum;
+			spectrum_bar(s, rLed, &lSeg[i], ucFirst, ((i + 1) * SPECTRUM_BANDS) / ucSegNum - ucFirst);
+		}
+		else if (eMode == SPECTRUM_VU)
+		{
+			spectrum_vu(s, rLed, &lSeg[i]);
+		}
+	}
+}
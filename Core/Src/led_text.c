@@ -0,0 +1,195 @@
+#include <string.h>
+#include "main.h"
+#include "led_text.h"
+
+
+// Column packed, bit 0 = top row
+static const uint8_t ucFont[TEXT_LAST - TEXT_FIRST + 1][TEXT_GLYPH_W] = {
+	{0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00},   //   !
+	{0x00, 0x07, 0x00, 0x07, 0x00}, {0x14, 0x7F, 0x14, 0x7F, 0x14},   // " #
+	{0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62},   // $ %
+	{0x36, 0x49, 0x56, 0x20, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00},   // & '
+	{0x00, 0x1C, 0x22, 0x41, 0x00}, {0x00, 0x41, 0x22, 0x1C, 0x00},   // ( )
+	{0x14, 0x08, 0x3E, 0x08, 0x14}, {0x08, 0x08, 0x3E, 0x08, 0x08},   // * +
+	{0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08},   // , -
+	{0x00, 0x60, 0x60, 0x00, 0x00}, {0x20, 0x10, 0x08, 0x04, 0x02},   // . /
+	{0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00},   // 0 1
+	{0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4B, 0x31},   // 2 3
+	{0x18, 0x14, 0x12, 0x7F, 0x10}, {0x27, 0x45, 0x45, 0x45, 0x39},   // 4 5
+	{0x3C, 0x4A, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03},   // 6 7
+	{0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1E},   // 8 9
+	{0x00, 0x36, 0x36, 0x00, 0x00}, {0x00, 0x56, 0x36, 0x00, 0x00},   // : ;
+	{0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14},   // < =
+	{0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06},   // > ?
+	{0x32, 0x49, 0x79, 0x41, 0x3E}, {0x7E, 0x11, 0x11, 0x11, 0x7E},   // @ A
+	{0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22},   // B C
+	{0x7F, 0x41, 0x41, 0x22, 0x1C}, {0x7F, 0x49, 0x49, 0x49, 0x41},   // D E
+	{0x7F, 0x09, 0x09, 0x09, 0x01}, {0x3E, 0x41, 0x49, 0x49, 0x7A},   // F G
+	{0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00},   // H I
+	{0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41},   // J K
+	{0x7F, 0x40, 0x40, 0x40, 0x40}, {0x7F, 0x02, 0x0C, 0x02, 0x7F},   // L M
+	{0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E},   // N O
+	{0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E},   // P Q
+	{0x7F, 0x09, 0x19, 0x29, 0x46}, {0x46, 0x49, 0x49, 0x49, 0x31},   // R S
+	{0x01, 0x01, 0x7F, 0x01, 0x01}, {0x3F, 0x40, 0x40, 0x40, 0x3F},   // T U
+	{0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F},   // V W
+	{0x63, 0x14, 0x08, 0x14, 0x63}, {0x07, 0x08, 0x70, 0x08, 0x07},   // X Y
+	{0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x00},   // Z [
+	{0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7F, 0x00},   // \ ]
+	{0x04, 0x02, 0x01, 0x02, 0x04}, {0x40, 0x40, 0x40, 0x40, 0x40},   // ^ _
+	{0x00, 0x01, 0x02, 0x04, 0x00}, {0x20, 0x54, 0x54, 0x54, 0x78},   // ` a
+	{0x7F, 0x48, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x20},   // b c
+	{0x38, 0x44, 0x44, 0x48, 0x7F}, {0x38, 0x54, 0x54, 0x54, 0x18},   // d e
+	{0x08, 0x7E, 0x09, 0x01, 0x02}, {0x0C, 0x52, 0x52, 0x52, 0x3E},   // f g
+	{0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00},   // h i
+	{0x20, 0x40, 0x44, 0x3D, 0x00}, {0x7F, 0x10, 0x28, 0x44, 0x00},   // j k
+	{0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x18, 0x04, 0x78},   // l m
+	{0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38},   // n o
+	{0x7C, 0x14, 0x14, 0x14, 0x08}, {0x08, 0x14, 0x14, 0x18, 0x7C},   // p q
+	{0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x20},   // r s
+	{0x04, 0x3F, 0x44, 0x40, 0x20}, {0x3C, 0x40, 0x40, 0x20, 0x7C},   // t u
+	{0x1C, 0x20, 0x40, 0x20, 0x1C}, {0x3C, 0x40, 0x30, 0x40, 0x3C},   // v w
+	{0x44, 0x28, 0x10, 0x28, 0x44}, {0x0C, 0x50, 0x50, 0x50, 0x3C},   // x y
+	{0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00},   // z {
+	{0x00, 0x00, 0x7F, 0x00, 0x00}, {0x00, 0x41, 0x36, 0x08, 0x00},   // | }
+	{0x10, 0x08, 0x08, 0x10, 0x08},                                   // ~
+};
+
+static MatrixTypeDef     *pPanel;
+static uint8_t            ucTextTop;                   // Panel row of the glyph top
+static rgb_color          rBack;
+
+static uint8_t            ucText[2][TEXT_MAX];         // Double buffered, text_set() fills the back one
+static uint8_t            ucTextLen[2];
+static rgb_color          rFore[2];
+static volatile uint8_t   ucFront;                     // Message owned by text_step()
+static volatile uint8_t   ucPend;                      // Back buffer holds a new message
+
+static const uint8_t     *pGlyph;                      // Glyph of the character being drawn
+static uint8_t            ucIdx;                       // Character being drawn
+static uint8_t            ucCol;                       // Column within its cell
+static uint16_t           wGap;                        // Blank columns left before the message repeats
+
+
+// ==================================================================================
+static const uint8_t *text_glyph(uint8_t ucChar)
+{
+	if (ucChar < TEXT_FIRST || ucChar > TEXT_LAST)
+		ucChar = '?';
+	return ucFont[ucChar - TEXT_FIRST];
+}
+
+// ==================================================================================
+/**
+ * @brief  Binds the scroller to a panel, the message is kept
+ * @param   mMat   Panel, already set up by matrix_init()
+ * @param   ucTop  Row of the glyph top, rows outside the glyph get rBg
+ * @param   rBg    Background color
+ */
+void text_init(MatrixTypeDef *mMat, uint8_t ucTop, rgb_color rBg)
+{
+	pPanel    = mMat;
+	ucTextTop = ucTop;
+	rBack     = rBg;
+	ucIdx     = 0;
+	ucCol     = 0;
+	wGap      = 0;
+}
+
+// ==================================================================================
+/**
+ * @brief  Replaces the message, safe to call from an interrupt
+ * @details The new message starts entering the panel on the next text_step(),
+ *          right behind what is already shown. ucNum 0 stops the scroller.
+ *
+ * @return 0 if the message is too long
+ */
+uint8_t text_set(const uint8_t *pText, uint8_t ucNum, rgb_color rColor)
+{
+	uint32_t ulPrimask;
+	uint8_t  ucBack;
+
+	if (ucNum > TEXT_MAX)
+		return 0;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();
+	ucBack = ucFront ^ 1;
+	memcpy(ucText[ucBack], pText, ucNum);
+	ucTextLen[ucBack] = ucNum;
+	rFore[ucBack]     = rColor;
+	ucPend = 1;
+	__set_PRIMASK(ulPrimask);
+	return 1;
+}
+
+// ==================================================================================
+/**
+ * @brief  Returns 1 while there is a message to scroll
+ */
+uint8_t text_active(void)
+{
+	uint32_t ulPrimask;
+	uint8_t  ucOn;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();
+	ucOn = ucTextLen[ucPend ? ucFront ^ 1 : ucFront] != 0;
+	__set_PRIMASK(ulPrimask);
+	return ucOn;
+}
+
+// ==================================================================================
+/**
+ * @brief  Scrolls the panel one column left and draws the column that enters
+ * @details Only the new column is rasterized, so a step costs one panel scroll
+ *          plus one glyph column whatever the message length. After the last
+ *          character the panel runs empty before the message starts again.
+ */
+void text_step(rgb_color *rLed)
+{
+	uint32_t ulPrimask;
+	uint8_t  ucBits = 0;
+	uint8_t  ucLen;
+
+	if (ucPend)
+	{
+		ulPrimask = __get_PRIMASK();
+		__disable_irq();
+		ucFront ^= 1;
+		ucPend   = 0;
+		__set_PRIMASK(ulPrimask);
+		ucIdx = 0;
+		ucCol = 0;
+		wGap  = 0;
+	}
+
+	ucLen = ucTextLen[ucFront];
+	if (!pPanel || !ucLen)
+		return;
+
+	if (wGap)
+	{
+		wGap--;
+	}
+	else
+	{
+		if (!ucCol)
+			pGlyph = text_glyph(ucText[ucFront][ucIdx]);
+		if (ucCol < TEXT_GLYPH_W)
+			ucBits = pGlyph[ucCol];
+
+		if (++ucCol == TEXT_GLYPH_W + TEXT_SPACING)
+		{
+			ucCol = 0;
+			if (++ucIdx == ucLen)
+			{
+				ucIdx = 0;
+				wGap  = pPanel->ucWidth;
+			}
+		}
+	}
+
+	matrix_scroll_left(rLed, pPanel, rBack);
+	matrix_set_col_mask(rLed, pPanel, pPanel->ucWidth - 1, (uint32_t)ucBits << ucTextTop, rFore[ucFront], rBack);
+}
@@ -18,7 +18,11 @@
 /* USER CODE END Header */
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
+#include "adc.h"
+#include "crc.h"
+#include "dma.h"
 #include "spi.h"
+#include "tim.h"
 #include "usart.h"
 #include "gpio.h"
 
@@ -28,6 +32,15 @@
 #include "led_conf.h"
 #include "led_move.h"
 #include "otimers.h"
+#include "key.h"
+#include "stream.h"
+#include "tlog.h"
+#include "cfg.h"
+#include "led_matrix.h"
+#include "led_text.h"
+#include "sync.h"
+#include "audio.h"
+#include "led_particle.h"
 
 /* USER CODE END Includes */
 
@@ -58,6 +71,9 @@ extern volatile uint8_t gucKeyMode,
 rgb_color       rLed_Data[MAX_NUMB];
 int brightness = 30;
 
+static uint16_t      wPanelMap[MATRIX_WIDTH * MATRIX_HEIGHT];
+static MatrixTypeDef mPanel;
+
 
 
 /* USER CODE END PV */
@@ -70,6 +86,114 @@ void SystemClock_Config(void);
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+// ==================================================================================
+/**
+ * @brief  Runs one animation step of segment ucSeg
+ * @return 1 when the segment finished a cycle
+ */
+static uint8_t seg_step(LedTypeDef *lLed, uint8_t ucSeg)
+{
+	if (ucSeg == ONE)
+		return led_shift_left_num(rLed_Data, lLed, SET, 3);
+	return led_shift_right_num(rLed_Data, lLed, SET, 4);
+}
+
+// ==================================================================================
+/**
+ * @brief  Puts restarted segments in phase with network time
+ * @details Step n of a segment belongs to network ms n * period, on every
+ *          board. A restarted segment runs one cycle to measure its length,
+ *          restarts and catches up to the step of the current network ms.
+ *          Its timer then expires on the next step boundary.
+ *
+ * @param  ucMask    Segments to put in phase, bit n = segment n
+ * @param  ulPeriod  Step period of every segment, ms
+ */
+static void seg_phase(uint8_t ucMask, LedTypeDef *lLed, const uint32_t *ulPeriod)
+{
+	uint32_t ulCycle, ulSteps;
+	uint8_t  loop;
+
+	for (loop = 0; loop < 3; loop++)
+	{
+		if (!(ucMask & (1 << loop)))
+			continue;
+
+		led_color_init(rLed_Data, &lLed[loop]);
+		for (ulCycle = 1; !seg_step(&lLed[loop], loop) && ulCycle < 4 * MAX_NUMB; ulCycle++)
+			;
+		led_color_init(rLed_Data, &lLed[loop]);
+
+		for (ulSteps = (sync_now() / ulPeriod[loop]) % ulCycle; ulSteps; ulSteps--)
+			seg_step(&lLed[loop], loop);
+		load_timer(loop, sync_until(ulPeriod[loop]));
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Reports whether a flash page erase may stop the core now
+ * @details Nothing runs for CFG_ERASE_MS, so the link has to be quiet and
+ *          nothing timed by SysTick may be in flight, see cfg.h.
+ */
+static uint8_t cfg_erase_ok(void)
+{
+	return stream_quiet() >= CFG_QUIET_MS && key_idle() && !sync_shared();
+}
+
+// ==================================================================================
+/**
+ * @brief  Applies changed settings from the config store
+ * @details A segment is only taken over if it is valid, otherwise the one in
+ *          sSeg stays. The old range is blanked before the segment restarts.
+ *
+ * @param  wKeys  Changed keys, bit n = key n (cfg_changes())
+ * @return Restarted segments, bit n = segment n, for seg_phase()
+ */
+static uint8_t cfg_apply(uint16_t wKeys, CfgSegDef *sSeg, LedTypeDef *lLed)
+{
+	CfgSegDef sCfg;
+	uint8_t   ucBright, ucRole, ucMode, loop;
+	uint8_t   uOut = 0;
+	int16_t   i;
+
+	if ((wKeys & (1 << CFG_KEY_BRIGHT)) && cfg_get(CFG_KEY_BRIGHT, &ucBright, sizeof(ucBright)))
+		brightness = ucBright;
+
+	if ((wKeys & (1 << CFG_KEY_SYNC)) && cfg_get(CFG_KEY_SYNC, &ucRole, sizeof(ucRole)))
+		sync_set_master(ucRole == 1);
+
+	if ((wKeys & (1 << CFG_KEY_AUDIO)) && cfg_get(CFG_KEY_AUDIO, &ucMode, sizeof(ucMode)))
+		audio_set_mode(ucMode);
+
+	for (loop = 0; loop < 3; loop++)
+	{
+		if (!(wKeys & (1 << (CFG_KEY_SEG0 + loop))))
+			continue;
+
+		if (cfg_get(CFG_KEY_SEG0 + loop, &sCfg, sizeof(sCfg)) == sizeof(sCfg) &&
+		    sCfg.wStart <= sCfg.wEnd && sCfg.wEnd < MAX_NUMB &&
+		    (sCfg.ucDir == SHIFT_LEFT || sCfg.ucDir == SHIFT_RIGHT))
+			sSeg[loop] = sCfg;
+
+		for (i = lLed[loop].wPosStart; i <= lLed[loop].wPosEnd; i++)
+			rLed_Data[i] = COLOR_BLANK;
+
+		lLed[loop].wPosStart  = sSeg[loop].wStart;
+		lLed[loop].wPosEnd    = sSeg[loop].wEnd;
+		lLed[loop].rColorOri  = sSeg[loop].rColorOri;
+		lLed[loop].rColorFill = sSeg[loop].rColorFill;
+		lLed[loop].sDir       = (StateDir)sSeg[loop].ucDir;
+		if (lLed[loop].sDir == SHIFT_LEFT)
+			lLed[loop].wPosCurr = sSeg[loop].wStart;
+		else
+			lLed[loop].wPosCurr = sSeg[loop].wEnd;
+
+		led_color_init(rLed_Data, &lLed[loop]);
+		uOut |= 1 << loop;
+	}
+	return uOut;
+}
 
 /* USER CODE END 0 */
 
@@ -81,19 +205,31 @@ int main(void)
 {
 
   /* USER CODE BEGIN 1 */
-	LedTypeDef lLed_Data[3];
-
-	uint16_t wStart[3]  = {  0,  20, 40};
-	uint16_t wEnd[3]    = { 19, 39, 79};
-	
-	uint32_t ulTime[] = {500, 500, 500, 20};
+	LedTypeDef lLed_Data[3] = {0};
+
+	// Defaults, replaced by CFG_KEY_SEG0..2 from the config store
+	CfgSegDef sSeg[3] = {
+		{  0, 19, SHIFT_RIGHT, COLOR_RED,   COLOR_YELLOW },
+		{ 20, 39, SHIFT_LEFT,  COLOR_BLUE,  COLOR_BLANK  },
+		{ 40, 79, SHIFT_LEFT,  COLOR_GREEN, COLOR_WHITE  },
+	};
 	
-	StateDir sDir[3]   = {SHIFT_RIGHT, SHIFT_LEFT, SHIFT_LEFT};
-	rgb_color  rClrOri[3] = { COLOR_RED, COLOR_BLUE, COLOR_GREEN };
-	rgb_color  rClrNew[3] = { COLOR_YELLOW, COLOR_BLANK, COLOR_WHITE};
+	uint32_t ulTime[] = {500, 500, 500, 20, TEXT_STEP_MS};
+	uint32_t ulIdle;
 
 	int i=0;
 
+	rgb_color *rLed_Stream;
+	uint16_t   wStreamNum;
+	uint8_t    ucStreamOn = 0;
+	uint8_t    ucTextOn = 0;
+	uint8_t    ucAudioOn = 0;
+	uint8_t    ucSparkOn = 0;
+	uint8_t    ucKeyMode = KEY_MODE_AUTO;
+	uint16_t   wCfgKeys = 0xFFFF;           // Keys the segment path may apply
+	uint8_t    ucPhase, ucStep;
+	uint32_t   ulStat[3];
+
   /* USER CODE END 1 */
 
   /* MCU Configuration--------------------------------------------------------*/
@@ -114,9 +250,21 @@ int main(void)
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
+  MX_DMA_Init();
   MX_SPI1_Init();
   MX_USART1_UART_Init();
+  MX_CRC_Init();
+  MX_ADC_Init();
+  MX_TIM3_Init();
   /* USER CODE BEGIN 2 */
+  tlog_init();
+  tlog_write(TLOG_ID_BOOT, &SystemCoreClock, sizeof(SystemCoreClock));
+  cfg_init();
+  key_init();
+  sync_init();
+  stream_init();
+  audio_init();
+
 	// Clear all display, fill with color blank
   for (i=0; i<MAX_NUMB; i++)
 	  rLed_Data[i] = COLOR_BLANK;
@@ -124,27 +272,17 @@ int main(void)
   HAL_Delay(50);
   WS2812_Send();    // Make sure data is blank
 	
-	// Copy parameters to lLedData
-  for (i = 0; i<3; i++)
-  {
-	  lLed_Data[i].wPosStart  = wStart[i];
-	  lLed_Data[i].wPosEnd    = wEnd[i];
-	  lLed_Data[i].rColorOri  = rClrOri[i];
-	  lLed_Data[i].rColorFill = rClrNew[i];
-	  lLed_Data[i].sDir       = sDir[i];
-		if (sDir[i] == SHIFT_LEFT)
-		  lLed_Data[i].wPosCurr   = wStart[i];
-		else
-		  lLed_Data[i].wPosCurr   = wEnd[i];
-  }
+	// Copy parameters to lLedData and init all color
+  ucPhase = cfg_apply(0xFFFF, sSeg, lLed_Data);
 
-  // Init all color
-  for (i=0; i<3; i++)
-    led_color_init(rLed_Data, &lLed_Data[i]);
+  // The strip doubles as a panel for the ticker (STREAM_TYPE_TEXT)
+  matrix_init(&mPanel, wPanelMap, MATRIX_WIDTH, MATRIX_HEIGHT, MATRIX_WIRING, 0);
+  text_init(&mPanel, (MATRIX_HEIGHT - TEXT_GLYPH_H) / 2, COLOR_BLANK);
 
 //// ================================================= Init roda	
-	for (i=0; i<4; i++)
-	  load_timer(i, ulTime[i]);
+	for (i=0; i<5; i++)
+	  load_timer(i, sync_until(ulTime[i]));
+	seg_phase(ucPhase, lLed_Data, ulTime);
 		
 
   /* USER CODE END 2 */
@@ -154,25 +292,153 @@ int main(void)
   while (1)
   {
 		HAL_GPIO_TogglePin(GPIOC, GPIO_PIN_13);
-		if (check_timer(0) == TIMER_TIMEOUT)
+		read_key();
+		sync_poll();
+		tlog_poll();
+
+		// The mode key picks what may drive the strip. Sampling stops for
+		// segments and sparks, the spectrum setting comes back with the next mode.
+		if (gucKeyMode != ucKeyMode)
 		{
-			load_timer(0, ulTime[0]);
-			led_shift_right_num(rLed_Data, &lLed_Data[ZERO],SET, 4);
+			if (gucKeyMode == KEY_MODE_SEGMENT || gucKeyMode == KEY_MODE_SPARK)
+				audio_set_mode(SPECTRUM_OFF);
+			else if (ucKeyMode == KEY_MODE_SEGMENT || ucKeyMode == KEY_MODE_SPARK)
+				cfg_apply(1 << CFG_KEY_AUDIO, sSeg, lLed_Data);
+			ucKeyMode = gucKeyMode;
+			wCfgKeys  = (ucKeyMode == KEY_MODE_SEGMENT || ucKeyMode == KEY_MODE_SPARK) ?
+			            (uint16_t)~(1 << CFG_KEY_AUDIO) : 0xFFFF;
 		}
 
-		if (check_timer(1) == TIMER_TIMEOUT)
+		// Host frames take over the strip while they keep arriving
+		if (ucKeyMode == KEY_MODE_AUTO && stream_active())
 		{
-			load_timer(1, ulTime[1]);
-			led_shift_left_num(rLed_Data, &lLed_Data[ONE],SET, 3);
+			ucStreamOn = 1;
+			if (stream_swap())          // Full frames and deltas alike
+			{
+				rLed_Stream = stream_front(&wStreamNum);
+				WS2812_Send_Data(rLed_Stream, wStreamNum);
+			}
+			continue;
 		}
-		
+		if (ucStreamOn)                 // Report the session once the host goes quiet
+		{
+			ucStreamOn = 0;
+			ulStat[0] = sStreamStat.ulFrames;
+			ulStat[1] = sStreamStat.ulCrcErr;
+			ulStat[2] = sStreamStat.ulDropped;
+			tlog_write(TLOG_ID_STREAM, ulStat, sizeof(ulStat));
+		}
+
+		// A host message replaces the segment animation until it is cleared.
+		// Segment keys wait for the way back, cfg_apply() would draw over the text.
+		if (ucKeyMode == KEY_MODE_AUTO && text_active())
+		{
+			if (!ucTextOn)
+			{
+				ucTextOn = 1;
+				matrix_fill(rLed_Data, &mPanel, COLOR_BLANK);
+			}
+			cfg_apply(cfg_changes() & ((1 << CFG_KEY_BRIGHT) | (1 << CFG_KEY_SYNC) | (1 << CFG_KEY_AUDIO)), sSeg, lLed_Data);
+
+			if (check_timer(4) == TIMER_TIMEOUT)
+			{
+				load_timer(4, sync_until(ulTime[4]));
+				text_step(rLed_Data);
+				WS2812_Send();
+			}
+			cfg_poll(read_timer(4), cfg_erase_ok());
+			continue;
+		}
+		ucPhase = 0;
+		if (ucTextOn)                   // Segments restart from their settings
+		{
+			ucTextOn = 0;
+			matrix_fill(rLed_Data, &mPanel, COLOR_BLANK);
+			ucPhase = cfg_apply(wCfgKeys, sSeg, lLed_Data);
+		}
+
+		// Sparks own the whole strip, one frame per timer 3 period.
+		// Segment keys wait for the way back like with the text.
+		if (ucKeyMode == KEY_MODE_SPARK)
+		{
+			if (!ucSparkOn)
+			{
+				ucSparkOn = 1;
+				particle_init();
+				for (i = 0; i < MAX_NUMB; i++)
+					rLed_Data[i] = COLOR_BLANK;
+			}
+			cfg_apply(cfg_changes() & ((1 << CFG_KEY_BRIGHT) | (1 << CFG_KEY_SYNC)), sSeg, lLed_Data);
+
+			if (check_timer(3) == TIMER_TIMEOUT)
+			{
+				load_timer(3, ulTime[3]);
+				particle_spark(rLed_Data, MAX_NUMB);
+				WS2812_Send();
+			}
+			cfg_poll(read_timer(3), cfg_erase_ok());
+			continue;
+		}
+		if (ucSparkOn)                  // Report the session, segments restart
+		{
+			ucSparkOn = 0;
+			ulStat[0] = sParticleStat.ulFrames;
+			ulStat[1] = sParticleStat.ulClkLast;
+			ulStat[2] = sParticleStat.ulClkMax;
+			tlog_write(TLOG_ID_SPARK, ulStat, sizeof(ulStat));
+			for (i = 0; i < MAX_NUMB; i++)
+				rLed_Data[i] = COLOR_BLANK;
+			ucPhase |= cfg_apply(wCfgKeys, sSeg, lLed_Data);
+		}
+
+		// The spectrum draws over the segment ranges, one frame per audio block.
+		// Flash work gets less than a block, so page erases wait for the way back.
+		if (audio_mode() != SPECTRUM_OFF)
+		{
+			ucAudioOn = 1;
+			cfg_apply(cfg_changes() & ((1 << CFG_KEY_BRIGHT) | (1 << CFG_KEY_SYNC) | (1 << CFG_KEY_AUDIO)), sSeg, lLed_Data);
+			if (audio_poll(rLed_Data, lLed_Data, 3))
+				WS2812_Send();
+			cfg_poll(AUDIO_BLOCK_MS, cfg_erase_ok());
+			continue;
+		}
+		if (ucAudioOn)                  // Report the session, segments restart
+		{
+			ucAudioOn = 0;
+			ulStat[0] = sAudioStat.ulBlocks;
+			ulStat[1] = sAudioStat.ulOverrun;
+			ulStat[2] = sAudioStat.ulClkMax;
+			tlog_write(TLOG_ID_AUDIO, ulStat, sizeof(ulStat));
+			ucPhase |= cfg_apply(wCfgKeys, sSeg, lLed_Data);
+		}
+
+		ucPhase |= cfg_apply(cfg_changes() & wCfgKeys, sSeg, lLed_Data);
+		if (sync_stepped())             // Network time jumped, every segment catches up
+			ucPhase = 0x07;
+		seg_phase(ucPhase, lLed_Data, ulTime);
 
-		if (check_timer(2) == TIMER_TIMEOUT)
+		// Timers reload to the next network step boundary, so boards in sync
+		// step together; the strip is latched right away for the same reason.
+		ucStep = 0;
+		for (i = 0; i < 3; i++)
 		{
-			load_timer(2, ulTime[2]);
-			
-			led_shift_right_num(rLed_Data, &lLed_Data[TWO],SET, 4);
+			if (check_timer(i) == TIMER_TIMEOUT)
+			{
+				load_timer(i, sync_until(ulTime[i]));
+				seg_step(&lLed_Data[i], i);
+				ucStep = 1;
+			}
 		}
+		if (ucStep)
+			WS2812_Send();
+
+		// Flash work only runs until the next animation step; skipping a refresh
+		// of timer 3 is invisible because the strip holds its last frame.
+		ulIdle = read_timer(0);
+		for (i = 1; i < 3; i++)
+			if (read_timer(i) < ulIdle)
+				ulIdle = read_timer(i);
+		cfg_poll(ulIdle, cfg_erase_ok());
 				
 	
     /* USER CODE END WHILE */
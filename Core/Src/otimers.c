@@ -1,34 +1,57 @@
 #include "main.h"
 
-#define MAX_TIMERS        	4
-
 timers timer_block[MAX_TIMERS];
 
 // ==================================================================================
-void update_timers (void)
+// Block functions work on any array of timers, a host simulation gives every
+// virtual controller its own. The functions below them use timer_block.
+// ==================================================================================
+void update_timer_block (timers *pBlock, uint8_t ucNum)
 {
 	uint8_t loop;
 
-  for (loop = 0; loop < MAX_TIMERS; loop++)
+  for (loop = 0; loop < ucNum; loop++)
   {
-    if (timer_block[loop].timer_state == TIMER_RUNNING)
+    if (pBlock[loop].timer_state == TIMER_RUNNING)
     {
-      if (timer_block[loop].timer_value){ // if timer value is non-zero
-        if (!--timer_block[loop].timer_value)
-          timer_block[loop].timer_state = TIMER_TIMEOUT;
+      if (pBlock[loop].timer_value){ // if timer value is non-zero
+        if (!--pBlock[loop].timer_value)
+          pBlock[loop].timer_state = TIMER_TIMEOUT;
       }
     }
   }
 }
+// ==================================================================================
+void load_timer_block (timers *pBlock, uint8_t timer_id, uint32_t timer_val){
+  pBlock[timer_id].timer_value = timer_val;
+  pBlock[timer_id].timer_state = TIMER_RUNNING;
+}
+// ==================================================================================
+char check_timer_block (timers *pBlock, uint8_t timer_id){
+  return (pBlock[timer_id].timer_state);
+}
+// ==================================================================================
+uint32_t read_timer_block (timers *pBlock, uint8_t timer_id){
+  return (pBlock[timer_id].timer_value);
+}
+
+// ==================================================================================
+void update_timers (void)
+{
+  update_timer_block(timer_block, MAX_TIMERS);
+}
 
 // ==================================================================================
 void load_timer (uint8_t timer_id, uint32_t timer_val){
-  timer_block[timer_id].timer_value = timer_val;
-  start_timer(timer_id);
+  load_timer_block(timer_block, timer_id, timer_val);
 }
 // ==================================================================================
 char check_timer (uint8_t timer_id){
-  return (timer_block[timer_id].timer_state);
+  return check_timer_block(timer_block, timer_id);
+}
+// ==================================================================================
+uint32_t read_timer (uint8_t timer_id){
+  return read_timer_block(timer_block, timer_id);
 }
 // ==================================================================================
 void start_timer (uint8_t timer_id){
@@ -0,0 +1,144 @@
+#include "main.h"
+#include "stream.h"
+#include "stream_parse.h"
+#include "crc.h"
+#include "cfg.h"
+#include "led_text.h"
+#include "sync.h"
+
+extern UART_HandleTypeDef huart1;
+
+static uint8_t       ucRxRing[STREAM_RX_SIZE];        // Circular DMA target
+static uint16_t      wRxTail;                         // Next ring byte to parse
+static volatile uint32_t ulRxLast;                    // Tick of the last event that brought bytes
+static StreamTypeDef sStream;                         // Parser of the USART1 stream
+
+StreamStatDef sStreamStat;
+
+
+// ==================================================================================
+static void stream_restart(void)
+{
+	sStream.sState = ST_SYNC0;
+	wRxTail = 0;
+	HAL_UARTEx_ReceiveToIdle_DMA(&huart1, ucRxRing, STREAM_RX_SIZE);
+}
+
+// ==================================================================================
+/**
+ * @brief  Checked packets that do not take over the strip
+ */
+static void stream_other(uint8_t ucType, const uint8_t *pData, uint16_t wLen)
+{
+	switch (ucType)
+	{
+		case STREAM_TYPE_CONFIG:
+			cfg_set(pData[0], &pData[1], wLen - 1);
+			break;
+
+		case STREAM_TYPE_TEXT:                        // Ticker runs from the main loop
+			text_set(&pData[3], wLen - 3, (rgb_color){ pData[0], pData[1], pData[2] });
+			break;
+
+		case STREAM_TYPE_SYNC:                        // Timestamps keep the local animation
+			sync_rx(pData);
+			break;
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Starts circular DMA reception on USART1
+ * @note   Call after MX_DMA_Init(), MX_USART1_UART_Init() and MX_CRC_Init().
+ */
+void stream_init(void)
+{
+	stream_parse_init(&sStream, MAX_NUMB, &hcrc, &sStreamStat, stream_other);
+	stream_restart();
+}
+
+// ==================================================================================
+/**
+ * @brief  Parses everything the DMA wrote since the last event
+ * @param  wPos  DMA write position in the ring (HT, TC or IDLE event)
+ */
+void stream_rx_event(uint16_t wPos)
+{
+	uint32_t ulNow = HAL_GetTick();
+
+	if (wPos != wRxTail)
+		ulRxLast = ulNow;
+	if (wPos > wRxTail)
+	{
+		stream_parse(&sStream, &ucRxRing[wRxTail], wPos - wRxTail, ulNow);
+	}
+	else if (wPos < wRxTail)
+	{
+		stream_parse(&sStream, &ucRxRing[wRxTail], STREAM_RX_SIZE - wRxTail, ulNow);
+		stream_parse(&sStream, &ucRxRing[0], wPos, ulNow);
+	}
+	wRxTail = (wPos == STREAM_RX_SIZE) ? 0 : wPos;
+}
+
+// ==================================================================================
+/**
+ * @brief  Reports whether a host is currently streaming frames
+ */
+uint8_t stream_active(void)
+{
+	return stream_parse_active(&sStream, HAL_GetTick());
+}
+
+// ==================================================================================
+/**
+ * @brief  Reports how long USART1 has received nothing
+ * @details Bytes the DMA wrote after the last event, in the middle of a
+ *          packet, count as traffic too.
+ * @return ms since the last byte, 0 while one is still waiting in the ring
+ */
+uint32_t stream_quiet(void)
+{
+	uint32_t ulPrimask, ulOut = 0;
+	uint16_t wPos;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();
+	wPos = (STREAM_RX_SIZE - __HAL_DMA_GET_COUNTER(huart1.hdmarx)) % STREAM_RX_SIZE;
+	if (wPos == wRxTail)
+		ulOut = HAL_GetTick() - ulRxLast;
+	__set_PRIMASK(ulPrimask);
+	return ulOut;
+}
+
+// ==================================================================================
+/**
+ * @brief  Makes the newest frame, full or patched by deltas, the front buffer
+ * @return 1 if a new frame was swapped in, 0 if nothing new arrived
+ */
+uint8_t stream_swap(void)
+{
+	return stream_parse_swap(&sStream);
+}
+
+// ==================================================================================
+/**
+ * @brief  Returns the front buffer and its pixel count
+ */
+rgb_color *stream_front(uint16_t *wNum)
+{
+	return stream_parse_front(&sStream, wNum);
+}
+
+// ==================================================================================
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+	if (huart->Instance == USART1)
+		stream_rx_event(Size);
+}
+
+// ==================================================================================
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+	if (huart->Instance == USART1 && huart->RxState == HAL_UART_STATE_READY)
+		stream_restart();                             // Reception was aborted (overrun)
+}
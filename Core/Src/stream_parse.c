@@ -0,0 +1,315 @@
+#include <string.h>
+#include "main.h"
+#include "stream_parse.h"
+#include "cfg.h"
+#include "led_text.h"
+#include "sync.h"
+
+
+// ==================================================================================
+/**
+ * @brief  Checks the header and selects where the payload goes
+ * @return 1 if the packet is accepted, 0 to resync
+ */
+static uint8_t stream_header(StreamTypeDef *s)
+{
+	s->wLen = s->ucHdr[1] | (s->ucHdr[2] << 8);
+	s->ucPre = 0;
+
+	switch (s->ucHdr[0])
+	{
+		case STREAM_TYPE_FRAME:
+			if (s->wLen < STREAM_SEQ_LEN || s->wLen > STREAM_SEQ_LEN + STREAM_MAX_LED * 3 ||
+			    (s->wLen - STREAM_SEQ_LEN) % 3)
+				return 0;
+			if (s->ucReady)                           // Render loop did not take the last image
+			{
+				s->ucReady = 0;
+				s->pStat->ulDropped++;
+			}
+			s->pPayload = (uint8_t *)s->rFrame[s->ucFront ^ 1];
+			s->ucPre = STREAM_SEQ_LEN;
+			return 1;
+
+		case STREAM_TYPE_DELTA:
+			if (s->wLen < STREAM_DELTA_HDR || s->wLen > STREAM_DELTA_MAX)
+				return 0;
+			s->pPayload = s->ucDelta;
+			return 1;
+
+		case STREAM_TYPE_CONFIG:
+			if (s->wLen < 2 || s->wLen > 1 + CFG_VALUE_MAX)
+				return 0;
+			s->pPayload = s->ucDelta;
+			return 1;
+
+		case STREAM_TYPE_TEXT:
+			if (s->wLen < 3 || s->wLen > 3 + TEXT_MAX)
+				return 0;
+			s->pPayload = s->ucDelta;
+			return 1;
+
+		case STREAM_TYPE_SYNC:
+			if (s->wLen != SYNC_PAYLOAD_LEN)
+				return 0;
+			s->pPayload = s->ucDelta;
+			return 1;
+	}
+	return 0;
+}
+
+// ==================================================================================
+/**
+ * @brief  Decodes a checked delta packet into the back buffer and times it
+ * @details The packet patches the newest image, which must be its BASE. If
+ *          the back buffer does not hold one waiting for stream_parse_swap(),
+ *          the front image is copied into it first; the render loop keeps
+ *          reading the front meanwhile.
+ * @note   SysTick counts core clocks down from LOAD, so the difference of two
+ *         VAL reads is exact for decodes shorter than one tick (1 ms). The
+ *         time includes the copy.
+ */
+static void stream_delta(StreamTypeDef *s)
+{
+	StreamStatDef *pStat = s->pStat;
+	uint8_t  ucBack = s->ucFront ^ 1;
+	uint32_t ulStart, ulEnd, ulClk;
+	uint32_t ulBase = s->ucDelta[2] | (s->ucDelta[3] << 8);
+	uint8_t  uOk;
+
+	// The image it was made against was lost, patching another one shows garbage
+	if (s->ulSeq[s->ucReady ? ucBack : s->ucFront] != ulBase)
+	{
+		pStat->ulDeltaErr++;
+		return;
+	}
+
+	ulStart = SysTick->VAL;
+	if (!s->ucReady)
+	{
+		s->wFrameNum[ucBack] = s->wFrameNum[s->ucFront];
+		memcpy(s->rFrame[ucBack], s->rFrame[s->ucFront], s->wFrameNum[ucBack] * sizeof(rgb_color));
+	}
+	uOk = led_delta_decode(&s->dDelta, s->rFrame[ucBack], s->wFrameNum[ucBack],
+	                       &s->ucDelta[STREAM_DELTA_HDR], s->wLen - STREAM_DELTA_HDR);
+	ulEnd = SysTick->VAL;
+
+	ulClk = (ulStart >= ulEnd) ? ulStart - ulEnd : ulStart + SysTick->LOAD + 1 - ulEnd;
+	pStat->ulDecodeLast = ulClk;
+	if (ulClk > pStat->ulDecodeMax)
+		pStat->ulDecodeMax = ulClk;
+
+	pStat->wDeltaLast    = 2 + STREAM_HDR_LEN + s->wLen + STREAM_CRC_LEN;
+	pStat->ulDeltaBytes += pStat->wDeltaLast;
+
+	// A half patched image is not shown and patches no further delta
+	if (uOk)
+	{
+		s->ulSeq[ucBack] = s->ucDelta[0] | (s->ucDelta[1] << 8);
+		pStat->ulDeltaFrames++;
+	}
+	else
+	{
+		s->ulSeq[ucBack] = STREAM_SEQ_NONE;
+		pStat->ulDeltaErr++;
+		if (s->ucReady)
+			pStat->ulDropped++;
+	}
+	s->ucReady = uOk;
+}
+
+// ==================================================================================
+static void stream_packet(StreamTypeDef *s, uint32_t ulNow)
+{
+	uint32_t ulCrc, ulRx;
+
+	ulRx  = s->ucCrc[0] | (s->ucCrc[1] << 8) | (s->ucCrc[2] << 16) | ((uint32_t)s->ucCrc[3] << 24);
+
+	ulCrc = HAL_CRC_Calculate(s->pCrc, (uint32_t *)s->ucHdr, STREAM_HDR_LEN);
+	if (s->ucPre)
+		ulCrc = HAL_CRC_Accumulate(s->pCrc, (uint32_t *)s->ucSeq, s->ucPre);
+	if (s->wLen > s->ucPre)
+		ulCrc = HAL_CRC_Accumulate(s->pCrc, (uint32_t *)s->pPayload, s->wLen - s->ucPre);
+
+	if (~ulCrc != ulRx)
+	{
+		s->pStat->ulCrcErr++;
+		return;
+	}
+
+	s->pStat->ulFrames++;
+
+	switch (s->ucHdr[0])
+	{
+		case STREAM_TYPE_FRAME:
+			s->ulLastFrame = ulNow;
+			s->wFrameNum[s->ucFront ^ 1] = (s->wLen - STREAM_SEQ_LEN) / 3;
+			s->ulSeq[s->ucFront ^ 1] = s->ucSeq[0] | (s->ucSeq[1] << 8);
+			s->ucReady = 1;
+			break;
+
+		case STREAM_TYPE_DELTA:
+			s->ulLastFrame = ulNow;
+			stream_delta(s);
+			break;
+
+		default:                                      // Does not take over the strip
+			if (s->fOther)
+				s->fOther(s->ucHdr[0], s->ucDelta, s->wLen);
+			break;
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Sets up a parser, frames are dropped until stream_parse() sees a header
+ * @param  wLedNum  Pixels of the blank frame shown before the first frame
+ * @param  pCrc     CRC unit, see MX_CRC_Init()
+ * @param  pStat    Counters, cleared here
+ * @param  fOther   Handler of config, text and sync packets, NULL to ignore them
+ */
+void stream_parse_init(StreamTypeDef *s, uint16_t wLedNum, CRC_HandleTypeDef *pCrc,
+                       StreamStatDef *pStat, StreamOtherFunc fOther)
+{
+	s->ucFront = 0;
+	s->ucReady = 0;
+	s->ulLastFrame = 0;
+	memset(s->rFrame, 0, sizeof(s->rFrame));
+	s->wFrameNum[0] = s->wFrameNum[1] = (wLedNum < STREAM_MAX_LED) ? wLedNum : STREAM_MAX_LED;
+	s->ulSeq[0] = s->ulSeq[1] = STREAM_SEQ_NONE;
+	s->sState  = ST_SYNC0;
+	s->pCrc    = pCrc;
+	s->pStat   = pStat;
+	s->fOther  = fOther;
+	memset(pStat, 0, sizeof(*pStat));
+	led_delta_init(&s->dDelta);
+}
+
+// ==================================================================================
+/**
+ * @brief  Runs the packet state machine over a block of received bytes
+ * @details Payload bytes are copied in bulk straight into the back frame buffer,
+ *          only the header, sync and CRC bytes are handled one at a time.
+ *
+ * @param  ulNow  Time stamp for stream_parse_active(), ms
+ */
+void stream_parse(StreamTypeDef *s, const uint8_t *pData, uint16_t wNum, uint32_t ulNow)
+{
+	StreamStatDef *pStat = s->pStat;
+	uint16_t wCopy;
+
+	pStat->ulRxBytes += wNum;
+
+	while (wNum)
+	{
+		switch (s->sState)
+		{
+			case ST_SYNC0:
+				if (*pData == STREAM_SYNC0)
+					s->sState = ST_SYNC1;
+				else
+					pStat->ulSyncErr++;
+				pData++; wNum--;
+				break;
+
+			case ST_SYNC1:
+				if (*pData == STREAM_SYNC1)
+				{
+					s->sState = ST_HEADER;
+					s->wIdx = 0;
+				}
+				else if (*pData != STREAM_SYNC0)
+				{
+					s->sState = ST_SYNC0;
+					pStat->ulSyncErr++;
+				}
+				pData++; wNum--;
+				break;
+
+			case ST_HEADER:
+				s->ucHdr[s->wIdx++] = *pData++; wNum--;
+				if (s->wIdx == STREAM_HDR_LEN)
+				{
+					s->wIdx = 0;
+					if (!stream_header(s))
+						s->sState = ST_SYNC0;
+					else
+						s->sState = s->wLen ? ST_PAYLOAD : ST_CRC;
+				}
+				break;
+
+			case ST_PAYLOAD:
+				if (s->wIdx < s->ucPre)
+				{
+					s->ucSeq[s->wIdx++] = *pData++; wNum--;
+					if (s->wIdx == s->wLen)
+					{
+						s->wIdx = 0;
+						s->sState = ST_CRC;
+					}
+					break;
+				}
+				wCopy = s->wLen - s->wIdx;
+				if (wCopy > wNum)
+					wCopy = wNum;
+				memcpy(s->pPayload + s->wIdx - s->ucPre, pData, wCopy);
+				pData += wCopy; wNum -= wCopy; s->wIdx += wCopy;
+				if (s->wIdx == s->wLen)
+				{
+					s->wIdx = 0;
+					s->sState = ST_CRC;
+				}
+				break;
+
+			case ST_CRC:
+				s->ucCrc[s->wIdx++] = *pData++; wNum--;
+				if (s->wIdx == STREAM_CRC_LEN)
+				{
+					stream_packet(s, ulNow);
+					s->sState = ST_SYNC0;
+				}
+				break;
+		}
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Reports whether frames arrived within STREAM_TIMEOUT_MS of ulNow
+ */
+uint8_t stream_parse_active(StreamTypeDef *s, uint32_t ulNow)
+{
+	return s->ulLastFrame && (ulNow - s->ulLastFrame) < STREAM_TIMEOUT_MS;
+}
+
+// ==================================================================================
+/**
+ * @brief  Makes the newest frame, full or patched by deltas, the front buffer
+ * @return 1 if a new frame was swapped in, 0 if nothing new arrived
+ */
+uint8_t stream_parse_swap(StreamTypeDef *s)
+{
+	uint32_t ulPrimask;
+	uint8_t  uOut = 0;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();
+	if (s->ucReady)
+	{
+		s->ucFront ^= 1;
+		s->ucReady = 0;
+		uOut = 1;
+	}
+	__set_PRIMASK(ulPrimask);
+	return uOut;
+}
+
+// ==================================================================================
+/**
+ * @brief  Returns the front buffer and its pixel count
+ */
+rgb_color *stream_parse_front(StreamTypeDef *s, uint16_t *wNum)
+{
+	*wNum = s->wFrameNum[s->ucFront];
+	return s->rFrame[s->ucFront];
+}
@@ -0,0 +1,211 @@
+#include <string.h>
+#include "main.h"
+#include "sync.h"
+#include "stream.h"
+#include "tlog.h"
+#include "crc.h"
+
+SyncClockDef sSync;
+
+static volatile uint8_t ucMaster;
+static uint32_t         ulNextSend;           // Network ms of the next master timestamp
+static SyncState        sReported;            // Last state sent as TLOG_ID_SYNC
+
+
+// ==================================================================================
+/**
+ * @brief  Reads network time down to the us, caller holds the lock
+ * @details A tick that ended while interrupts were off shows up as a pending
+ *          SysTick; its count already runs in the next tick.
+ * @note    A USART interrupt that preempts SysTick_Handler before sync_tick()
+ *          reads the ms count one tick late. The controller drops such a
+ *          single sample once it is locked (SYNC_OUTLIER_US).
+ */
+static void sync_read(uint32_t *pMs, int32_t *pUs)
+{
+	uint32_t ulVal = SysTick->VAL;
+	uint32_t ulMs  = sSync.ulMs;
+	uint32_t ulLen = sSync.ulCurLen;
+
+	if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+	{
+		ulVal = SysTick->VAL;
+		ulMs++;
+		ulLen = sSync.ulNextLen;
+	}
+	*pMs = ulMs;
+	*pUs = (ulLen - 1 - ulVal) * 1000 / ulLen;
+}
+
+// ==================================================================================
+/**
+ * @brief  Starts as a free running follower
+ * @note   Call after SystemClock_Config(), SysTick LOAD gives the nominal tick.
+ */
+void sync_init(void)
+{
+	sync_clock_init(&sSync, SysTick->LOAD + 1);
+	ucMaster   = 0;
+	ulNextSend = 0;
+	sReported  = SYNC_FREE;
+}
+
+// ==================================================================================
+/**
+ * @brief  Advances network time, first thing in SysTick_Handler
+ * @details The new LOAD is taken at the next reload, so it sets the length of
+ *          the tick after the one that just started.
+ */
+void sync_tick(void)
+{
+	uint32_t ulPrimask;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();                                  // USART1 outranks SysTick
+	SysTick->LOAD = sync_clock_tick(&sSync) - 1;
+	__set_PRIMASK(ulPrimask);
+}
+
+// ==================================================================================
+uint32_t sync_now(void)
+{
+	return sSync.ulMs;
+}
+
+// ==================================================================================
+/**
+ * @brief  Ticks until the next network ms that is a multiple of ulPeriod
+ * @details Reloading a timer with this instead of ulPeriod makes it expire on
+ *          the same network ms on every board, and heals late reloads.
+ */
+uint32_t sync_until(uint32_t ulPeriod)
+{
+	return ulPeriod - sSync.ulMs % ulPeriod;
+}
+
+// ==================================================================================
+/**
+ * @brief  Takes a checked STREAM_TYPE_SYNC payload, from the USART interrupt
+ */
+void sync_rx(const uint8_t *pData)
+{
+	uint32_t ulPrimask, ulMaster, ulMs;
+	int32_t  lMasterUs, lUs;
+
+	if (ucMaster)
+		return;
+
+	ulMaster  = pData[0] | (pData[1] << 8) | (pData[2] << 16) | ((uint32_t)pData[3] << 24);
+	lMasterUs = (pData[4] | (pData[5] << 8)) + SYNC_LATENCY_US;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();
+	sync_read(&ulMs, &lUs);
+	sync_clock_sample(&sSync, ulMaster, lMasterUs, ulMs, lUs);
+	__set_PRIMASK(ulPrimask);
+}
+
+// ==================================================================================
+/**
+ * @brief  Sends the master timestamp when due and reports state changes
+ * @details The stamp, the CRC and the hand over to the DMA run in one
+ *          critical section, so nothing gets between the stamp and the first
+ *          byte on the wire. A busy telemetry DMA defers the packet to a
+ *          later call.
+ */
+void sync_poll(void)
+{
+	uint8_t  ucPkt[SYNC_WIRE_BYTES];
+	uint32_t ulPrimask, ulMs, ulCrc;
+	int32_t  lUs, lLog[2];
+	uint8_t  ucLog[9];
+
+	if (ucMaster && (int32_t)(sSync.ulMs - ulNextSend) >= 0)
+	{
+		ulPrimask = __get_PRIMASK();
+		__disable_irq();
+		if (tlog_idle())
+		{
+			sync_read(&ulMs, &lUs);
+			ucPkt[0]  = STREAM_SYNC0;
+			ucPkt[1]  = STREAM_SYNC1;
+			ucPkt[2]  = STREAM_TYPE_SYNC;
+			ucPkt[3]  = SYNC_PAYLOAD_LEN;
+			ucPkt[4]  = 0;
+			ucPkt[5]  = ulMs;
+			ucPkt[6]  = ulMs >> 8;
+			ucPkt[7]  = ulMs >> 16;
+			ucPkt[8]  = ulMs >> 24;
+			ucPkt[9]  = lUs;
+			ucPkt[10] = lUs >> 8;
+
+			ulCrc = ~HAL_CRC_Calculate(&hcrc, (uint32_t *)&ucPkt[2], STREAM_HDR_LEN + SYNC_PAYLOAD_LEN);
+			ucPkt[11] = ulCrc;
+			ucPkt[12] = ulCrc >> 8;
+			ucPkt[13] = ulCrc >> 16;
+			ucPkt[14] = ulCrc >> 24;
+
+			if (tlog_raw(ucPkt, sizeof(ucPkt)))
+				ulNextSend = ulMs - ulMs % SYNC_PERIOD_MS + SYNC_PERIOD_MS;
+		}
+		__set_PRIMASK(ulPrimask);
+	}
+
+	if (sSync.sState != sReported)
+	{
+		sReported = sSync.sState;
+		lLog[0]   = sSync.lOffset;
+		lLog[1]   = sync_clock_ppm(&sSync);
+		ucLog[0]  = sReported;
+		memcpy(&ucLog[1], lLog, sizeof(lLog));
+		tlog_write(TLOG_ID_SYNC, ucLog, sizeof(ucLog));
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Selects the role (CFG_KEY_SYNC), a master runs at the nominal rate
+ */
+void sync_set_master(uint8_t ucOn)
+{
+	uint32_t ulPrimask;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();
+	ucMaster = ucOn;
+	if (ucOn)
+	{
+		sSync.lFreq      = 0;
+		sSync.wPhaseLeft = 0;
+		sSync.sState     = SYNC_FREE;
+		ulNextSend       = sSync.ulMs;
+	}
+	__set_PRIMASK(ulPrimask);
+}
+
+// ==================================================================================
+/**
+ * @brief  Reports whether other boards follow this clock or this one follows a master
+ * @return 1 if lost SysTick ticks would put the network time out of step
+ */
+uint8_t sync_shared(void)
+{
+	return ucMaster || sSync.sState != SYNC_FREE;
+}
+
+// ==================================================================================
+/**
+ * @brief  Reports (and clears) a jump of network time
+ * @return 1 if animations must be put back in phase
+ */
+uint8_t sync_stepped(void)
+{
+	uint32_t ulPrimask;
+	uint8_t  uOut;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();
+	uOut = sync_clock_stepped(&sSync);
+	__set_PRIMASK(ulPrimask);
+	return uOut;
+}
@@ -0,0 +1,167 @@
+#include "main.h"
+#include "sync_clock.h"
+
+
+// ==================================================================================
+static int32_t sync_clamp(int32_t lVal, int32_t lMax)
+{
+	if (lVal > lMax)
+		return lMax;
+	if (lVal < -lMax)
+		return -lMax;
+	return lVal;
+}
+
+// ==================================================================================
+/**
+ * @brief  Starts free running at the nominal tick length
+ * @param   ulClkMs  Core clocks per ms (SysTick LOAD + 1)
+ */
+void sync_clock_init(SyncClockDef *c, uint32_t ulClkMs)
+{
+	c->ulMs       = 0;
+	c->ulClkMs    = ulClkMs;
+	c->ulCurLen   = ulClkMs;
+	c->ulNextLen  = ulClkMs;
+	c->lFreq      = 0;
+	c->lPhase     = 0;
+	c->wPhaseLeft = 0;
+	c->ucAcc      = 0;
+	c->ulIdleMs   = 0;
+	c->sState     = SYNC_FREE;
+	c->ucGood     = 0;
+	c->ucOutlier  = 0;
+	c->ucStepped  = 0;
+	c->ulSamples  = 0;
+	c->ulSteps    = 0;
+	c->ulOutliers = 0;
+	c->lOffset    = 0;
+}
+
+// ==================================================================================
+/**
+ * @brief  Advances network time by one tick
+ * @details Called when a tick starts. The counter already reloaded the length
+ *          computed one tick earlier (ulCurLen), the returned length is for
+ *          the tick after this one and goes to SysTick LOAD - 1.
+ *
+ * @return  Core clocks of the next tick
+ */
+uint32_t sync_clock_tick(SyncClockDef *c)
+{
+	int32_t lTot;
+
+	c->ulMs++;
+	c->ulCurLen = c->ulNextLen;
+
+	if (c->ulIdleMs < SYNC_HOLD_MS)
+		c->ulIdleMs++;
+	else if (c->sState != SYNC_FREE)
+	{
+		c->sState = SYNC_FREE;                        // Holdover, lFreq keeps the last rate
+		c->ucGood = 0;
+	}
+
+	lTot = c->lFreq + c->ucAcc;
+	if (c->wPhaseLeft)
+	{
+		lTot += c->lPhase;
+		c->wPhaseLeft--;
+	}
+	c->ucAcc     = lTot & 0xFF;                       // Dither, the fraction goes to the next tick
+	c->ulNextLen = c->ulClkMs + (lTot >> 8);
+	return c->ulNextLen;
+}
+
+// ==================================================================================
+/**
+ * @brief  Takes one master timestamp
+ * @details Both times are ms plus us into that ms; the master time already
+ *          includes the transport delay. The us parts may run outside 0..999.
+ *
+ * @param   ulMasterMs, lMasterUs   Master network time when the local one was read
+ * @param   ulLocalMs,  lLocalUs    Local network time
+ */
+void sync_clock_sample(SyncClockDef *c, uint32_t ulMasterMs, int32_t lMasterUs, uint32_t ulLocalMs, int32_t lLocalUs)
+{
+	int32_t lMs  = (int32_t)(ulMasterMs - ulLocalMs);
+	int32_t lSub = lMasterUs - lLocalUs;
+	int32_t lErr, lCorr;
+	uint32_t ulDt;
+
+	if (!c->ulSamples++ || lMs > SYNC_STEP_US / 1000 || lMs < -(SYNC_STEP_US / 1000))
+	{
+		c->lOffset = sync_clamp(lMs, 0x7FFFFFFF / 1000) * 1000 + lSub;
+		while (lSub >= 500)  { lMs++; lSub -= 1000; }
+		while (lSub < -500)  { lMs--; lSub += 1000; }
+
+		c->ulMs      += lMs;                          // The sub ms rest is left to the PI loop
+		c->lPhase     = 0;
+		c->wPhaseLeft = 0;
+		c->sState     = SYNC_ACQUIRE;
+		c->ucGood     = 0;
+		c->ucOutlier  = 0;
+		c->ulIdleMs   = 0;
+		c->ucStepped  = 1;
+		c->ulSteps++;
+		return;
+	}
+
+	lErr = lMs * 1000 + lSub;
+	c->lOffset = lErr;
+
+	if (c->sState == SYNC_LOCKED && (lErr > SYNC_OUTLIER_US || lErr < -SYNC_OUTLIER_US))
+	{
+		c->ulOutliers++;
+		if (!c->ucOutlier++)
+			return;                                   // ulIdleMs keeps counting to the next sample
+		c->sState = SYNC_ACQUIRE;
+		c->ucGood = 0;
+	}
+	c->ucOutlier = 0;
+
+	ulDt = c->ulIdleMs ? c->ulIdleMs : 1;
+	c->ulIdleMs = 0;
+
+	// Clocks to remove, Q0; an offset of SYNC_STEP_US is below 2^20 clocks
+	lCorr = -(lErr * (int32_t)(c->ulClkMs / 8)) / 125;
+
+	c->lPhase     = lCorr * SYNC_GAIN_P / SYNC_PERIOD_MS;
+	c->wPhaseLeft = SYNC_PERIOD_MS;
+	c->lFreq      = sync_clamp(c->lFreq + lCorr * SYNC_GAIN_I / (int32_t)ulDt,
+	                           c->ulClkMs * SYNC_TRIM_PCT * 256 / 100);
+
+	if (lErr < SYNC_LOCK_US && lErr > -SYNC_LOCK_US)
+	{
+		if (c->ucGood < SYNC_LOCK_COUNT && ++c->ucGood == SYNC_LOCK_COUNT)
+			c->sState = SYNC_LOCKED;
+	}
+	else
+	{
+		c->ucGood = 0;
+	}
+	if (c->sState == SYNC_FREE)
+		c->sState = SYNC_ACQUIRE;
+}
+
+// ==================================================================================
+/**
+ * @brief  Reports (and clears) a jump of the ms count since the last call
+ */
+uint8_t sync_clock_stepped(SyncClockDef *c)
+{
+	uint8_t uOut = c->ucStepped;
+
+	if (uOut)
+		c->ucStepped = 0;
+	return uOut;
+}
+
+// ==================================================================================
+/**
+ * @brief  Rate trim in ppm, + = ticks are longer than nominal
+ */
+int32_t sync_clock_ppm(SyncClockDef *c)
+{
+	return (c->lFreq / 4) * 15625 / (int32_t)c->ulClkMs;
+}
@@ -0,0 +1,214 @@
+#include "main.h"
+#include "tlog.h"
+
+#define TLOG_MASK           (TLOG_BUF_SIZE - 1)
+
+extern UART_HandleTypeDef huart1;
+
+static uint8_t           ucBuf[TLOG_BUF_SIZE];
+static volatile uint16_t wHead;                       // Free running write index
+static volatile uint16_t wTail;                       // Free running index of the oldest unsent byte
+static volatile uint16_t wTxLen;                      // Bytes owned by the DMA, 0 = idle
+static uint32_t          ulDropPending;               // Losses not yet reported with TLOG_ID_DROP
+static volatile uint8_t  ucHold;                      // 1 = raw packet on the wire, 2 = gap after it
+static uint32_t          ulHoldTick;                  // Tick the raw packet left
+
+TlogStatDef sTlogStat;
+
+
+// ==================================================================================
+static uint16_t tlog_free(void)
+{
+	return TLOG_BUF_SIZE - (uint16_t)(wHead - wTail);
+}
+
+// ==================================================================================
+/**
+ * @brief  Copies one record into the ring, caller holds the lock
+ * @return 1 if written, 0 if it does not fit
+ */
+static uint8_t tlog_put(uint8_t ucId, const uint8_t *pData, uint8_t ucLen)
+{
+	uint16_t wTime = (uint16_t)HAL_GetTick();
+	uint16_t wPos  = wHead;
+	uint8_t  ucSum, i;
+
+	if (tlog_free() < ucLen + TLOG_REC_OVERHEAD)
+		return 0;
+
+	ucBuf[wPos++ & TLOG_MASK] = TLOG_SYNC;
+	ucBuf[wPos++ & TLOG_MASK] = ucId;
+	ucBuf[wPos++ & TLOG_MASK] = ucLen;
+	ucBuf[wPos++ & TLOG_MASK] = wTime;
+	ucBuf[wPos++ & TLOG_MASK] = wTime >> 8;
+	ucSum = ucId + ucLen + (uint8_t)wTime + (uint8_t)(wTime >> 8);
+
+	for (i = 0; i < ucLen; i++)
+	{
+		ucBuf[wPos++ & TLOG_MASK] = pData[i];
+		ucSum += pData[i];
+	}
+	ucBuf[wPos++ & TLOG_MASK] = ucSum;
+
+	wHead = wPos;
+	sTlogStat.ulRecords++;
+	return 1;
+}
+
+// ==================================================================================
+/**
+ * @brief  Hands the oldest contiguous block of the ring to the DMA if it is idle
+ * @note   Caller holds the lock. A block never wraps, the rest follows from
+ *         the transfer complete callback. Nothing starts during the gap after
+ *         a raw packet.
+ */
+static void tlog_kick(void)
+{
+	uint16_t wStart, wNum;
+
+	if (wTxLen || wHead == wTail)
+		return;
+	if (ucHold)
+	{
+		if (HAL_GetTick() - ulHoldTick < TLOG_GAP_MS)
+			return;
+		ucHold = 0;
+	}
+
+	wStart = wTail & TLOG_MASK;
+	wNum   = (uint16_t)(wHead - wTail);
+	if (wNum > TLOG_BUF_SIZE - wStart)
+		wNum = TLOG_BUF_SIZE - wStart;
+
+	wTxLen = wNum;
+	if (HAL_UART_Transmit_DMA(&huart1, &ucBuf[wStart], wNum) != HAL_OK)
+		wTxLen = 0;                                   // Retried on the next write
+}
+
+// ==================================================================================
+void tlog_init(void)
+{
+	wHead = wTail = wTxLen = 0;
+	ulDropPending = 0;
+	ucHold = 0;
+	sTlogStat.ulRecords = sTlogStat.ulDropped = sTlogStat.ulBytes = 0;
+}
+
+// ==================================================================================
+/**
+ * @brief  Queues a telemetry record without blocking
+ * @details Safe from thread and interrupt context. The record is copied into
+ *          the ring inside a short critical section (at most TLOG_MAX_DATA +
+ *          TLOG_REC_OVERHEAD bytes), then drained by HAL_UART_Transmit_DMA.
+ *          When the ring is full the record is counted and dropped; the count
+ *          is sent as a TLOG_ID_DROP record once space is available again.
+ *
+ * @param  ucId   Record ID (TLOG_ID_xxx)
+ * @param  pData  Record data, may be NULL when ucLen is 0
+ * @param  ucLen  Data length, clipped to TLOG_MAX_DATA
+ *
+ * @return 1 if queued, 0 if dropped
+ */
+uint8_t tlog_write(uint8_t ucId, const void *pData, uint8_t ucLen)
+{
+	uint32_t ulPrimask;
+	uint8_t  uOut;
+
+	if (ucLen > TLOG_MAX_DATA)
+		ucLen = TLOG_MAX_DATA;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();
+
+	if (ulDropPending && tlog_put(TLOG_ID_DROP, (const uint8_t *)&ulDropPending, sizeof(ulDropPending)))
+		ulDropPending = 0;
+
+	uOut = tlog_put(ucId, pData, ucLen);
+	if (!uOut)
+	{
+		ulDropPending++;
+		sTlogStat.ulDropped++;
+	}
+	tlog_kick();
+
+	__set_PRIMASK(ulPrimask);
+	return uOut;
+}
+
+// ==================================================================================
+/**
+ * @brief  Sends a raw packet as the only thing on the wire
+ * @details For other packets that share the TX line (sync.c), see "Raw
+ *          packets" in tlog.h. The packet goes to the DMA at once, records
+ *          written meanwhile wait until it and TLOG_GAP_MS of idle line are
+ *          out.
+ *
+ * @param  pData  Packet starting with STREAM_SYNC0
+ * @return 1 if on the wire, 0 if the ring is busy or the DMA refused it
+ */
+uint8_t tlog_raw(const void *pData, uint8_t ucLen)
+{
+	const uint8_t *p = pData;
+	uint32_t ulPrimask;
+	uint16_t wPos;
+	uint8_t  uOut = 0;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();
+	if (tlog_idle() && !ucHold)
+	{
+		for (wPos = wHead; ucLen; ucLen--)
+			ucBuf[wPos++ & TLOG_MASK] = *p++;
+		wHead = wPos;
+		tlog_kick();
+		if (wTxLen)
+		{
+			ucHold = 1;
+			uOut   = 1;
+		}
+		else
+			wHead = wTail;                            // A stale stamp is no use later
+	}
+	__set_PRIMASK(ulPrimask);
+	return uOut;
+}
+
+// ==================================================================================
+/**
+ * @brief  Returns 1 while nothing is queued or on the wire
+ */
+uint8_t tlog_idle(void)
+{
+	return !wTxLen && wHead == wTail;
+}
+
+// ==================================================================================
+/**
+ * @brief  Restarts the DMA once the gap after a raw packet is over, main loop
+ */
+void tlog_poll(void)
+{
+	uint32_t ulPrimask;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();
+	tlog_kick();
+	__set_PRIMASK(ulPrimask);
+}
+
+// ==================================================================================
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+	if (huart->Instance == USART1)
+	{
+		sTlogStat.ulBytes += wTxLen;
+		wTail += wTxLen;
+		wTxLen = 0;
+		if (ucHold)
+		{
+			ucHold     = 2;                           // Last stop bit is out, the gap starts
+			ulHoldTick = HAL_GetTick();
+		}
+		tlog_kick();
+	}
+}
@@ -118,4 +118,14 @@ extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
 extern const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1];
 extern const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1];
 
+/* Tables for the fixed-point fast math functions, Tools/fastmath_tables.py */
+extern const uint16_t reciprocalTable_q15[33];
+extern const uint16_t invSqrtTable_q15[49];
+extern const uint16_t log2Table_q15[33];
+extern const uint16_t exp2Table_q15[65];
+extern const uint16_t atanTable_q15[65];
+extern const q31_t log2Table_q31[128];
+extern const q31_t exp2Table_q31[128];
+extern const q31_t atanTable_q31[256];
+
 #endif /*  ARM_COMMON_TABLES_H */
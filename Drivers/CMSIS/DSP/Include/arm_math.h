@@ -1195,6 +1195,93 @@ extern "C"
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the Q15 FIR filter with interleaved channels.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t numChannels;     /**< number of interleaved channels. */
+    q15_t *pState;            /**< points to the state variable array. The array is of length (numTaps+blockSize-1)*numChannels. */
+    q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+  } arm_fir_multi_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point FIR filter with interleaved channels.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t numChannels;     /**< number of interleaved channels. */
+    float32_t *pState;        /**< points to the state variable array. The array is of length (numTaps+blockSize-1)*numChannels. */
+    float32_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_multi_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 FIR filter with interleaved channels.
+   * @param[in]  S          points to an instance of the multichannel Q15 FIR structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data.
+   * @param[in]  blockSize  number of frames, of numChannels samples each, to process.
+   */
+  void arm_fir_multi_q15(
+  const arm_fir_multi_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 FIR filter with interleaved channels.
+   * @param[in,out] S            points to an instance of the multichannel Q15 FIR filter structure.
+   * @param[in]     numTaps      Number of filter coefficients in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     blockSize    number of frames that are processed at a time.
+   */
+  void arm_fir_multi_init_q15(
+  arm_fir_multi_instance_q15 * S,
+  uint16_t numTaps,
+  uint16_t numChannels,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point FIR filter with interleaved channels.
+   * @param[in]  S          points to an instance of the multichannel floating-point FIR structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data.
+   * @param[in]  blockSize  number of frames, of numChannels samples each, to process.
+   */
+  void arm_fir_multi_f32(
+  const arm_fir_multi_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR filter with interleaved channels.
+   * @param[in,out] S            points to an instance of the multichannel floating-point FIR filter structure.
+   * @param[in]     numTaps      Number of filter coefficients in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     blockSize    number of frames that are processed at a time.
+   */
+  void arm_fir_multi_init_f32(
+  arm_fir_multi_instance_f32 * S,
+  uint16_t numTaps,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
    */
@@ -1316,6 +1403,95 @@ extern "C"
   int8_t postShift);
 
 
+  /**
+   * @brief Instance structure for the Q15 Biquad cascade filter with interleaved channels.
+   */
+  typedef struct
+  {
+    int8_t numStages;        /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;    /**< number of interleaved channels. */
+    q15_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    q15_t *pCoeffs;          /**< Points to the array of coefficients.  The array is of length 6*numStages. */
+    int8_t postShift;        /**< Additional shift, in bits, applied to each output sample. */
+  } arm_biquad_casd_df1_multi_inst_q15;
+
+  /**
+   * @brief Instance structure for the Q31 Biquad cascade filter with interleaved channels.
+   */
+  typedef struct
+  {
+    uint32_t numStages;      /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;    /**< number of interleaved channels. */
+    q31_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    q31_t *pCoeffs;          /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< Additional shift, in bits, applied to each output sample. */
+  } arm_biquad_casd_df1_multi_inst_q31;
+
+
+  /**
+   * @brief Processing function for the Q15 Biquad cascade filter with interleaved channels.
+   * @param[in]  S          points to an instance of the multichannel Q15 Biquad cascade structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data.
+   * @param[in]  blockSize  number of frames, of numChannels samples each, to process.
+   */
+  void arm_biquad_cascade_multi_df1_q15(
+  const arm_biquad_casd_df1_multi_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 Biquad cascade filter with interleaved channels.
+   * @param[in,out] S            points to an instance of the multichannel Q15 Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cascade_multi_df1_init_q15(
+  arm_biquad_casd_df1_multi_inst_q15 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  int8_t postShift);
+
+
+  /**
+   * @brief Processing function for the Q31 Biquad cascade filter with interleaved channels.
+   * @param[in]  S          points to an instance of the multichannel Q31 Biquad cascade structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data.
+   * @param[in]  blockSize  number of frames, of numChannels samples each, to process.
+   */
+  void arm_biquad_cascade_multi_df1_q31(
+  const arm_biquad_casd_df1_multi_inst_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 Biquad cascade filter with interleaved channels.
+   * @param[in,out] S            points to an instance of the multichannel Q31 Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cascade_multi_df1_init_q31(
+  arm_biquad_casd_df1_multi_inst_q31 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  int8_t postShift);
+
+
   /**
    * @brief Processing function for the floating-point Biquad cascade filter.
    * @param[in]  S          points to an instance of the floating-point Biquad cascade structure.
@@ -2229,6 +2405,320 @@ void arm_rfft_fast_f32(
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+  /**
+   * @brief Most radix stages of a mixed radix CFFT, lengths up to 4096.
+   */
+#define ARM_CFFT_MIXED_MAX_STAGES 8U
+
+  /**
+   * @brief Instance structure for the mixed radix Q15 CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                 /**< length of the FFT, a product of 2, 3, 4 and 5. */
+    uint8_t numStages;               /**< number of radix stages. */
+    uint8_t twidStride;              /**< twiddle table step, 2 when the table belongs to a real FFT. */
+    uint8_t pFactors[ARM_CFFT_MIXED_MAX_STAGES]; /**< radix of every stage, first to last. */
+    const q15_t *pTwiddle;           /**< points to the twiddle factor table. */
+    const uint16_t *pCycles;         /**< points to the digit reversal cycles. */
+    uint16_t cyclesLength;           /**< number of entries in pCycles. */
+  } arm_cfft_mixed_instance_q15;
+
+  /**
+   * @brief Instance structure for the mixed radix Q31 CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                 /**< length of the FFT, a product of 2, 3, 4 and 5. */
+    uint8_t numStages;               /**< number of radix stages. */
+    uint8_t twidStride;              /**< twiddle table step, 2 when the table belongs to a real FFT. */
+    uint8_t pFactors[ARM_CFFT_MIXED_MAX_STAGES]; /**< radix of every stage, first to last. */
+    const q31_t *pTwiddle;           /**< points to the twiddle factor table. */
+    const uint16_t *pCycles;         /**< points to the digit reversal cycles. */
+    uint16_t cyclesLength;           /**< number of entries in pCycles. */
+  } arm_cfft_mixed_instance_q31;
+
+  /**
+   * @brief Instance structure for the mixed radix floating-point CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                 /**< length of the FFT, a product of 2, 3, 4 and 5. */
+    uint8_t numStages;               /**< number of radix stages. */
+    uint8_t twidStride;              /**< twiddle table step, 2 when the table belongs to a real FFT. */
+    uint8_t pFactors[ARM_CFFT_MIXED_MAX_STAGES]; /**< radix of every stage, first to last. */
+    const float32_t *pTwiddle;       /**< points to the twiddle factor table. */
+    const uint16_t *pCycles;         /**< points to the digit reversal cycles. */
+    uint16_t cyclesLength;           /**< number of entries in pCycles. */
+  } arm_cfft_mixed_instance_f32;
+
+  arm_status arm_cfft_mixed_init_q15(
+  arm_cfft_mixed_instance_q15 * S,
+  uint16_t fftLen,
+  q15_t * pTwiddle,
+  uint16_t * pCycles);
+
+  arm_status arm_cfft_mixed_init_q31(
+  arm_cfft_mixed_instance_q31 * S,
+  uint16_t fftLen,
+  q31_t * pTwiddle,
+  uint16_t * pCycles);
+
+  arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  uint16_t * pCycles);
+
+  void arm_cfft_mixed_q15(
+  const arm_cfft_mixed_instance_q15 * S,
+  q15_t * p1,
+  uint8_t ifftFlag);
+
+  void arm_cfft_mixed_q31(
+  const arm_cfft_mixed_instance_q31 * S,
+  q31_t * p1,
+  uint8_t ifftFlag);
+
+  void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the mixed radix Q15 RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+    arm_cfft_mixed_instance_q15 Sint; /**< internal CFFT structure, fftLenRFFT / 2 points. */
+    uint16_t fftLenRFFT;              /**< length of the real sequence. */
+  } arm_rfft_mixed_instance_q15;
+
+  /**
+   * @brief Instance structure for the mixed radix Q31 RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+    arm_cfft_mixed_instance_q31 Sint; /**< internal CFFT structure, fftLenRFFT / 2 points. */
+    uint16_t fftLenRFFT;              /**< length of the real sequence. */
+  } arm_rfft_mixed_instance_q31;
+
+  /**
+   * @brief Instance structure for the mixed radix floating-point RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+    arm_cfft_mixed_instance_f32 Sint; /**< internal CFFT structure, fftLenRFFT / 2 points. */
+    uint16_t fftLenRFFT;              /**< length of the real sequence. */
+  } arm_rfft_mixed_instance_f32;
+
+  arm_status arm_rfft_mixed_init_q15(
+  arm_rfft_mixed_instance_q15 * S,
+  uint16_t fftLen,
+  q15_t * pTwiddle,
+  uint16_t * pCycles);
+
+  arm_status arm_rfft_mixed_init_q31(
+  arm_rfft_mixed_instance_q31 * S,
+  uint16_t fftLen,
+  q31_t * pTwiddle,
+  uint16_t * pCycles);
+
+  arm_status arm_rfft_mixed_init_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  uint16_t * pCycles);
+
+  void arm_rfft_mixed_q15(
+  const arm_rfft_mixed_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint8_t ifftFlag);
+
+  void arm_rfft_mixed_q31(
+  const arm_rfft_mixed_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint8_t ifftFlag);
+
+  void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the Q15 Goertzel detector.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                /**< number of frequencies detected. */
+    uint16_t blockLen;               /**< samples per detection block. */
+    uint16_t count;                  /**< samples of the current block so far. */
+    const q15_t *pCoeffs;            /**< mantissa and shift of 2*cos -/+ 2 and of sine for each frequency, 4*numBins values. */
+    q31_t *pState;                   /**< s[n-1] and s[n-1] -/+ s[n-2] of each frequency, 2*numBins values. */
+  } arm_goertzel_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel detector.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                /**< number of frequencies detected. */
+    uint16_t blockLen;               /**< samples per detection block. */
+    uint16_t count;                  /**< samples of the current block so far. */
+    const q31_t *pCoeffs;            /**< cosine and sine of each frequency, 2*numBins values. */
+    q63_t *pState;                   /**< s[n-1] and s[n-2] of each frequency, 2*numBins values. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point Goertzel detector.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                /**< number of frequencies detected. */
+    uint16_t blockLen;               /**< samples per detection block. */
+    uint16_t count;                  /**< samples of the current block so far. */
+    const float32_t *pCoeffs;        /**< cosine and sine of each frequency, 2*numBins values. */
+    float32_t *pState;               /**< s[n-1] and s[n-2] of each frequency, 2*numBins values. */
+  } arm_goertzel_instance_f32;
+
+  arm_status arm_goertzel_init_q15(
+  arm_goertzel_instance_q15 * S,
+  uint16_t numBins,
+  uint16_t blockLen,
+  const q15_t * pFreqs,
+  q15_t * pCoeffs,
+  q31_t * pState);
+
+  arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t blockLen,
+  const q31_t * pFreqs,
+  q31_t * pCoeffs,
+  q63_t * pState);
+
+  arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t blockLen,
+  const float32_t * pFreqs,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+  uint32_t arm_goertzel_q15(
+  arm_goertzel_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pDst);
+
+  uint32_t arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pDst);
+
+  uint32_t arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst);
+
+  /* Radius of the sliding DFT twiddles, below 1 by more than their rounding so the bins decay */
+#define ARM_SDFT_DAMPING_F32 0.999999f
+#define ARM_SDFT_DAMPING_Q15 ((q15_t) 0x7FFE)       /* 1 - 2^-14 */
+#define ARM_SDFT_DAMPING_Q31 ((q31_t) 0x7FFFFFF0)   /* 1 - 2^-27 */
+
+  /**
+   * @brief Instance structure for the Q15 sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                 /**< length of the DFT window. */
+    uint16_t numBins;                /**< number of bins updated. */
+    uint16_t index;                  /**< position of the oldest sample in pHistory. */
+    q15_t damping;                   /**< ARM_SDFT_DAMPING_Q15 to the power fftLen, weight of the leaving sample. */
+    const q15_t *pCoeffs;            /**< twiddle factor of each bin, 2*numBins values. */
+    q31_t *pState;                   /**< bins, real and imaginary part, 2*numBins values. */
+    q15_t *pHistory;                 /**< the last fftLen samples. */
+  } arm_sdft_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                 /**< length of the DFT window. */
+    uint16_t numBins;                /**< number of bins updated. */
+    uint16_t index;                  /**< position of the oldest sample in pHistory. */
+    q31_t damping;                   /**< ARM_SDFT_DAMPING_Q31 to the power fftLen, weight of the leaving sample. */
+    q31_t invLen;                    /**< 1/(2*fftLen), scale of the samples entering the bins. */
+    const q31_t *pCoeffs;            /**< twiddle factor of each bin, 2*numBins values. */
+    q31_t *pState;                   /**< bins, real and imaginary part, 2*numBins values. */
+    q31_t *pHistory;                 /**< the last fftLen samples. */
+  } arm_sdft_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                 /**< length of the DFT window. */
+    uint16_t numBins;                /**< number of bins updated. */
+    uint16_t index;                  /**< position of the oldest sample in pHistory. */
+    float32_t damping;               /**< ARM_SDFT_DAMPING_F32 to the power fftLen, weight of the leaving sample. */
+    const float32_t *pCoeffs;        /**< twiddle factor of each bin, 2*numBins values. */
+    float32_t *pState;               /**< bins, real and imaginary part, 2*numBins values. */
+    float32_t *pHistory;             /**< the last fftLen samples. */
+  } arm_sdft_instance_f32;
+
+  arm_status arm_sdft_init_q15(
+  arm_sdft_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  q15_t * pCoeffs,
+  q31_t * pState,
+  q15_t * pHistory);
+
+  arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t fftLen,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t * pHistory);
+
+  arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pHistory);
+
+  void arm_sdft_q15(
+  arm_sdft_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pDst);
+
+  void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pDst);
+
+  void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -3542,40 +4032,255 @@ void arm_rfft_fast_f32(
   float32_t * pState,
   uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 L/M resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint32_t phase;                 /**< polyphase filter component of the next output, counted from the newest input. */
+    uint32_t blockSize;             /**< most input samples the state buffer takes at once. */
+    const q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q15;
 
   /**
-   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   * @brief Instance structure for the floating-point L/M resampler.
    */
   typedef struct
   {
-    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
-    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
-    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
-  } arm_biquad_cas_df1_32x64_ins_q31;
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint32_t phase;                 /**< polyphase filter component of the next output, counted from the newest input. */
+    uint32_t blockSize;             /**< most input samples the state buffer takes at once. */
+    const float32_t *pCoeffs;       /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_f32;
 
 
   /**
-   * @param[in]  S          points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of samples to process.
+   * @brief Processing function for the Q15 L/M resampler.
+   * @param[in,out] S          points to an instance of the Q15 L/M resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, <code>(blockSize*L)/M+1</code> values at most.
+   * @param[in]     blockSize  number of input samples to process, any number.
+   * @return        number of output samples written.
    */
-  void arm_biquad_cas_df1_32x64_q31(
-  const arm_biquad_cas_df1_32x64_ins_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
+  uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @param[in,out] S          points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]     numStages  number of 2nd order stages in the filter.
-   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @brief  Initialization function for the Q15 L/M resampler.
+   * @param[in,out] S          points to an instance of the Q15 L/M resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
    * @param[in]     pState     points to the state buffer.
-   * @param[in]     postShift  shift to be applied to the output. Varies according to the coefficients format
+   * @param[in]     blockSize  most input samples the state buffer takes at once.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>L</code>, <code>M</code> or <code>blockSize</code> is 0 or ARM_MATH_LENGTH_ERROR if the filter length
+   * <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_q15(
+  arm_fir_resample_instance_q15 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  const q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point L/M resampler.
+   * @param[in,out] S          points to an instance of the floating-point L/M resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, <code>(blockSize*L)/M+1</code> values at most.
+   * @param[in]     blockSize  number of input samples to process, any number.
+   * @return        number of output samples written.
    */
-  void arm_biquad_cas_df1_32x64_init_q31(
+  uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point L/M resampler.
+   * @param[in,out] S          points to an instance of the floating-point L/M resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  most input samples the state buffer takes at once.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>L</code>, <code>M</code> or <code>blockSize</code> is 0 or ARM_MATH_LENGTH_ERROR if the filter length
+   * <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief 1.0 in the 8.24 format of the fractional resampler step and position.
+   */
+#define ARM_RESAMPLE_STEP_ONE 0x01000000U
+
+  /**
+   * @brief Instance structure for the Q15 fractional resampler.
+   */
+  typedef struct
+  {
+    uint16_t numPhases;             /**< number of polyphase filter components, 256 at most. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint32_t step;                  /**< input samples per output sample in 8.24 format, may be changed between calls. */
+    uint32_t pos;                   /**< time of the next output after the newest input in 8.24 format. */
+    uint32_t blockSize;             /**< most input samples the state buffer takes at once. */
+    const q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numPhases*phaseLength. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_frac_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point fractional resampler.
+   */
+  typedef struct
+  {
+    uint16_t numPhases;             /**< number of polyphase filter components, 256 at most. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint32_t step;                  /**< input samples per output sample in 8.24 format, may be changed between calls. */
+    uint32_t pos;                   /**< time of the next output after the newest input in 8.24 format. */
+    uint32_t blockSize;             /**< most input samples the state buffer takes at once. */
+    const float32_t *pCoeffs;       /**< points to the coefficient array. The array is of length numPhases*phaseLength. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_frac_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 fractional resampler.
+   * @param[in,out] S          points to an instance of the Q15 fractional resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, <code>blockSize*ARM_RESAMPLE_STEP_ONE/step+1</code> values at most.
+   * @param[in]     blockSize  number of input samples to process, any number.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_frac_q15(
+  arm_fir_resample_frac_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 fractional resampler.
+   * @param[in,out] S          points to an instance of the Q15 fractional resampler structure.
+   * @param[in]     numPhases  number of polyphase filter components, 256 at most.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     step       input samples per output sample in 8.24 format.
+   * @param[in]     blockSize  most input samples the state buffer takes at once.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>numPhases</code>, <code>step</code> or <code>blockSize</code> is out of range or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of <code>numPhases</code>.
+   */
+  arm_status arm_fir_resample_frac_init_q15(
+  arm_fir_resample_frac_instance_q15 * S,
+  uint16_t numPhases,
+  uint16_t numTaps,
+  const q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t step,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point fractional resampler.
+   * @param[in,out] S          points to an instance of the floating-point fractional resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, <code>blockSize*ARM_RESAMPLE_STEP_ONE/step+1</code> values at most.
+   * @param[in]     blockSize  number of input samples to process, any number.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_frac_f32(
+  arm_fir_resample_frac_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point fractional resampler.
+   * @param[in,out] S          points to an instance of the floating-point fractional resampler structure.
+   * @param[in]     numPhases  number of polyphase filter components, 256 at most.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     step       input samples per output sample in 8.24 format.
+   * @param[in]     blockSize  most input samples the state buffer takes at once.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>numPhases</code>, <code>step</code> or <code>blockSize</code> is out of range or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of <code>numPhases</code>.
+   */
+  arm_status arm_fir_resample_frac_init_f32(
+  arm_fir_resample_frac_instance_f32 * S,
+  uint16_t numPhases,
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t step,
+  uint32_t blockSize);
+
+
+
+  /**
+   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cas_df1_32x64_ins_q31;
+
+
+  /**
+   * @param[in]  S          points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_biquad_cas_df1_32x64_q31(
+  const arm_biquad_cas_df1_32x64_ins_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @param[in,out] S          points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     postShift  shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cas_df1_32x64_init_q31(
   arm_biquad_cas_df1_32x64_ins_q31 * S,
   uint8_t numStages,
   q31_t * pCoeffs,
@@ -3698,6 +4403,48 @@ void arm_rfft_fast_f32(
   float64_t * pState);
 
 
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter with interleaved channels.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;      /**< number of interleaved channels. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_multi_df2T_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. N channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data.
+   * @param[in]  blockSize  number of frames, of numChannels samples each, to process.
+   */
+  void arm_biquad_cascade_multi_df2T_f32(
+  const arm_biquad_cascade_multi_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter. N channels
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   */
+  void arm_biquad_cascade_multi_df2T_init_f32(
+  arm_biquad_cascade_multi_df2T_instance_f32 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+
   /**
    * @brief Instance structure for the Q15 FIR lattice filter.
    */
@@ -4405,6 +5152,258 @@ void arm_rfft_fast_f32(
   q7_t * pDst);
 
 
+  /**
+   * @brief Shortest kernel the FFT convolution and correlation functions take
+   * to the frequency domain. Below it they run the direct form. Measured with
+   * the arm_conv_fft cases of k3na_dsp (Sim/Src/dsp_main.c).
+   *
+   * The Q15 functions stay in direct form unless ARM_FFT_CONV_MIN_Q15 is
+   * set, as their FFT path is not as precise: against the direct form,
+   * whose results are those of arm_conv_q15(), it keeps about 42 dB SNR up
+   * to fftLen 128 and 6 dB less for each doubling above, 24 dB at 1024.
+   * Where that is enough, -DARM_FFT_CONV_MIN_Q15=128U is the crossover on
+   * the x86 host.
+   */
+#ifndef ARM_FFT_CONV_MIN_F32
+#define ARM_FFT_CONV_MIN_F32 32U
+#endif
+#ifndef ARM_FFT_CONV_MIN_Q15
+#define ARM_FFT_CONV_MIN_Q15 0xFFFFFFFFU
+#endif
+
+  /**
+   * @brief Instance structure for the floating-point overlap-save FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;                 /**< number of filter coefficients in the filter. */
+    uint16_t fftLen;                  /**< length of the FFT, 0 when the filter runs in direct form. */
+    uint16_t blockLen;                /**< input samples per FFT frame, fftLen - numTaps + 1. */
+    float32_t *pState;                /**< points to the state variable array. The array is of length numTaps-1. */
+    float32_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps. */
+    float32_t *pSpectrum;             /**< points to the spectrum of the coefficients. The array is of length fftLen. */
+    float32_t *pScratch;              /**< points to the scratch buffer. The array is of length 2*fftLen. */
+    arm_rfft_fast_instance_f32 rfft;  /**< real FFT of fftLen points. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 overlap-save FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;                 /**< number of filter coefficients in the filter. */
+    uint16_t fftLen;                  /**< length of the FFT, 0 when the filter runs in direct form. */
+    uint16_t blockLen;                /**< input samples per FFT frame, fftLen - numTaps + 1. */
+    int16_t outShift;                 /**< left shift of the inverse FFT output before the frame exponents. */
+    q15_t *pState;                    /**< points to the state variable array. The array is of length numTaps-1. */
+    q15_t *pCoeffs;                   /**< points to the coefficient array. The array is of length numTaps. */
+    q15_t *pSpectrum;                 /**< points to the normalized spectrum of the coefficients. The array is of length fftLen+2. */
+    q15_t *pScratch;                  /**< points to the scratch buffer. The array is of length 3*fftLen. */
+    arm_rfft_instance_q15 rfft;       /**< real FFT of fftLen points. */
+    arm_rfft_instance_q15 rifft;      /**< real inverse FFT of fftLen points. */
+  } arm_fir_fft_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point overlap-save FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point overlap-save FIR filter structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients, in time reversed order as for arm_fir_f32().
+   * @param[in]     pState     points to the state buffer of numTaps-1 values.
+   * @param[in]     pSpectrum  points to the coefficient spectrum buffer of fftLen values.
+   * @param[in]     pScratch   points to the scratch buffer of 2*fftLen values.
+   * @param[in]     fftLen     length of the FFT, a power of two from 32 to 4096 and at least numTaps.
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+   */
+  arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pSpectrum,
+  float32_t * pScratch,
+  uint16_t fftLen);
+
+  /**
+   * @brief  Initialization function for the Q15 overlap-save FIR filter.
+   * @param[in,out] S          points to an instance of the Q15 overlap-save FIR filter structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients, in time reversed order as for arm_fir_q15().
+   * @param[in]     pState     points to the state buffer of numTaps-1 values.
+   * @param[in]     pSpectrum  points to the coefficient spectrum buffer of fftLen+2 values.
+   * @param[in]     pScratch   points to the scratch buffer of 3*fftLen values.
+   * @param[in]     fftLen     length of the FFT, a power of two from 32 to 8192 and at least numTaps.
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+   */
+  arm_status arm_fir_fft_init_q15(
+  arm_fir_fft_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  q15_t * pSpectrum,
+  q15_t * pScratch,
+  uint16_t fftLen);
+
+  /**
+   * @brief Processing function for the floating-point overlap-save FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point overlap-save FIR filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, may be pSrc.
+   * @param[in]     blockSize  number of samples to process, any number.
+   */
+  void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q15 overlap-save FIR filter.
+   * @param[in,out] S          points to an instance of the Q15 overlap-save FIR filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, may be pSrc.
+   * @param[in]     blockSize  number of samples to process, any number.
+   */
+  void arm_fir_fft_q15(
+  arm_fir_fft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Convolution of floating-point sequences by overlap-save FFT.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the location where the output result is written.  Length srcALen+srcBLen-1.
+   * @param[in]  pScratch  points to the scratch buffer of 3*fftLen values.
+   * @param[in]  fftLen    length of the FFT, a power of two from 32 to 4096 and at least min(srcALen, srcBLen).
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+   */
+  arm_status arm_conv_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch,
+  uint16_t fftLen);
+
+  /**
+   * @brief Convolution of Q15 sequences by overlap-save FFT.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the location where the output result is written.  Length srcALen+srcBLen-1.
+   * @param[in]  pScratch  points to the scratch buffer of 4*fftLen+2 values.
+   * @param[in]  fftLen    length of the FFT, a power of two from 32 to 8192 and at least min(srcALen, srcBLen).
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+   */
+  arm_status arm_conv_fft_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pScratch,
+  uint16_t fftLen);
+
+  /**
+   * @brief Correlation of floating-point sequences by overlap-save FFT.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch  points to the scratch buffer of 3*fftLen values.
+   * @param[in]  fftLen    length of the FFT, a power of two from 32 to 4096 and at least min(srcALen, srcBLen).
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+   */
+  arm_status arm_correlate_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch,
+  uint16_t fftLen);
+
+  /**
+   * @brief Correlation of Q15 sequences by overlap-save FFT.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch  points to the scratch buffer of 4*fftLen+2 values.
+   * @param[in]  fftLen    length of the FFT, a power of two from 32 to 8192 and at least min(srcALen, srcBLen).
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+   */
+  arm_status arm_correlate_fft_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pScratch,
+  uint16_t fftLen);
+
+  /**
+   * @brief Convolution of floating-point sequences in overlap-save frames, the
+   * FFT or the direct form as asked, whatever ARM_FFT_CONV_MIN_F32.
+   * @param[in]  pKernel     points to the first kernel value, in natural order.
+   * @param[in]  kernelInc   step from one kernel value to the next, 1 or -1.
+   * @param[in]  kernelLen   length of the kernel, at most fftLen.
+   * @param[in]  pSrc        points to the first input value.
+   * @param[in]  srcInc      step from one input value to the next, 1 or -1.
+   * @param[in]  srcLen      length of the input.
+   * @param[out] pDst        points to the srcLen+kernelLen-1 outputs.
+   * @param[in]  pScratch    points to the scratch buffer of 3*fftLen values.
+   * @param[in]  fftLen      length of the FFT, a power of two from 32 to 4096.
+   * @param[in]  directFlag  FFT if flag is 0, direct form if flag is 1.
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+   */
+  arm_status arm_conv_fft_ols_f32(
+  const float32_t * pKernel,
+  int32_t kernelInc,
+  uint32_t kernelLen,
+  const float32_t * pSrc,
+  int32_t srcInc,
+  uint32_t srcLen,
+  float32_t * pDst,
+  float32_t * pScratch,
+  uint16_t fftLen,
+  uint8_t directFlag);
+
+  /**
+   * @brief Convolution of Q15 sequences in overlap-save frames, the FFT or the
+   * direct form as asked, whatever ARM_FFT_CONV_MIN_Q15.
+   * @param[in]  pKernel     points to the first kernel value, in natural order.
+   * @param[in]  kernelInc   step from one kernel value to the next, 1 or -1.
+   * @param[in]  kernelLen   length of the kernel, at most fftLen.
+   * @param[in]  pSrc        points to the first input value.
+   * @param[in]  srcInc      step from one input value to the next, 1 or -1.
+   * @param[in]  srcLen      length of the input.
+   * @param[out] pDst        points to the srcLen+kernelLen-1 outputs.
+   * @param[in]  pScratch    points to the scratch buffer of 4*fftLen+2 values.
+   * @param[in]  fftLen      length of the FFT, a power of two from 32 to 8192.
+   * @param[in]  directFlag  FFT if flag is 0, direct form if flag is 1.
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+   */
+  arm_status arm_conv_fft_ols_q15(
+  const q15_t * pKernel,
+  int32_t kernelInc,
+  uint32_t kernelLen,
+  const q15_t * pSrc,
+  int32_t srcInc,
+  uint32_t srcLen,
+  q15_t * pDst,
+  q15_t * pScratch,
+  uint16_t fftLen,
+  uint8_t directFlag);
+
+
   /**
    * @brief Instance structure for the floating-point sparse FIR filter.
    */
@@ -5780,6 +6779,306 @@ void arm_rfft_fast_f32(
    */
 
 
+  /**
+   * @brief  Reciprocal of a Q15 value.
+   * @param[in]  in      input value, not 0.
+   * @param[out] pOut    mantissa of 1/in in [0.5, 1) or (-1, -0.5].
+   * @param[out] pShift  1/in = out * 2^shift.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0.
+   */
+  arm_status arm_reciprocal_q15(
+  q15_t in,
+  q15_t * pOut,
+  int16_t * pShift);
+
+
+  /**
+   * @brief  Reciprocals of a block of Q15 values.
+   * @param[in]  pSrc       points to the input values.
+   * @param[out] pDst       points to the mantissas.
+   * @param[out] pShift     points to the shifts.
+   * @param[in]  blockSize  number of values.
+   */
+  void arm_vreciprocal_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  int16_t * pShift,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Reciprocal of a Q31 value.
+   * @param[in]  in      input value, not 0.
+   * @param[out] pOut    mantissa of 1/in in [0.5, 1) or (-1, -0.5].
+   * @param[out] pShift  1/in = out * 2^shift.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0.
+   */
+  arm_status arm_reciprocal_q31(
+  q31_t in,
+  q31_t * pOut,
+  int16_t * pShift);
+
+
+  /**
+   * @brief  Reciprocals of a block of Q31 values.
+   * @param[in]  pSrc       points to the input values.
+   * @param[out] pDst       points to the mantissas.
+   * @param[out] pShift     points to the shifts.
+   * @param[in]  blockSize  number of values.
+   */
+  void arm_vreciprocal_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  int16_t * pShift,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Inverse square root of a Q15 value.
+   * @param[in]  in      input value, positive.
+   * @param[out] pOut    mantissa of 1/sqrt(in) in [0.5, 1).
+   * @param[out] pShift  1/sqrt(in) = out * 2^shift.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0 and negative values.
+   */
+  arm_status arm_inv_sqrt_q15(
+  q15_t in,
+  q15_t * pOut,
+  int16_t * pShift);
+
+
+  /**
+   * @brief  Inverse square roots of a block of Q15 values.
+   * @param[in]  pSrc       points to the input values.
+   * @param[out] pDst       points to the mantissas.
+   * @param[out] pShift     points to the shifts.
+   * @param[in]  blockSize  number of values.
+   */
+  void arm_vinv_sqrt_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  int16_t * pShift,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Inverse square root of a Q31 value.
+   * @param[in]  in      input value, positive.
+   * @param[out] pOut    mantissa of 1/sqrt(in) in [0.5, 1).
+   * @param[out] pShift  1/sqrt(in) = out * 2^shift.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0 and negative values.
+   */
+  arm_status arm_inv_sqrt_q31(
+  q31_t in,
+  q31_t * pOut,
+  int16_t * pShift);
+
+
+  /**
+   * @brief  Inverse square roots of a block of Q31 values.
+   * @param[in]  pSrc       points to the input values.
+   * @param[out] pDst       points to the mantissas.
+   * @param[out] pShift     points to the shifts.
+   * @param[in]  blockSize  number of values.
+   */
+  void arm_vinv_sqrt_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  int16_t * pShift,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Base 2 logarithm of a Q15 value.
+   * @param[in]  in    input value, positive.
+   * @param[out] pOut  log2(in) in Q4.11.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0 and negative values.
+   */
+  arm_status arm_log2_q15(
+  q15_t in,
+  q15_t * pOut);
+
+
+  /**
+   * @brief  Base 2 logarithms of a block of Q15 values.
+   * @param[in]  pSrc       points to the input values.
+   * @param[out] pDst       points to the logarithms in Q4.11.
+   * @param[in]  blockSize  number of values.
+   */
+  void arm_vlog2_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Natural logarithm of a Q15 value.
+   * @param[in]  in    input value, positive.
+   * @param[out] pOut  ln(in) in Q4.11.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0 and negative values.
+   */
+  arm_status arm_log_q15(
+  q15_t in,
+  q15_t * pOut);
+
+
+  /**
+   * @brief  Natural logarithms of a block of Q15 values.
+   * @param[in]  pSrc       points to the input values.
+   * @param[out] pDst       points to the logarithms in Q4.11.
+   * @param[in]  blockSize  number of values.
+   */
+  void arm_vlog_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Base 2 logarithm of a Q31 value.
+   * @param[in]  in    input value, positive.
+   * @param[out] pOut  log2(in) in Q5.26.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0 and negative values.
+   */
+  arm_status arm_log2_q31(
+  q31_t in,
+  q31_t * pOut);
+
+
+  /**
+   * @brief  Base 2 logarithms of a block of Q31 values.
+   * @param[in]  pSrc       points to the input values.
+   * @param[out] pDst       points to the logarithms in Q5.26.
+   * @param[in]  blockSize  number of values.
+   */
+  void arm_vlog2_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Natural logarithm of a Q31 value.
+   * @param[in]  in    input value, positive.
+   * @param[out] pOut  ln(in) in Q5.26.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0 and negative values.
+   */
+  arm_status arm_log_q31(
+  q31_t in,
+  q31_t * pOut);
+
+
+  /**
+   * @brief  Natural logarithms of a block of Q31 values.
+   * @param[in]  pSrc       points to the input values.
+   * @param[out] pDst       points to the logarithms in Q5.26.
+   * @param[in]  blockSize  number of values.
+   */
+  void arm_vlog_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Base 2 exponential of a Q4.11 value.
+   * @param[in]  in    exponent in Q4.11, 0 or below.
+   * @param[out] pOut  2^in in Q15.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for positive values.
+   */
+  arm_status arm_exp2_q15(
+  q15_t in,
+  q15_t * pOut);
+
+
+  /**
+   * @brief  Base 2 exponentials of a block of Q4.11 values.
+   * @param[in]  pSrc       points to the exponents in Q4.11.
+   * @param[out] pDst       points to the results in Q15.
+   * @param[in]  blockSize  number of values.
+   */
+  void arm_vexp2_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Base 2 exponential of a Q5.26 value.
+   * @param[in]  in    exponent in Q5.26, 0 or below.
+   * @param[out] pOut  2^in in Q31.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for positive values.
+   */
+  arm_status arm_exp2_q31(
+  q31_t in,
+  q31_t * pOut);
+
+
+  /**
+   * @brief  Base 2 exponentials of a block of Q5.26 values.
+   * @param[in]  pSrc       points to the exponents in Q5.26.
+   * @param[out] pDst       points to the results in Q31.
+   * @param[in]  blockSize  number of values.
+   */
+  void arm_vexp2_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Four quadrant arctangent of Q15 values.
+   * @param[in]  y     ordinate.
+   * @param[in]  x     abscissa.
+   * @param[out] pOut  angle of (x, y) divided by pi.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for (0, 0).
+   */
+  arm_status arm_atan2_q15(
+  q15_t y,
+  q15_t x,
+  q15_t * pOut);
+
+
+  /**
+   * @brief  Four quadrant arctangents of a block of Q15 points.
+   * @param[in]  pSrcY      points to the ordinates.
+   * @param[in]  pSrcX      points to the abscissas.
+   * @param[out] pDst       points to the angles divided by pi.
+   * @param[in]  blockSize  number of points.
+   */
+  void arm_vatan2_q15(
+  const q15_t * pSrcY,
+  const q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Four quadrant arctangent of Q31 values.
+   * @param[in]  y     ordinate.
+   * @param[in]  x     abscissa.
+   * @param[out] pOut  angle of (x, y) divided by pi.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for (0, 0).
+   */
+  arm_status arm_atan2_q31(
+  q31_t y,
+  q31_t x,
+  q31_t * pOut);
+
+
+  /**
+   * @brief  Four quadrant arctangents of a block of Q31 points.
+   * @param[in]  pSrcY      points to the ordinates.
+   * @param[in]  pSrcX      points to the abscissas.
+   * @param[out] pDst       points to the angles divided by pi.
+   * @param[in]  blockSize  number of points.
+   */
+  void arm_vatan2_q31(
+  const q31_t * pSrcY,
+  const q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @brief floating-point Circular write function.
    */
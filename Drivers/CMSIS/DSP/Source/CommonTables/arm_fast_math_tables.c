@@ -0,0 +1,203 @@
+/* Generated by Tools/fastmath_tables.py, do not edit */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @brief  1 / (2a) for a = 0.5 + k/64, k = 0 to 32, 32768 = 1.0
+ */
+const uint16_t reciprocalTable_q15[33] = {
+	32768, 31775, 30840, 29959, 29127, 28340, 27594, 26887, 26214, 25575, 24966, 24385,
+	23831, 23302, 22795, 22310, 21845, 21400, 20972, 20560, 20165, 19784, 19418, 19065,
+	18725, 18396, 18079, 17772, 17476, 17190, 16913, 16644, 16384,
+};
+
+/**
+ * @brief  1 / (2 sqrt(a)) for a = (16 + k) / 64, k = 0 to 48, 32768 = 1.0
+ */
+const uint16_t invSqrtTable_q15[49] = {
+	32768, 31790, 30894, 30070, 29309, 28602, 27945, 27330, 26755, 26214, 25705, 25225,
+	24770, 24339, 23930, 23541, 23170, 22817, 22479, 22155, 21845, 21548, 21263, 20988,
+	20724, 20470, 20225, 19988, 19760, 19539, 19326, 19119, 18919, 18725, 18536, 18354,
+	18176, 18004, 17837, 17674, 17515, 17361, 17211, 17064, 16921, 16782, 16646, 16514,
+	16384,
+};
+
+/**
+ * @brief  log2(1 + k/32), k = 0 to 32, 32768 = 1.0
+ */
+const uint16_t log2Table_q15[33] = {
+	0, 1455, 2866, 4236, 5568, 6863, 8124, 9352, 10549, 11716, 12855, 13968,
+	15055, 16117, 17156, 18173, 19168, 20143, 21098, 22034, 22952, 23852, 24736, 25604,
+	26455, 27292, 28114, 28922, 29717, 30498, 31267, 32024, 32768,
+};
+
+/**
+ * @brief  2^(k/64) / 2, k = 0 to 64, 32768 = 1.0
+ */
+const uint16_t exp2Table_q15[65] = {
+	16384, 16562, 16743, 16925, 17109, 17296, 17484, 17674, 17867, 18061, 18258, 18457,
+	18658, 18861, 19066, 19274, 19484, 19696, 19911, 20127, 20347, 20568, 20792, 21019,
+	21247, 21479, 21713, 21949, 22188, 22430, 22674, 22921, 23170, 23423, 23678, 23936,
+	24196, 24460, 24726, 24995, 25268, 25543, 25821, 26102, 26386, 26674, 26964, 27258,
+	27554, 27855, 28158, 28464, 28774, 29088, 29405, 29725, 30048, 30376, 30706, 31041,
+	31379, 31720, 32066, 32415, 32768,
+};
+
+/**
+ * @brief  atan(k/64) / pi, k = 0 to 64, 32768 = 1.0
+ */
+const uint16_t atanTable_q15[65] = {
+	0, 163, 326, 489, 651, 813, 975, 1136, 1297, 1457, 1617, 1775,
+	1933, 2090, 2246, 2401, 2555, 2708, 2860, 3010, 3159, 3307, 3453, 3599,
+	3742, 3884, 4025, 4164, 4302, 4438, 4572, 4705, 4836, 4966, 5094, 5220,
+	5344, 5467, 5589, 5708, 5826, 5943, 6058, 6171, 6282, 6392, 6500, 6607,
+	6712, 6815, 6917, 7018, 7117, 7214, 7310, 7405, 7498, 7589, 7679, 7768,
+	7856, 7942, 8026, 8110, 8192,
+};
+
+/**
+ * @brief  log2(1 + t) in 32 segments of t, c0 to c3 of each in 1.31
+ */
+const q31_t log2Table_q31[128] = {
+	(q31_t)0x00000005, (q31_t)0x05C55129, (q31_t)0xFFE8EE2C, (q31_t)0x00007588,
+	(q31_t)0x05AEB4E2, (q31_t)0x05988CD2, (q31_t)0xFFEA4E7D, (q31_t)0x00006B51,
+	(q31_t)0x0B31FB82, (q31_t)0x056E6A9C, (q31_t)0xFFEB9032, (q31_t)0x00006240,
+	(q31_t)0x108C5891, (q31_t)0x0546B0C0, (q31_t)0xFFECB6BF, (q31_t)0x00005A2E,
+	(q31_t)0x15C01A3D, (q31_t)0x05212BE1, (q31_t)0xFFEDC51B, (q31_t)0x000052F8,
+	(q31_t)0x1ACF5E31, (q31_t)0x04FDAE2F, (q31_t)0xFFEEBDDA, (q31_t)0x00004C82,
+	(q31_t)0x1FBC16BC, (q31_t)0x04DC0EAF, (q31_t)0xFFEFA33C, (q31_t)0x000046B3,
+	(q31_t)0x24880F59, (q31_t)0x04BC2896, (q31_t)0xFFF07735, (q31_t)0x00004176,
+	(q31_t)0x2934F09A, (q31_t)0x049DDACB, (q31_t)0xFFF13B7D, (q31_t)0x00003CBB,
+	(q31_t)0x2DC4439D, (q31_t)0x0481076E, (q31_t)0xFFF1F197, (q31_t)0x00003872,
+	(q31_t)0x32377514, (q31_t)0x04659376, (q31_t)0xFFF29AD8, (q31_t)0x0000348E,
+	(q31_t)0x368FD7F0, (q31_t)0x044B665F, (q31_t)0xFFF3386F, (q31_t)0x00003103,
+	(q31_t)0x3ACEA7C2, (q31_t)0x043269E1, (q31_t)0xFFF3CB68, (q31_t)0x00002DC8,
+	(q31_t)0x3EF50AD3, (q31_t)0x041A89AB, (q31_t)0xFFF454B2, (q31_t)0x00002AD4,
+	(q31_t)0x43041405, (q31_t)0x0403B336, (q31_t)0xFFF4D521, (q31_t)0x00002820,
+	(q31_t)0x46FCC47C, (q31_t)0x03EDD589, (q31_t)0xFFF54D75, (q31_t)0x000025A5,
+	(q31_t)0x4AE00D1E, (q31_t)0x03D8E118, (q31_t)0xFFF5BE58, (q31_t)0x0000235D,
+	(q31_t)0x4EAECFEC, (q31_t)0x03C4C79C, (q31_t)0xFFF62865, (q31_t)0x00002143,
+	(q31_t)0x5269E130, (q31_t)0x03B17BF2, (q31_t)0xFFF68C26, (q31_t)0x00001F53,
+	(q31_t)0x5612089B, (q31_t)0x039EF1FE, (q31_t)0xFFF6EA17, (q31_t)0x00001D89,
+	(q31_t)0x59A8023A, (q31_t)0x038D1E93, (q31_t)0xFFF742AB, (q31_t)0x00001BE1,
+	(q31_t)0x5D2C7F5A, (q31_t)0x037BF75D, (q31_t)0xFFF79648, (q31_t)0x00001A58,
+	(q31_t)0x60A02758, (q31_t)0x036B72C9, (q31_t)0xFFF7E54C, (q31_t)0x000018EC,
+	(q31_t)0x64039859, (q31_t)0x035B87FA, (q31_t)0xFFF8300A, (q31_t)0x00001799,
+	(q31_t)0x675767F6, (q31_t)0x034C2EB2, (q31_t)0xFFF876D0, (q31_t)0x0000165E,
+	(q31_t)0x6A9C23D7, (q31_t)0x033D5F49, (q31_t)0xFFF8B9E6, (q31_t)0x00001538,
+	(q31_t)0x6DD2523E, (q31_t)0x032F129C, (q31_t)0xFFF8F98B, (q31_t)0x00001427,
+	(q31_t)0x70FA728C, (q31_t)0x03214207, (q31_t)0xFFF935FB, (q31_t)0x00001327,
+	(q31_t)0x7414FDB5, (q31_t)0x0313E754, (q31_t)0xFFF96F6C, (q31_t)0x00001238,
+	(q31_t)0x772266AD, (q31_t)0x0306FCB8, (q31_t)0xFFF9A610, (q31_t)0x00001158,
+	(q31_t)0x7A231ACE, (q31_t)0x02FA7CC6, (q31_t)0xFFF9DA15, (q31_t)0x00001086,
+	(q31_t)0x7D178230, (q31_t)0x02EE626B, (q31_t)0xFFFA0BA5, (q31_t)0x00000FC1,
+};
+
+/**
+ * @brief  2^t / 2 in 32 segments of t, c0 to c3 of each in 1.31
+ */
+const q31_t exp2Table_q31[128] = {
+	(q31_t)0x40000000, (q31_t)0x0162E432, (q31_t)0x0003D7EB, (q31_t)0x0000072F,
+	(q31_t)0x4166C34C, (q31_t)0x016AA99A, (q31_t)0x0003ED77, (q31_t)0x00000757,
+	(q31_t)0x42D561B4, (q31_t)0x01729A91, (q31_t)0x0004037B, (q31_t)0x00000780,
+	(q31_t)0x444C0740, (q31_t)0x017AB80D, (q31_t)0x000419FB, (q31_t)0x000007AA,
+	(q31_t)0x45CAE0F2, (q31_t)0x01830306, (q31_t)0x000430F9, (q31_t)0x000007D5,
+	(q31_t)0x47521CC6, (q31_t)0x018B7C7C, (q31_t)0x00044877, (q31_t)0x00000801,
+	(q31_t)0x48E1E9BA, (q31_t)0x01942573, (q31_t)0x0004607A, (q31_t)0x0000082E,
+	(q31_t)0x4A7A77D4, (q31_t)0x019CFEF6, (q31_t)0x00047903, (q31_t)0x0000085C,
+	(q31_t)0x4C1BF829, (q31_t)0x01A60A14, (q31_t)0x00049215, (q31_t)0x0000088A,
+	(q31_t)0x4DC69CDD, (q31_t)0x01AF47E4, (q31_t)0x0004ABB5, (q31_t)0x000008BA,
+	(q31_t)0x4F7A9930, (q31_t)0x01B8B983, (q31_t)0x0004C5E3, (q31_t)0x000008EB,
+	(q31_t)0x51382181, (q31_t)0x01C26011, (q31_t)0x0004E0A5, (q31_t)0x0000091D,
+	(q31_t)0x52FF6B55, (q31_t)0x01CC3CB9, (q31_t)0x0004FBFC, (q31_t)0x00000950,
+	(q31_t)0x54D0AD5A, (q31_t)0x01D650A9, (q31_t)0x000517ED, (q31_t)0x00000985,
+	(q31_t)0x56AC1F75, (q31_t)0x01E09D17, (q31_t)0x0005347A, (q31_t)0x000009BA,
+	(q31_t)0x5891FAC1, (q31_t)0x01EB2341, (q31_t)0x000551A8, (q31_t)0x000009F0,
+	(q31_t)0x5A82799A, (q31_t)0x01F5E469, (q31_t)0x00056F79, (q31_t)0x00000A28,
+	(q31_t)0x5C7DD7A4, (q31_t)0x0200E1DA, (q31_t)0x00058DF1, (q31_t)0x00000A61,
+	(q31_t)0x5E8451D0, (q31_t)0x020C1CE6, (q31_t)0x0005AD14, (q31_t)0x00000A9B,
+	(q31_t)0x60962665, (q31_t)0x021796E7, (q31_t)0x0005CCE5, (q31_t)0x00000AD7,
+	(q31_t)0x62B39509, (q31_t)0x0223513E, (q31_t)0x0005ED69, (q31_t)0x00000B13,
+	(q31_t)0x64DCDEC3, (q31_t)0x022F4D52, (q31_t)0x00060EA3, (q31_t)0x00000B52,
+	(q31_t)0x6712460A, (q31_t)0x023B8C96, (q31_t)0x00063098, (q31_t)0x00000B91,
+	(q31_t)0x69540EC9, (q31_t)0x02481080, (q31_t)0x0006534A, (q31_t)0x00000BD2,
+	(q31_t)0x6BA27E65, (q31_t)0x0254DA93, (q31_t)0x000676C0, (q31_t)0x00000C14,
+	(q31_t)0x6DFDDBCC, (q31_t)0x0261EC57, (q31_t)0x00069AFC, (q31_t)0x00000C58,
+	(q31_t)0x70666F76, (q31_t)0x026F475E, (q31_t)0x0006C003, (q31_t)0x00000C9D,
+	(q31_t)0x72DC8374, (q31_t)0x027CED43, (q31_t)0x0006E5D9, (q31_t)0x00000CE4,
+	(q31_t)0x75606374, (q31_t)0x028ADFAA, (q31_t)0x00070C84, (q31_t)0x00000D2C,
+	(q31_t)0x77F25CCE, (q31_t)0x0299203F, (q31_t)0x00073408, (q31_t)0x00000D76,
+	(q31_t)0x7A92BE8A, (q31_t)0x02A7B0B9, (q31_t)0x00075C69, (q31_t)0x00000DC1,
+	(q31_t)0x7D41D96E, (q31_t)0x02B692D8, (q31_t)0x000785AC, (q31_t)0x00000E0E,
+};
+
+/**
+ * @brief  atan(t) / pi in 64 segments of t, c0 to c3 of each in 1.31
+ */
+const q31_t atanTable_q31[256] = {
+	(q31_t)0x00000000, (q31_t)0x00A2F983, (q31_t)0x00000000, (q31_t)0xFFFFFC9B,
+	(q31_t)0x00A2F61E, (q31_t)0x00A2EF55, (q31_t)0xFFFFF5D1, (q31_t)0xFFFFFC9E,
+	(q31_t)0x0145D7E1, (q31_t)0x00A2D0D0, (q31_t)0xFFFFEBA9, (q31_t)0xFFFFFCA3,
+	(q31_t)0x01E890FD, (q31_t)0x00A29E0B, (q31_t)0xFFFFE191, (q31_t)0xFFFFFCAA,
+	(q31_t)0x028B0D43, (q31_t)0x00A2572D, (q31_t)0xFFFFD78F, (q31_t)0xFFFFFCB4,
+	(q31_t)0x032D38B4, (q31_t)0x00A1FC6A, (q31_t)0xFFFFCDAC, (q31_t)0xFFFFFCC1,
+	(q31_t)0x03CEFF8A, (q31_t)0x00A18E05, (q31_t)0xFFFFC3ED, (q31_t)0xFFFFFCCF,
+	(q31_t)0x04704E4B, (q31_t)0x00A10C4F, (q31_t)0xFFFFBA5A, (q31_t)0xFFFFFCE0,
+	(q31_t)0x051111D4, (q31_t)0x00A077A6, (q31_t)0xFFFFB0FA, (q31_t)0xFFFFFCF3,
+	(q31_t)0x05B13767, (q31_t)0x009FD075, (q31_t)0xFFFFA7D2, (q31_t)0xFFFFFD08,
+	(q31_t)0x0650ACB7, (q31_t)0x009F1734, (q31_t)0xFFFF9EE9, (q31_t)0xFFFFFD1E,
+	(q31_t)0x06EF5FF2, (q31_t)0x009E4C63, (q31_t)0xFFFF9643, (q31_t)0xFFFFFD36,
+	(q31_t)0x078D3FCE, (q31_t)0x009D7090, (q31_t)0xFFFF8DE6, (q31_t)0xFFFFFD50,
+	(q31_t)0x082A3B95, (q31_t)0x009C8450, (q31_t)0xFFFF85D6, (q31_t)0xFFFFFD6B,
+	(q31_t)0x08C64325, (q31_t)0x009B8840, (q31_t)0xFFFF7E17, (q31_t)0xFFFFFD87,
+	(q31_t)0x09614704, (q31_t)0x009A7D07, (q31_t)0xFFFF76AC, (q31_t)0xFFFFFDA4,
+	(q31_t)0x09FB385B, (q31_t)0x00996350, (q31_t)0xFFFF6F99, (q31_t)0xFFFFFDC2,
+	(q31_t)0x0A940907, (q31_t)0x00983BCD, (q31_t)0xFFFF68E0, (q31_t)0xFFFFFDE1,
+	(q31_t)0x0B2BAB95, (q31_t)0x00970734, (q31_t)0xFFFF6283, (q31_t)0xFFFFFE00,
+	(q31_t)0x0BC2134B, (q31_t)0x0095C63D, (q31_t)0xFFFF5C83, (q31_t)0xFFFFFE20,
+	(q31_t)0x0C57342A, (q31_t)0x009479A5, (q31_t)0xFFFF56E1, (q31_t)0xFFFFFE3F,
+	(q31_t)0x0CEB02EF, (q31_t)0x00932228, (q31_t)0xFFFF519F, (q31_t)0xFFFFFE5F,
+	(q31_t)0x0D7D7515, (q31_t)0x0091C086, (q31_t)0xFFFF4CBB, (q31_t)0xFFFFFE7E,
+	(q31_t)0x0E0E80D4, (q31_t)0x0090557B, (q31_t)0xFFFF4837, (q31_t)0xFFFFFE9E,
+	(q31_t)0x0E9E1D24, (q31_t)0x008EE1C6, (q31_t)0xFFFF4410, (q31_t)0xFFFFFEBD,
+	(q31_t)0x0F2C41B7, (q31_t)0x008D6620, (q31_t)0xFFFF4047, (q31_t)0xFFFFFEDB,
+	(q31_t)0x0FB8E6F9, (q31_t)0x008BE344, (q31_t)0xFFFF3CD9, (q31_t)0xFFFFFEF9,
+	(q31_t)0x1044060F, (q31_t)0x008A59E6, (q31_t)0xFFFF39C5, (q31_t)0xFFFFFF17,
+	(q31_t)0x10CD98D1, (q31_t)0x0088CAB8, (q31_t)0xFFFF370A, (q31_t)0xFFFFFF33,
+	(q31_t)0x115599C7, (q31_t)0x00873669, (q31_t)0xFFFF34A4, (q31_t)0xFFFFFF4F,
+	(q31_t)0x11DC0423, (q31_t)0x00859DA3, (q31_t)0xFFFF3292, (q31_t)0xFFFFFF6A,
+	(q31_t)0x1260D3C2, (q31_t)0x00840108, (q31_t)0xFFFF30D0, (q31_t)0xFFFFFF84,
+	(q31_t)0x12E4051E, (q31_t)0x00826137, (q31_t)0xFFFF2F5D, (q31_t)0xFFFFFF9D,
+	(q31_t)0x1365954F, (q31_t)0x0080BECB, (q31_t)0xFFFF2E34, (q31_t)0xFFFFFFB5,
+	(q31_t)0x13E58204, (q31_t)0x007F1A56, (q31_t)0xFFFF2D54, (q31_t)0xFFFFFFCC,
+	(q31_t)0x1463C97A, (q31_t)0x007D7466, (q31_t)0xFFFF2CB9, (q31_t)0xFFFFFFE2,
+	(q31_t)0x14E06A7B, (q31_t)0x007BCD80, (q31_t)0xFFFF2C5F, (q31_t)0xFFFFFFF7,
+	(q31_t)0x155B6450, (q31_t)0x007A2625, (q31_t)0xFFFF2C44, (q31_t)0x0000000B,
+	(q31_t)0x15D4B6C4, (q31_t)0x00787ED0, (q31_t)0xFFFF2C65, (q31_t)0x0000001D,
+	(q31_t)0x164C6217, (q31_t)0x0076D7F4, (q31_t)0xFFFF2CBD, (q31_t)0x0000002F,
+	(q31_t)0x16C266F7, (q31_t)0x007531FE, (q31_t)0xFFFF2D4B, (q31_t)0x00000040,
+	(q31_t)0x1736C67F, (q31_t)0x00738D54, (q31_t)0xFFFF2E0A, (q31_t)0x0000004F,
+	(q31_t)0x17A9822D, (q31_t)0x0071EA58, (q31_t)0xFFFF2EF8, (q31_t)0x0000005E,
+	(q31_t)0x181A9BDB, (q31_t)0x00704964, (q31_t)0xFFFF3012, (q31_t)0x0000006B,
+	(q31_t)0x188A15BC, (q31_t)0x006EAACB, (q31_t)0xFFFF3154, (q31_t)0x00000078,
+	(q31_t)0x18F7F252, (q31_t)0x006D0EDC, (q31_t)0xFFFF32BC, (q31_t)0x00000084,
+	(q31_t)0x1964346E, (q31_t)0x006B75E0, (q31_t)0xFFFF3447, (q31_t)0x0000008E,
+	(q31_t)0x19CEDF22, (q31_t)0x0069E019, (q31_t)0xFFFF35F2, (q31_t)0x00000098,
+	(q31_t)0x1A37F5C5, (q31_t)0x00684DC5, (q31_t)0xFFFF37BA, (q31_t)0x000000A1,
+	(q31_t)0x1A9F7BE5, (q31_t)0x0066BF1D, (q31_t)0xFFFF399D, (q31_t)0x000000A9,
+	(q31_t)0x1B057548, (q31_t)0x00653454, (q31_t)0xFFFF3B99, (q31_t)0x000000B1,
+	(q31_t)0x1B69E5E6, (q31_t)0x0063AD98, (q31_t)0xFFFF3DAB, (q31_t)0x000000B7,
+	(q31_t)0x1BCCD1E0, (q31_t)0x00622B14, (q31_t)0xFFFF3FD0, (q31_t)0x000000BD,
+	(q31_t)0x1C2E3D81, (q31_t)0x0060ACED, (q31_t)0xFFFF4208, (q31_t)0x000000C2,
+	(q31_t)0x1C8E2D38, (q31_t)0x005F3344, (q31_t)0xFFFF444F, (q31_t)0x000000C7,
+	(q31_t)0x1CECA593, (q31_t)0x005DBE38, (q31_t)0xFFFF46A4, (q31_t)0x000000CB,
+	(q31_t)0x1D49AB3B, (q31_t)0x005C4DE2, (q31_t)0xFFFF4905, (q31_t)0x000000CE,
+	(q31_t)0x1DA542F1, (q31_t)0x005AE259, (q31_t)0xFFFF4B71, (q31_t)0x000000D1,
+	(q31_t)0x1DFF718C, (q31_t)0x00597BAF, (q31_t)0xFFFF4DE5, (q31_t)0x000000D4,
+	(q31_t)0x1E583BF4, (q31_t)0x005819F5, (q31_t)0xFFFF5060, (q31_t)0x000000D6,
+	(q31_t)0x1EAFA71F, (q31_t)0x0056BD37, (q31_t)0xFFFF52E1, (q31_t)0x000000D7,
+	(q31_t)0x1F05B80E, (q31_t)0x0055657F, (q31_t)0xFFFF5567, (q31_t)0x000000D8,
+	(q31_t)0x1F5A73CD, (q31_t)0x005412D6, (q31_t)0xFFFF57F0, (q31_t)0x000000D9,
+	(q31_t)0x1FADDF6B, (q31_t)0x0052C541, (q31_t)0xFFFF5A7B, (q31_t)0x000000D9,
+};
@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_q15.c
+ * Description:  Q15 four quadrant arctangent
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup Atan2 Four Quadrant Arctangent
+ *
+ * Computes the angle of the point (x, y) as a fraction of pi, the format
+ * arm_sin_cos_q31() takes: -1 is -pi and +pi saturates to the largest
+ * value. The smaller of |x| and |y| is divided by the larger with the
+ * Newton-Raphson reciprocal of arm_reciprocal_q15() or
+ * arm_reciprocal_q31(), atan of the ratio t in [0, 1] is taken from a
+ * table and moved to its octant:
+ *
+ * <pre>
+ *            atan(t)/pi             max error     operations
+ *    Q15     65 entries, linear     1.5 LSB       1 CLZ, 4 table reads, 5 32-bit multiplies
+ *    Q31     64 segments, cubic     5 LSB         1 CLZ, 6 table reads, 1 32-bit and 8 64-bit multiplies
+ * </pre>
+ *
+ * Errors are in LSBs of the result, over inputs of any magnitude. The
+ * angle of (0, 0) is 0. The time does not depend on the values. The
+ * vector functions do a block of points with the same code inline.
+ */
+
+/**
+ * @addtogroup Atan2
+ * @{
+ */
+
+__STATIC_INLINE q15_t arm_atan2_one_q15(
+  q15_t y,
+  q15_t x)
+{
+  uint32_t ax, ay, mx, mn;                       /* |x|, |y|, the larger and the smaller */
+  uint32_t n, r, t, idx, frac, a;                /* Normalization, 1/(2 mx), ratio, table index, angle */
+  int32_t e;                                     /* 1 - 2 mx*r */
+
+  ax = (uint32_t) ((x < 0) ? -(int32_t) x : x);
+  ay = (uint32_t) ((y < 0) ? -(int32_t) y : y);
+  mx = (ay > ax) ? ay : ax;
+  mn = (ay > ax) ? ax : ay;
+
+  if (mx == 0U)
+  {
+    return (0);
+  }
+
+  /* mx normalized to [0.5, 1) with 16 fractional bits, mn along */
+  n = __CLZ(mx) - 16U;
+  mx <<= n;
+  mn <<= n;
+
+  /* 1/(2 mx) as arm_reciprocal_q15(), to 16 fractional bits */
+  idx = (mx >> 10) & 0x1FU;
+  frac = mx & 0x3FFU;
+  r = reciprocalTable_q15[idx] - ((((uint32_t) reciprocalTable_q15[idx] - reciprocalTable_q15[idx + 1U]) * frac) >> 10);
+  e = (int32_t) (0x80000000U - ((mx * r) << 1));
+  r = (r << 1) + (uint32_t) (((int32_t) r * (e >> 12)) >> 18);
+
+  /* t = mn/mx in [0, 1] with 16 fractional bits */
+  t = (mn * r) >> 15;
+  if (t > 0xFFFFU)
+  {
+    t = 0xFFFFU;
+  }
+
+  /* atan(t)/pi, 32768 = 1 */
+  idx = t >> 10;
+  frac = t & 0x3FFU;
+  a = atanTable_q15[idx] + (((((uint32_t) atanTable_q15[idx + 1U] - atanTable_q15[idx]) * frac) + 0x200U) >> 10);
+
+  /* To the octant */
+  if (ay > ax)
+  {
+    a = 0x4000U - a;
+  }
+  if (x < 0)
+  {
+    a = 0x8000U - a;
+  }
+  if (y < 0)
+  {
+    return ((q15_t) -(int32_t) a);
+  }
+
+  return ((a > 0x7FFFU) ? 0x7FFF : (q15_t) a);
+}
+
+/**
+ * @brief  Four quadrant arctangent of Q15 values.
+ * @param[in]  y     imaginary part or ordinate.
+ * @param[in]  x     real part or abscissa.
+ * @param[out] *pOut angle of (x, y) divided by pi.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for (0, 0) with out 0.
+ */
+arm_status arm_atan2_q15(
+  q15_t y,
+  q15_t x,
+  q15_t * pOut)
+{
+  *pOut = arm_atan2_one_q15(y, x);
+
+  return (((x == 0) && (y == 0)) ? ARM_MATH_ARGUMENT_ERROR : ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Four quadrant arctangents of a block of Q15 points.
+ * @param[in]  *pSrcY    points to the ordinates.
+ * @param[in]  *pSrcX    points to the abscissas.
+ * @param[out] *pDst     points to the angles divided by pi, as arm_atan2_q15().
+ * @param[in]  blockSize number of points.
+ * @return none.
+ */
+void arm_vatan2_q15(
+  const q15_t * pSrcY,
+  const q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  while (blockSize > 0U)
+  {
+    *pDst++ = arm_atan2_one_q15(*pSrcY++, *pSrcX++);
+    blockSize--;
+  }
+}
+
+/**
+ * @} end of Atan2 group
+ */
@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_q31.c
+ * Description:  Q31 four quadrant arctangent
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @addtogroup Atan2
+ * @{
+ */
+
+__STATIC_INLINE q31_t arm_atan2_one_q31(
+  q31_t y,
+  q31_t x)
+{
+  const q31_t *pC;                               /* Coefficients of the segment */
+  uint32_t ax, ay, mx, mn;                       /* |x|, |y|, the larger and the smaller */
+  uint32_t n, r, t, idx, frac, a;                /* Normalization, 1/(2 mx), ratio, table index, angle */
+  int32_t e;                                     /* 1 - 2 mx*r */
+  q31_t s, acc;                                  /* Position in the segment, atan(t)/pi */
+
+  ax = (x < 0) ? (0U - (uint32_t) x) : (uint32_t) x;
+  ay = (y < 0) ? (0U - (uint32_t) y) : (uint32_t) y;
+  mx = (ay > ax) ? ay : ax;
+  mn = (ay > ax) ? ax : ay;
+
+  if (mx == 0U)
+  {
+    return (0);
+  }
+
+  /* mx normalized to [0.5, 1) with 32 fractional bits, mn along */
+  n = __CLZ(mx);
+  mx <<= n;
+  mn <<= n;
+
+  /* 1/(2 mx) in 1.31 as arm_reciprocal_q31() */
+  idx = (mx >> 26) & 0x1FU;
+  frac = (mx >> 16) & 0x3FFU;
+  r = reciprocalTable_q15[idx] - ((((uint32_t) reciprocalTable_q15[idx] - reciprocalTable_q15[idx + 1U]) * frac) >> 10);
+  r <<= 16;
+  e = (int32_t) (0x80000000U - (uint32_t) (((uint64_t) mx * r) >> 31));
+  r += (uint32_t) (((int64_t) r * e) >> 31);
+  e = (int32_t) (0x80000000U - (uint32_t) (((uint64_t) mx * r) >> 31));
+  r += (uint32_t) ((((int64_t) r * e) + 0x40000000) >> 31);
+
+  /* t = mn/mx in [0, 1) in 1.31 */
+  t = (uint32_t) (((uint64_t) mn * r) >> 31);
+  if (t > 0x7FFFFFFFU)
+  {
+    t = 0x7FFFFFFFU;
+  }
+
+  /* atan(t)/pi in 1.31 */
+  pC = &atanTable_q31[4U * (t >> 25)];
+  s = (q31_t) ((t & 0x01FFFFFFU) << 6);
+
+  acc = pC[3];
+  acc = pC[2] + (q31_t) (((q63_t) acc * s) >> 31);
+  acc = pC[1] + (q31_t) (((q63_t) acc * s) >> 31);
+  acc = pC[0] + (q31_t) (((q63_t) acc * s) >> 31);
+  a = (uint32_t) acc;
+
+  /* To the octant */
+  if (ay > ax)
+  {
+    a = 0x40000000U - a;
+  }
+  if (x < 0)
+  {
+    a = 0x80000000U - a;
+  }
+  if (y < 0)
+  {
+    return ((q31_t) (0U - a));
+  }
+
+  return ((a > 0x7FFFFFFFU) ? 0x7FFFFFFF : (q31_t) a);
+}
+
+/**
+ * @brief  Four quadrant arctangent of Q31 values.
+ * @param[in]  y     imaginary part or ordinate.
+ * @param[in]  x     real part or abscissa.
+ * @param[out] *pOut angle of (x, y) divided by pi.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for (0, 0) with out 0.
+ */
+arm_status arm_atan2_q31(
+  q31_t y,
+  q31_t x,
+  q31_t * pOut)
+{
+  *pOut = arm_atan2_one_q31(y, x);
+
+  return (((x == 0) && (y == 0)) ? ARM_MATH_ARGUMENT_ERROR : ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Four quadrant arctangents of a block of Q31 points.
+ * @param[in]  *pSrcY    points to the ordinates.
+ * @param[in]  *pSrcX    points to the abscissas.
+ * @param[out] *pDst     points to the angles divided by pi, as arm_atan2_q31().
+ * @param[in]  blockSize number of points.
+ * @return none.
+ */
+void arm_vatan2_q31(
+  const q31_t * pSrcY,
+  const q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  while (blockSize > 0U)
+  {
+    *pDst++ = arm_atan2_one_q31(*pSrcY++, *pSrcX++);
+    blockSize--;
+  }
+}
+
+/**
+ * @} end of Atan2 group
+ */
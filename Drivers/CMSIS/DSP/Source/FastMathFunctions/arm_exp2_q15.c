@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_exp2_q15.c
+ * Description:  Q15 base 2 exponential
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup Exp2 Base 2 Exponential
+ *
+ * Computes 2^x of a negative fixed-point value, the inverse of
+ * arm_log2_q15() and arm_log2_q31(): x is in Q4.11 for a Q15 result and
+ * in Q5.26 for a Q31 result. x is split into an integer i and a fraction
+ * f in [0, 1), 2^f/2 is taken from a table and shifted right by -(i+1).
+ * A gain of g dB is <code>2^(g / 6.0206)</code>.
+ *
+ * <pre>
+ *            2^f/2                  max error     operations
+ *    Q15     65 entries, linear     1.3 LSB       2 table reads, 1 32-bit multiply
+ *    Q31     32 segments, cubic     4 LSB         4 table reads, 3 64-bit multiplies
+ * </pre>
+ *
+ * Errors are in LSBs of the result. 2^0 = 1 saturates to the largest
+ * value, larger x are out of range. The time does not depend on the
+ * value. The vector functions do a block of values with the same code
+ * inline.
+ */
+
+/**
+ * @addtogroup Exp2
+ * @{
+ */
+
+__STATIC_INLINE q15_t arm_exp2_one_q15(
+  q15_t in)
+{
+  uint32_t f, idx, frac, v, sh;                  /* Fraction, table index, 2^f/2, right shift */
+
+  if (in >= 0)
+  {
+    return (0x7FFF);
+  }
+
+  /* in = i + f, 2^in = 2^f/2 * 2^(i+1) with i + 1 <= 0 */
+  f = (uint32_t) in & 0x7FFU;
+  sh = (uint32_t) (-(((int32_t) in >> 11) + 1));
+
+  /* 2^f/2 with 20 fractional bits */
+  idx = f >> 5;
+  frac = f & 0x1FU;
+  v = ((uint32_t) exp2Table_q15[idx] << 5) + (((uint32_t) exp2Table_q15[idx + 1U] - exp2Table_q15[idx]) * frac);
+  v = (v + (0x10U << sh)) >> (5U + sh);
+
+  return ((v > 0x7FFFU) ? 0x7FFF : (q15_t) v);
+}
+
+/**
+ * @brief  Base 2 exponential of a Q4.11 value.
+ * @param[in]  in    exponent in Q4.11, 0 or below.
+ * @param[out] *pOut 2^in in Q15.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR above 0 with out 0x7FFF.
+ */
+arm_status arm_exp2_q15(
+  q15_t in,
+  q15_t * pOut)
+{
+  *pOut = arm_exp2_one_q15(in);
+
+  return ((in > 0) ? ARM_MATH_ARGUMENT_ERROR : ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Base 2 exponentials of a block of Q4.11 values.
+ * @param[in]  *pSrc     points to the exponents in Q4.11.
+ * @param[out] *pDst     points to 2^x of each in Q15, as arm_exp2_q15().
+ * @param[in]  blockSize number of values.
+ * @return none.
+ */
+void arm_vexp2_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  while (blockSize > 0U)
+  {
+    *pDst++ = arm_exp2_one_q15(*pSrc++);
+    blockSize--;
+  }
+}
+
+/**
+ * @} end of Exp2 group
+ */
@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_exp2_q31.c
+ * Description:  Q31 base 2 exponential
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @addtogroup Exp2
+ * @{
+ */
+
+__STATIC_INLINE q31_t arm_exp2_one_q31(
+  q31_t in)
+{
+  const q31_t *pC;                               /* Coefficients of the segment */
+  uint32_t f, sh;                                /* Fraction, right shift */
+  q31_t s, acc;                                  /* Position in the segment, 2^f/2 */
+
+  if (in >= 0)
+  {
+    return (0x7FFFFFFF);
+  }
+
+  /* in = i + f, 2^in = 2^f/2 * 2^(i+1) with i + 1 <= 0 */
+  f = (uint32_t) in & 0x03FFFFFFU;
+  sh = (uint32_t) (-((in >> 26) + 1));
+
+  pC = &exp2Table_q31[4U * (f >> 21)];
+  s = (q31_t) ((f & 0x001FFFFFU) << 10);
+
+  acc = pC[3];
+  acc = pC[2] + (q31_t) (((q63_t) acc * s) >> 31);
+  acc = pC[1] + (q31_t) (((q63_t) acc * s) >> 31);
+  acc = clip_q63_to_q31((q63_t) pC[0] + (((q63_t) acc * s) >> 31));
+
+  if (sh == 0U)
+  {
+    return (acc);
+  }
+
+  return ((q31_t) (((uint32_t) acc + (1U << (sh - 1U))) >> sh));
+}
+
+/**
+ * @brief  Base 2 exponential of a Q5.26 value.
+ * @param[in]  in    exponent in Q5.26, 0 or below.
+ * @param[out] *pOut 2^in in Q31.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR above 0 with out 0x7FFFFFFF.
+ */
+arm_status arm_exp2_q31(
+  q31_t in,
+  q31_t * pOut)
+{
+  *pOut = arm_exp2_one_q31(in);
+
+  return ((in > 0) ? ARM_MATH_ARGUMENT_ERROR : ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Base 2 exponentials of a block of Q5.26 values.
+ * @param[in]  *pSrc     points to the exponents in Q5.26.
+ * @param[out] *pDst     points to 2^x of each in Q31, as arm_exp2_q31().
+ * @param[in]  blockSize number of values.
+ * @return none.
+ */
+void arm_vexp2_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  while (blockSize > 0U)
+  {
+    *pDst++ = arm_exp2_one_q31(*pSrc++);
+    blockSize--;
+  }
+}
+
+/**
+ * @} end of Exp2 group
+ */
@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_inv_sqrt_q15.c
+ * Description:  Q15 inverse square root
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup InvSqrt Inverse Square Root
+ *
+ * Computes 1/sqrt(x) of a positive fixed-point fraction as a mantissa and
+ * a shift, <code>1/sqrt(x) = out * 2^shift</code>. x is normalized to
+ * a = [0.25, 1) with an even exponent, a seed of 1/(2 sqrt(a)) is
+ * interpolated from a 49 entry table and refined by Newton-Raphson steps
+ * r = r + r*(1 - 4a*r^2)/2, each of which doubles the correct bits:
+ *
+ * <pre>
+ *            seed       steps   max error of out   operations
+ *    Q15     10 bits    1       0.75 LSB           1 CLZ, 2 table reads, 4 32-bit multiplies
+ *    Q31     10 bits    2       2 LSB              1 CLZ, 2 table reads, 1 32-bit and 6 64-bit multiplies
+ * </pre>
+ *
+ * The mantissa is in [0.5, 1), 1/sqrt(x) of an even power of two comes
+ * out as 0.5 with one more shift. The time does not depend on the value.
+ * The vector functions do a block of values with the same code inline.
+ */
+
+/**
+ * @addtogroup InvSqrt
+ * @{
+ */
+
+__STATIC_INLINE arm_status arm_inv_sqrt_one_q15(
+  q15_t in,
+  q15_t * pOut,
+  int16_t * pShift)
+{
+  uint32_t a, r, u, t, n, idx, frac;             /* Mantissa, 1/(2 sqrt(a)), products, table index */
+  int32_t e, exp;                                /* 1 - 4a*r^2, exponent of in */
+
+  if (in <= 0)
+  {
+    *pOut = (in == 0) ? 0x7FFF : 0;
+    *pShift = (in == 0) ? 16 : 0;
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* in = a * 2^exp with a in [0.25, 1) in 1.31 and exp even */
+  n = __CLZ((uint32_t) in) - 16U;
+  a = (uint32_t) in << (n + 15U);
+  exp = 1 - (int32_t) n;
+  if ((exp & 1) != 0)
+  {
+    a >>= 1;
+    exp++;
+  }
+
+  /* Seed interpolated from the table, 32768 = 1.0 */
+  idx = (a >> 25) - 16U;
+  frac = (a >> 15) & 0x3FFU;
+  r = invSqrtTable_q15[idx] - ((((uint32_t) invSqrtTable_q15[idx] - invSqrtTable_q15[idx + 1U]) * frac) >> 10);
+
+  /* One Newton-Raphson step, 4a*r^2 and e in 1.31 and r to 19 fractional bits */
+  u = ((a >> 14) * r) >> 14;
+  t = u * r;
+  e = (int32_t) (0x80000000U - t);
+  r = (r << 4) + (uint32_t) (((int32_t) r * (e >> 12)) >> 16);
+  r = (r + 8U) >> 4;
+
+  /* 1/(2 sqrt(a)) = 1 only for a = 0.25 */
+  exp = 1 - (exp / 2);
+  if (r >= 0x8000U)
+  {
+    r = 0x4000U;
+    exp++;
+  }
+
+  *pOut = (q15_t) r;
+  *pShift = (int16_t) exp;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Inverse square root of a Q15 value.
+ * @param[in]  in      input value, greater than 0.
+ * @param[out] *pOut   mantissa of 1/sqrt(in) in [0.5, 1).
+ * @param[out] *pShift 1/sqrt(in) = out * 2^shift, 1 to 8.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0 with out 0x7FFF and
+ *             shift 16, or for a negative value with out and shift 0.
+ */
+arm_status arm_inv_sqrt_q15(
+  q15_t in,
+  q15_t * pOut,
+  int16_t * pShift)
+{
+  return (arm_inv_sqrt_one_q15(in, pOut, pShift));
+}
+
+/**
+ * @brief  Inverse square roots of a block of Q15 values.
+ * @param[in]  *pSrc     points to the input values.
+ * @param[out] *pDst     points to the mantissas, as arm_inv_sqrt_q15().
+ * @param[out] *pShift   points to the shifts, one per value.
+ * @param[in]  blockSize number of values.
+ * @return none.
+ */
+void arm_vinv_sqrt_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  int16_t * pShift,
+  uint32_t blockSize)
+{
+  while (blockSize > 0U)
+  {
+    (void) arm_inv_sqrt_one_q15(*pSrc++, pDst++, pShift++);
+    blockSize--;
+  }
+}
+
+/**
+ * @} end of InvSqrt group
+ */
@@ -0,0 +1,129 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_inv_sqrt_q31.c
+ * Description:  Q31 inverse square root
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @addtogroup InvSqrt
+ * @{
+ */
+
+__STATIC_INLINE arm_status arm_inv_sqrt_one_q31(
+  q31_t in,
+  q31_t * pOut,
+  int16_t * pShift)
+{
+  uint32_t a, r, r2, n, idx, frac;               /* Mantissa, 1/(2 sqrt(a)), r^2, table index */
+  int32_t e, exp;                                /* 1 - 4a*r^2, exponent of in */
+
+  if (in <= 0)
+  {
+    *pOut = (in == 0) ? 0x7FFFFFFF : 0;
+    *pShift = (in == 0) ? 32 : 0;
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* in = a * 2^exp with a in [0.25, 1) in 0.32 and exp even */
+  n = __CLZ((uint32_t) in);
+  a = (uint32_t) in << n;
+  exp = 1 - (int32_t) n;
+  if ((exp & 1) != 0)
+  {
+    a >>= 1;
+    exp++;
+  }
+
+  /* Seed interpolated from the table, to 1.31 */
+  idx = (a >> 26) - 16U;
+  frac = (a >> 16) & 0x3FFU;
+  r = invSqrtTable_q15[idx] - ((((uint32_t) invSqrtTable_q15[idx] - invSqrtTable_q15[idx + 1U]) * frac) >> 10);
+  r <<= 16;
+
+  /* Two Newton-Raphson steps in 1.31, the second rounded */
+  r2 = (uint32_t) (((uint64_t) r * r) >> 31);
+  e = (int32_t) (0x80000000U - (uint32_t) (((uint64_t) a * r2) >> 30));
+  r += (uint32_t) (((int64_t) r * e) >> 32);
+  r2 = (uint32_t) (((uint64_t) r * r) >> 31);
+  e = (int32_t) (0x80000000U - (uint32_t) (((uint64_t) a * r2) >> 30));
+  r += (uint32_t) ((((int64_t) r * e) + 0x80000000LL) >> 32);
+
+  /* 1/(2 sqrt(a)) = 1 only for a = 0.25 */
+  exp = 1 - (exp / 2);
+  if (r >= 0x80000000U)
+  {
+    r = 0x40000000U;
+    exp++;
+  }
+
+  *pOut = (q31_t) r;
+  *pShift = (int16_t) exp;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Inverse square root of a Q31 value.
+ * @param[in]  in      input value, greater than 0.
+ * @param[out] *pOut   mantissa of 1/sqrt(in) in [0.5, 1).
+ * @param[out] *pShift 1/sqrt(in) = out * 2^shift, 1 to 16.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0 with out 0x7FFFFFFF and
+ *             shift 32, or for a negative value with out and shift 0.
+ */
+arm_status arm_inv_sqrt_q31(
+  q31_t in,
+  q31_t * pOut,
+  int16_t * pShift)
+{
+  return (arm_inv_sqrt_one_q31(in, pOut, pShift));
+}
+
+/**
+ * @brief  Inverse square roots of a block of Q31 values.
+ * @param[in]  *pSrc     points to the input values.
+ * @param[out] *pDst     points to the mantissas, as arm_inv_sqrt_q31().
+ * @param[out] *pShift   points to the shifts, one per value.
+ * @param[in]  blockSize number of values.
+ * @return none.
+ */
+void arm_vinv_sqrt_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  int16_t * pShift,
+  uint32_t blockSize)
+{
+  while (blockSize > 0U)
+  {
+    (void) arm_inv_sqrt_one_q31(*pSrc++, pDst++, pShift++);
+    blockSize--;
+  }
+}
+
+/**
+ * @} end of InvSqrt group
+ */
@@ -0,0 +1,171 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_log2_q15.c
+ * Description:  Q15 base 2 and natural logarithms
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup Log2 Logarithm
+ *
+ * Computes log2(x) and ln(x) of a positive fixed-point fraction. x is
+ * normalized to 1+u with u in [0, 1), log2(1+u) is taken from a table and
+ * the exponent added. The results are negative, so they are in Q4.11 for
+ * Q15 inputs (-15 to 0) and in Q5.26 for Q31 inputs (-31 to 0), the
+ * formats arm_exp2_q15() and arm_exp2_q31() take back. A dB value is
+ * <code>10*log10(x) = 3.0103 * log2(x)</code>.
+ *
+ * <pre>
+ *            log2(1+u)                         max error          operations
+ *    Q15     33 entries, linear                log2 0.85 LSB      1 CLZ, 2 table reads, 1 32-bit multiply
+ *                                              ln   0.9 LSB       1 more 32-bit multiply
+ *    Q31     32 segments, cubic                log2 1 LSB         1 CLZ, 4 table reads, 3 64-bit multiplies
+ *                                              ln   1 LSB         1 more 64-bit multiply
+ * </pre>
+ *
+ * Errors are in LSBs of the output format. Inputs of 0 or below return
+ * the most negative output, -16 or -32. The time does not depend on the
+ * value. The vector functions do a block of values with the same code
+ * inline.
+ */
+
+/**
+ * @addtogroup Log2
+ * @{
+ */
+
+/* ln(2) in 1.15 */
+#define LN2_Q15 22713
+
+/* log2(in) with 15 fractional bits, 32 bits wide */
+__STATIC_INLINE int32_t arm_log2_one_q15(
+  q15_t in)
+{
+  uint32_t a, n, idx, frac, l;                   /* Mantissa, normalization, table index, log2(1+u) */
+
+  if (in <= 0)
+  {
+    return (-16 * 32768);
+  }
+
+  /* in = (1+u) * 2^-n with u in 0.15 */
+  n = __CLZ((uint32_t) in) - 16U;
+  a = ((uint32_t) in << n) & 0x7FFFU;
+
+  idx = a >> 10;
+  frac = a & 0x3FFU;
+  l = log2Table_q15[idx] + ((((uint32_t) log2Table_q15[idx + 1U] - log2Table_q15[idx]) * frac) >> 10);
+
+  return ((int32_t) l - (int32_t) (n << 15));
+}
+
+/**
+ * @brief  Base 2 logarithm of a Q15 value.
+ * @param[in]  in    input value, greater than 0.
+ * @param[out] *pOut log2(in) in Q4.11.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0 or below with out -16 (0x8000).
+ */
+arm_status arm_log2_q15(
+  q15_t in,
+  q15_t * pOut)
+{
+  *pOut = (q15_t) ((arm_log2_one_q15(in) + 8) >> 4);
+
+  return ((in > 0) ? ARM_MATH_SUCCESS : ARM_MATH_ARGUMENT_ERROR);
+}
+
+/**
+ * @brief  Base 2 logarithms of a block of Q15 values.
+ * @param[in]  *pSrc     points to the input values.
+ * @param[out] *pDst     points to log2 of each in Q4.11, as arm_log2_q15().
+ * @param[in]  blockSize number of values.
+ * @return none.
+ */
+void arm_vlog2_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  while (blockSize > 0U)
+  {
+    *pDst++ = (q15_t) ((arm_log2_one_q15(*pSrc++) + 8) >> 4);
+    blockSize--;
+  }
+}
+
+/**
+ * @brief  Natural logarithm of a Q15 value.
+ * @param[in]  in    input value, greater than 0.
+ * @param[out] *pOut ln(in) in Q4.11.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0 or below with out -16 (0x8000).
+ */
+arm_status arm_log_q15(
+  q15_t in,
+  q15_t * pOut)
+{
+  if (in <= 0)
+  {
+    *pOut = (q15_t) 0x8000;
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* log2 rounded to 12 fractional bits times 1.15 is 27, within 32 bits */
+  *pOut = (q15_t) (((((arm_log2_one_q15(in) + 4) >> 3) * LN2_Q15) + 0x8000) >> 16);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Natural logarithms of a block of Q15 values.
+ * @param[in]  *pSrc     points to the input values.
+ * @param[out] *pDst     points to ln of each in Q4.11, as arm_log_q15().
+ * @param[in]  blockSize number of values.
+ * @return none.
+ */
+void arm_vlog_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t in;
+
+  while (blockSize > 0U)
+  {
+    in = *pSrc++;
+    *pDst++ = (in <= 0) ? (q15_t) 0x8000 :
+              (q15_t) (((((arm_log2_one_q15(in) + 4) >> 3) * LN2_Q15) + 0x8000) >> 16);
+    blockSize--;
+  }
+}
+
+/**
+ * @} end of Log2 group
+ */
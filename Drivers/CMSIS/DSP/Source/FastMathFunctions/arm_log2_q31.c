@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_log2_q31.c
+ * Description:  Q31 base 2 and natural logarithms
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @addtogroup Log2
+ * @{
+ */
+
+/* ln(2) in 1.31 */
+#define LN2_Q31 1488522236
+
+/* log2(1+u) in 1.31 and the exponent n of in = (1+u) * 2^-n */
+__STATIC_INLINE q31_t arm_log2_mant_q31(
+  q31_t in,
+  uint32_t * pExp)
+{
+  const q31_t *pC;                               /* Coefficients of the segment */
+  uint32_t a, n;                                 /* Mantissa, normalization */
+  q31_t s, acc;                                  /* Position in the segment, polynomial */
+
+  n = __CLZ((uint32_t) in);
+  a = ((uint32_t) in << n) & 0x7FFFFFFFU;
+  *pExp = n;
+
+  pC = &log2Table_q31[4U * (a >> 26)];
+  s = (q31_t) ((a & 0x03FFFFFFU) << 5);
+
+  acc = pC[3];
+  acc = pC[2] + (q31_t) (((q63_t) acc * s) >> 31);
+  acc = pC[1] + (q31_t) (((q63_t) acc * s) >> 31);
+  acc = clip_q63_to_q31((q63_t) pC[0] + (((q63_t) acc * s) >> 31));
+
+  return (acc);
+}
+
+/* log2(in) in Q5.26 */
+__STATIC_INLINE q31_t arm_log2_one_q31(
+  q31_t in)
+{
+  uint32_t n;
+
+  if (in <= 0)
+  {
+    return (INT32_MIN);
+  }
+
+  return ((((arm_log2_mant_q31(in, &n) >> 4) + 1) >> 1) - (q31_t) (n << 26));
+}
+
+/* ln(in) in Q5.26 */
+__STATIC_INLINE q31_t arm_log_one_q31(
+  q31_t in)
+{
+  uint32_t n;
+  q63_t ln;                                      /* ln(in) in 1.31 */
+
+  if (in <= 0)
+  {
+    return (INT32_MIN);
+  }
+
+  ln = ((q63_t) arm_log2_mant_q31(in, &n) * LN2_Q31) >> 31;
+  ln -= (q63_t) n * LN2_Q31;
+
+  return ((q31_t) ((ln + 16) >> 5));
+}
+
+/**
+ * @brief  Base 2 logarithm of a Q31 value.
+ * @param[in]  in    input value, greater than 0.
+ * @param[out] *pOut log2(in) in Q5.26.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0 or below with out -32 (0x80000000).
+ */
+arm_status arm_log2_q31(
+  q31_t in,
+  q31_t * pOut)
+{
+  *pOut = arm_log2_one_q31(in);
+
+  return ((in > 0) ? ARM_MATH_SUCCESS : ARM_MATH_ARGUMENT_ERROR);
+}
+
+/**
+ * @brief  Base 2 logarithms of a block of Q31 values.
+ * @param[in]  *pSrc     points to the input values.
+ * @param[out] *pDst     points to log2 of each in Q5.26, as arm_log2_q31().
+ * @param[in]  blockSize number of values.
+ * @return none.
+ */
+void arm_vlog2_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  while (blockSize > 0U)
+  {
+    *pDst++ = arm_log2_one_q31(*pSrc++);
+    blockSize--;
+  }
+}
+
+/**
+ * @brief  Natural logarithm of a Q31 value.
+ * @param[in]  in    input value, greater than 0.
+ * @param[out] *pOut ln(in) in Q5.26.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0 or below with out -32 (0x80000000).
+ */
+arm_status arm_log_q31(
+  q31_t in,
+  q31_t * pOut)
+{
+  *pOut = arm_log_one_q31(in);
+
+  return ((in > 0) ? ARM_MATH_SUCCESS : ARM_MATH_ARGUMENT_ERROR);
+}
+
+/**
+ * @brief  Natural logarithms of a block of Q31 values.
+ * @param[in]  *pSrc     points to the input values.
+ * @param[out] *pDst     points to ln of each in Q5.26, as arm_log_q31().
+ * @param[in]  blockSize number of values.
+ * @return none.
+ */
+void arm_vlog_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  while (blockSize > 0U)
+  {
+    *pDst++ = arm_log_one_q31(*pSrc++);
+    blockSize--;
+  }
+}
+
+/**
+ * @} end of Log2 group
+ */
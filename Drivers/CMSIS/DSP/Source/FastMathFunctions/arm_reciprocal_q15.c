@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_reciprocal_q15.c
+ * Description:  Q15 reciprocal
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup Reciprocal Reciprocal
+ *
+ * Computes 1/x of a fixed-point fraction as a mantissa and a shift,
+ * <code>1/x = out * 2^shift</code>, without a division. |x| is normalized
+ * to a = [0.5, 1), a seed of 1/(2a) is interpolated from a 33 entry table
+ * and refined by Newton-Raphson steps r = r + r*(1 - 2a*r), each of which
+ * doubles the correct bits:
+ *
+ * <pre>
+ *            seed       steps   max error of out   operations
+ *    Q15     12 bits    1       0.6 LSB            1 CLZ, 2 table reads, 3 32-bit multiplies
+ *    Q31     12 bits    2       2 LSB              1 CLZ, 2 table reads, 1 32-bit and 4 64-bit multiplies
+ * </pre>
+ *
+ * The mantissa is in [0.5, 1) with the sign of x, 1/x of a power of two
+ * comes out as 0.5 with one more shift. The functions have no loops or
+ * branches on the value besides the sign, so they take the same time for
+ * every input; Tools/bench_qemu.py --dsp counts their Cortex-M0
+ * instructions against the soft-float division they replace.
+ * The vector functions do a block of values with the same code inline.
+ */
+
+/**
+ * @addtogroup Reciprocal
+ * @{
+ */
+
+__STATIC_INLINE arm_status arm_reciprocal_one_q15(
+  q15_t in,
+  q15_t * pOut,
+  int16_t * pShift)
+{
+  uint32_t a, r, n, idx, frac;                   /* Mantissa, 1/(2a), normalization, table index */
+  int32_t e;                                     /* 1 - 2a*r */
+
+  if (in == 0)
+  {
+    *pOut = 0x7FFF;
+    *pShift = 16;
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* |in| normalized to a in [0.5, 1) with 16 fractional bits, -1 included */
+  a = (uint32_t) ((in < 0) ? -(int32_t) in : in);
+  n = __CLZ(a) - 16U;
+  a <<= n;
+
+  /* Seed interpolated from the table, 32768 = 1.0 */
+  idx = (a >> 10) & 0x1FU;
+  frac = a & 0x3FFU;
+  r = reciprocalTable_q15[idx] - ((((uint32_t) reciprocalTable_q15[idx] - reciprocalTable_q15[idx + 1U]) * frac) >> 10);
+
+  /* One Newton-Raphson step, e in 1.31 and r to 19 fractional bits */
+  e = (int32_t) (0x80000000U - ((a * r) << 1));
+  r = (r << 4) + (uint32_t) (((int32_t) r * (e >> 12)) >> 15);
+  r = (r + 8U) >> 4;
+
+  /* 1/(2a) = 1 only for a = 0.5 */
+  if (r >= 0x8000U)
+  {
+    r = 0x4000U;
+    n++;
+  }
+
+  *pOut = (in < 0) ? (q15_t) -(int32_t) r : (q15_t) r;
+  *pShift = (int16_t) n;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Reciprocal of a Q15 value.
+ * @param[in]  in      input value, not 0.
+ * @param[out] *pOut   mantissa of 1/in in [0.5, 1) or (-1, -0.5].
+ * @param[out] *pShift 1/in = out * 2^shift, 1 to 16.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0 with out 0x7FFF and shift 16.
+ */
+arm_status arm_reciprocal_q15(
+  q15_t in,
+  q15_t * pOut,
+  int16_t * pShift)
+{
+  return (arm_reciprocal_one_q15(in, pOut, pShift));
+}
+
+/**
+ * @brief  Reciprocals of a block of Q15 values.
+ * @param[in]  *pSrc     points to the input values.
+ * @param[out] *pDst     points to the mantissas, as arm_reciprocal_q15().
+ * @param[out] *pShift   points to the shifts, one per value.
+ * @param[in]  blockSize number of values.
+ * @return none.
+ */
+void arm_vreciprocal_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  int16_t * pShift,
+  uint32_t blockSize)
+{
+  while (blockSize > 0U)
+  {
+    (void) arm_reciprocal_one_q15(*pSrc++, pDst++, pShift++);
+    blockSize--;
+  }
+}
+
+/**
+ * @} end of Reciprocal group
+ */
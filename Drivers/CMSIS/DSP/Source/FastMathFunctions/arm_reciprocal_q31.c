@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_reciprocal_q31.c
+ * Description:  Q31 reciprocal
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @addtogroup Reciprocal
+ * @{
+ */
+
+__STATIC_INLINE arm_status arm_reciprocal_one_q31(
+  q31_t in,
+  q31_t * pOut,
+  int16_t * pShift)
+{
+  uint32_t a, r, n, idx, frac;                   /* Mantissa, 1/(2a), normalization, table index */
+  int32_t e;                                     /* 1 - 2a*r */
+
+  if (in == 0)
+  {
+    *pOut = 0x7FFFFFFF;
+    *pShift = 32;
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* |in| normalized to a in [0.5, 1) with 32 fractional bits, -1 included */
+  a = (in < 0) ? (0U - (uint32_t) in) : (uint32_t) in;
+  n = __CLZ(a);
+  a <<= n;
+
+  /* Seed interpolated from the table, to 1.31 */
+  idx = (a >> 26) & 0x1FU;
+  frac = (a >> 16) & 0x3FFU;
+  r = reciprocalTable_q15[idx] - ((((uint32_t) reciprocalTable_q15[idx] - reciprocalTable_q15[idx + 1U]) * frac) >> 10);
+  r <<= 16;
+
+  /* Two Newton-Raphson steps in 1.31, the second rounded */
+  e = (int32_t) (0x80000000U - (uint32_t) (((uint64_t) a * r) >> 31));
+  r += (uint32_t) (((int64_t) r * e) >> 31);
+  e = (int32_t) (0x80000000U - (uint32_t) (((uint64_t) a * r) >> 31));
+  r += (uint32_t) ((((int64_t) r * e) + 0x40000000) >> 31);
+
+  /* 1/(2a) = 1 only for a = 0.5 */
+  if (r >= 0x80000000U)
+  {
+    r = 0x40000000U;
+    n++;
+  }
+
+  *pOut = (in < 0) ? (q31_t) (0U - r) : (q31_t) r;
+  *pShift = (int16_t) n;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Reciprocal of a Q31 value.
+ * @param[in]  in      input value, not 0.
+ * @param[out] *pOut   mantissa of 1/in in [0.5, 1) or (-1, -0.5].
+ * @param[out] *pShift 1/in = out * 2^shift, 1 to 32.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for 0 with out 0x7FFFFFFF and shift 32.
+ */
+arm_status arm_reciprocal_q31(
+  q31_t in,
+  q31_t * pOut,
+  int16_t * pShift)
+{
+  return (arm_reciprocal_one_q31(in, pOut, pShift));
+}
+
+/**
+ * @brief  Reciprocals of a block of Q31 values.
+ * @param[in]  *pSrc     points to the input values.
+ * @param[out] *pDst     points to the mantissas, as arm_reciprocal_q31().
+ * @param[out] *pShift   points to the shifts, one per value.
+ * @param[in]  blockSize number of values.
+ * @return none.
+ */
+void arm_vreciprocal_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  int16_t * pShift,
+  uint32_t blockSize)
+{
+  while (blockSize > 0U)
+  {
+    (void) arm_reciprocal_one_q31(*pSrc++, pDst++, pShift++);
+    blockSize--;
+  }
+}
+
+/**
+ * @} end of Reciprocal group
+ */
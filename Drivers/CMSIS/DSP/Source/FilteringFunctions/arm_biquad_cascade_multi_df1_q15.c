@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multi_df1_q15.c
+ * Description:  Processing function for the Q15 Biquad cascade filter with interleaved channels
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 Biquad cascade filter with interleaved channels.
+ * @param[in]  *S        points to an instance of the multichannel Q15 Biquad cascade structure.
+ * @param[in]  *pSrc     points to the block of interleaved input data.
+ * @param[out] *pDst     points to the block of interleaved output data, may be pSrc.
+ * @param[in]  blockSize number of frames to process.
+ * @return none.
+ *
+ * \par
+ * Sample n of channel c is <code>pSrc[n*numChannels + c]</code>. The
+ * coefficients of a stage are read once per block for all channels, and
+ * each channel gives the result arm_biquad_cascade_df1_q15() gives on
+ * Cortex-M0 for that channel alone.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * As arm_biquad_cascade_df1_q15().
+ */
+void arm_biquad_cascade_multi_df1_q15(
+  const arm_biquad_casd_df1_multi_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pIn = pSrc;                             /*  Source pointer                */
+  q15_t *pOut;                                   /*  Destination pointer           */
+  q15_t *pState = S->pState;                     /*  State pointer                 */
+  q15_t *pCoeffs = S->pCoeffs;                   /*  Coefficient pointer           */
+  q15_t *pX1, *pX2, *pY1, *pY2;                  /*  State of the stage            */
+  q15_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
+  q15_t Xn;                                      /*  temporary input               */
+  q63_t acc;                                     /*  Accumulator                   */
+  int32_t shift = (15 - (int32_t) S->postShift); /*  Post shift                    */
+  uint32_t numChannels = S->numChannels;         /*  Number of channels            */
+  uint32_t sample, ch, stage = (uint32_t) S->numStages;     /*  Loop counters      */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    pCoeffs++;  // skip the 0 coefficient
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* x[n-1], x[n-2], y[n-1] and y[n-2] of every channel */
+    pX1 = pState;
+    pX2 = pX1 + numChannels;
+    pY1 = pX2 + numChannels;
+    pY2 = pY1 + numChannels;
+    pOut = pDst;
+
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      for (ch = 0U; ch < numChannels; ch++)
+      {
+        /* Read the input */
+        Xn = pIn[ch];
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q31_t) b0 * Xn;
+        acc += (q31_t) b1 * pX1[ch];
+        acc += (q31_t) b2 * pX2[ch];
+        acc += (q31_t) a1 * pY1[ch];
+        acc += (q31_t) a2 * pY2[ch];
+
+        /* The result is converted to 1.15 */
+        acc = __SSAT((acc >> shift), 16);
+
+        /* Update the state and store the output */
+        pX2[ch] = pX1[ch];
+        pX1[ch] = Xn;
+        pY2[ch] = pY1[ch];
+        pY1[ch] = (q15_t) acc;
+        pOut[ch] = (q15_t) acc;
+      }
+
+      pIn += numChannels;
+      pOut += numChannels;
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /*  The first stage goes from the input buffer to the output buffer. */
+    /*  Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    /* Move to the state of the next stage */
+    pState += 4U * numChannels;
+
+  } while (--stage);
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multi_df2T_f32.c
+ * Description:  Processing function for floating-point transposed direct form II Biquad cascade filter with interleaved channels
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+* @addtogroup BiquadCascadeDF2T
+* @{
+*/
+
+/**
+* @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. N channels
+* @param[in]  *S        points to an instance of the filter data structure.
+* @param[in]  *pSrc     points to the block of interleaved input data.
+* @param[out] *pDst     points to the block of interleaved output data, may be pSrc.
+* @param[in]  blockSize number of frames to process.
+* @return none.
+*
+* \par
+* A frame holds one sample of each of the <code>numChannels</code> channels,
+* so sample n of channel c is <code>pSrc[n*numChannels + c]</code>. Every
+* channel runs through the same cascade. The coefficients of a stage are
+* read once per block and the inner loop goes across the channels, whose
+* state values lie next to each other; this is the loop compilers vectorize.
+*/
+void arm_biquad_cascade_multi_df2T_f32(
+  const arm_biquad_cascade_multi_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /*  source pointer            */
+  float32_t *pOut;                               /*  destination pointer       */
+  float32_t *pState = S->pState;                 /*  State pointer             */
+  float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+  float32_t *pD1, *pD2;                          /*  state of the stage        */
+  float32_t acc;                                 /*  accumulator               */
+  float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+  float32_t Xn;                                  /*  temporary input           */
+  uint32_t numChannels = S->numChannels;         /*  number of channels        */
+  uint32_t sample, ch, stage = S->numStages;     /*  loop counters             */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* d1 of every channel, then d2 of every channel */
+    pD1 = pState;
+    pD2 = pState + numChannels;
+    pOut = pDst;
+
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      for (ch = 0U; ch < numChannels; ch++)
+      {
+        /* Read the input */
+        Xn = pIn[ch];
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc = (b0 * Xn) + pD1[ch];
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        pD1[ch] = ((b1 * Xn) + (a1 * acc)) + pD2[ch];
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        pD2[ch] = (b2 * Xn) + (a2 * acc);
+
+        /* Store the result in the accumulator in the destination buffer. */
+        pOut[ch] = acc;
+      }
+
+      pIn += numChannels;
+      pOut += numChannels;
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* Move to the state of the next stage */
+    pState += 2U * numChannels;
+
+  } while (--stage);
+}
+
+/**
+* @} end of BiquadCascadeDF2T group
+*/
@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multi_df2T_init_f32.c
+ * Description:  Initialization function for floating-point transposed direct form II Biquad cascade filter with interleaved channels
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+* @addtogroup BiquadCascadeDF2T
+* @{
+*/
+
+/**
+* @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter. N channels
+* @param[in,out] *S           points to an instance of the filter data structure.
+* @param[in]     numStages    number of 2nd order stages in the filter.
+* @param[in]     numChannels  number of interleaved channels.
+* @param[in]     *pCoeffs     points to the filter coefficients.
+* @param[in]     *pState      points to the state buffer.
+* @return        none
+*
+* \par
+* The coefficients are ordered as for arm_biquad_cascade_df2T_init_f32(),
+* <code>5*numStages</code> values shared by all channels.
+*
+* \par
+* Each stage holds d1 of all channels followed by d2 of all channels:
+* <pre>
+*     {d1[0], ..., d1[numChannels-1], d2[0], ..., d2[numChannels-1]}
+* </pre>
+* for stage 1, then stage 2, and so on, <code>2*numStages*numChannels</code> values in all.
+*/
+void arm_biquad_cascade_multi_df2T_init_f32(
+  arm_biquad_cascade_multi_df2T_instance_f32 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState)
+{
+  /* Assign filter stages and channels */
+  S->numStages = numStages;
+  S->numChannels = numChannels;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always 2 * numStages * numChannels */
+  memset(pState, 0, (2U * (uint32_t) numStages * numChannels) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+* @} end of BiquadCascadeDF2T group
+*/
@@ -0,0 +1,172 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_f32.c
+ * Description:  Floating-point convolution by overlap-save FFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_fir_fft_kernel_f32(
+    arm_fir_fft_instance_f32 * S,
+    const float32_t * pKernel,
+    int32_t kernelInc);
+
+extern void arm_fir_fft_frame_f32(
+    arm_fir_fft_instance_f32 * S,
+    float32_t * pDst,
+    uint32_t blkCnt);
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FirFft
+ * @{
+ */
+
+/**
+ * @brief  Convolution of a sequence with a kernel in overlap-save frames.
+ * @param[in]  *pKernel    points to the first kernel value, in natural order.
+ * @param[in]  kernelInc   step from one kernel value to the next, 1 or -1.
+ * @param[in]  kernelLen   length of the kernel, at most fftLen.
+ * @param[in]  *pSrc       points to the first input value.
+ * @param[in]  srcInc      step from one input value to the next, 1 or -1.
+ * @param[in]  srcLen      length of the input.
+ * @param[out] *pDst       points to the srcLen+kernelLen-1 outputs.
+ * @param[in]  *pScratch   points to the scratch buffer of 3*fftLen values.
+ * @param[in]  fftLen      length of the FFT.
+ * @param[in]  directFlag  FFT if flag is 0, direct form over the same frames if flag is 1.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+ *
+ * \par
+ * The direct form keeps the kernel reversed where the FFT keeps its
+ * spectrum and runs a dot product per output.
+ */
+arm_status arm_conv_fft_ols_f32(
+  const float32_t * pKernel,
+  int32_t kernelInc,
+  uint32_t kernelLen,
+  const float32_t * pSrc,
+  int32_t srcInc,
+  uint32_t srcLen,
+  float32_t * pDst,
+  float32_t * pScratch,
+  uint16_t fftLen,
+  uint8_t directFlag)
+{
+  arm_fir_fft_instance_f32 S;                   /* Instance without state, the whole input is at hand */
+  float32_t *pFrame;
+  uint32_t numHist = kernelLen - 1U;
+  uint32_t outLen = srcLen + numHist;
+  uint32_t pos, blkCnt, i;
+  int32_t j;
+
+  if ((kernelLen == 0U) || (fftLen < kernelLen) ||
+      (arm_rfft_fast_init_f32(&S.rfft, fftLen) != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S.numTaps = (uint16_t) kernelLen;
+  S.fftLen = fftLen;
+  S.blockLen = (uint16_t) ((fftLen - S.numTaps) + 1U);
+  S.pState = NULL;
+  S.pCoeffs = NULL;
+  S.pSpectrum = pScratch;
+  S.pScratch = pScratch + fftLen;
+  if (directFlag == 0U)
+  {
+    arm_fir_fft_kernel_f32(&S, pKernel, kernelInc);
+  }
+  else
+  {
+    for (i = 0U; i < kernelLen; i++)
+    {
+      S.pSpectrum[i] = pKernel[(int32_t) (numHist - i) * kernelInc];
+    }
+  }
+
+  pFrame = S.pScratch;
+  for (pos = 0U; pos < outLen; pos += blkCnt)
+  {
+    blkCnt = ((outLen - pos) < S.blockLen) ? (outLen - pos) : S.blockLen;
+
+    /* Inputs pos-numHist to pos+blkCnt-1, zero before and after the sequence */
+    for (i = 0U; i < S.fftLen; i++)
+    {
+      j = (int32_t) (pos + i) - (int32_t) numHist;
+      pFrame[i] = ((j >= 0) && ((uint32_t) j < srcLen) && (i < numHist + blkCnt)) ? pSrc[j * srcInc] : 0.0f;
+    }
+    if (directFlag == 0U)
+    {
+      arm_fir_fft_frame_f32(&S, pDst + pos, blkCnt);
+    }
+    else
+    {
+      for (i = 0U; i < blkCnt; i++)
+      {
+        arm_dot_prod_f32(pFrame + i, S.pSpectrum, kernelLen, pDst + pos + i);
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Convolution of floating-point sequences by overlap-save FFT.
+ * @param[in]  *pSrcA     points to the first input sequence.
+ * @param[in]  srcALen    length of the first input sequence.
+ * @param[in]  *pSrcB     points to the second input sequence.
+ * @param[in]  srcBLen    length of the second input sequence.
+ * @param[out] *pDst      points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @param[in]  *pScratch  points to the scratch buffer of 3*fftLen values.
+ * @param[in]  fftLen     length of the FFT, a power of two from 32 to 4096 and at least min(srcALen, srcBLen).
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+ *
+ * \par
+ * The shorter sequence is the kernel. Below ARM_FFT_CONV_MIN_F32 samples
+ * the function runs the direct form, with the results of arm_conv_f32().
+ */
+arm_status arm_conv_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch,
+  uint16_t fftLen)
+{
+  if (srcALen < srcBLen)
+  {
+    return (arm_conv_fft_ols_f32(pSrcA, 1, srcALen, pSrcB, 1, srcBLen, pDst, pScratch, fftLen,
+                                 (srcALen < ARM_FFT_CONV_MIN_F32) ? 1U : 0U));
+  }
+  return (arm_conv_fft_ols_f32(pSrcB, 1, srcBLen, pSrcA, 1, srcALen, pDst, pScratch, fftLen,
+                               (srcBLen < ARM_FFT_CONV_MIN_F32) ? 1U : 0U));
+}
+
+/**
+ * @} end of FirFft group
+ */
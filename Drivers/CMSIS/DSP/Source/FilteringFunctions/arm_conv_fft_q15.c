@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_q15.c
+ * Description:  Q15 convolution by overlap-save FFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern arm_status arm_fir_fft_setup_q15(
+    arm_fir_fft_instance_q15 * S,
+    uint16_t numTaps,
+    q15_t * pSpectrum,
+    q15_t * pScratch,
+    uint16_t fftLen);
+
+extern void arm_fir_fft_kernel_q15(
+    arm_fir_fft_instance_q15 * S,
+    const q15_t * pKernel,
+    int32_t kernelInc);
+
+extern void arm_fir_fft_frame_q15(
+    arm_fir_fft_instance_q15 * S,
+    q15_t * pDst,
+    uint32_t blkCnt);
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FirFft
+ * @{
+ */
+
+/**
+ * @brief  Convolution of a sequence with a kernel in overlap-save frames.
+ * @param[in]  *pKernel    points to the first kernel value, in natural order.
+ * @param[in]  kernelInc   step from one kernel value to the next, 1 or -1.
+ * @param[in]  kernelLen   length of the kernel, at most fftLen.
+ * @param[in]  *pSrc       points to the first input value.
+ * @param[in]  srcInc      step from one input value to the next, 1 or -1.
+ * @param[in]  srcLen      length of the input.
+ * @param[out] *pDst       points to the srcLen+kernelLen-1 outputs.
+ * @param[in]  *pScratch   points to the scratch buffer of 4*fftLen+2 values.
+ * @param[in]  fftLen      length of the FFT.
+ * @param[in]  directFlag  FFT if flag is 0, direct form over the same frames if flag is 1.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+ *
+ * \par
+ * The direct form keeps the kernel reversed where the FFT keeps its
+ * spectrum and runs a dot product per output.
+ */
+arm_status arm_conv_fft_ols_q15(
+  const q15_t * pKernel,
+  int32_t kernelInc,
+  uint32_t kernelLen,
+  const q15_t * pSrc,
+  int32_t srcInc,
+  uint32_t srcLen,
+  q15_t * pDst,
+  q15_t * pScratch,
+  uint16_t fftLen,
+  uint8_t directFlag)
+{
+  arm_fir_fft_instance_q15 S;                   /* Instance without state, the whole input is at hand */
+  q15_t *pFrame;
+  uint32_t numHist = kernelLen - 1U;
+  uint32_t outLen = srcLen + numHist;
+  uint32_t pos, blkCnt, i;
+  int32_t j;
+  q63_t sum;
+
+  if ((kernelLen == 0U) || (fftLen < kernelLen) ||
+      (arm_fir_fft_setup_q15(&S, (uint16_t) kernelLen, pScratch, pScratch + fftLen + 2U, fftLen) != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S.pState = NULL;
+  S.pCoeffs = NULL;
+  if (directFlag == 0U)
+  {
+    arm_fir_fft_kernel_q15(&S, pKernel, kernelInc);
+  }
+  else
+  {
+    for (i = 0U; i < kernelLen; i++)
+    {
+      S.pSpectrum[i] = pKernel[(int32_t) (numHist - i) * kernelInc];
+    }
+  }
+
+  pFrame = S.pScratch;
+  for (pos = 0U; pos < outLen; pos += blkCnt)
+  {
+    blkCnt = ((outLen - pos) < S.blockLen) ? (outLen - pos) : S.blockLen;
+
+    /* Inputs pos-numHist to pos+blkCnt-1, zero before and after the sequence */
+    for (i = 0U; i < S.fftLen; i++)
+    {
+      j = (int32_t) (pos + i) - (int32_t) numHist;
+      pFrame[i] = ((j >= 0) && ((uint32_t) j < srcLen) && (i < numHist + blkCnt)) ? pSrc[j * srcInc] : 0;
+    }
+    if (directFlag == 0U)
+    {
+      arm_fir_fft_frame_q15(&S, pDst + pos, blkCnt);
+    }
+    else
+    {
+      for (i = 0U; i < blkCnt; i++)
+      {
+        arm_dot_prod_q15(pFrame + i, S.pSpectrum, kernelLen, &sum);
+        pDst[pos + i] = (q15_t) __SSAT((q31_t) (sum >> 15), 16);
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Convolution of Q15 sequences by overlap-save FFT.
+ * @param[in]  *pSrcA     points to the first input sequence.
+ * @param[in]  srcALen    length of the first input sequence.
+ * @param[in]  *pSrcB     points to the second input sequence.
+ * @param[in]  srcBLen    length of the second input sequence.
+ * @param[out] *pDst      points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @param[in]  *pScratch  points to the scratch buffer of 4*fftLen+2 values.
+ * @param[in]  fftLen     length of the FFT, a power of two from 32 to 8192 and at least min(srcALen, srcBLen).
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+ *
+ * \par
+ * The shorter sequence is the kernel. Below ARM_FFT_CONV_MIN_Q15 samples
+ * the function runs the direct form, with the results of arm_conv_q15().
+ */
+arm_status arm_conv_fft_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pScratch,
+  uint16_t fftLen)
+{
+  if (srcALen < srcBLen)
+  {
+    return (arm_conv_fft_ols_q15(pSrcA, 1, srcALen, pSrcB, 1, srcBLen, pDst, pScratch, fftLen,
+                                 (srcALen < ARM_FFT_CONV_MIN_Q15) ? 1U : 0U));
+  }
+  return (arm_conv_fft_ols_q15(pSrcB, 1, srcBLen, pSrcA, 1, srcALen, pDst, pScratch, fftLen,
+                               (srcBLen < ARM_FFT_CONV_MIN_Q15) ? 1U : 0U));
+}
+
+/**
+ * @} end of FirFft group
+ */
@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_correlate_fft_q15.c
+ * Description:  Q15 correlation by overlap-save FFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FirFft
+ * @{
+ */
+
+/**
+ * @brief Correlation of Q15 sequences by overlap-save FFT.
+ * @param[in]  *pSrcA     points to the first input sequence.
+ * @param[in]  srcALen    length of the first input sequence.
+ * @param[in]  *pSrcB     points to the second input sequence.
+ * @param[in]  srcBLen    length of the second input sequence.
+ * @param[out] *pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+ * @param[in]  *pScratch  points to the scratch buffer of 4*fftLen+2 values.
+ * @param[in]  fftLen     length of the FFT, a power of two from 32 to 8192 and at least min(srcALen, srcBLen).
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+ *
+ * \par
+ * The output is that of arm_correlate_q15(), including the zeros that pad it to
+ * 2 * max(srcALen, srcBLen) - 1 values, so pDst needs no clearing. Below
+ * ARM_FFT_CONV_MIN_Q15 samples in the shorter sequence the function runs
+ * the direct form.
+ */
+arm_status arm_correlate_fft_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pScratch,
+  uint16_t fftLen)
+{
+  if (srcALen >= srcBLen)
+  {
+    /* srcALen - srcBLen zeros, then a convolved with b reversed */
+    memset(pDst, 0, (srcALen - srcBLen) * sizeof(q15_t));
+    return (arm_conv_fft_ols_q15(pSrcB + (srcBLen - 1U), -1, srcBLen, pSrcA, 1, srcALen,
+                                 pDst + (srcALen - srcBLen), pScratch, fftLen,
+                                 (srcBLen < ARM_FFT_CONV_MIN_Q15) ? 1U : 0U));
+  }
+
+  /* The same convolution with a as the kernel, then srcBLen - srcALen zeros */
+  memset(pDst + (srcALen + srcBLen - 1U), 0, (srcBLen - srcALen) * sizeof(q15_t));
+  return (arm_conv_fft_ols_q15(pSrcA, 1, srcALen, pSrcB + (srcBLen - 1U), -1, srcBLen,
+                               pDst, pScratch, fftLen,
+                               (srcALen < ARM_FFT_CONV_MIN_Q15) ? 1U : 0U));
+}
+
+/**
+ * @} end of FirFft group
+ */
@@ -0,0 +1,174 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_f32.c
+ * Description:  Floating-point overlap-save FIR filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FirFft FFT Convolution, Correlation and FIR Filters
+ *
+ * \par
+ * Long filters and sequences cost numTaps multiplies per output sample in
+ * direct form. These functions work in frames of fftLen samples instead:
+ * each frame holds the last numTaps-1 inputs and blockLen = fftLen -
+ * numTaps + 1 new ones, goes through a real FFT, is multiplied by the
+ * spectrum of the coefficients and comes back through the inverse FFT, of
+ * which the last blockLen samples are outputs (overlap-save). The cost
+ * per output grows as log2(fftLen) * fftLen / blockLen, so fftLen of two
+ * to eight times numTaps is usually best.
+ *
+ * \par
+ * Below a kernel length of ARM_FFT_CONV_MIN_F32 or ARM_FFT_CONV_MIN_Q15
+ * the direct form is faster, and the functions fall back to it on their
+ * own: a dot product per output over the same frames, with the buffers
+ * the FFT would use. The Q15 functions keep to the direct form unless
+ * ARM_FFT_CONV_MIN_Q15 is set, see Fixed point below. On Cortex-M0 this also beats arm_conv_f32() and
+ * arm_conv_q15(), whose loops there visit every pair of samples.
+ *
+ * \par
+ * arm_fir_fft_f32() and arm_fir_fft_q15() take the time reversed
+ * coefficients of arm_fir_f32() and arm_fir_q15() and blocks of any size;
+ * a block longer than blockLen takes several frames, a shorter one a frame
+ * of its own, so the output has no added latency. Given a template in
+ * natural order as coefficients, the filter is the matched filter of the
+ * template: output n is the correlation of the template with the last
+ * numTaps inputs.
+ *
+ * \par
+ * arm_conv_fft_f32(), arm_conv_fft_q15(), arm_correlate_fft_f32() and
+ * arm_correlate_fft_q15() give the results of arm_conv_f32() and
+ * arm_correlate_f32() and their Q15 versions, running the longer sequence
+ * through frames against the shorter one.
+ *
+ * <pre>
+ *                          f32 values         q15 values
+ *   FIR pState             numTaps - 1        numTaps - 1
+ *   FIR pSpectrum          fftLen             fftLen + 2
+ *   FIR pScratch           2 * fftLen         3 * fftLen
+ *   conv, corr pScratch    3 * fftLen         4 * fftLen + 2
+ * </pre>
+ *
+ * \par Fixed point
+ * arm_rfft_q15() scales every stage down, so the Q15 functions carry a
+ * block exponent: each frame is normalized before the forward FFT, the
+ * product of the spectra before the inverse one, and the outputs are
+ * shifted back and saturated as in arm_fir_q15(). The FFTs still lose
+ * resolution: the outputs keep about 42 dB SNR against the direct form up
+ * to fftLen 128 and 6 dB less for each doubling above, 24 dB at 1024.
+ * That is enough for matched filters and correlation peaks rather than
+ * audio, so the FFT path is opt-in through ARM_FFT_CONV_MIN_Q15.
+ */
+
+/**
+ * @addtogroup FirFft
+ * @{
+ */
+
+/**
+ * @brief  Filters the frame in pScratch and writes its outputs.
+ * @param[in,out] *S       points to an instance of the floating-point overlap-save FIR structure.
+ * @param[out]    *pDst    points to the blkCnt outputs.
+ * @param[in]     blkCnt   number of new inputs in the frame.
+ * @return none.
+ *
+ * \par
+ * The frame holds numTaps-1 old and blkCnt new inputs, then zeros to
+ * fftLen. The circular convolution wraps into the first numTaps-1 samples
+ * only, the next blkCnt are outputs.
+ */
+void arm_fir_fft_frame_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pDst,
+  uint32_t blkCnt)
+{
+  float32_t *pTime = S->pScratch;
+  float32_t *pFreq = S->pScratch + S->fftLen;
+  const float32_t *pH = S->pSpectrum;
+
+  arm_rfft_fast_f32(&S->rfft, pTime, pFreq, 0U);
+
+  /* Bins 0 and fftLen/2 are real and packed into the first pair */
+  pFreq[0] *= pH[0];
+  pFreq[1] *= pH[1];
+  arm_cmplx_mult_cmplx_f32(pFreq + 2U, (float32_t *) pH + 2U, pFreq + 2U, (S->fftLen / 2U) - 1U);
+
+  arm_rfft_fast_f32(&S->rfft, pFreq, pTime, 1U);
+
+  memcpy(pDst, pTime + (S->numTaps - 1U), blkCnt * sizeof(float32_t));
+}
+
+/**
+ * @brief Processing function for the floating-point overlap-save FIR filter.
+ * @param[in,out] *S         points to an instance of the floating-point overlap-save FIR structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data, may be pSrc.
+ * @param[in]     blockSize  number of samples to process, any number.
+ * @return none.
+ */
+void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pFrame = S->pScratch;               /* Frame of numTaps-1 old and blkCnt new inputs */
+  uint32_t numHist = S->numTaps - 1U;            /* Inputs kept from block to block */
+  uint32_t blkCnt, i;                            /* Loop counters */
+
+  while (blockSize > 0U)
+  {
+    blkCnt = (blockSize < S->blockLen) ? blockSize : S->blockLen;
+
+    /* The last numTaps-1 inputs of the frame are the state for the next one */
+    memcpy(pFrame, S->pState, numHist * sizeof(float32_t));
+    memcpy(pFrame + numHist, pSrc, blkCnt * sizeof(float32_t));
+    memcpy(S->pState, pFrame + blkCnt, numHist * sizeof(float32_t));
+
+    if (S->fftLen == 0U)
+    {
+      for (i = 0U; i < blkCnt; i++)
+      {
+        arm_dot_prod_f32(pFrame + i, S->pCoeffs, S->numTaps, pDst + i);
+      }
+    }
+    else
+    {
+      memset(pFrame + numHist + blkCnt, 0, (S->fftLen - numHist - blkCnt) * sizeof(float32_t));
+      arm_fir_fft_frame_f32(S, pDst, blkCnt);
+    }
+
+    pSrc += blkCnt;
+    pDst += blkCnt;
+    blockSize -= blkCnt;
+  }
+}
+
+/**
+ * @} end of FirFft group
+ */
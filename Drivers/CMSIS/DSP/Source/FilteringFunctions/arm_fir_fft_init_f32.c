@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_init_f32.c
+ * Description:  Floating-point overlap-save FIR filter initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FirFft
+ * @{
+ */
+
+/**
+ * @brief  Fills the coefficient spectrum of an overlap-save instance.
+ * @param[in,out] *S          points to an instance with numTaps, fftLen, rfft and the buffers set.
+ * @param[in]     *pKernel    points to the first kernel value, in natural order.
+ * @param[in]     kernelInc   step from one kernel value to the next, 1 or -1.
+ * @return none.
+ */
+void arm_fir_fft_kernel_f32(
+  arm_fir_fft_instance_f32 * S,
+  const float32_t * pKernel,
+  int32_t kernelInc)
+{
+  float32_t *pTime = S->pScratch;
+  uint32_t i;
+
+  for (i = 0U; i < S->numTaps; i++)
+  {
+    pTime[i] = *pKernel;
+    pKernel += kernelInc;
+  }
+  memset(pTime + S->numTaps, 0, (S->fftLen - S->numTaps) * sizeof(float32_t));
+
+  arm_rfft_fast_f32(&S->rfft, pTime, S->pSpectrum, 0U);
+}
+
+/**
+ * @brief  Initialization function for the floating-point overlap-save FIR filter.
+ * @param[in,out] *S          points to an instance of the floating-point overlap-save FIR structure.
+ * @param[in]     numTaps     number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs    points to the filter coefficients, in time reversed order as for arm_fir_f32().
+ * @param[in]     *pState     points to the state buffer of numTaps-1 values.
+ * @param[in]     *pSpectrum  points to the coefficient spectrum buffer of fftLen values.
+ * @param[in]     *pScratch   points to the scratch buffer of 2*fftLen values.
+ * @param[in]     fftLen      length of the FFT, a power of two from 32 to 4096 and at least numTaps.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+ *
+ * \par
+ * Below ARM_FFT_CONV_MIN_F32 taps the filter runs in direct form and
+ * pSpectrum is not used. The coefficients are read again in that case,
+ * otherwise only here.
+ */
+arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pSpectrum,
+  float32_t * pScratch,
+  uint16_t fftLen)
+{
+  if ((numTaps == 0U) || (fftLen < numTaps) ||
+      (arm_rfft_fast_init_f32(&S->rfft, fftLen) != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numTaps = numTaps;
+  S->fftLen = fftLen;
+  S->blockLen = (uint16_t) ((fftLen - numTaps) + 1U);
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pSpectrum = pSpectrum;
+  S->pScratch = pScratch;
+
+  /* Clear the state of numTaps-1 inputs */
+  memset(pState, 0, (numTaps - 1U) * sizeof(float32_t));
+
+  if (numTaps < ARM_FFT_CONV_MIN_F32)
+  {
+    S->fftLen = 0U;
+  }
+  else
+  {
+    arm_fir_fft_kernel_f32(S, pCoeffs + (numTaps - 1U), -1);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FirFft group
+ */
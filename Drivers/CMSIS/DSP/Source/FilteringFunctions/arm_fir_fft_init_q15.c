@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_init_q15.c
+ * Description:  Q15 overlap-save FIR filter initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern int32_t arm_fir_fft_normalize_q15(
+    q15_t * pSrc,
+    uint32_t blockSize);
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FirFft
+ * @{
+ */
+
+/**
+ * @brief  Sets the FFT fields of a Q15 overlap-save instance.
+ * @param[out] *S          points to an instance of the Q15 overlap-save FIR structure.
+ * @param[in]  numTaps     number of filter coefficients, at most fftLen.
+ * @param[in]  *pSpectrum  points to the coefficient spectrum buffer of fftLen+2 values.
+ * @param[in]  *pScratch   points to the scratch buffer of 3*fftLen values.
+ * @param[in]  fftLen      length of the FFT.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+ */
+arm_status arm_fir_fft_setup_q15(
+  arm_fir_fft_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pSpectrum,
+  q15_t * pScratch,
+  uint16_t fftLen)
+{
+  if ((arm_rfft_init_q15(&S->rfft, fftLen, 0U, 1U) != ARM_MATH_SUCCESS) ||
+      (arm_rfft_init_q15(&S->rifft, fftLen, 1U, 1U) != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numTaps = numTaps;
+  S->fftLen = fftLen;
+  S->blockLen = (uint16_t) ((fftLen - numTaps) + 1U);
+  S->pSpectrum = pSpectrum;
+  S->pScratch = pScratch;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Fills the normalized coefficient spectrum of a Q15 overlap-save instance.
+ * @param[in,out] *S          points to an instance set up by arm_fir_fft_setup_q15().
+ * @param[in]     *pKernel    points to the first kernel value, in natural order.
+ * @param[in]     kernelInc   step from one kernel value to the next, 1 or -1.
+ * @return none.
+ *
+ * \par
+ * The forward and the inverse FFT each divide by fftLen = 2^m and the
+ * product of two Q15 spectra is kept in Q29, so the convolution comes out
+ * of the inverse FFT shifted right by 2m + 1 and left by the shifts that
+ * normalized the frame, the kernel and its spectrum and the product.
+ * Against the 15 of a Q15 FIR, outShift is 2m - 14 less the kernel shifts.
+ */
+void arm_fir_fft_kernel_q15(
+  arm_fir_fft_instance_q15 * S,
+  const q15_t * pKernel,
+  int32_t kernelInc)
+{
+  q15_t *pTime = S->pScratch;
+  q15_t *pFreq = S->pScratch + S->fftLen;
+  int32_t shift, log2Len = 0;
+  uint32_t i;
+
+  for (i = 0U; i < S->numTaps; i++)
+  {
+    pTime[i] = *pKernel;
+    pKernel += kernelInc;
+  }
+  memset(pTime + S->numTaps, 0, (S->fftLen - S->numTaps) * sizeof(q15_t));
+
+  shift = arm_fir_fft_normalize_q15(pTime, S->fftLen);
+  arm_rfft_q15(&S->rfft, pTime, pFreq);
+  shift += arm_fir_fft_normalize_q15(pFreq, S->fftLen + 2U);
+  memcpy(S->pSpectrum, pFreq, (S->fftLen + 2U) * sizeof(q15_t));
+
+  while ((1U << log2Len) < S->fftLen)
+  {
+    log2Len++;
+  }
+  S->outShift = (int16_t) ((2 * log2Len) - 14 - shift);
+}
+
+/**
+ * @brief  Initialization function for the Q15 overlap-save FIR filter.
+ * @param[in,out] *S          points to an instance of the Q15 overlap-save FIR structure.
+ * @param[in]     numTaps     number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs    points to the filter coefficients, in time reversed order as for arm_fir_q15().
+ * @param[in]     *pState     points to the state buffer of numTaps-1 values.
+ * @param[in]     *pSpectrum  points to the coefficient spectrum buffer of fftLen+2 values.
+ * @param[in]     *pScratch   points to the scratch buffer of 3*fftLen values.
+ * @param[in]     fftLen      length of the FFT, a power of two from 32 to 8192 and at least numTaps.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+ *
+ * \par
+ * Below ARM_FFT_CONV_MIN_Q15 taps the filter runs in direct form and
+ * pSpectrum is not used. The coefficients are read again in that case,
+ * otherwise only here.
+ */
+arm_status arm_fir_fft_init_q15(
+  arm_fir_fft_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  q15_t * pSpectrum,
+  q15_t * pScratch,
+  uint16_t fftLen)
+{
+  if ((numTaps == 0U) || (fftLen < numTaps) ||
+      (arm_fir_fft_setup_q15(S, numTaps, pSpectrum, pScratch, fftLen) != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* Clear the state of numTaps-1 inputs */
+  memset(pState, 0, (numTaps - 1U) * sizeof(q15_t));
+
+  if (numTaps < ARM_FFT_CONV_MIN_Q15)
+  {
+    S->fftLen = 0U;
+    S->outShift = 0;
+  }
+  else
+  {
+    arm_fir_fft_kernel_q15(S, pCoeffs + (numTaps - 1U), -1);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FirFft group
+ */
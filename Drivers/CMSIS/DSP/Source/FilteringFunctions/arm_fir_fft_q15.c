@@ -0,0 +1,202 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_q15.c
+ * Description:  Q15 overlap-save FIR filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FirFft
+ * @{
+ */
+
+/**
+ * @brief  Shifts a block left until its largest value uses all 15 bits.
+ * @param[in,out] *pSrc     points to the block.
+ * @param[in]     blockSize number of values.
+ * @return the left shift, 15 for a block of zeros.
+ */
+int32_t arm_fir_fft_normalize_q15(
+  q15_t * pSrc,
+  uint32_t blockSize)
+{
+  q31_t peak = 0;                                /* Or of the magnitudes, as long as the largest */
+  int32_t shift;
+  uint32_t i;
+
+  for (i = 0U; i < blockSize; i++)
+  {
+    peak |= pSrc[i] ^ (pSrc[i] >> 15);
+  }
+
+  shift = (int32_t) __CLZ((uint32_t) peak) - 17;
+  if (shift > 0)
+  {
+    for (i = 0U; i < blockSize; i++)
+    {
+      pSrc[i] = (q15_t) (pSrc[i] << shift);
+    }
+  }
+
+  return (shift);
+}
+
+/**
+ * @brief  Filters the frame in pScratch and writes its outputs.
+ * @param[in,out] *S       points to an instance of the Q15 overlap-save FIR structure.
+ * @param[out]    *pDst    points to the blkCnt outputs.
+ * @param[in]     blkCnt   number of new inputs in the frame.
+ * @return none.
+ *
+ * \par
+ * The frame holds numTaps-1 old and blkCnt new inputs, then zeros to
+ * fftLen. It is normalized before the FFT and the product of the spectra
+ * before the inverse FFT; the outputs come back by outShift plus the
+ * product shift minus the frame shift.
+ */
+void arm_fir_fft_frame_q15(
+  arm_fir_fft_instance_q15 * S,
+  q15_t * pDst,
+  uint32_t blkCnt)
+{
+  q15_t *pTime = S->pScratch;
+  q15_t *pFreq = S->pScratch + S->fftLen;
+  const q15_t *pH = S->pSpectrum;
+  uint32_t numVals = S->fftLen + 2U;             /* Bins 0 to fftLen/2 */
+  uint32_t i;
+  int32_t inShift, mulShift, shift;
+  q31_t re, im, peak = 0, rnd;
+
+  inShift = arm_fir_fft_normalize_q15(pTime, S->fftLen);
+  arm_rfft_q15(&S->rfft, pTime, pFreq);
+
+  /* Products in Q29, once for their size and once to keep 15 bits of them */
+  for (i = 0U; i < numVals; i += 2U)
+  {
+    re = ((pFreq[i] * pH[i]) >> 1) - ((pFreq[i + 1U] * pH[i + 1U]) >> 1);
+    im = ((pFreq[i] * pH[i + 1U]) >> 1) + ((pFreq[i + 1U] * pH[i]) >> 1);
+    peak |= (re ^ (re >> 31)) | (im ^ (im >> 31));
+  }
+  mulShift = 17 - (int32_t) __CLZ((uint32_t) peak);
+  for (i = 0U; i < numVals; i += 2U)
+  {
+    re = ((pFreq[i] * pH[i]) >> 1) - ((pFreq[i + 1U] * pH[i + 1U]) >> 1);
+    im = ((pFreq[i] * pH[i + 1U]) >> 1) + ((pFreq[i + 1U] * pH[i]) >> 1);
+    if (mulShift >= 0)
+    {
+      pFreq[i] = (q15_t) (re >> mulShift);
+      pFreq[i + 1U] = (q15_t) (im >> mulShift);
+    }
+    else
+    {
+      pFreq[i] = (q15_t) (re << -mulShift);
+      pFreq[i + 1U] = (q15_t) (im << -mulShift);
+    }
+  }
+
+  arm_rfft_q15(&S->rifft, pFreq, pTime);
+
+  /* Back to the scale of arm_fir_q15(), saturated */
+  pTime += S->numTaps - 1U;
+  shift = S->outShift + mulShift - inShift;
+  if (shift >= 0)
+  {
+    shift = (shift > 16) ? 16 : shift;
+    for (i = 0U; i < blkCnt; i++)
+    {
+      pDst[i] = (q15_t) __SSAT(((q31_t) pTime[i]) << shift, 16);
+    }
+  }
+  else
+  {
+    shift = (shift < -16) ? 16 : -shift;
+    rnd = (q31_t) 1 << (shift - 1);
+    for (i = 0U; i < blkCnt; i++)
+    {
+      pDst[i] = (q15_t) ((pTime[i] + rnd) >> shift);
+    }
+  }
+}
+
+/**
+ * @brief Processing function for the Q15 overlap-save FIR filter.
+ * @param[in,out] *S         points to an instance of the Q15 overlap-save FIR structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data, may be pSrc.
+ * @param[in]     blockSize  number of samples to process, any number.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * In direct form as arm_fir_q15(): 64-bit accumulation, results shifted
+ * by 15 and saturated. The FFT frames keep a block exponent, see the
+ * FirFft group.
+ */
+void arm_fir_fft_q15(
+  arm_fir_fft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pFrame = S->pScratch;                   /* Frame of numTaps-1 old and blkCnt new inputs */
+  uint32_t numHist = S->numTaps - 1U;            /* Inputs kept from block to block */
+  uint32_t blkCnt, i;                            /* Loop counters */
+  q63_t sum;
+
+  while (blockSize > 0U)
+  {
+    blkCnt = (blockSize < S->blockLen) ? blockSize : S->blockLen;
+
+    /* The last numTaps-1 inputs of the frame are the state for the next one */
+    memcpy(pFrame, S->pState, numHist * sizeof(q15_t));
+    memcpy(pFrame + numHist, pSrc, blkCnt * sizeof(q15_t));
+    memcpy(S->pState, pFrame + blkCnt, numHist * sizeof(q15_t));
+
+    if (S->fftLen == 0U)
+    {
+      for (i = 0U; i < blkCnt; i++)
+      {
+        arm_dot_prod_q15(pFrame + i, S->pCoeffs, S->numTaps, &sum);
+        pDst[i] = (q15_t) __SSAT((q31_t) (sum >> 15), 16);
+      }
+    }
+    else
+    {
+      memset(pFrame + numHist + blkCnt, 0, (S->fftLen - numHist - blkCnt) * sizeof(q15_t));
+      arm_fir_fft_frame_q15(S, pDst, blkCnt);
+    }
+
+    pSrc += blkCnt;
+    pDst += blkCnt;
+    blockSize -= blkCnt;
+  }
+}
+
+/**
+ * @} end of FirFft group
+ */
@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_multi_init_q15.c
+ * Description:  Q15 FIR filter initialization function with interleaved channels
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+* @addtogroup FIR
+* @{
+*/
+
+/**
+* @brief  Initialization function for the Q15 FIR filter with interleaved channels.
+* @param[in,out] *S           points to an instance of the multichannel Q15 FIR filter structure.
+* @param[in]     numTaps      Number of filter coefficients in the filter.
+* @param[in]     numChannels  number of interleaved channels.
+* @param[in]     *pCoeffs     points to the filter coefficients.
+* @param[in]     *pState      points to the state buffer.
+* @param[in]     blockSize    number of frames that are processed per call.
+* @return        none.
+*
+* \par
+* The coefficients are stored in time reversed order as for a single
+* channel FIR and are shared by all channels. <code>pState</code> holds
+* <code>(numTaps+blockSize-1)*numChannels</code> interleaved values.
+*/
+void arm_fir_multi_init_q15(
+  arm_fir_multi_instance_q15 * S,
+  uint16_t numTaps,
+  uint16_t numChannels,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize)
+{
+  /* Assign filter taps and channels */
+  S->numTaps = numTaps;
+  S->numChannels = numChannels;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and the size of state buffer is (blockSize + numTaps - 1) * numChannels */
+  memset(pState, 0, ((numTaps + (blockSize - 1U)) * numChannels) * sizeof(q15_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+* @} end of FIR group
+*/
@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_multi_q15.c
+ * Description:  Q15 FIR filter processing function with interleaved channels
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+* @addtogroup FIR
+* @{
+*/
+
+/* Channels accumulated together, each coefficient is read once per group */
+#define FIR_MULTI_LANES 4U
+
+/**
+* @brief Processing function for the Q15 FIR filter with interleaved channels.
+* @param[in]  *S        points to an instance of the multichannel Q15 FIR structure.
+* @param[in]  *pSrc     points to the block of interleaved input data.
+* @param[out] *pDst     points to the block of interleaved output data.
+* @param[in]  blockSize number of frames to process.
+* @return none.
+*
+* \par
+* Sample n of channel c is <code>pSrc[n*numChannels + c]</code>. The state
+* buffer keeps the past frames interleaved the same way, so a tap is one
+* coefficient against FIR_MULTI_LANES adjacent samples.
+*
+* <b>Scaling and Overflow Behavior:</b>
+* \par
+* As arm_fir_q15() on Cortex-M0: the products are summed in a 64-bit
+* accumulator, which is truncated to 1.15 and saturated, so each channel
+* is bit exact with that function.
+*/
+void arm_fir_multi_q15(
+  const arm_fir_multi_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current frame of the state */
+  q15_t *px;                                     /* Temporary pointer for state buffer */
+  q63_t acc[FIR_MULTI_LANES];                    /* Accumulators */
+  q63_t sum;                                     /* Accumulator of a single channel */
+  q31_t coef;                                    /* Coefficient of the tap */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numChannels = S->numChannels;         /* Number of channels */
+  uint32_t tapCnt, blkCnt, ch, lane;             /* Loop counters */
+
+  /* The new frames go after the previous numTaps - 1 frames */
+  pStateCurnt = pState + ((numTaps - 1U) * numChannels);
+  memcpy(pStateCurnt, pSrc, (blockSize * numChannels) * sizeof(q15_t));
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* Groups of FIR_MULTI_LANES channels, the accumulators stay in registers */
+    for (ch = 0U; (ch + FIR_MULTI_LANES) <= numChannels; ch += FIR_MULTI_LANES)
+    {
+      for (lane = 0U; lane < FIR_MULTI_LANES; lane++)
+      {
+        acc[lane] = 0;
+      }
+
+      /* acc =  b[numTaps-1] * x[n-numTaps+1] + ... + b[0] * x[n] */
+      px = pState + ch;
+
+      for (tapCnt = 0U; tapCnt < numTaps; tapCnt++)
+      {
+        coef = pCoeffs[tapCnt];
+
+        for (lane = 0U; lane < FIR_MULTI_LANES; lane++)
+        {
+          acc[lane] += (q31_t) px[lane] * coef;
+        }
+
+        px += numChannels;
+      }
+
+      /* The result is in 2.30 format.  Convert to 1.15 */
+      for (lane = 0U; lane < FIR_MULTI_LANES; lane++)
+      {
+        pDst[ch + lane] = (q15_t) __SSAT((acc[lane] >> 15U), 16);
+      }
+    }
+
+    /* The remaining channels one at a time */
+    for (; ch < numChannels; ch++)
+    {
+      sum = 0;
+      px = pState + ch;
+
+      for (tapCnt = 0U; tapCnt < numTaps; tapCnt++)
+      {
+        sum += (q31_t) *px * pCoeffs[tapCnt];
+        px += numChannels;
+      }
+
+      pDst[ch] = (q15_t) __SSAT((sum >> 15U), 16);
+    }
+
+    /* Advance state and destination by one frame */
+    pState += numChannels;
+    pDst += numChannels;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 frames to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  memmove(S->pState, pState, ((numTaps - 1U) * numChannels) * sizeof(q15_t));
+}
+
+/**
+* @} end of FIR group
+*/
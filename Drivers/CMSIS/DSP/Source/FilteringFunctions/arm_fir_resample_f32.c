@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_f32.c
+ * Description:  Floating-point polyphase L/M resampler
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+
+/**
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Resamplers
+ *
+ * These functions change the sample rate of a signal by a rational factor
+ * <code>L/M</code>, or by any factor with the fractional variant. They do
+ * the work of an FIR interpolator by <code>L</code> followed by a
+ * decimator by <code>M</code>, but compute only the outputs that are kept:
+ * 44.1 kHz to 16 kHz is <code>L=160</code>, <code>M=441</code>, where the
+ * chain would compute 441 samples for each one it keeps.
+ *
+ * \par Algorithm:
+ * The filter runs at <code>L</code> times the input rate and is split into
+ * <code>L</code> polyphase components of <code>phaseLength=numTaps/L</code>
+ * taps, as in the \ref FIR_Interpolate "FIR interpolator". Output m falls
+ * on the upsampled sample <code>m*M = n*L + p</code>, so it is component p
+ * against the newest input x[n]:
+ * <pre>
+ *    y[m] = b[p] * x[n] + b[L+p] * x[n-1] + ... + b[L*(phaseLength-1)+p] * x[n-phaseLength+1]
+ * </pre>
+ * The instance keeps p across calls, so blocks of any length, down to
+ * single samples, give the same output stream. A call writes between
+ * <code>(blockSize*L)/M</code> and <code>(blockSize*L)/M+1</code> samples
+ * and returns how many.
+ * \par
+ * The filter is a lowpass at the upsampled rate with a cutoff of
+ * <code>1/L</code> or <code>1/M</code> of Nyquist, whichever is lower, and
+ * a DC gain of <code>L</code>. The coefficients are stored in time
+ * reversed order like those of the interpolator, so an interpolator
+ * filter works unchanged:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * <code>pState</code> holds <code>blockSize + phaseLength - 1</code>
+ * samples. <code>blockSize</code> only sizes this buffer: longer calls
+ * are taken in parts of <code>blockSize</code> inputs.
+ *
+ * \par Fractional resampler
+ * For rates with no small ratio, or ones that drift, the fractional
+ * resamplers step through the input by <code>step</code> samples per
+ * output, an 8.24 value that may be changed between calls to track a
+ * clock. A position between polyphase components p and p+1 of a filter
+ * with <code>numPhases</code> components is linearly interpolated
+ * between the outputs of both. Only the newest tap of component
+ * <code>numPhases</code>, which would need the next input, is left out;
+ * a lowpass with a small b[0] makes that negligible. With the lowpass
+ * designed for <code>numPhases</code> times the input rate, the
+ * interpolation images fall at multiples of that rate and are attenuated
+ * by about 12 dB per doubling of <code>numPhases</code>.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a resampler are stored together in an instance data structure.
+ * A separate instance structure must be defined for each resampler.
+ * Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.
+ * The initialization functions set the factors, clear the state and
+ * check the filter length, which must be a multiple of <code>L</code> or
+ * <code>numPhases</code>.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 functions accumulate in 64 bits and truncate to 1.15 with
+ * saturation, as arm_fir_interpolate_q15() does; the L/M resampler is
+ * bit exact with that function followed by keeping every M-th sample.
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point L/M resampler.
+ * @param[in,out] *S        points to an instance of the floating-point L/M resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data, <code>(blockSize*L)/M+1</code> values at most.
+ * @param[in]     blockSize number of input samples to process, any number.
+ * @return        number of output samples written.
+ */
+uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+  float32_t *pNew;                               /* State of the newest input minus phaseLen - 1 */
+  const float32_t *px, *pb;                      /* Temporary pointers for state and coefficient buffers */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t L = S->L, M = S->M;                   /* Resampling factors */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t phase = S->phase;                     /* Component of the next output */
+  uint32_t numOut = 0U;                          /* Output samples written */
+  uint32_t blkCnt, tapCnt, part;                 /* Loop counters */
+
+  while (blockSize > 0U)
+  {
+    /* The new inputs go after the previous phaseLen - 1 samples */
+    part = (blockSize < S->blockSize) ? blockSize : S->blockSize;
+    memcpy(pState + (phaseLen - 1U), pSrc, part * sizeof(float32_t));
+    pSrc += part;
+    blockSize -= part;
+
+    pNew = pState;
+
+    for (blkCnt = part; blkCnt > 0U; blkCnt--)
+    {
+      /* Every output with this input as its newest, none when M > L skips it */
+      while (phase < L)
+      {
+        sum = 0.0f;
+        px = pNew;
+        pb = pCoeffs + (L - 1U - phase);
+
+        for (tapCnt = phaseLen; tapCnt > 0U; tapCnt--)
+        {
+          sum += *px++ * *pb;
+          pb += L;
+        }
+
+        *pDst++ = sum;
+        numOut++;
+        phase += M;
+      }
+
+      phase -= L;
+      pNew++;
+    }
+
+    /* Keep the last phaseLen - 1 samples for the next part or call */
+    memmove(pState, pNew, (phaseLen - 1U) * sizeof(float32_t));
+  }
+
+  S->phase = phase;
+
+  return (numOut);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_frac_f32.c
+ * Description:  Floating-point polyphase fractional resampler
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point fractional resampler.
+ * @param[in,out] *S        points to an instance of the floating-point fractional resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data, <code>blockSize*ARM_RESAMPLE_STEP_ONE/step+1</code> values at most.
+ * @param[in]     blockSize number of input samples to process, any number.
+ * @return        number of output samples written.
+ *
+ * \par
+ * An output at <code>pos</code> past the newest input x[n] is at the
+ * upsampled sample <code>n*numPhases + pos*numPhases</code>: component
+ * p is the integer part of <code>pos*numPhases</code>, the fraction
+ * weights component p+1. Both are summed in one pass over the taps.
+ */
+uint32_t arm_fir_resample_frac_f32(
+  arm_fir_resample_frac_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+  float32_t *pNew;                               /* State of the newest input minus phaseLen - 1 */
+  const float32_t *px, *pb;                      /* Temporary pointers for state and coefficient buffers */
+  float32_t sum0, sum1;                          /* Accumulators of components p and p+1 */
+  float32_t x0;                                  /* Input sample */
+  uint32_t P = S->numPhases;                     /* Number of polyphase filter components */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t step = S->step, pos = S->pos;         /* 8.24 step and position of the next output */
+  uint32_t idx, p;                               /* Upsampled position in 8.24 and its component */
+  uint32_t numOut = 0U;                          /* Output samples written */
+  uint32_t blkCnt, tapCnt, part;                 /* Loop counters */
+
+  while (blockSize > 0U)
+  {
+    /* The new inputs go after the previous phaseLen - 1 samples */
+    part = (blockSize < S->blockSize) ? blockSize : S->blockSize;
+    memcpy(pState + (phaseLen - 1U), pSrc, part * sizeof(float32_t));
+    pSrc += part;
+    blockSize -= part;
+
+    pNew = pState;
+
+    for (blkCnt = part; blkCnt > 0U; blkCnt--)
+    {
+      /* Every output before the next input */
+      while (pos < ARM_RESAMPLE_STEP_ONE)
+      {
+        idx = pos * P;
+        p = idx >> 24;
+
+        sum0 = 0.0f;
+        sum1 = 0.0f;
+        px = pNew;
+        pb = pCoeffs + (P - 1U - p);
+        tapCnt = phaseLen;
+
+        /* Component p+1 is the coefficient before, the oldest tap of
+           component P has none */
+        if (p == (P - 1U))
+        {
+          sum0 = *px++ * *pb;
+          pb += P;
+          tapCnt--;
+        }
+
+        while (tapCnt > 0U)
+        {
+          x0 = *px++;
+          sum0 += x0 * pb[0];
+          sum1 += x0 * pb[-1];
+          pb += P;
+          tapCnt--;
+        }
+
+        *pDst++ = sum0 + ((sum1 - sum0) * ((float32_t) (idx & 0x00FFFFFFU) * (1.0f / 16777216.0f)));
+        numOut++;
+        pos += step;
+      }
+
+      pos -= ARM_RESAMPLE_STEP_ONE;
+      pNew++;
+    }
+
+    /* Keep the last phaseLen - 1 samples for the next part or call */
+    memmove(pState, pNew, (phaseLen - 1U) * sizeof(float32_t));
+  }
+
+  S->pos = pos;
+
+  return (numOut);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_frac_init_f32.c
+ * Description:  Floating-point fractional resampler initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point fractional resampler.
+ * @param[in,out] *S         points to an instance of the floating-point fractional resampler structure.
+ * @param[in]     numPhases  number of polyphase filter components, 256 at most.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs   points to the filter coefficient buffer.
+ * @param[in]     *pState    points to the state buffer.
+ * @param[in]     step       input samples per output sample in 8.24 format, below 128.
+ * @param[in]     blockSize  most input samples the state buffer takes at once.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+ * <code>numPhases</code>, <code>step</code> or <code>blockSize</code> is out of range or ARM_MATH_LENGTH_ERROR if
+ * the filter length <code>numTaps</code> is not a multiple of <code>numPhases</code>.
+ *
+ * \par
+ * <code>pState</code> points to an array of length <code>blockSize + numTaps/numPhases - 1</code>.
+ * The first output is at the time of the first input.
+ */
+arm_status arm_fir_resample_frac_init_f32(
+  arm_fir_resample_frac_instance_f32 * S,
+  uint16_t numPhases,
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t step,
+  uint32_t blockSize)
+{
+  /* numPhases times a position below ARM_RESAMPLE_STEP_ONE fits 32 bits,
+     the position plus a step too */
+  if ((numPhases == 0U) || (numPhases > 256U) || (step == 0U) || (step >= 0x80000000U) || (blockSize == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* The filter length must be a multiple of the number of components */
+  if ((numTaps % numPhases) != 0U)
+  {
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  S->numPhases = numPhases;
+  S->phaseLength = numTaps / numPhases;
+  S->step = step;
+  S->pos = 0U;
+  S->blockSize = blockSize;
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size of buffer is always phaseLength + blockSize - 1 */
+  memset(pState, 0, (blockSize + ((uint32_t) S->phaseLength - 1U)) * sizeof(float32_t));
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
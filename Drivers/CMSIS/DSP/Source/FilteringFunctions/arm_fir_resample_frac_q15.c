@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_frac_q15.c
+ * Description:  Q15 polyphase fractional resampler
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 fractional resampler.
+ * @param[in,out] *S        points to an instance of the Q15 fractional resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data, <code>blockSize*ARM_RESAMPLE_STEP_ONE/step+1</code> values at most.
+ * @param[in]     blockSize number of input samples to process, any number.
+ * @return        number of output samples written.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Both components are summed in 64-bit accumulators in 2.30 format and
+ * truncated to 1.15 in 32 bits. Their difference is weighted by the
+ * fraction in 1.15 and the result saturated to 16 bits.
+ */
+uint32_t arm_fir_resample_frac_q15(
+  arm_fir_resample_frac_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;             /* Coefficient pointer */
+  q15_t *pNew;                                   /* State of the newest input minus phaseLen - 1 */
+  const q15_t *px, *pb;                          /* Temporary pointers for state and coefficient buffers */
+  q63_t sum0, sum1;                              /* Accumulators of components p and p+1 */
+  q31_t x0;                                      /* Input sample */
+  uint32_t P = S->numPhases;                     /* Number of polyphase filter components */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t step = S->step, pos = S->pos;         /* 8.24 step and position of the next output */
+  uint32_t idx, p;                               /* Upsampled position in 8.24 and its component */
+  uint32_t numOut = 0U;                          /* Output samples written */
+  uint32_t blkCnt, tapCnt, part;                 /* Loop counters */
+
+  while (blockSize > 0U)
+  {
+    /* The new inputs go after the previous phaseLen - 1 samples */
+    part = (blockSize < S->blockSize) ? blockSize : S->blockSize;
+    memcpy(pState + (phaseLen - 1U), pSrc, part * sizeof(q15_t));
+    pSrc += part;
+    blockSize -= part;
+
+    pNew = pState;
+
+    for (blkCnt = part; blkCnt > 0U; blkCnt--)
+    {
+      /* Every output before the next input */
+      while (pos < ARM_RESAMPLE_STEP_ONE)
+      {
+        idx = pos * P;
+        p = idx >> 24;
+
+        sum0 = 0;
+        sum1 = 0;
+        px = pNew;
+        pb = pCoeffs + (P - 1U - p);
+        tapCnt = phaseLen;
+
+        /* Component p+1 is the coefficient before, the oldest tap of
+           component P has none */
+        if (p == (P - 1U))
+        {
+          sum0 = (q31_t) *px++ * *pb;
+          pb += P;
+          tapCnt--;
+        }
+
+        while (tapCnt > 0U)
+        {
+          x0 = *px++;
+          sum0 += x0 * pb[0];
+          sum1 += x0 * pb[-1];
+          pb += P;
+          tapCnt--;
+        }
+
+        /* Convert to 1.15, then weight the difference by the fraction in 1.15 */
+        sum0 = (q31_t) (sum0 >> 15);
+        sum1 = (q31_t) (sum1 >> 15);
+        sum0 += ((sum1 - sum0) * (q31_t) ((idx & 0x00FFFFFFU) >> 9)) >> 15;
+
+        *pDst++ = (q15_t) (__SSAT((q31_t) sum0, 16));
+        numOut++;
+        pos += step;
+      }
+
+      pos -= ARM_RESAMPLE_STEP_ONE;
+      pNew++;
+    }
+
+    /* Keep the last phaseLen - 1 samples for the next part or call */
+    memmove(pState, pNew, (phaseLen - 1U) * sizeof(q15_t));
+  }
+
+  S->pos = pos;
+
+  return (numOut);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_init_f32.c
+ * Description:  Floating-point L/M resampler initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point L/M resampler.
+ * @param[in,out] *S         points to an instance of the floating-point L/M resampler structure.
+ * @param[in]     L          upsample factor.
+ * @param[in]     M          downsample factor.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs   points to the filter coefficient buffer.
+ * @param[in]     *pState    points to the state buffer.
+ * @param[in]     blockSize  most input samples the state buffer takes at once.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+ * <code>L</code>, <code>M</code> or <code>blockSize</code> is 0 or ARM_MATH_LENGTH_ERROR if the filter length
+ * <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+ *
+ * \par
+ * <code>pState</code> points to an array of length <code>blockSize + numTaps/L - 1</code>.
+ * The first output uses component 0 against the first input.
+ */
+arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  if ((L == 0U) || (M == 0U) || (blockSize == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* The filter length must be a multiple of the interpolation factor */
+  if ((numTaps % L) != 0U)
+  {
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  S->L = L;
+  S->M = M;
+  S->phaseLength = numTaps / L;
+  S->phase = 0U;
+  S->blockSize = blockSize;
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size of buffer is always phaseLength + blockSize - 1 */
+  memset(pState, 0, (blockSize + ((uint32_t) S->phaseLength - 1U)) * sizeof(float32_t));
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
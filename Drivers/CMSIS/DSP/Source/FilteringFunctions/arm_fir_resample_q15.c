@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q15.c
+ * Description:  Q15 polyphase L/M resampler
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 L/M resampler.
+ * @param[in,out] *S        points to an instance of the Q15 L/M resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data, <code>(blockSize*L)/M+1</code> values at most.
+ * @param[in]     blockSize number of input samples to process, any number.
+ * @return        number of output samples written.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are summed in a 64-bit accumulator, which is truncated to
+ * 1.15 and saturated. The DC gain of <code>L</code> spreads over the
+ * <code>L</code> components, which sum to about 1 each, so the
+ * coefficients of the lowpass fit 1.15.
+ */
+uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;             /* Coefficient pointer */
+  q15_t *pNew;                                   /* State of the newest input minus phaseLen - 1 */
+  const q15_t *px, *pb;                          /* Temporary pointers for state and coefficient buffers */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t L = S->L, M = S->M;                   /* Resampling factors */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t phase = S->phase;                     /* Component of the next output */
+  uint32_t numOut = 0U;                          /* Output samples written */
+  uint32_t blkCnt, tapCnt, part;                 /* Loop counters */
+
+  while (blockSize > 0U)
+  {
+    /* The new inputs go after the previous phaseLen - 1 samples */
+    part = (blockSize < S->blockSize) ? blockSize : S->blockSize;
+    memcpy(pState + (phaseLen - 1U), pSrc, part * sizeof(q15_t));
+    pSrc += part;
+    blockSize -= part;
+
+    pNew = pState;
+
+    for (blkCnt = part; blkCnt > 0U; blkCnt--)
+    {
+      /* Every output with this input as its newest, none when M > L skips it */
+      while (phase < L)
+      {
+        sum = 0;
+        px = pNew;
+        pb = pCoeffs + (L - 1U - phase);
+
+        for (tapCnt = phaseLen; tapCnt > 0U; tapCnt--)
+        {
+          sum += (q31_t) *px++ * *pb;
+          pb += L;
+        }
+
+        /* The result is in 2.30 format.  Convert to 1.15 */
+        *pDst++ = (q15_t) (__SSAT((sum >> 15), 16));
+        numOut++;
+        phase += M;
+      }
+
+      phase -= L;
+      pNew++;
+    }
+
+    /* Keep the last phaseLen - 1 samples for the next part or call */
+    memmove(pState, pNew, (phaseLen - 1U) * sizeof(q15_t));
+  }
+
+  S->phase = phase;
+
+  return (numOut);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
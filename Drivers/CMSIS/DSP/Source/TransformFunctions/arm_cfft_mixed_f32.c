@@ -0,0 +1,394 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_f32.c
+ * Description:  Mixed radix 2/3/4/5 Decimation in Frequency CFFT Floating point processing function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_cfft_mixed_reorder_32(
+    uint32_t * pSrc,
+    const uint16_t * pCycles,
+    uint16_t cyclesLength);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup MixedFFT Mixed Radix FFT Functions
+ *
+ * \par
+ * Complex and real FFTs of any length that is a product of 2, 3 and 5,
+ * such as 60, 80, 96, 120 or 240, for frames that do not come in powers
+ * of two. The complex FFT runs radix 4, 2, 3 and 5 stages, decimation in
+ * frequency and in place, followed by a digit reversal; its cost grows as
+ * N log N like that of arm_cfft_f32(). The real FFT of N points runs the
+ * complex FFT of N/2 points and a split step, as arm_rfft_fast_f32() does.
+ *
+ * \par
+ * The init functions factor the length and fill caller supplied buffers
+ * with the twiddle factors and the digit reversal cycles, there are no
+ * tables in flash:
+ *
+ * <pre>
+ *                      pTwiddle (values)    pCycles (entries)
+ *   CFFT, fftLen       2 * fftLen           fftLen
+ *   RFFT, fftLen       2 * fftLen           fftLen / 2
+ * </pre>
+ *
+ * \par
+ * The twiddles are computed in double precision once, so init pulls in
+ * sin() and cos(); the buffers may be reused by any number of instances
+ * of the same length and type.
+ *
+ * \par Fixed point
+ * As with arm_cfft_q15() every stage divides by its radix, so the complex
+ * FFT and IFFT both return the transform divided by fftLen. Inputs are
+ * exact within the unit circle, larger ones saturate. The real FFT returns
+ * the spectrum divided by fftLen and the real IFFT the inverse transform,
+ * so a round trip gives the input divided by fftLen.
+ *
+ * \par Output format
+ * The complex transforms keep the layout of arm_cfft_f32(). The real FFT
+ * packs its output as arm_rfft_fast_f32() does: the real parts of bin 0
+ * and of bin fftLen/2, then the complex bins 1 to fftLen/2 - 1. The real
+ * IFFT takes that format.
+ */
+
+/**
+ * @addtogroup MixedFFT
+ * @{
+ */
+
+#define C3_F32  0.86602540378f    /* sin(2*pi/3) */
+#define C51_F32 0.30901699437f    /* cos(2*pi/5) */
+#define C52_F32 -0.80901699437f   /* cos(4*pi/5) */
+#define S51_F32 0.95105651630f    /* sin(2*pi/5) */
+#define S52_F32 0.58778525229f    /* sin(4*pi/5) */
+
+/* Stores y times the twiddle factor c - j*s */
+#define ROTATE_F32(p, yr, yi, c, s)   \
+  (p)[0] = ((yr) * (c)) + ((yi) * (s)); \
+  (p)[1] = ((yi) * (c)) - ((yr) * (s))
+
+/*
+ * One stage: fftLen / (radix * m) groups of radix blocks of m samples.
+ * Butterfly k of a group takes sample k of every block and leaves bin r
+ * times exp(-j*2*pi*r*k*twidStep/tableLen) in block r.
+ */
+static void arm_radix2_mixed_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  uint32_t m,
+  const float32_t * pCoef,
+  uint32_t twidStep)
+{
+  float32_t *p0, *p1;
+  float32_t x0r, x0i, x1r, x1i, c1, s1;
+  uint32_t i, k, n = 2U * m;
+
+  for (k = 0U; k < m; k++)
+  {
+    c1 = pCoef[2U * k * twidStep];
+    s1 = pCoef[2U * k * twidStep + 1U];
+
+    for (i = k; i < fftLen; i += n)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+      x0r = p0[0];
+      x0i = p0[1];
+      x1r = p1[0];
+      x1i = p1[1];
+
+      p0[0] = x0r + x1r;
+      p0[1] = x0i + x1i;
+      x0r -= x1r;
+      x0i -= x1i;
+      if (k == 0U)
+      {
+        p1[0] = x0r;
+        p1[1] = x0i;
+      }
+      else
+      {
+        ROTATE_F32(p1, x0r, x0i, c1, s1);
+      }
+    }
+  }
+}
+
+static void arm_radix3_mixed_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  uint32_t m,
+  const float32_t * pCoef,
+  uint32_t twidStep)
+{
+  float32_t *p0, *p1, *p2;
+  float32_t tr, ti, dr, di, mr, mi, c1, s1, c2, s2;
+  uint32_t i, k, n = 3U * m;
+
+  for (k = 0U; k < m; k++)
+  {
+    c1 = pCoef[2U * k * twidStep];
+    s1 = pCoef[2U * k * twidStep + 1U];
+    c2 = pCoef[4U * k * twidStep];
+    s2 = pCoef[4U * k * twidStep + 1U];
+
+    for (i = k; i < fftLen; i += n)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+      p2 = p1 + 2U * m;
+
+      tr = p1[0] + p2[0];
+      ti = p1[1] + p2[1];
+      dr = C3_F32 * (p1[0] - p2[0]);
+      di = C3_F32 * (p1[1] - p2[1]);
+      mr = p0[0] - 0.5f * tr;
+      mi = p0[1] - 0.5f * ti;
+
+      /* y1 = m - j*d, y2 = m + j*d */
+      p0[0] += tr;
+      p0[1] += ti;
+      if (k == 0U)
+      {
+        p1[0] = mr + di;
+        p1[1] = mi - dr;
+        p2[0] = mr - di;
+        p2[1] = mi + dr;
+      }
+      else
+      {
+        ROTATE_F32(p1, mr + di, mi - dr, c1, s1);
+        ROTATE_F32(p2, mr - di, mi + dr, c2, s2);
+      }
+    }
+  }
+}
+
+static void arm_radix4_mixed_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  uint32_t m,
+  const float32_t * pCoef,
+  uint32_t twidStep)
+{
+  float32_t *p0, *p1, *p2, *p3;
+  float32_t a0r, a0i, a1r, a1i, b0r, b0i, b1r, b1i;
+  float32_t c1, s1, c2, s2, c3, s3;
+  uint32_t i, k, n = 4U * m;
+
+  for (k = 0U; k < m; k++)
+  {
+    c1 = pCoef[2U * k * twidStep];
+    s1 = pCoef[2U * k * twidStep + 1U];
+    c2 = pCoef[4U * k * twidStep];
+    s2 = pCoef[4U * k * twidStep + 1U];
+    c3 = pCoef[6U * k * twidStep];
+    s3 = pCoef[6U * k * twidStep + 1U];
+
+    for (i = k; i < fftLen; i += n)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+      p2 = p1 + 2U * m;
+      p3 = p2 + 2U * m;
+
+      a0r = p0[0] + p2[0];
+      a0i = p0[1] + p2[1];
+      a1r = p0[0] - p2[0];
+      a1i = p0[1] - p2[1];
+      b0r = p1[0] + p3[0];
+      b0i = p1[1] + p3[1];
+      b1r = p1[0] - p3[0];
+      b1i = p1[1] - p3[1];
+
+      /* y0 = a0 + b0, y1 = a1 - j*b1, y2 = a0 - b0, y3 = a1 + j*b1 */
+      p0[0] = a0r + b0r;
+      p0[1] = a0i + b0i;
+      if (k == 0U)
+      {
+        p1[0] = a1r + b1i;
+        p1[1] = a1i - b1r;
+        p2[0] = a0r - b0r;
+        p2[1] = a0i - b0i;
+        p3[0] = a1r - b1i;
+        p3[1] = a1i + b1r;
+      }
+      else
+      {
+        ROTATE_F32(p1, a1r + b1i, a1i - b1r, c1, s1);
+        ROTATE_F32(p2, a0r - b0r, a0i - b0i, c2, s2);
+        ROTATE_F32(p3, a1r - b1i, a1i + b1r, c3, s3);
+      }
+    }
+  }
+}
+
+static void arm_radix5_mixed_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  uint32_t m,
+  const float32_t * pCoef,
+  uint32_t twidStep)
+{
+  float32_t *p0, *p1, *p2, *p3, *p4;
+  float32_t a1r, a1i, a2r, a2i, b1r, b1i, b2r, b2i;
+  float32_t m1r, m1i, m2r, m2i, q1r, q1i, q2r, q2i;
+  float32_t c1, s1, c2, s2, c3, s3, c4, s4;
+  uint32_t i, k, n = 5U * m;
+
+  for (k = 0U; k < m; k++)
+  {
+    c1 = pCoef[2U * k * twidStep];
+    s1 = pCoef[2U * k * twidStep + 1U];
+    c2 = pCoef[4U * k * twidStep];
+    s2 = pCoef[4U * k * twidStep + 1U];
+    c3 = pCoef[6U * k * twidStep];
+    s3 = pCoef[6U * k * twidStep + 1U];
+    c4 = pCoef[8U * k * twidStep];
+    s4 = pCoef[8U * k * twidStep + 1U];
+
+    for (i = k; i < fftLen; i += n)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+      p2 = p1 + 2U * m;
+      p3 = p2 + 2U * m;
+      p4 = p3 + 2U * m;
+
+      a1r = p1[0] + p4[0];
+      a1i = p1[1] + p4[1];
+      b1r = p1[0] - p4[0];
+      b1i = p1[1] - p4[1];
+      a2r = p2[0] + p3[0];
+      a2i = p2[1] + p3[1];
+      b2r = p2[0] - p3[0];
+      b2i = p2[1] - p3[1];
+
+      m1r = p0[0] + (C51_F32 * a1r) + (C52_F32 * a2r);
+      m1i = p0[1] + (C51_F32 * a1i) + (C52_F32 * a2i);
+      m2r = p0[0] + (C52_F32 * a1r) + (C51_F32 * a2r);
+      m2i = p0[1] + (C52_F32 * a1i) + (C51_F32 * a2i);
+      q1r = (S51_F32 * b1r) + (S52_F32 * b2r);
+      q1i = (S51_F32 * b1i) + (S52_F32 * b2i);
+      q2r = (S52_F32 * b1r) - (S51_F32 * b2r);
+      q2i = (S52_F32 * b1i) - (S51_F32 * b2i);
+
+      /* y1 = m1 - j*q1, y4 = m1 + j*q1, y2 = m2 - j*q2, y3 = m2 + j*q2 */
+      p0[0] += a1r + a2r;
+      p0[1] += a1i + a2i;
+      if (k == 0U)
+      {
+        p1[0] = m1r + q1i;
+        p1[1] = m1i - q1r;
+        p2[0] = m2r + q2i;
+        p2[1] = m2i - q2r;
+        p3[0] = m2r - q2i;
+        p3[1] = m2i + q2r;
+        p4[0] = m1r - q1i;
+        p4[1] = m1i + q1r;
+      }
+      else
+      {
+        ROTATE_F32(p1, m1r + q1i, m1i - q1r, c1, s1);
+        ROTATE_F32(p2, m2r + q2i, m2i - q2r, c2, s2);
+        ROTATE_F32(p3, m2r - q2i, m2i + q2r, c3, s3);
+        ROTATE_F32(p4, m1r - q1i, m1i + q1r, c4, s4);
+      }
+    }
+  }
+}
+
+/**
+* @brief       Processing function for the mixed radix floating-point complex FFT.
+* @param[in]      *S       points to an instance of the mixed radix floating-point CFFT structure.
+* @param[in, out] *p1      points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+* @param[in]      ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @return none.
+*
+* \par
+* The output is in natural order. The inverse transform is scaled by 1/fftLen.
+*/
+void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag)
+{
+  uint32_t L = S->fftLen, n = L, m, l, s;
+  float32_t invL, *pSrc;
+
+  if (ifftFlag == 1U)
+  {
+    /*  Conjugate input data  */
+    pSrc = p1 + 1;
+    for (l = 0U; l < L; l++)
+    {
+      *pSrc = -*pSrc;
+      pSrc += 2;
+    }
+  }
+
+  for (s = 0U; s < S->numStages; s++)
+  {
+    m = n / S->pFactors[s];
+    switch (S->pFactors[s])
+    {
+    case 2U:
+      arm_radix2_mixed_f32(p1, L, m, S->pTwiddle, (L / n) * S->twidStride);
+      break;
+    case 3U:
+      arm_radix3_mixed_f32(p1, L, m, S->pTwiddle, (L / n) * S->twidStride);
+      break;
+    case 4U:
+      arm_radix4_mixed_f32(p1, L, m, S->pTwiddle, (L / n) * S->twidStride);
+      break;
+    default:
+      arm_radix5_mixed_f32(p1, L, m, S->pTwiddle, (L / n) * S->twidStride);
+      break;
+    }
+    n = m;
+  }
+
+  arm_cfft_mixed_reorder_32((uint32_t *) p1, S->pCycles, S->cyclesLength);
+
+  if (ifftFlag == 1U)
+  {
+    invL = 1.0f / (float32_t) L;
+    /*  Conjugate and scale output data */
+    pSrc = p1;
+    for (l = 0U; l < L; l++)
+    {
+      *pSrc++ *=   invL ;
+      *pSrc    = -(*pSrc) * invL;
+      pSrc++;
+    }
+  }
+}
+
+/**
+* @} end of MixedFFT group
+*/
@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_init_f32.c
+ * Description:  Initialization function for the mixed radix CFFT Floating point
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+#include "arm_math.h"
+
+#define TWO_PI_F64 6.28318530717958647692
+
+extern uint8_t arm_cfft_mixed_plan(
+    uint16_t fftLen,
+    uint8_t * pFactors,
+    uint16_t * pCycles,
+    uint16_t * pCyclesLength);
+
+/**
+ * @addtogroup MixedFFT
+ * @{
+ */
+
+/**
+* @brief  Fills a floating-point twiddle table for the mixed radix FFTs.
+* @param[out] *pTwiddle  cos and sin of 2*pi*k/tableLen for k = 0 to tableLen-1, <code>2*tableLen</code> values.
+* @param[in]  tableLen   number of twiddle factors.
+* @return none.
+*/
+void arm_cfft_mixed_twiddle_f32(
+  float32_t * pTwiddle,
+  uint32_t tableLen)
+{
+  uint32_t k;
+  double angle;
+
+  /* The second half mirrors the first with the sine negated */
+  for (k = 0U; k <= tableLen / 2U; k++)
+  {
+    angle = TWO_PI_F64 * (double) k / (double) tableLen;
+    pTwiddle[2U * k] = (float32_t) cos(angle);
+    pTwiddle[2U * k + 1U] = (float32_t) sin(angle);
+    if ((k != 0U) && (2U * k != tableLen))
+    {
+      pTwiddle[2U * (tableLen - k)] = pTwiddle[2U * k];
+      pTwiddle[2U * (tableLen - k) + 1U] = -pTwiddle[2U * k + 1U];
+    }
+  }
+}
+
+/**
+* @brief  Initialization function for the mixed radix floating-point complex FFT.
+* @param[out] *S        points to an instance of the mixed radix floating-point CFFT structure.
+* @param[in]  fftLen    length of the FFT, a product of 2, 3 and 5 up to 4096.
+* @param[out] *pTwiddle twiddle factor buffer of <code>2*fftLen</code> values.
+* @param[out] *pCycles  digit reversal buffer of <code>fftLen</code> entries.
+* @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+*/
+arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  uint16_t * pCycles)
+{
+  S->numStages = arm_cfft_mixed_plan(fftLen, S->pFactors, pCycles, &S->cyclesLength);
+  if (S->numStages == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->fftLen = fftLen;
+  S->twidStride = 1U;
+  S->pTwiddle = pTwiddle;
+  S->pCycles = pCycles;
+  arm_cfft_mixed_twiddle_f32(pTwiddle, fftLen);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+* @} end of MixedFFT group
+*/
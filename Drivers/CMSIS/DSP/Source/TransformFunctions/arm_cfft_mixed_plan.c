@@ -0,0 +1,201 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_plan.c
+ * Description:  Factorization and digit reversal of the mixed radix CFFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Marks the last index of a cycle in the cycle table */
+#define CYCLE_END 0x8000U
+
+/*
+ * Position at which the decimation in frequency stages leave bin f.
+ * Stage s splits the data into pFactors[s] blocks of m samples and bin
+ * f = r0 + p0 * (r1 + p1 * (r2 + ...)) ends up in block r0 of the first
+ * stage, block r1 of the second and so on.
+ */
+static uint16_t arm_cfft_mixed_position(
+  uint16_t f,
+  uint16_t fftLen,
+  const uint8_t * pFactors,
+  uint8_t numStages)
+{
+  uint32_t pos = 0U, m = fftLen;
+  uint32_t s;
+
+  for (s = 0U; s < numStages; s++)
+  {
+    m /= pFactors[s];
+    pos += (f % pFactors[s]) * m;
+    f /= pFactors[s];
+  }
+
+  return ((uint16_t) pos);
+}
+
+/**
+* @brief  Factors a mixed radix CFFT length and builds its digit reversal.
+* @param[in]  fftLen         length of the FFT, 2 to 4096.
+* @param[out] *pFactors      radix of every stage, ARM_CFFT_MIXED_MAX_STAGES entries.
+* @param[out] *pCycles       digit reversal cycles, <code>fftLen</code> entries at most.
+* @param[out] *pCyclesLength number of entries written to pCycles.
+* @return     number of stages, 0 if <code>fftLen</code> is not a product of 2, 3 and 5 in range.
+*
+* \par
+* Radix 4 stages come first, then at most one radix 2 stage, then the
+* radix 3 and radix 5 stages. The output permutation is written as its
+* cycles: the indices of a cycle in order, the last one or'ed with 0x8000.
+* A cycle starts at its lowest index, fixed points are left out.
+*/
+uint8_t arm_cfft_mixed_plan(
+  uint16_t fftLen,
+  uint8_t * pFactors,
+  uint16_t * pCycles,
+  uint16_t * pCyclesLength)
+{
+  uint32_t n = fftLen, num = 0U, f, j, next;
+  uint8_t numStages = 0U;
+
+  if ((fftLen < 2U) || (fftLen > 4096U))
+  {
+    return (0U);
+  }
+
+  while ((n % 4U) == 0U)
+  {
+    pFactors[numStages++] = 4U;
+    n /= 4U;
+  }
+  if ((n % 2U) == 0U)
+  {
+    pFactors[numStages++] = 2U;
+    n /= 2U;
+  }
+  while ((n % 3U) == 0U)
+  {
+    pFactors[numStages++] = 3U;
+    n /= 3U;
+  }
+  while ((n % 5U) == 0U)
+  {
+    pFactors[numStages++] = 5U;
+    n /= 5U;
+  }
+  if (n != 1U)
+  {
+    return (0U);
+  }
+
+  /* Bin f is read from the position of f. Every cycle is written from
+     its lowest index, found by walking it from each candidate. */
+  for (f = 1U; f < fftLen; f++)
+  {
+    next = arm_cfft_mixed_position(f, fftLen, pFactors, numStages);
+    j = next;
+    while (j > f)
+    {
+      j = arm_cfft_mixed_position(j, fftLen, pFactors, numStages);
+    }
+    if ((next == f) || (j != f))
+    {
+      continue;
+    }
+
+    pCycles[num++] = (uint16_t) f;
+    for (j = next; j != f; j = arm_cfft_mixed_position(j, fftLen, pFactors, numStages))
+    {
+      pCycles[num++] = (uint16_t) j;
+    }
+    pCycles[num - 1U] |= CYCLE_END;
+  }
+
+  *pCyclesLength = (uint16_t) num;
+
+  return (numStages);
+}
+
+/**
+* @brief  Reorders a mixed radix CFFT output of 32 bit values.
+* @param[in,out] *pSrc        complex data, two words per sample.
+* @param[in]     *pCycles     digit reversal cycles of arm_cfft_mixed_plan().
+* @param[in]     cyclesLength number of entries in pCycles.
+* @return none.
+*/
+void arm_cfft_mixed_reorder_32(
+  uint32_t * pSrc,
+  const uint16_t * pCycles,
+  uint16_t cyclesLength)
+{
+  const uint16_t *pEnd = pCycles + cyclesLength;
+  uint32_t j, k, re, im;
+
+  while (pCycles < pEnd)
+  {
+    /* Every sample of a cycle takes the one of the next index,
+       the last one the first */
+    j = *pCycles & (CYCLE_END - 1U);
+    re = pSrc[2U * j];
+    im = pSrc[2U * j + 1U];
+    while ((*pCycles & CYCLE_END) == 0U)
+    {
+      k = *++pCycles & (CYCLE_END - 1U);
+      pSrc[2U * j] = pSrc[2U * k];
+      pSrc[2U * j + 1U] = pSrc[2U * k + 1U];
+      j = k;
+    }
+    pCycles++;
+    pSrc[2U * j] = re;
+    pSrc[2U * j + 1U] = im;
+  }
+}
+
+/**
+* @brief  Reorders a mixed radix CFFT output of 16 bit values.
+* @param[in,out] *pSrc        complex data, one word per sample.
+* @param[in]     *pCycles     digit reversal cycles of arm_cfft_mixed_plan().
+* @param[in]     cyclesLength number of entries in pCycles.
+* @return none.
+*/
+void arm_cfft_mixed_reorder_16(
+  uint32_t * pSrc,
+  const uint16_t * pCycles,
+  uint16_t cyclesLength)
+{
+  const uint16_t *pEnd = pCycles + cyclesLength;
+  uint32_t j, k, in;
+
+  while (pCycles < pEnd)
+  {
+    j = *pCycles & (CYCLE_END - 1U);
+    in = pSrc[j];
+    while ((*pCycles & CYCLE_END) == 0U)
+    {
+      k = *++pCycles & (CYCLE_END - 1U);
+      pSrc[j] = pSrc[k];
+      j = k;
+    }
+    pCycles++;
+    pSrc[j] = in;
+  }
+}
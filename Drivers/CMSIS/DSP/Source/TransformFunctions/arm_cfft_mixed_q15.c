@@ -0,0 +1,333 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_q15.c
+ * Description:  Mixed radix 2/3/4/5 Decimation in Frequency CFFT Q15 processing function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_cfft_mixed_reorder_16(
+    uint32_t * pSrc,
+    const uint16_t * pCycles,
+    uint16_t cyclesLength);
+
+/**
+ * @addtogroup MixedFFT
+ * @{
+ */
+
+#define C3_Q15  28378     /* sin(2*pi/3) */
+#define C51_Q15 10126     /* cos(2*pi/5) */
+#define C52_Q15 (-26510)  /* cos(4*pi/5) */
+#define S51_Q15 31164     /* sin(2*pi/5) */
+#define S52_Q15 19261     /* sin(4*pi/5) */
+#define R3_Q15  10922     /* 1/3, rounded down so full scale cannot overflow */
+#define R5_Q15  6553      /* 1/5 */
+
+/* Stores y times the twiddle factor c - j*s */
+#define ROTATE_Q15(p, yr, yi, c, s)                                        \
+  (p)[0] = clip_q31_to_q15((((yr) * (c)) + ((yi) * (s))) >> 15);           \
+  (p)[1] = clip_q31_to_q15((((yi) * (c)) - ((yr) * (s))) >> 15)
+
+/* Stores y, or y times the twiddle factor of butterfly k */
+#define STORE_Q15(p, yr, yi, c, s)                                         \
+  if (k == 0U)                                                             \
+  {                                                                        \
+    (p)[0] = clip_q31_to_q15(yr);                                          \
+    (p)[1] = clip_q31_to_q15(yi);                                          \
+  }                                                                        \
+  else                                                                     \
+  {                                                                        \
+    ROTATE_Q15(p, yr, yi, c, s);                                           \
+  }
+
+/*
+ * One stage: fftLen / (radix * m) groups of radix blocks of m samples.
+ * Butterfly k of a group takes sample k of every block and leaves bin r
+ * divided by the radix and times exp(-j*2*pi*r*k*twidStep/tableLen) in
+ * block r. The butterflies run in 32 bits, radix 2 and 4 cannot exceed
+ * full scale, radix 3 and 5 saturate outside the unit circle.
+ */
+static void arm_radix2_mixed_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  uint32_t m,
+  const q15_t * pCoef,
+  uint32_t twidStep)
+{
+  q15_t *p0, *p1;
+  q31_t y1r, y1i, c1, s1;
+  uint32_t i, k, n = 2U * m;
+
+  for (k = 0U; k < m; k++)
+  {
+    c1 = pCoef[2U * k * twidStep];
+    s1 = pCoef[2U * k * twidStep + 1U];
+
+    for (i = k; i < fftLen; i += n)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+
+      y1r = ((q31_t) p0[0] - p1[0]) >> 1;
+      y1i = ((q31_t) p0[1] - p1[1]) >> 1;
+      p0[0] = (q15_t) (((q31_t) p0[0] + p1[0]) >> 1);
+      p0[1] = (q15_t) (((q31_t) p0[1] + p1[1]) >> 1);
+      STORE_Q15(p1, y1r, y1i, c1, s1);
+    }
+  }
+}
+
+static void arm_radix3_mixed_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  uint32_t m,
+  const q15_t * pCoef,
+  uint32_t twidStep)
+{
+  q15_t *p0, *p1, *p2;
+  q31_t tr, ti, dr, di, mr, mi, yr, yi, c1, s1, c2, s2;
+  uint32_t i, k, n = 3U * m;
+
+  for (k = 0U; k < m; k++)
+  {
+    c1 = pCoef[2U * k * twidStep];
+    s1 = pCoef[2U * k * twidStep + 1U];
+    c2 = pCoef[4U * k * twidStep];
+    s2 = pCoef[4U * k * twidStep + 1U];
+
+    for (i = k; i < fftLen; i += n)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+      p2 = p1 + 2U * m;
+
+      tr = (q31_t) p1[0] + p2[0];
+      ti = (q31_t) p1[1] + p2[1];
+      dr = (C3_Q15 * ((q31_t) p1[0] - p2[0])) >> 15;
+      di = (C3_Q15 * ((q31_t) p1[1] - p2[1])) >> 15;
+      mr = p0[0] - (tr >> 1);
+      mi = p0[1] - (ti >> 1);
+
+      /* y1 = m - j*d, y2 = m + j*d, all divided by 3 */
+      p0[0] = (q15_t) ((R3_Q15 * (p0[0] + tr)) >> 15);
+      p0[1] = (q15_t) ((R3_Q15 * (p0[1] + ti)) >> 15);
+      yr = (R3_Q15 * (mr + di)) >> 15;
+      yi = (R3_Q15 * (mi - dr)) >> 15;
+      STORE_Q15(p1, yr, yi, c1, s1);
+      yr = (R3_Q15 * (mr - di)) >> 15;
+      yi = (R3_Q15 * (mi + dr)) >> 15;
+      STORE_Q15(p2, yr, yi, c2, s2);
+    }
+  }
+}
+
+static void arm_radix4_mixed_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  uint32_t m,
+  const q15_t * pCoef,
+  uint32_t twidStep)
+{
+  q15_t *p0, *p1, *p2, *p3;
+  q31_t a0r, a0i, a1r, a1i, b0r, b0i, b1r, b1i, yr, yi;
+  q31_t c1, s1, c2, s2, c3, s3;
+  uint32_t i, k, n = 4U * m;
+
+  for (k = 0U; k < m; k++)
+  {
+    c1 = pCoef[2U * k * twidStep];
+    s1 = pCoef[2U * k * twidStep + 1U];
+    c2 = pCoef[4U * k * twidStep];
+    s2 = pCoef[4U * k * twidStep + 1U];
+    c3 = pCoef[6U * k * twidStep];
+    s3 = pCoef[6U * k * twidStep + 1U];
+
+    for (i = k; i < fftLen; i += n)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+      p2 = p1 + 2U * m;
+      p3 = p2 + 2U * m;
+
+      a0r = (q31_t) p0[0] + p2[0];
+      a0i = (q31_t) p0[1] + p2[1];
+      a1r = (q31_t) p0[0] - p2[0];
+      a1i = (q31_t) p0[1] - p2[1];
+      b0r = (q31_t) p1[0] + p3[0];
+      b0i = (q31_t) p1[1] + p3[1];
+      b1r = (q31_t) p1[0] - p3[0];
+      b1i = (q31_t) p1[1] - p3[1];
+
+      /* y0 = a0 + b0, y1 = a1 - j*b1, y2 = a0 - b0, y3 = a1 + j*b1, all divided by 4 */
+      p0[0] = (q15_t) ((a0r + b0r) >> 2);
+      p0[1] = (q15_t) ((a0i + b0i) >> 2);
+      yr = (a1r + b1i) >> 2;
+      yi = (a1i - b1r) >> 2;
+      STORE_Q15(p1, yr, yi, c1, s1);
+      yr = (a0r - b0r) >> 2;
+      yi = (a0i - b0i) >> 2;
+      STORE_Q15(p2, yr, yi, c2, s2);
+      yr = (a1r - b1i) >> 2;
+      yi = (a1i + b1r) >> 2;
+      STORE_Q15(p3, yr, yi, c3, s3);
+    }
+  }
+}
+
+static void arm_radix5_mixed_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  uint32_t m,
+  const q15_t * pCoef,
+  uint32_t twidStep)
+{
+  q15_t *p0, *p1, *p2, *p3, *p4;
+  q31_t a1r, a1i, a2r, a2i, b1r, b1i, b2r, b2i;
+  q31_t m1r, m1i, m2r, m2i, q1r, q1i, q2r, q2i, yr, yi;
+  q31_t c1, s1, c2, s2, c3, s3, c4, s4;
+  uint32_t i, k, n = 5U * m;
+
+  for (k = 0U; k < m; k++)
+  {
+    c1 = pCoef[2U * k * twidStep];
+    s1 = pCoef[2U * k * twidStep + 1U];
+    c2 = pCoef[4U * k * twidStep];
+    s2 = pCoef[4U * k * twidStep + 1U];
+    c3 = pCoef[6U * k * twidStep];
+    s3 = pCoef[6U * k * twidStep + 1U];
+    c4 = pCoef[8U * k * twidStep];
+    s4 = pCoef[8U * k * twidStep + 1U];
+
+    for (i = k; i < fftLen; i += n)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+      p2 = p1 + 2U * m;
+      p3 = p2 + 2U * m;
+      p4 = p3 + 2U * m;
+
+      a1r = (q31_t) p1[0] + p4[0];
+      a1i = (q31_t) p1[1] + p4[1];
+      b1r = (q31_t) p1[0] - p4[0];
+      b1i = (q31_t) p1[1] - p4[1];
+      a2r = (q31_t) p2[0] + p3[0];
+      a2i = (q31_t) p2[1] + p3[1];
+      b2r = (q31_t) p2[0] - p3[0];
+      b2i = (q31_t) p2[1] - p3[1];
+
+      /* The products are shifted one by one, their sums could exceed 32 bits */
+      m1r = p0[0] + ((C51_Q15 * a1r) >> 15) + ((C52_Q15 * a2r) >> 15);
+      m1i = p0[1] + ((C51_Q15 * a1i) >> 15) + ((C52_Q15 * a2i) >> 15);
+      m2r = p0[0] + ((C52_Q15 * a1r) >> 15) + ((C51_Q15 * a2r) >> 15);
+      m2i = p0[1] + ((C52_Q15 * a1i) >> 15) + ((C51_Q15 * a2i) >> 15);
+      q1r = ((S51_Q15 * b1r) >> 15) + ((S52_Q15 * b2r) >> 15);
+      q1i = ((S51_Q15 * b1i) >> 15) + ((S52_Q15 * b2i) >> 15);
+      q2r = ((S52_Q15 * b1r) >> 15) - ((S51_Q15 * b2r) >> 15);
+      q2i = ((S52_Q15 * b1i) >> 15) - ((S51_Q15 * b2i) >> 15);
+
+      /* y1 = m1 - j*q1, y4 = m1 + j*q1, y2 = m2 - j*q2, y3 = m2 + j*q2, all divided by 5 */
+      p0[0] = (q15_t) ((R5_Q15 * (p0[0] + a1r + a2r)) >> 15);
+      p0[1] = (q15_t) ((R5_Q15 * (p0[1] + a1i + a2i)) >> 15);
+      yr = (R5_Q15 * (m1r + q1i)) >> 15;
+      yi = (R5_Q15 * (m1i - q1r)) >> 15;
+      STORE_Q15(p1, yr, yi, c1, s1);
+      yr = (R5_Q15 * (m2r + q2i)) >> 15;
+      yi = (R5_Q15 * (m2i - q2r)) >> 15;
+      STORE_Q15(p2, yr, yi, c2, s2);
+      yr = (R5_Q15 * (m2r - q2i)) >> 15;
+      yi = (R5_Q15 * (m2i + q2r)) >> 15;
+      STORE_Q15(p3, yr, yi, c3, s3);
+      yr = (R5_Q15 * (m1r - q1i)) >> 15;
+      yi = (R5_Q15 * (m1i + q1r)) >> 15;
+      STORE_Q15(p4, yr, yi, c4, s4);
+    }
+  }
+}
+
+/**
+* @brief       Processing function for the mixed radix Q15 complex FFT.
+* @param[in]      *S       points to an instance of the mixed radix Q15 CFFT structure.
+* @param[in, out] *p1      points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+* @param[in]      ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @return none.
+*
+* \par
+* The output is in natural order and, in both directions, divided by fftLen.
+*/
+void arm_cfft_mixed_q15(
+  const arm_cfft_mixed_instance_q15 * S,
+  q15_t * p1,
+  uint8_t ifftFlag)
+{
+  uint32_t L = S->fftLen, n = L, m, l, s;
+  q15_t *pSrc;
+
+  if (ifftFlag == 1U)
+  {
+    /*  Conjugate input data, the inverse runs the forward stages  */
+    pSrc = p1 + 1;
+    for (l = 0U; l < L; l++)
+    {
+      *pSrc = clip_q31_to_q15(-(q31_t) *pSrc);
+      pSrc += 2;
+    }
+  }
+
+  for (s = 0U; s < S->numStages; s++)
+  {
+    m = n / S->pFactors[s];
+    switch (S->pFactors[s])
+    {
+    case 2U:
+      arm_radix2_mixed_q15(p1, L, m, S->pTwiddle, (L / n) * S->twidStride);
+      break;
+    case 3U:
+      arm_radix3_mixed_q15(p1, L, m, S->pTwiddle, (L / n) * S->twidStride);
+      break;
+    case 4U:
+      arm_radix4_mixed_q15(p1, L, m, S->pTwiddle, (L / n) * S->twidStride);
+      break;
+    default:
+      arm_radix5_mixed_q15(p1, L, m, S->pTwiddle, (L / n) * S->twidStride);
+      break;
+    }
+    n = m;
+  }
+
+  arm_cfft_mixed_reorder_16((uint32_t *) p1, S->pCycles, S->cyclesLength);
+
+  if (ifftFlag == 1U)
+  {
+    pSrc = p1 + 1;
+    for (l = 0U; l < L; l++)
+    {
+      *pSrc = clip_q31_to_q15(-(q31_t) *pSrc);
+      pSrc += 2;
+    }
+  }
+}
+
+/**
+* @} end of MixedFFT group
+*/
@@ -0,0 +1,338 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_q31.c
+ * Description:  Mixed radix 2/3/4/5 Decimation in Frequency CFFT Q31 processing function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_cfft_mixed_reorder_32(
+    uint32_t * pSrc,
+    const uint16_t * pCycles,
+    uint16_t cyclesLength);
+
+/**
+ * @addtogroup MixedFFT
+ * @{
+ */
+
+#define C3_Q31  1859775393     /* sin(2*pi/3) */
+#define C51_Q31 663608942      /* cos(2*pi/5) */
+#define C52_Q31 (-1737350766)  /* cos(4*pi/5) */
+#define S51_Q31 2042378317     /* sin(2*pi/5) */
+#define S52_Q31 1262259218     /* sin(4*pi/5) */
+#define R3_Q31  715827882      /* 1/3, rounded down so full scale cannot overflow */
+#define R5_Q31  429496729      /* 1/5 */
+
+#define MUL_Q31(x, c) ((q31_t) (((q63_t) (x) * (c)) >> 31))
+
+/* Stores y times the twiddle factor c - j*s */
+#define ROTATE_Q31(p, yr, yi, c, s)                                           \
+  (p)[0] = clip_q63_to_q31((((q63_t) (yr) * (c)) + ((q63_t) (yi) * (s))) >> 31); \
+  (p)[1] = clip_q63_to_q31((((q63_t) (yi) * (c)) - ((q63_t) (yr) * (s))) >> 31)
+
+/* Stores y, or y times the twiddle factor of butterfly k */
+#define STORE_Q31(p, yr, yi, c, s)                                            \
+  if (k == 0U)                                                                \
+  {                                                                           \
+    (p)[0] = clip_q63_to_q31(yr);                                             \
+    (p)[1] = clip_q63_to_q31(yi);                                             \
+  }                                                                           \
+  else                                                                        \
+  {                                                                           \
+    ROTATE_Q31(p, yr, yi, c, s);                                              \
+  }
+
+/*
+ * One stage: fftLen / (radix * m) groups of radix blocks of m samples.
+ * Butterfly k of a group takes sample k of every block and leaves bin r
+ * divided by the radix and times exp(-j*2*pi*r*k*twidStep/tableLen) in
+ * block r. The inputs are divided by the radix first; radix 2 and 4 then
+ * stay within 32 bits, the outputs of radix 3 and 5 are summed in 64 bits
+ * and saturate outside the unit circle.
+ */
+static void arm_radix2_mixed_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  uint32_t m,
+  const q31_t * pCoef,
+  uint32_t twidStep)
+{
+  q31_t *p0, *p1;
+  q31_t x0r, x0i, x1r, x1i, c1, s1;
+  uint32_t i, k, n = 2U * m;
+
+  for (k = 0U; k < m; k++)
+  {
+    c1 = pCoef[2U * k * twidStep];
+    s1 = pCoef[2U * k * twidStep + 1U];
+
+    for (i = k; i < fftLen; i += n)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+      x0r = p0[0] >> 1;
+      x0i = p0[1] >> 1;
+      x1r = p1[0] >> 1;
+      x1i = p1[1] >> 1;
+
+      p0[0] = x0r + x1r;
+      p0[1] = x0i + x1i;
+      STORE_Q31(p1, x0r - x1r, x0i - x1i, c1, s1);
+    }
+  }
+}
+
+static void arm_radix3_mixed_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  uint32_t m,
+  const q31_t * pCoef,
+  uint32_t twidStep)
+{
+  q31_t *p0, *p1, *p2;
+  q31_t x0r, x0i, x1r, x1i, x2r, x2i, tr, ti, dr, di, mr, mi;
+  q31_t c1, s1, c2, s2;
+  uint32_t i, k, n = 3U * m;
+
+  for (k = 0U; k < m; k++)
+  {
+    c1 = pCoef[2U * k * twidStep];
+    s1 = pCoef[2U * k * twidStep + 1U];
+    c2 = pCoef[4U * k * twidStep];
+    s2 = pCoef[4U * k * twidStep + 1U];
+
+    for (i = k; i < fftLen; i += n)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+      p2 = p1 + 2U * m;
+
+      x0r = MUL_Q31(p0[0], R3_Q31);
+      x0i = MUL_Q31(p0[1], R3_Q31);
+      x1r = MUL_Q31(p1[0], R3_Q31);
+      x1i = MUL_Q31(p1[1], R3_Q31);
+      x2r = MUL_Q31(p2[0], R3_Q31);
+      x2i = MUL_Q31(p2[1], R3_Q31);
+
+      tr = x1r + x2r;
+      ti = x1i + x2i;
+      dr = MUL_Q31(x1r - x2r, C3_Q31);
+      di = MUL_Q31(x1i - x2i, C3_Q31);
+      mr = x0r - (tr >> 1);
+      mi = x0i - (ti >> 1);
+
+      /* y1 = m - j*d, y2 = m + j*d */
+      p0[0] = x0r + tr;
+      p0[1] = x0i + ti;
+      STORE_Q31(p1, (q63_t) mr + di, (q63_t) mi - dr, c1, s1);
+      STORE_Q31(p2, (q63_t) mr - di, (q63_t) mi + dr, c2, s2);
+    }
+  }
+}
+
+static void arm_radix4_mixed_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  uint32_t m,
+  const q31_t * pCoef,
+  uint32_t twidStep)
+{
+  q31_t *p0, *p1, *p2, *p3;
+  q31_t a0r, a0i, a1r, a1i, b0r, b0i, b1r, b1i;
+  q31_t c1, s1, c2, s2, c3, s3;
+  uint32_t i, k, n = 4U * m;
+
+  for (k = 0U; k < m; k++)
+  {
+    c1 = pCoef[2U * k * twidStep];
+    s1 = pCoef[2U * k * twidStep + 1U];
+    c2 = pCoef[4U * k * twidStep];
+    s2 = pCoef[4U * k * twidStep + 1U];
+    c3 = pCoef[6U * k * twidStep];
+    s3 = pCoef[6U * k * twidStep + 1U];
+
+    for (i = k; i < fftLen; i += n)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+      p2 = p1 + 2U * m;
+      p3 = p2 + 2U * m;
+
+      a0r = (p0[0] >> 2) + (p2[0] >> 2);
+      a0i = (p0[1] >> 2) + (p2[1] >> 2);
+      a1r = (p0[0] >> 2) - (p2[0] >> 2);
+      a1i = (p0[1] >> 2) - (p2[1] >> 2);
+      b0r = (p1[0] >> 2) + (p3[0] >> 2);
+      b0i = (p1[1] >> 2) + (p3[1] >> 2);
+      b1r = (p1[0] >> 2) - (p3[0] >> 2);
+      b1i = (p1[1] >> 2) - (p3[1] >> 2);
+
+      /* y0 = a0 + b0, y1 = a1 - j*b1, y2 = a0 - b0, y3 = a1 + j*b1 */
+      p0[0] = a0r + b0r;
+      p0[1] = a0i + b0i;
+      STORE_Q31(p1, a1r + b1i, a1i - b1r, c1, s1);
+      STORE_Q31(p2, a0r - b0r, a0i - b0i, c2, s2);
+      STORE_Q31(p3, a1r - b1i, a1i + b1r, c3, s3);
+    }
+  }
+}
+
+static void arm_radix5_mixed_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  uint32_t m,
+  const q31_t * pCoef,
+  uint32_t twidStep)
+{
+  q31_t *p0, *p1, *p2, *p3, *p4;
+  q31_t x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i, x4r, x4i;
+  q31_t a1r, a1i, a2r, a2i, b1r, b1i, b2r, b2i;
+  q31_t m1r, m1i, m2r, m2i, q1r, q1i, q2r, q2i;
+  q31_t c1, s1, c2, s2, c3, s3, c4, s4;
+  uint32_t i, k, n = 5U * m;
+
+  for (k = 0U; k < m; k++)
+  {
+    c1 = pCoef[2U * k * twidStep];
+    s1 = pCoef[2U * k * twidStep + 1U];
+    c2 = pCoef[4U * k * twidStep];
+    s2 = pCoef[4U * k * twidStep + 1U];
+    c3 = pCoef[6U * k * twidStep];
+    s3 = pCoef[6U * k * twidStep + 1U];
+    c4 = pCoef[8U * k * twidStep];
+    s4 = pCoef[8U * k * twidStep + 1U];
+
+    for (i = k; i < fftLen; i += n)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+      p2 = p1 + 2U * m;
+      p3 = p2 + 2U * m;
+      p4 = p3 + 2U * m;
+
+      x0r = MUL_Q31(p0[0], R5_Q31);
+      x0i = MUL_Q31(p0[1], R5_Q31);
+      x1r = MUL_Q31(p1[0], R5_Q31);
+      x1i = MUL_Q31(p1[1], R5_Q31);
+      x4r = MUL_Q31(p4[0], R5_Q31);
+      x4i = MUL_Q31(p4[1], R5_Q31);
+      a1r = x1r + x4r;
+      a1i = x1i + x4i;
+      b1r = x1r - x4r;
+      b1i = x1i - x4i;
+      x2r = MUL_Q31(p2[0], R5_Q31);
+      x2i = MUL_Q31(p2[1], R5_Q31);
+      x3r = MUL_Q31(p3[0], R5_Q31);
+      x3i = MUL_Q31(p3[1], R5_Q31);
+      a2r = x2r + x3r;
+      a2i = x2i + x3i;
+      b2r = x2r - x3r;
+      b2i = x2i - x3i;
+
+      m1r = x0r + MUL_Q31(a1r, C51_Q31) + MUL_Q31(a2r, C52_Q31);
+      m1i = x0i + MUL_Q31(a1i, C51_Q31) + MUL_Q31(a2i, C52_Q31);
+      m2r = x0r + MUL_Q31(a1r, C52_Q31) + MUL_Q31(a2r, C51_Q31);
+      m2i = x0i + MUL_Q31(a1i, C52_Q31) + MUL_Q31(a2i, C51_Q31);
+      q1r = MUL_Q31(b1r, S51_Q31) + MUL_Q31(b2r, S52_Q31);
+      q1i = MUL_Q31(b1i, S51_Q31) + MUL_Q31(b2i, S52_Q31);
+      q2r = MUL_Q31(b1r, S52_Q31) - MUL_Q31(b2r, S51_Q31);
+      q2i = MUL_Q31(b1i, S52_Q31) - MUL_Q31(b2i, S51_Q31);
+
+      /* y1 = m1 - j*q1, y4 = m1 + j*q1, y2 = m2 - j*q2, y3 = m2 + j*q2 */
+      p0[0] = x0r + a1r + a2r;
+      p0[1] = x0i + a1i + a2i;
+      STORE_Q31(p1, (q63_t) m1r + q1i, (q63_t) m1i - q1r, c1, s1);
+      STORE_Q31(p2, (q63_t) m2r + q2i, (q63_t) m2i - q2r, c2, s2);
+      STORE_Q31(p3, (q63_t) m2r - q2i, (q63_t) m2i + q2r, c3, s3);
+      STORE_Q31(p4, (q63_t) m1r - q1i, (q63_t) m1i + q1r, c4, s4);
+    }
+  }
+}
+
+/**
+* @brief       Processing function for the mixed radix Q31 complex FFT.
+* @param[in]      *S       points to an instance of the mixed radix Q31 CFFT structure.
+* @param[in, out] *p1      points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+* @param[in]      ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @return none.
+*
+* \par
+* The output is in natural order and, in both directions, divided by fftLen.
+*/
+void arm_cfft_mixed_q31(
+  const arm_cfft_mixed_instance_q31 * S,
+  q31_t * p1,
+  uint8_t ifftFlag)
+{
+  uint32_t L = S->fftLen, n = L, m, l, s;
+  q31_t *pSrc;
+
+  if (ifftFlag == 1U)
+  {
+    /*  Conjugate input data, the inverse runs the forward stages  */
+    pSrc = p1 + 1;
+    for (l = 0U; l < L; l++)
+    {
+      *pSrc = clip_q63_to_q31(-(q63_t) *pSrc);
+      pSrc += 2;
+    }
+  }
+
+  for (s = 0U; s < S->numStages; s++)
+  {
+    m = n / S->pFactors[s];
+    switch (S->pFactors[s])
+    {
+    case 2U:
+      arm_radix2_mixed_q31(p1, L, m, S->pTwiddle, (L / n) * S->twidStride);
+      break;
+    case 3U:
+      arm_radix3_mixed_q31(p1, L, m, S->pTwiddle, (L / n) * S->twidStride);
+      break;
+    case 4U:
+      arm_radix4_mixed_q31(p1, L, m, S->pTwiddle, (L / n) * S->twidStride);
+      break;
+    default:
+      arm_radix5_mixed_q31(p1, L, m, S->pTwiddle, (L / n) * S->twidStride);
+      break;
+    }
+    n = m;
+  }
+
+  arm_cfft_mixed_reorder_32((uint32_t *) p1, S->pCycles, S->cyclesLength);
+
+  if (ifftFlag == 1U)
+  {
+    pSrc = p1 + 1;
+    for (l = 0U; l < L; l++)
+    {
+      *pSrc = clip_q63_to_q31(-(q63_t) *pSrc);
+      pSrc += 2;
+    }
+  }
+}
+
+/**
+* @} end of MixedFFT group
+*/
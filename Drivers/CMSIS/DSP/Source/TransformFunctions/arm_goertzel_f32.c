@@ -0,0 +1,159 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_f32.c
+ * Description:  Floating-point Goertzel detector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Detector
+ *
+ * \par
+ * The Goertzel detector gives the DFT power of a block of
+ * <code>blockLen</code> samples at a few chosen frequencies, with no FFT
+ * and no buffer of the block. For each frequency w = 2*pi*f/fs the
+ * recursion
+ * <pre>
+ *    s[n] = x[n] + 2*cos(w)*s[n-1] - s[n-2]
+ * </pre>
+ * runs over the block, and with s1 and s2 its last two values
+ * <pre>
+ *    |X(w)|^2 = (s1 - cos(w)*s2)^2 + (sin(w)*s2)^2
+ * </pre>
+ * The output is <code>|X(w)|^2 / blockLen^2</code>, so a sine of amplitude
+ * A at w gives A^2/4 and a constant A gives A^2 at w = 0.
+ *
+ * \par
+ * A frequency costs one multiply per sample; the frequencies need not be
+ * DFT bins. The processing functions take blocks of any size, keep the
+ * state between calls and write the powers of every detection block that
+ * completes within the call.
+ *
+ * \par
+ * Against the RFFT of a 256 sample block the detector is faster for 1
+ * bin in f32 and q15 and up to 2 in q31. These are x86 host timings
+ * (k3na_dsp) only. The Cortex-M0 crossover has not been measured;
+ * Tools/bench_qemu.py --dsp on the ARM cross build of k3na_dsp counts it.
+ *
+ * \par Fixed point
+ * The Q15 version keeps the state in 32 bits. A Q15 <code>2*cos(w)</code>
+ * would detune the low and high bins of long blocks, so it runs the
+ * Reinsch form on <code>2*cos(w) -/+ 2</code> with a 15 bit mantissa and
+ * a shift, and scales the samples down by the growth bound of s[n],
+ * <code>blockLen*min(blockLen, 1/sin(w))</code>, past 2^13. Its inner loop
+ * has no 64-bit multiply. The Q31 version keeps the state in 64 bits,
+ * which is precise enough for the plain recursion. Both give the power in
+ * 1.31 format, saturated. Their coefficients come from arm_sin_cos_q31(),
+ * so the fixed point initializations need no floating point.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point Goertzel detector.
+ * @param[in,out] *S        points to an instance of the floating-point Goertzel structure.
+ * @param[in]     *pSrc     points to the input samples.
+ * @param[in]     blockSize number of input samples.
+ * @param[out]    *pDst     numBins powers for each detection block completed in the call.
+ * @return        number of detection blocks completed.
+ */
+uint32_t arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst)
+{
+  const float32_t *pCoeffs;                      /* Coefficient pointer */
+  const float32_t *px;                           /* Input pointer */
+  float32_t *pState;                             /* State pointer */
+  float32_t c2, s0, s1, s2, re, im, scale;       /* Recursion values */
+  uint32_t numBins = S->numBins;                 /* Number of frequencies */
+  uint32_t i, k, n, blocks = 0U;                 /* Loop counters */
+
+  while (blockSize > 0U)
+  {
+    /* Up to the end of the current detection block */
+    n = (uint32_t) S->blockLen - S->count;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    /* One frequency at a time, its coefficient and state stay in registers */
+    pCoeffs = S->pCoeffs;
+    pState = S->pState;
+    for (k = 0U; k < numBins; k++)
+    {
+      c2 = 2.0f * pCoeffs[2U * k];
+      s1 = pState[2U * k];
+      s2 = pState[2U * k + 1U];
+      px = pSrc;
+
+      for (i = 0U; i < n; i++)
+      {
+        s0 = (*px++ + (c2 * s1)) - s2;
+        s2 = s1;
+        s1 = s0;
+      }
+
+      pState[2U * k] = s1;
+      pState[2U * k + 1U] = s2;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+    S->count = (uint16_t) (S->count + n);
+
+    if (S->count == S->blockLen)
+    {
+      /* |X|^2 / blockLen^2 and a fresh state for the next block */
+      scale = 1.0f / ((float32_t) S->blockLen * S->blockLen);
+      for (k = 0U; k < numBins; k++)
+      {
+        s1 = pState[2U * k];
+        s2 = pState[2U * k + 1U];
+        re = s1 - (pCoeffs[2U * k] * s2);
+        im = pCoeffs[2U * k + 1U] * s2;
+        *pDst++ = ((re * re) + (im * im)) * scale;
+        pState[2U * k] = 0.0f;
+        pState[2U * k + 1U] = 0.0f;
+      }
+      S->count = 0U;
+      blocks++;
+    }
+  }
+
+  return (blocks);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_q15.c
+ * Description:  Initialization function for the Q15 Goertzel detector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Mantissa and shift of a positive value, for the Q15 Goertzel.
+ * @param[in]  v       the value in units of 2^-unit.
+ * @param[in]  unit    its scale.
+ * @param[out] *pMant  mantissa, 0x4000 to 0x7FFF unless v is tiny or 0.
+ * @param[out] *pShift value = mantissa * 2^-shift, at most 46.
+ */
+static void arm_goertzel_norm_q15(
+  uint64_t v,
+  int32_t unit,
+  q15_t * pMant,
+  q15_t * pShift)
+{
+  int32_t n = 0;                                 /* Bits dropped from v */
+  uint64_t m;
+
+  while ((v >> n) >= 0x8000U)
+  {
+    n++;
+  }
+  m = (n > 0) ? ((v >> (n - 1)) + 1U) >> 1 : v;
+  if (m == 0x8000U)
+  {
+    m >>= 1;
+    n++;
+  }
+  while (m != 0U && m < 0x4000U)
+  {
+    m <<= 1;
+    n--;
+  }
+
+  /* The process function shifts by up to (shift - 16) < 32 */
+  if (unit - n > 46)
+  {
+    m >>= (unit - n - 46);
+    n = unit - 46;
+  }
+  *pMant = (q15_t) m;
+  *pShift = (q15_t) (unit - n);
+}
+
+/**
+ * @brief  Initialization function for the Q15 Goertzel detector.
+ * @param[out] *S        points to an instance of the Q15 Goertzel structure.
+ * @param[in]  numBins   number of frequencies.
+ * @param[in]  blockLen  samples per detection block.
+ * @param[in]  *pFreqs   the frequencies in 1.15 format, as fractions of the sample rate.
+ * @param[out] *pCoeffs  coefficient buffer of <code>4*numBins</code> values.
+ * @param[out] *pState   state buffer of <code>2*numBins</code> values.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>blockLen</code> is 0.
+ *
+ * \par
+ * For each frequency the coefficients are the mantissa and shift of
+ * <code>2*cos(w) - 2</code> up to fs/4 and of <code>2*cos(w) + 2</code>
+ * above, the mantissa negative or positive accordingly, then the mantissa
+ * and shift of <code>sin(w)</code>. Both are computed from the sine and
+ * cosine of w/2, which keeps their relative precision near 0 and fs/2.
+ */
+arm_status arm_goertzel_init_q15(
+  arm_goertzel_instance_q15 * S,
+  uint16_t numBins,
+  uint16_t blockLen,
+  const q15_t * pFreqs,
+  q15_t * pCoeffs,
+  q31_t * pState)
+{
+  q31_t sinVal, cosVal;                          /* Of w/2 */
+  uint32_t f, k;
+
+  if (blockLen == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0U; k < numBins; k++)
+  {
+    /* f and 1 - f, f and -f give the same power: fold into 0 to fs/2 */
+    f = (uint16_t) pFreqs[k] & 0x7FFFU;
+    if (f > 0x4000U)
+    {
+      f = 0x8000U - f;
+    }
+
+    /* arm_sin_cos_q31() takes the angle over pi: w/2 is pi*f */
+    arm_sin_cos_q31((q31_t) (f << 16), &sinVal, &cosVal);
+    sinVal = (sinVal < 0) ? 0 : sinVal;
+    cosVal = (cosVal < 0) ? 0 : cosVal;
+
+    if (f <= 0x2000U)
+    {
+      /* 2*cos(w) - 2 = -4*sin(w/2)^2 */
+      arm_goertzel_norm_q15((uint64_t) sinVal * (uint32_t) sinVal, 60, &pCoeffs[4U * k], &pCoeffs[4U * k + 1U]);
+      pCoeffs[4U * k] = (q15_t) -pCoeffs[4U * k];
+    }
+    else
+    {
+      /* 2*cos(w) + 2 = 4*cos(w/2)^2, kept above 0 at fs/2 so its sign still tells */
+      arm_goertzel_norm_q15((uint64_t) cosVal * (uint32_t) cosVal, 60, &pCoeffs[4U * k], &pCoeffs[4U * k + 1U]);
+      if (pCoeffs[4U * k] == 0)
+      {
+        pCoeffs[4U * k] = 1;
+        pCoeffs[4U * k + 1U] = 46;
+      }
+    }
+
+    /* sin(w) = 2*sin(w/2)*cos(w/2), 0 at 0 and fs/2 */
+    arm_goertzel_norm_q15((uint64_t) sinVal * (uint32_t) cosVal, 61, &pCoeffs[4U * k + 2U], &pCoeffs[4U * k + 3U]);
+    if (pCoeffs[4U * k + 2U] == 0)
+    {
+      pCoeffs[4U * k + 3U] = 63;
+    }
+  }
+
+  S->numBins = numBins;
+  S->blockLen = blockLen;
+  S->count = 0U;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  memset(pState, 0, (2U * numBins) * sizeof(q31_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_q31.c
+ * Description:  Initialization function for the Q31 Goertzel detector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 Goertzel detector.
+ * @param[out] *S        points to an instance of the Q31 Goertzel structure.
+ * @param[in]  numBins   number of frequencies.
+ * @param[in]  blockLen  samples per detection block.
+ * @param[in]  *pFreqs   the frequencies in 1.31 format, as fractions of the sample rate.
+ * @param[out] *pCoeffs  coefficient buffer of <code>2*numBins</code> values.
+ * @param[out] *pState   state buffer of <code>2*numBins</code> values.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>blockLen</code> is 0.
+ */
+arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t blockLen,
+  const q31_t * pFreqs,
+  q31_t * pCoeffs,
+  q63_t * pState)
+{
+  q31_t sinVal, cosVal;
+  uint32_t k;
+
+  if (blockLen == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* arm_sin_cos_q31() takes the angle over pi: twice the frequency */
+  for (k = 0U; k < numBins; k++)
+  {
+    arm_sin_cos_q31((q31_t) ((uint32_t) pFreqs[k] << 1), &sinVal, &cosVal);
+    pCoeffs[2U * k] = cosVal;
+    pCoeffs[2U * k + 1U] = sinVal;
+  }
+
+  S->numBins = numBins;
+  S->blockLen = blockLen;
+  S->count = 0U;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  memset(pState, 0, (2U * numBins) * sizeof(q63_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q15.c
+ * Description:  Q15 Goertzel detector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Input shift of the Q15 Goertzel detector.
+ * @param[in] logLen  ceil(log2(blockLen)).
+ * @param[in] sShift  shift of the sine of the frequency, 63 when it is 0.
+ * @return    right shift keeping s[n] within 2^28 for a full-scale input.
+ */
+static uint32_t arm_goertzel_shift_q15(
+  uint32_t logLen,
+  int32_t sShift)
+{
+  /* 1/sin(w) is below 2^(sShift - 14), and blockLen bounds the gain at 0 and fs/2 */
+  int32_t bits = 15 + (int32_t) logLen + (((sShift - 14) < (int32_t) logLen) ? (sShift - 14) : (int32_t) logLen);
+
+  return ((bits > 28) ? (uint32_t) (bits - 28) : 0U);
+}
+
+/**
+ * @brief Processing function for the Q15 Goertzel detector.
+ * @param[in,out] *S        points to an instance of the Q15 Goertzel structure.
+ * @param[in]     *pSrc     points to the input samples.
+ * @param[in]     blockSize number of input samples.
+ * @param[out]    *pDst     numBins powers in 1.31 format for each detection block completed in the call.
+ * @return        number of detection blocks completed.
+ *
+ * \par
+ * The recursion runs on s[n] and d[n] = s[n] -/+ s[n-1] (Reinsch), which
+ * only needs the small <code>2*cos(w) -/+ 2</code> and so keeps the tuning
+ * exact at low and high frequencies. Its product is a 16x16 split of the
+ * state, without 64-bit arithmetic; the input is scaled down so that the
+ * state stays within 2^28 over a block, and the power scaled back up.
+ */
+uint32_t arm_goertzel_q15(
+  arm_goertzel_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pDst)
+{
+  const q15_t *pCoeffs;                          /* Coefficient pointer */
+  const q15_t *px;                               /* Input pointer */
+  q31_t *pState;                                 /* State pointer */
+  q31_t m, p, s, d, s2, re, im, rnd, r;          /* Recursion values, 2^-15 units */
+  q63_t power;                                   /* |X|^2, 2^-30 units */
+  uint64_t lenSq;                                /* blockLen^2 */
+  uint32_t numBins = S->numBins;                 /* Number of frequencies */
+  uint32_t logLen, sh, a, b, c;                  /* Scaling */
+  int32_t e;
+  uint32_t i, k, n, blocks = 0U;                 /* Loop counters */
+
+  /* The state grows up to blockLen * min(blockLen, 1/sin(w)) times the input */
+  logLen = 0U;
+  while ((1UL << logLen) < S->blockLen)
+  {
+    logLen++;
+  }
+
+  while (blockSize > 0U)
+  {
+    /* Up to the end of the current detection block */
+    n = (uint32_t) S->blockLen - S->count;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    /* One frequency at a time, its coefficient and state stay in registers */
+    pCoeffs = S->pCoeffs;
+    pState = S->pState;
+    for (k = 0U; k < numBins; k++)
+    {
+      m = pCoeffs[4U * k];
+      e = pCoeffs[4U * k + 1U];
+      sh = arm_goertzel_shift_q15(logLen, pCoeffs[4U * k + 3U]);
+      rnd = (sh > 0U) ? (1L << (sh - 1U)) : 0;
+
+      /* P = m * s >> e from the halves of s: (m * hi << a) + (m * lo >> b) >> c */
+      if (e >= 16)
+      {
+        a = 0U;
+        b = 16U;
+        c = (uint32_t) e - 16U;
+        r = (c > 0U) ? (1L << (c - 1U)) : 0;
+      }
+      else
+      {
+        a = 16U - (uint32_t) e;
+        b = (uint32_t) e;
+        c = 0U;
+        r = 0;
+      }
+
+      s = pState[2U * k];
+      d = pState[2U * k + 1U];
+      px = pSrc;
+
+      if (m <= 0)
+      {
+        /* d[n] = d[n-1] + (2cos - 2) * s[n-1] + x, s[n] = s[n-1] + d[n] */
+        for (i = 0U; i < n; i++)
+        {
+          p = (((m * (s >> 16)) << a) + ((m * (s & 0xFFFF)) >> b) + r) >> c;
+          d += p + ((*px++ + rnd) >> sh);
+          s += d;
+        }
+      }
+      else
+      {
+        /* d[n] = (2cos + 2) * s[n-1] - d[n-1] + x, s[n] = d[n] - s[n-1] */
+        for (i = 0U; i < n; i++)
+        {
+          p = (((m * (s >> 16)) << a) + ((m * (s & 0xFFFF)) >> b) + r) >> c;
+          d = p - d + ((*px++ + rnd) >> sh);
+          s = d - s;
+        }
+      }
+
+      pState[2U * k] = s;
+      pState[2U * k + 1U] = d;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+    S->count = (uint16_t) (S->count + n);
+
+    if (S->count == S->blockLen)
+    {
+      /* 2 * |X|^2 / blockLen^2 is the power in 1.31 */
+      lenSq = (uint64_t) S->blockLen * S->blockLen;
+      for (k = 0U; k < numBins; k++)
+      {
+        m = pCoeffs[4U * k];
+        e = pCoeffs[4U * k + 1U];
+        sh = arm_goertzel_shift_q15(logLen, pCoeffs[4U * k + 3U]);
+        s = pState[2U * k];
+        d = pState[2U * k + 1U];
+
+        /* X = s[n] - cos * s[n-1] = d[n] - (2cos -/+ 2) / 2 * s[n-1] */
+        s2 = (m <= 0) ? (s - d) : (d - s);
+        re = d - (q31_t) ((((q63_t) m * s2) + (1LL << e)) >> (e + 1));
+        im = (q31_t) ((((q63_t) pCoeffs[4U * k + 2U] * s2) + (1LL << (pCoeffs[4U * k + 3U] - 1))) >> pCoeffs[4U * k + 3U]);
+        power = ((q63_t) re * re) + ((q63_t) im * im);
+        power = (q63_t) (((uint64_t) power << (1U + 2U * sh)) / lenSq);
+        *pDst++ = (power > 0x7FFFFFFF) ? 0x7FFFFFFF : (q31_t) power;
+        pState[2U * k] = 0;
+        pState[2U * k + 1U] = 0;
+      }
+      S->count = 0U;
+      blocks++;
+    }
+  }
+
+  return (blocks);
+}
+
+/**
+ * @} end of Goertzel group
+ */
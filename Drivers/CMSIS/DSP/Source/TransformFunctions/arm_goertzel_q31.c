@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 Goertzel detector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 Goertzel detector.
+ * @param[in,out] *S        points to an instance of the Q31 Goertzel structure.
+ * @param[in]     *pSrc     points to the input samples.
+ * @param[in]     blockSize number of input samples.
+ * @param[out]    *pDst     numBins powers in 1.31 format for each detection block completed in the call.
+ * @return        number of detection blocks completed.
+ */
+uint32_t arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pDst)
+{
+  const q31_t *pCoeffs;                          /* Coefficient pointer */
+  const q31_t *px;                               /* Input pointer */
+  q63_t *pState;                                 /* State pointer */
+  q63_t s0, s1, s2, re, im;                      /* Recursion values, 2^-31 units */
+  q63_t power;                                   /* |X|^2 / blockLen^2 */
+  q31_t c;                                       /* Cosine of the frequency */
+  uint32_t numBins = S->numBins;                 /* Number of frequencies */
+  uint32_t i, k, n, blocks = 0U;                 /* Loop counters */
+
+  while (blockSize > 0U)
+  {
+    /* Up to the end of the current detection block */
+    n = (uint32_t) S->blockLen - S->count;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    /* One frequency at a time, its coefficient and state stay in registers */
+    pCoeffs = S->pCoeffs;
+    pState = S->pState;
+    for (k = 0U; k < numBins; k++)
+    {
+      c = pCoeffs[2U * k];
+      s1 = pState[2U * k];
+      s2 = pState[2U * k + 1U];
+      px = pSrc;
+
+      for (i = 0U; i < n; i++)
+      {
+        /* s0 = x + 2*cos*s1 - s2, mult32x64() giving cos*s1/2 */
+        s0 = ((q63_t) *px++ + (mult32x64(s1, c) << 2)) - s2;
+        s2 = s1;
+        s1 = s0;
+      }
+
+      pState[2U * k] = s1;
+      pState[2U * k + 1U] = s2;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+    S->count = (uint16_t) (S->count + n);
+
+    if (S->count == S->blockLen)
+    {
+      /* The parts of X / blockLen fit 32 bits, their squares give the power */
+      for (k = 0U; k < numBins; k++)
+      {
+        s1 = pState[2U * k];
+        s2 = pState[2U * k + 1U];
+        re = (s1 - (mult32x64(s2, pCoeffs[2U * k]) << 1)) / S->blockLen;
+        im = (mult32x64(s2, pCoeffs[2U * k + 1U]) << 1) / S->blockLen;
+        re = clip_q63_to_q31(re);
+        im = clip_q63_to_q31(im);
+        power = ((re * re) >> 31) + ((im * im) >> 31);
+        *pDst++ = (power > 0x7FFFFFFF) ? 0x7FFFFFFF : (q31_t) power;
+        pState[2U * k] = 0;
+        pState[2U * k + 1U] = 0;
+      }
+      S->count = 0U;
+      blocks++;
+    }
+  }
+
+  return (blocks);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_f32.c
+ * Description:  Mixed radix RFFT & RIFFT Floating point process function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup MixedFFT
+ * @{
+ */
+
+/*
+ * The fftLen real samples x are taken as fftLen/2 complex samples
+ * z[n] = x[2n] + j*x[2n+1]. With Z their transform, M = fftLen/2 and
+ * W = exp(-j*2*pi*k/fftLen):
+ *
+ *   X[k]   = (A + W*B) / 2          A = Z[k] + conj(Z[M-k])
+ *   X[M-k] = conj(A - W*B) / 2      B = -j * (Z[k] - conj(Z[M-k]))
+ *
+ * and the inverse solves these for Z[k] and Z[M-k]. k and M-k are done
+ * together, so both steps work in place.
+ */
+static void arm_split_rfft_mixed_f32(
+  float32_t * p,
+  uint32_t M,
+  const float32_t * pCoef)
+{
+  float32_t ar, ai, br, bi, tr, ti, c, s, z0r;
+  float32_t *pk, *pm;
+  uint32_t k;
+
+  z0r = p[0];
+  p[0] = z0r + p[1];
+  p[1] = z0r - p[1];
+
+  for (k = 1U; k <= M / 2U; k++)
+  {
+    pk = p + 2U * k;
+    pm = p + 2U * (M - k);
+    c = pCoef[2U * k];
+    s = pCoef[2U * k + 1U];
+
+    ar = pk[0] + pm[0];
+    ai = pk[1] - pm[1];
+    br = pk[1] + pm[1];
+    bi = pm[0] - pk[0];
+    tr = (c * br) + (s * bi);
+    ti = (c * bi) - (s * br);
+
+    pm[0] = 0.5f * (ar - tr);
+    pm[1] = 0.5f * (ti - ai);
+    pk[0] = 0.5f * (ar + tr);
+    pk[1] = 0.5f * (ai + ti);
+  }
+}
+
+static void arm_merge_rfft_mixed_f32(
+  float32_t * p,
+  uint32_t M,
+  const float32_t * pCoef)
+{
+  float32_t sr, si, dr, di, ur, ui, c, s, x0;
+  float32_t *pk, *pm;
+  uint32_t k;
+
+  x0 = p[0];
+  p[0] = 0.5f * (x0 + p[1]);
+  p[1] = 0.5f * (x0 - p[1]);
+
+  for (k = 1U; k <= M / 2U; k++)
+  {
+    pk = p + 2U * k;
+    pm = p + 2U * (M - k);
+    c = pCoef[2U * k];
+    s = pCoef[2U * k + 1U];
+
+    /* Z[k] = (S + j*conj(W)*D) / 2, Z[M-k] = conj(S - j*conj(W)*D) / 2 */
+    sr = pk[0] + pm[0];
+    si = pk[1] - pm[1];
+    dr = pk[0] - pm[0];
+    di = pk[1] + pm[1];
+    ur = (c * dr) - (s * di);
+    ui = (c * di) + (s * dr);
+
+    pm[0] = 0.5f * (sr + ui);
+    pm[1] = 0.5f * (ur - si);
+    pk[0] = 0.5f * (sr - ui);
+    pk[1] = 0.5f * (si + ur);
+  }
+}
+
+/**
+* @brief       Processing function for the mixed radix floating-point real FFT.
+* @param[in]  *S       points to an instance of the mixed radix floating-point RFFT structure.
+* @param[in]  *pSrc    points to the input buffer of <code>fftLen</code> values, left unchanged.
+* @param[out] *pDst    points to the output buffer of <code>fftLen</code> values, may be pSrc.
+* @param[in]  ifftFlag RFFT if flag is 0, RIFFT if flag is 1.
+* @return none.
+*
+* \par
+* The RFFT packs its output as arm_rfft_fast_f32() does, the RIFFT takes
+* that format and is scaled by 1/fftLen.
+*/
+void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint8_t ifftFlag)
+{
+  const arm_cfft_mixed_instance_f32 *Sint = &(S->Sint);
+
+  if (pDst != pSrc)
+  {
+    memcpy(pDst, pSrc, S->fftLenRFFT * sizeof(float32_t));
+  }
+
+  if (ifftFlag == 1U)
+  {
+    arm_merge_rfft_mixed_f32(pDst, Sint->fftLen, Sint->pTwiddle);
+    arm_cfft_mixed_f32(Sint, pDst, 1U);
+  }
+  else
+  {
+    arm_cfft_mixed_f32(Sint, pDst, 0U);
+    arm_split_rfft_mixed_f32(pDst, Sint->fftLen, Sint->pTwiddle);
+  }
+}
+
+/**
+* @} end of MixedFFT group
+*/
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_init_f32.c
+ * Description:  Initialization function for the mixed radix RFFT Floating point
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern uint8_t arm_cfft_mixed_plan(
+    uint16_t fftLen,
+    uint8_t * pFactors,
+    uint16_t * pCycles,
+    uint16_t * pCyclesLength);
+
+extern void arm_cfft_mixed_twiddle_f32(
+    float32_t * pTwiddle,
+    uint32_t tableLen);
+
+/**
+ * @addtogroup MixedFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the mixed radix floating-point real FFT.
+* @param[out] *S        points to an instance of the mixed radix floating-point RFFT structure.
+* @param[in]  fftLen    length of the real sequence, twice a product of 2, 3 and 5 up to 8192.
+* @param[out] *pTwiddle twiddle factor buffer of <code>2*fftLen</code> values.
+* @param[out] *pCycles  digit reversal buffer of <code>fftLen/2</code> entries.
+* @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+*
+* \par
+* The internal CFFT of fftLen/2 points reads every second twiddle factor
+* of the table, the split step all of the first half.
+*/
+arm_status arm_rfft_mixed_init_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  uint16_t * pCycles)
+{
+  arm_cfft_mixed_instance_f32 *Sint = &(S->Sint);
+
+  if ((fftLen % 2U) != 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+  Sint->numStages = arm_cfft_mixed_plan(fftLen / 2U, Sint->pFactors, pCycles, &Sint->cyclesLength);
+  if (Sint->numStages == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->fftLenRFFT = fftLen;
+  Sint->fftLen = fftLen / 2U;
+  Sint->twidStride = 2U;
+  Sint->pTwiddle = pTwiddle;
+  Sint->pCycles = pCycles;
+  arm_cfft_mixed_twiddle_f32(pTwiddle, fftLen);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+* @} end of MixedFFT group
+*/
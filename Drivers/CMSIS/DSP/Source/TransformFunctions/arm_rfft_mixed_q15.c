@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_q15.c
+ * Description:  Mixed radix RFFT & RIFFT Q15 process function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup MixedFFT
+ * @{
+ */
+
+/*
+ * The fftLen real samples x are taken as fftLen/2 complex samples
+ * z[n] = x[2n] + j*x[2n+1]. With Z their transform, M = fftLen/2 and
+ * W = exp(-j*2*pi*k/fftLen):
+ *
+ *   X[k]   = (A + W*B) / 2          A = Z[k] + conj(Z[M-k])
+ *   X[M-k] = conj(A - W*B) / 2      B = -j * (Z[k] - conj(Z[M-k]))
+ *
+ * and the inverse solves these for Z[k] and Z[M-k]. k and M-k are done
+ * together, so both steps work in place. The RFFT halves the input, so
+ * Z and X come out divided by fftLen. The RIFFT builds Z/2, which cannot
+ * exceed full scale, and doubles the result of the CIFFT.
+ */
+static void arm_split_rfft_mixed_q15(
+  q15_t * p,
+  uint32_t M,
+  const q15_t * pCoef)
+{
+  q31_t ar, ai, br, bi, tr, ti, c, s, z0r;
+  q15_t *pk, *pm;
+  uint32_t k;
+
+  z0r = p[0];
+  p[0] = clip_q31_to_q15(z0r + p[1]);
+  p[1] = clip_q31_to_q15(z0r - p[1]);
+
+  for (k = 1U; k <= M / 2U; k++)
+  {
+    pk = p + 2U * k;
+    pm = p + 2U * (M - k);
+    c = pCoef[2U * k];
+    s = pCoef[2U * k + 1U];
+
+    ar = (q31_t) pk[0] + pm[0];
+    ai = (q31_t) pk[1] - pm[1];
+    br = (q31_t) pk[1] + pm[1];
+    bi = (q31_t) pm[0] - pk[0];
+    tr = ((c * br) >> 15) + ((s * bi) >> 15);
+    ti = ((c * bi) >> 15) - ((s * br) >> 15);
+
+    pm[0] = clip_q31_to_q15((ar - tr) >> 1);
+    pm[1] = clip_q31_to_q15((ti - ai) >> 1);
+    pk[0] = clip_q31_to_q15((ar + tr) >> 1);
+    pk[1] = clip_q31_to_q15((ai + ti) >> 1);
+  }
+}
+
+static void arm_merge_rfft_mixed_q15(
+  q15_t * p,
+  uint32_t M,
+  const q15_t * pCoef)
+{
+  q31_t sr, si, dr, di, ur, ui, c, s, x0;
+  q15_t *pk, *pm;
+  uint32_t k;
+
+  x0 = p[0];
+  p[0] = (q15_t) ((x0 + p[1]) >> 2);
+  p[1] = (q15_t) ((x0 - p[1]) >> 2);
+
+  for (k = 1U; k <= M / 2U; k++)
+  {
+    pk = p + 2U * k;
+    pm = p + 2U * (M - k);
+    c = pCoef[2U * k];
+    s = pCoef[2U * k + 1U];
+
+    /* Z[k] = (S + j*conj(W)*D) / 2, Z[M-k] = conj(S - j*conj(W)*D) / 2, both halved */
+    sr = (q31_t) pk[0] + pm[0];
+    si = (q31_t) pk[1] - pm[1];
+    dr = (q31_t) pk[0] - pm[0];
+    di = (q31_t) pk[1] + pm[1];
+    ur = ((c * dr) >> 15) - ((s * di) >> 15);
+    ui = ((c * di) >> 15) + ((s * dr) >> 15);
+
+    pm[0] = clip_q31_to_q15((sr + ui) >> 2);
+    pm[1] = clip_q31_to_q15((ur - si) >> 2);
+    pk[0] = clip_q31_to_q15((sr - ui) >> 2);
+    pk[1] = clip_q31_to_q15((si + ur) >> 2);
+  }
+}
+
+/**
+* @brief       Processing function for the mixed radix Q15 real FFT.
+* @param[in]  *S       points to an instance of the mixed radix Q15 RFFT structure.
+* @param[in]  *pSrc    points to the input buffer of <code>fftLen</code> values, left unchanged.
+* @param[out] *pDst    points to the output buffer of <code>fftLen</code> values, may be pSrc.
+* @param[in]  ifftFlag RFFT if flag is 0, RIFFT if flag is 1.
+* @return none.
+*
+* \par
+* The RFFT packs its output as arm_rfft_fast_f32() does and divides it by
+* fftLen. The RIFFT takes that format and returns the inverse transform.
+*/
+void arm_rfft_mixed_q15(
+  const arm_rfft_mixed_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint8_t ifftFlag)
+{
+  const arm_cfft_mixed_instance_q15 *Sint = &(S->Sint);
+  uint32_t i;
+
+  if (ifftFlag == 1U)
+  {
+    if (pDst != pSrc)
+    {
+      memcpy(pDst, pSrc, S->fftLenRFFT * sizeof(q15_t));
+    }
+    arm_merge_rfft_mixed_q15(pDst, Sint->fftLen, Sint->pTwiddle);
+    arm_cfft_mixed_q15(Sint, pDst, 1U);
+    for (i = 0U; i < S->fftLenRFFT; i++)
+    {
+      pDst[i] = clip_q31_to_q15((q31_t) pDst[i] << 1);
+    }
+  }
+  else
+  {
+    for (i = 0U; i < S->fftLenRFFT; i++)
+    {
+      pDst[i] = pSrc[i] >> 1;
+    }
+    arm_cfft_mixed_q15(Sint, pDst, 0U);
+    arm_split_rfft_mixed_q15(pDst, Sint->fftLen, Sint->pTwiddle);
+  }
+}
+
+/**
+* @} end of MixedFFT group
+*/
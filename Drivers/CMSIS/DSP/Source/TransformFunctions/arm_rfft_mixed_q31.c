@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_q31.c
+ * Description:  Mixed radix RFFT & RIFFT Q31 process function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup MixedFFT
+ * @{
+ */
+
+/*
+ * The fftLen real samples x are taken as fftLen/2 complex samples
+ * z[n] = x[2n] + j*x[2n+1]. With Z their transform, M = fftLen/2 and
+ * W = exp(-j*2*pi*k/fftLen):
+ *
+ *   X[k]   = (A + W*B) / 2          A = Z[k] + conj(Z[M-k])
+ *   X[M-k] = conj(A - W*B) / 2      B = -j * (Z[k] - conj(Z[M-k]))
+ *
+ * and the inverse solves these for Z[k] and Z[M-k]. k and M-k are done
+ * together, so both steps work in place. The RFFT halves the input, so
+ * Z and X come out divided by fftLen. The RIFFT builds Z/2, which cannot
+ * exceed full scale, and doubles the result of the CIFFT.
+ */
+#define MUL_Q31(x, c) (((q63_t) (x) * (c)) >> 31)
+
+static void arm_split_rfft_mixed_q31(
+  q31_t * p,
+  uint32_t M,
+  const q31_t * pCoef)
+{
+  q31_t ar, ai, br, bi, c, s, z0r;
+  q63_t tr, ti;
+  q31_t *pk, *pm;
+  uint32_t k;
+
+  z0r = p[0];
+  p[0] = clip_q63_to_q31((q63_t) z0r + p[1]);
+  p[1] = clip_q63_to_q31((q63_t) z0r - p[1]);
+
+  /* A and B are halved on the way in */
+  for (k = 1U; k <= M / 2U; k++)
+  {
+    pk = p + 2U * k;
+    pm = p + 2U * (M - k);
+    c = pCoef[2U * k];
+    s = pCoef[2U * k + 1U];
+
+    ar = (pk[0] >> 1) + (pm[0] >> 1);
+    ai = (pk[1] >> 1) - (pm[1] >> 1);
+    br = (pk[1] >> 1) + (pm[1] >> 1);
+    bi = (pm[0] >> 1) - (pk[0] >> 1);
+    tr = MUL_Q31(br, c) + MUL_Q31(bi, s);
+    ti = MUL_Q31(bi, c) - MUL_Q31(br, s);
+
+    pm[0] = clip_q63_to_q31(ar - tr);
+    pm[1] = clip_q63_to_q31(ti - ai);
+    pk[0] = clip_q63_to_q31(ar + tr);
+    pk[1] = clip_q63_to_q31(ai + ti);
+  }
+}
+
+static void arm_merge_rfft_mixed_q31(
+  q31_t * p,
+  uint32_t M,
+  const q31_t * pCoef)
+{
+  q31_t sr, si, dr, di, c, s, x0;
+  q63_t ur, ui;
+  q31_t *pk, *pm;
+  uint32_t k;
+
+  x0 = p[0];
+  p[0] = (q31_t) (((q63_t) x0 + p[1]) >> 2);
+  p[1] = (q31_t) (((q63_t) x0 - p[1]) >> 2);
+
+  for (k = 1U; k <= M / 2U; k++)
+  {
+    pk = p + 2U * k;
+    pm = p + 2U * (M - k);
+    c = pCoef[2U * k];
+    s = pCoef[2U * k + 1U];
+
+    /* Z[k] = (S + j*conj(W)*D) / 2, Z[M-k] = conj(S - j*conj(W)*D) / 2,
+       both halved, S and D halved on the way in */
+    sr = (pk[0] >> 1) + (pm[0] >> 1);
+    si = (pk[1] >> 1) - (pm[1] >> 1);
+    dr = (pk[0] >> 1) - (pm[0] >> 1);
+    di = (pk[1] >> 1) + (pm[1] >> 1);
+    ur = MUL_Q31(dr, c) - MUL_Q31(di, s);
+    ui = MUL_Q31(di, c) + MUL_Q31(dr, s);
+
+    pm[0] = clip_q63_to_q31((sr + ui) >> 1);
+    pm[1] = clip_q63_to_q31((ur - si) >> 1);
+    pk[0] = clip_q63_to_q31((sr - ui) >> 1);
+    pk[1] = clip_q63_to_q31((si + ur) >> 1);
+  }
+}
+
+/**
+* @brief       Processing function for the mixed radix Q31 real FFT.
+* @param[in]  *S       points to an instance of the mixed radix Q31 RFFT structure.
+* @param[in]  *pSrc    points to the input buffer of <code>fftLen</code> values, left unchanged.
+* @param[out] *pDst    points to the output buffer of <code>fftLen</code> values, may be pSrc.
+* @param[in]  ifftFlag RFFT if flag is 0, RIFFT if flag is 1.
+* @return none.
+*
+* \par
+* The RFFT packs its output as arm_rfft_fast_f32() does and divides it by
+* fftLen. The RIFFT takes that format and returns the inverse transform.
+*/
+void arm_rfft_mixed_q31(
+  const arm_rfft_mixed_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint8_t ifftFlag)
+{
+  const arm_cfft_mixed_instance_q31 *Sint = &(S->Sint);
+  uint32_t i;
+
+  if (ifftFlag == 1U)
+  {
+    if (pDst != pSrc)
+    {
+      memcpy(pDst, pSrc, S->fftLenRFFT * sizeof(q31_t));
+    }
+    arm_merge_rfft_mixed_q31(pDst, Sint->fftLen, Sint->pTwiddle);
+    arm_cfft_mixed_q31(Sint, pDst, 1U);
+    for (i = 0U; i < S->fftLenRFFT; i++)
+    {
+      pDst[i] = clip_q63_to_q31((q63_t) pDst[i] << 1);
+    }
+  }
+  else
+  {
+    for (i = 0U; i < S->fftLenRFFT; i++)
+    {
+      pDst[i] = pSrc[i] >> 1;
+    }
+    arm_cfft_mixed_q31(Sint, pDst, 0U);
+    arm_split_rfft_mixed_q31(pDst, Sint->fftLen, Sint->pTwiddle);
+  }
+}
+
+/**
+* @} end of MixedFFT group
+*/
@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_f32.c
+ * Description:  Floating-point sliding DFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup SlidingDFT Sliding DFT
+ *
+ * \par
+ * The sliding DFT keeps a few bins k of the <code>fftLen</code> point DFT
+ * of the last <code>fftLen</code> samples, updated on every sample:
+ * <pre>
+ *    X[k] = W * (X[k] + x[n] - g * x[n-fftLen])     W = r * exp(j*2*pi*k/fftLen), g = r^fftLen
+ * </pre>
+ * The radius r, ARM_SDFT_DAMPING_F32/Q15/Q31, is below 1 by more than the
+ * rounding of W, so rounding errors die out instead of piling up. The
+ * window is weighted by r^m for the sample m back: Q15 bins come out
+ * 0.07 dB low at 256 points and 0.3 dB at 1024, the others less than
+ * 0.01 dB. The output after each call is
+ * <code>|X[k]|^2 / fftLen^2</code> as for the \ref Goertzel "Goertzel detector",
+ * in 1.31 format for Q15 and Q31.
+ *
+ * \par
+ * A bin costs one complex multiply per sample. The samples are taken in
+ * groups of SDFT_CHUNK, whose differences are worked out once and then
+ * run through each bin with its twiddle and state in registers.
+ *
+ * \par
+ * Against the RFFT of every 256 sample block the sliding DFT is faster
+ * for 1 bin in f32 and q31 and up to 2 in q15, on the x86 host only
+ * (k3na_dsp). As for the \ref Goertzel "Goertzel detector", the
+ * Cortex-M0 crossover has not been measured.
+ *
+ * \par Fixed point
+ * The Q15 bins are 32 bits at the scale of the samples, the Q31 bins hold
+ * X/(2*fftLen) in 1.31 format. Both multiply in 64 bits.
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/* Samples whose differences are worked out before the bins are updated */
+#define SDFT_CHUNK 16U
+
+/**
+ * @brief Processing function for the floating-point sliding DFT.
+ * @param[in,out] *S        points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     *pSrc     points to the input samples.
+ * @param[in]     blockSize number of input samples.
+ * @param[out]    *pDst     power of each bin after the last sample, numBins values.
+ * @return none.
+ */
+void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst)
+{
+  const float32_t *pCoeffs = S->pCoeffs;         /* Twiddle pointer */
+  float32_t *pState = S->pState;                 /* Bin pointer */
+  float32_t *pHistory = S->pHistory;             /* Past samples */
+  float32_t delta[SDFT_CHUNK];                   /* x[n] - g * x[n-fftLen] */
+  float32_t c, s, re, im, ar, scale;             /* Twiddle and bin */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t index = S->index;                     /* Oldest sample in pHistory */
+  uint32_t i, k, n;                              /* Loop counters */
+
+  while (blockSize > 0U)
+  {
+    n = (blockSize < SDFT_CHUNK) ? blockSize : SDFT_CHUNK;
+
+    /* The new samples take the place of the leaving ones */
+    for (i = 0U; i < n; i++)
+    {
+      delta[i] = pSrc[i] - (S->damping * pHistory[index]);
+      pHistory[index] = pSrc[i];
+      index++;
+      if (index == S->fftLen)
+      {
+        index = 0U;
+      }
+    }
+
+    for (k = 0U; k < numBins; k++)
+    {
+      c = pCoeffs[2U * k];
+      s = pCoeffs[2U * k + 1U];
+      re = pState[2U * k];
+      im = pState[2U * k + 1U];
+
+      for (i = 0U; i < n; i++)
+      {
+        ar = re + delta[i];
+        re = (c * ar) - (s * im);
+        im = (s * ar) + (c * im);
+      }
+
+      pState[2U * k] = re;
+      pState[2U * k + 1U] = im;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+  }
+  S->index = (uint16_t) index;
+
+  /* |X|^2 / fftLen^2 */
+  scale = 1.0f / ((float32_t) S->fftLen * S->fftLen);
+  for (k = 0U; k < numBins; k++)
+  {
+    re = pState[2U * k];
+    im = pState[2U * k + 1U];
+    pDst[k] = ((re * re) + (im * im)) * scale;
+  }
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
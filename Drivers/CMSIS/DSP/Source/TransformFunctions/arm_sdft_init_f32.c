@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_f32.c
+ * Description:  Initialization function for the floating-point sliding DFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+#include "arm_math.h"
+
+#define TWO_PI_F64 6.28318530717958647692
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point sliding DFT.
+ * @param[out] *S        points to an instance of the floating-point sliding DFT structure.
+ * @param[in]  fftLen    length of the DFT window.
+ * @param[in]  numBins   number of bins.
+ * @param[in]  *pBins    the bins, each below <code>fftLen</code>.
+ * @param[out] *pCoeffs  twiddle buffer of <code>2*numBins</code> values.
+ * @param[out] *pState   bin buffer of <code>2*numBins</code> values.
+ * @param[out] *pHistory sample buffer of <code>fftLen</code> values.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is 0 or a bin is out of range.
+ */
+arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pHistory)
+{
+  double angle;
+  uint32_t k;
+
+  if (fftLen == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0U; k < numBins; k++)
+  {
+    if (pBins[k] >= fftLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+    angle = TWO_PI_F64 * (double) pBins[k] / (double) fftLen;
+    pCoeffs[2U * k] = (float32_t) (ARM_SDFT_DAMPING_F32 * cos(angle));
+    pCoeffs[2U * k + 1U] = (float32_t) (ARM_SDFT_DAMPING_F32 * sin(angle));
+  }
+
+  S->fftLen = fftLen;
+  S->numBins = numBins;
+  S->index = 0U;
+  S->damping = (float32_t) pow(ARM_SDFT_DAMPING_F32, fftLen);
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pHistory = pHistory;
+  memset(pState, 0, (2U * numBins) * sizeof(float32_t));
+  memset(pHistory, 0, fftLen * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
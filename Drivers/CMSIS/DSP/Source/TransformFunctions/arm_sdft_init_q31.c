@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_q31.c
+ * Description:  Initialization function for the Q31 sliding DFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 sliding DFT.
+ * @param[out] *S        points to an instance of the Q31 sliding DFT structure.
+ * @param[in]  fftLen    length of the DFT window.
+ * @param[in]  numBins   number of bins.
+ * @param[in]  *pBins    the bins, each below <code>fftLen</code>.
+ * @param[out] *pCoeffs  twiddle buffer of <code>2*numBins</code> values.
+ * @param[out] *pState   bin buffer of <code>2*numBins</code> values.
+ * @param[out] *pHistory sample buffer of <code>fftLen</code> values.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is 0 or a bin is out of range.
+ */
+arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t fftLen,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t * pHistory)
+{
+  q31_t sinVal, cosVal;
+  q31_t damping;
+  uint32_t k;
+
+  if (fftLen == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* arm_sin_cos_q31() takes the angle over pi, 2*k/fftLen */
+  for (k = 0U; k < numBins; k++)
+  {
+    if (pBins[k] >= fftLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+    arm_sin_cos_q31((q31_t) (uint32_t) (((uint64_t) pBins[k] << 32) / fftLen), &sinVal, &cosVal);
+    pCoeffs[2U * k] = (q31_t) ((((q63_t) cosVal * ARM_SDFT_DAMPING_Q31) + 0x40000000) >> 31);
+    pCoeffs[2U * k + 1U] = (q31_t) ((((q63_t) sinVal * ARM_SDFT_DAMPING_Q31) + 0x40000000) >> 31);
+  }
+
+  /* r^fftLen */
+  damping = ARM_SDFT_DAMPING_Q31;
+  for (k = 1U; k < fftLen; k++)
+  {
+    damping = (q31_t) ((((q63_t) damping * ARM_SDFT_DAMPING_Q31) + 0x40000000) >> 31);
+  }
+
+  S->fftLen = fftLen;
+  S->numBins = numBins;
+  S->index = 0U;
+  S->damping = damping;
+  S->invLen = (q31_t) (0x40000000U / fftLen);
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pHistory = pHistory;
+  memset(pState, 0, (2U * numBins) * sizeof(q31_t));
+  memset(pHistory, 0, fftLen * sizeof(q31_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_q15.c
+ * Description:  Q15 sliding DFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/* Samples whose differences are worked out before the bins are updated */
+#define SDFT_CHUNK 16U
+
+/**
+ * @brief Processing function for the Q15 sliding DFT.
+ * @param[in,out] *S        points to an instance of the Q15 sliding DFT structure.
+ * @param[in]     *pSrc     points to the input samples.
+ * @param[in]     blockSize number of input samples.
+ * @param[out]    *pDst     power of each bin in 1.31 format after the last sample, numBins values.
+ * @return none.
+ */
+void arm_sdft_q15(
+  arm_sdft_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pDst)
+{
+  const q15_t *pCoeffs = S->pCoeffs;             /* Twiddle pointer */
+  q31_t *pState = S->pState;                     /* Bin pointer */
+  q15_t *pHistory = S->pHistory;                 /* Past samples */
+  q31_t delta[SDFT_CHUNK];                       /* x[n] - g * x[n-fftLen], 2^-15 units */
+  q31_t c, s, re, im, ar;                        /* Twiddle and bin, 2^-15 units */
+  q63_t power;                                   /* |X|^2, 2^-30 units */
+  uint64_t lenSq;                                /* fftLen^2 */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t index = S->index;                     /* Oldest sample in pHistory */
+  uint32_t i, k, n;                              /* Loop counters */
+
+  while (blockSize > 0U)
+  {
+    n = (blockSize < SDFT_CHUNK) ? blockSize : SDFT_CHUNK;
+
+    /* The new samples take the place of the leaving ones */
+    for (i = 0U; i < n; i++)
+    {
+      delta[i] = pSrc[i] - (((q31_t) S->damping * pHistory[index] + 0x4000) >> 15);
+      pHistory[index] = pSrc[i];
+      index++;
+      if (index == S->fftLen)
+      {
+        index = 0U;
+      }
+    }
+
+    for (k = 0U; k < numBins; k++)
+    {
+      c = pCoeffs[2U * k];
+      s = pCoeffs[2U * k + 1U];
+      re = pState[2U * k];
+      im = pState[2U * k + 1U];
+
+      for (i = 0U; i < n; i++)
+      {
+        ar = re + delta[i];
+        re = (q31_t) ((((q63_t) c * ar) - ((q63_t) s * im) + 0x4000) >> 15);
+        im = (q31_t) ((((q63_t) s * ar) + ((q63_t) c * im) + 0x4000) >> 15);
+      }
+
+      pState[2U * k] = re;
+      pState[2U * k + 1U] = im;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+  }
+  S->index = (uint16_t) index;
+
+  /* 2 * |X|^2 / fftLen^2 is the power in 1.31 */
+  lenSq = (uint64_t) S->fftLen * S->fftLen;
+  for (k = 0U; k < numBins; k++)
+  {
+    re = pState[2U * k];
+    im = pState[2U * k + 1U];
+    power = ((q63_t) re * re) + ((q63_t) im * im);
+    power = (q63_t) (((uint64_t) power << 1) / lenSq);
+    pDst[k] = (power > 0x7FFFFFFF) ? 0x7FFFFFFF : (q31_t) power;
+  }
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
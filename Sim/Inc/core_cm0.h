@@ -0,0 +1,60 @@
+/*
+ * core_cm0.h
+ *
+ * Host stand-in for the CMSIS core header that arm_math.h includes with
+ * ARM_MATH_CM0. Only the compiler macros and the intrinsics the DSP sources
+ * use are given here, in plain C; interrupt control lives in
+ * stm32f0xx_hal.h as before.
+ */
+
+#ifndef __CORE_CM0_H_GENERIC
+#define __CORE_CM0_H_GENERIC
+
+#include <stdint.h>
+
+#ifndef __ASM
+#define __ASM                   __asm
+#endif
+#ifndef __INLINE
+#define __INLINE                inline
+#endif
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE         static inline
+#endif
+#ifndef __STATIC_FORCEINLINE
+#define __STATIC_FORCEINLINE    __attribute__((always_inline)) static inline
+#endif
+#ifndef __ALIGNED
+#define __ALIGNED(x)            __attribute__((aligned(x)))
+#endif
+#ifndef __PACKED
+#define __PACKED                __attribute__((packed, aligned(1)))
+#endif
+
+static inline void     __NOP  (void)       { }
+
+static inline uint8_t  __CLZ  (uint32_t v) { return v ? __builtin_clz(v) : 32; }
+
+static inline int32_t __SSAT(int32_t lVal, uint32_t ulSat)
+{
+	int32_t lMax = (int32_t)((1U << (ulSat - 1U)) - 1U);
+
+	if (lVal > lMax)
+		return lMax;
+	if (lVal < -lMax - 1)
+		return -lMax - 1;
+	return lVal;
+}
+
+static inline uint32_t __USAT(int32_t lVal, uint32_t ulSat)
+{
+	uint32_t ulMax = (1U << ulSat) - 1U;
+
+	if (lVal < 0)
+		return 0;
+	if ((uint32_t)lVal > ulMax)
+		return ulMax;
+	return (uint32_t)lVal;
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef _HAL_SIM_H_
+#define _HAL_SIM_H_
+
+#include "main.h"
+
+
+// ============= Virtual hardware ===============
+//  Time only moves when the firmware spends it: SPI bytes at the SPI1 bit
+//  rate, HAL_Delay() and sim_idle(). Every 1 ms boundary runs the SysTick
+//  body of stm32f0xx_it.c (update_timers(), HAL tick).
+//
+//  HAL_SPI_Transmit() bytes are recorded. When the line then stays low for
+//  SIM_LATCH_NS the recorded bytes are decoded into one frame, like the
+//  strip latches on its reset time.
+
+#define SIM_CORE_HZ         40000000          // HSI / 2 x PLL 10, SystemClock_Config()
+#define SIM_SPI_PRESCALER   8                 // SPI_BAUDRATEPRESCALER_8, MX_SPI1_Init()
+#define SIM_SPI_BIT_NS      (1000000000ULL * SIM_SPI_PRESCALER / SIM_CORE_HZ)
+#define SIM_TICK_NS         1000000ULL
+#define SIM_LATCH_NS        50000ULL          // WS2812 reset time
+
+#define SIM_CODE_0          0x0C              // SPI byte of a 0 bit, WS2812_SPI.c
+#define SIM_CODE_1          0x1E              // SPI byte of a 1 bit
+#define SIM_MAX_LED         1024
+
+
+typedef struct
+{
+	rgb_color rPixel[SIM_MAX_LED];
+	uint16_t  wNum;                           // Pixels decoded
+	uint32_t  ulBadCodes;                     // SPI bytes that are neither SIM_CODE_0 nor SIM_CODE_1
+	uint32_t  ulBytes;                        // SPI bytes of the frame
+	const uint8_t *pRaw;                      // The recorded bytes, up to SIM_MAX_LED pixels
+	uint32_t  ulRaw;
+	uint64_t  ullLatchNs;                     // Virtual time the frame latched
+} SimFrameDef;
+
+typedef struct
+{
+	uint32_t ulFrames;                        // Frames latched
+	uint64_t ullSpiBytes;                     // All bytes through HAL_SPI_Transmit
+	uint32_t ulBadCodes;                      // Sum of SimFrameDef.ulBadCodes
+	uint32_t ulOverflow;                      // Frames longer than SIM_MAX_LED
+} SimStatDef;
+
+typedef void (*SimFrameFunc)(const SimFrameDef *);
+
+
+// =============== Simulator functions declaration ======================
+
+void     sim_reset               (void);
+void     sim_on_frame            (SimFrameFunc);
+void     sim_spi_capture         (uint8_t);
+void     sim_spend_ns            (uint64_t);
+void     sim_idle                (void);
+void     sim_latch               (void);
+uint64_t sim_time_ns             (void);
+uint16_t sim_decode              (const uint8_t *, uint32_t, rgb_color *, uint16_t, uint32_t *);
+
+extern SimStatDef sSimStat;
+extern rgb_color  rLed_Data[];
+extern int        brightness;
+
+
+
+#endif
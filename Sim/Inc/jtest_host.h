@@ -0,0 +1,29 @@
+/*
+ * jtest_host.h
+ *
+ * Host stand-in for JTest/inc/jtest_systick.h, force included into every
+ * DSP_Lib_TestSuite source of k3na_jtest. The suite counts cycles with the
+ * SysTick of the ARMCMx device headers; here the same macros read
+ * CLOCK_MONOTONIC instead, so JTEST_COUNT_CYCLES() reports nanoseconds per
+ * call of the function under test. The guard of jtest_systick.h is taken
+ * first, so the device header switch in it never runs.
+ */
+
+#ifndef _JTEST_HOST_H_
+#define _JTEST_HOST_H_
+
+#include <stdint.h>
+
+#define _JTEST_SYSTICK_H_
+
+// Down counter like SysTick: VALUE is INITIAL_VALUE less the ns since START
+#define JTEST_SYSTICK_INITIAL_VALUE   0xFFFFFFFFU
+
+#define JTEST_SYSTICK_RESET(systick_ptr)    do { } while (0)
+#define JTEST_SYSTICK_START(systick_ptr)    jtest_clock_start()
+#define JTEST_SYSTICK_VALUE(systick_ptr)    jtest_clock_value()
+
+void     jtest_clock_start       (void);
+uint32_t jtest_clock_value       (void);
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * stm32f0xx_hal.h
+ *
+ * Host stand-in for the STM32F0 HAL. Only what the engine sources built by
+ * Sim/CMakeLists.txt need is declared here, so Core/Inc/main.h compiles
+ * unchanged on a workstation. Behaviour lives in Sim/Src/hal_sim.c.
+ */
+
+#ifndef __STM32F0xx_HAL_H
+#define __STM32F0xx_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define __IO    volatile
+
+typedef enum {RESET = 0U, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0U, ENABLE = !DISABLE} FunctionalState;
+
+typedef enum
+{
+	HAL_OK       = 0x00U,
+	HAL_ERROR    = 0x01U,
+	HAL_BUSY     = 0x02U,
+	HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+	GPIO_PIN_RESET = 0U,
+	GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct
+{
+	uint32_t BaudRatePrescaler;
+} SPI_InitTypeDef;
+
+typedef struct
+{
+	void           *Instance;
+	SPI_InitTypeDef Init;
+} SPI_HandleTypeDef;
+
+#define SPI_BAUDRATEPRESCALER_2         0x00000000U
+#define SPI_BAUDRATEPRESCALER_4         0x00000008U
+#define SPI_BAUDRATEPRESCALER_8         0x00000010U
+#define SPI_BAUDRATEPRESCALER_16        0x00000018U
+
+// The CRC unit as MX_CRC_Init() sets it up (zlib CRC-32 without the final
+// inversion), computed in software. Each handle keeps its own register, so
+// parsers on different threads do not share state.
+typedef struct
+{
+	uint32_t ulCrc;
+} CRC_HandleTypeDef;
+
+// SysTick reads as stopped, cycle counts taken from it are 0
+typedef struct
+{
+	volatile uint32_t CTRL;
+	volatile uint32_t LOAD;
+	volatile uint32_t VAL;
+	volatile uint32_t CALIB;
+} SysTick_Type;
+
+extern SysTick_Type sSimSysTick;
+#define SysTick             (&sSimSysTick)
+
+static inline void     __disable_irq   (void)         { }
+static inline void     __enable_irq    (void)         { }
+static inline uint32_t __get_PRIMASK   (void)         { return 0; }
+static inline void     __set_PRIMASK   (uint32_t pri) { (void)pri; }
+
+HAL_StatusTypeDef HAL_SPI_Transmit     (SPI_HandleTypeDef *, uint8_t *, uint16_t, uint32_t);
+void              HAL_Delay            (uint32_t);
+uint32_t          HAL_GetTick          (void);
+uint32_t          HAL_CRC_Calculate    (CRC_HandleTypeDef *, uint32_t *, uint32_t);
+uint32_t          HAL_CRC_Accumulate   (CRC_HandleTypeDef *, uint32_t *, uint32_t);
+
+
+#endif /* __STM32F0xx_HAL_H */
@@ -0,0 +1,82 @@
+#ifndef _WAVE_CHECK_H_
+#define _WAVE_CHECK_H_
+
+#include "main.h"
+
+
+// ============= Line model ===============
+//  The data line is fed as runs of one level. Every high pulse is a bit,
+//  classified by its width (T0H / T1H window). The low time that follows
+//  must be inside [TL min, TL max], or at least the reset time, which
+//  latches the frame. Bits are GRB, MSB first.
+//
+//  SPI : one byte per bit group, MSB first, bit time = prescaler / core clock
+//  PWM : one compare value per bit, high for CCR ticks then low to the period
+
+#define WAVE_NO_ERR         0xFFFFFFFF
+
+typedef enum
+{
+	WAVE_WS2812,
+	WAVE_SK6812
+} WaveChipType;
+
+typedef struct
+{
+	const char *pName;
+	uint16_t    wT0HMin, wT0HMax;             // ns
+	uint16_t    wT1HMin, wT1HMax;             // ns
+	uint16_t    wTLMin,  wTLMax;              // ns, low time between bits
+	uint32_t    ulReset;                      // ns, shortest low time that latches
+} WaveTimingDef;
+
+typedef struct
+{
+	uint32_t ulBits;                          // High pulses decoded
+	uint32_t ulHighErr;                       // Pulse in neither the T0H nor the T1H window
+	uint32_t ulLowErr;                        // Low time outside TL and shorter than reset
+	uint32_t ulFrames;                        // Resets that latched at least one bit
+	uint32_t ulPartial;                       // Frames that ended inside a pixel
+	uint32_t ulFirstErr;                      // Bit index of the first violation, WAVE_NO_ERR if none
+
+	uint32_t ulHigh0Min, ulHigh0Max;          // Observed widths, ns
+	uint32_t ulHigh1Min, ulHigh1Max;
+	uint32_t ulLowMin,   ulLowMax;
+} WaveStatDef;
+
+typedef void (*WaveFrameFunc)(const rgb_color *, uint16_t, void *);
+
+typedef struct
+{
+	const WaveTimingDef *pTiming;
+	WaveStatDef          sStat;
+
+	rgb_color           *pPixel;              // Pixels of the frame being decoded
+	uint16_t             wMax;
+	uint16_t             wNum;
+	WaveFrameFunc        fFrame;              // Called on every latch, may be NULL
+	void                *pArg;
+
+	uint8_t              ucLevel;             // Level of the current run
+	uint64_t             ullRun;              // Length of the current run, ps
+	uint8_t              ucPulse;             // A high pulse waits for its low time
+	uint32_t             ulHigh;              // Width of that pulse, ns
+	uint32_t             ulShift;             // Bits of the pixel being built
+	uint8_t              ucBitCnt;
+} WaveCheckDef;
+
+extern const WaveTimingDef kWaveTiming[2];
+
+
+// =============== Waveform check functions declaration ======================
+
+void     wave_init               (WaveCheckDef *, WaveChipType, rgb_color *, uint16_t, WaveFrameFunc, void *);
+void     wave_level              (WaveCheckDef *, uint8_t, uint64_t);
+void     wave_spi                (WaveCheckDef *, const uint8_t *, uint32_t, uint64_t, uint64_t);
+void     wave_pwm                (WaveCheckDef *, const uint16_t *, uint32_t, uint16_t, uint64_t);
+void     wave_end                (WaveCheckDef *);
+uint64_t wave_spi_bit_ps         (uint32_t, uint32_t);
+
+
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef _WORK_POOL_H_
+#define _WORK_POOL_H_
+
+#include <stdint.h>
+#include <pthread.h>
+
+
+// ============= Work stealing thread pool ===============
+//  pool_run() splits tasks 0..n-1 into one contiguous range per worker. A
+//  worker takes its own tasks from the back of its range; once that is
+//  empty it steals from the front of the others, so workers that drew cheap
+//  tasks help those that drew expensive ones. The calling thread is worker
+//  0, pool_run() returns when every task has finished.
+
+typedef void (*PoolTaskFunc)(void *, uint32_t);
+
+typedef struct
+{
+	pthread_mutex_t mLock;
+	uint32_t ulHead;                          // Next task a thief takes
+	uint32_t ulTail;                          // One past the next task the owner takes
+	uint32_t ulRun;                           // Tasks run by this worker, all runs
+	uint32_t ulStolen;                        // Of those taken from other workers
+	uint8_t  ucPad[64];                       // Keeps queues on separate cache lines
+} PoolQueueDef;
+
+typedef struct
+{
+	uint16_t         wWorkers;
+	pthread_t       *pThread;
+	PoolQueueDef    *pQueue;
+
+	pthread_mutex_t  mLock;
+	pthread_cond_t   cStart;
+	pthread_cond_t   cDone;
+	uint32_t         ulGen;                   // Bumped by every pool_run()
+	uint16_t         wBusy;                   // Helper threads still working on this run
+	uint8_t          ucQuit;
+
+	PoolTaskFunc     fTask;
+	void            *pArg;
+} PoolTypeDef;
+
+
+// =============== Pool functions declaration ======================
+
+int       pool_init              (PoolTypeDef *, uint16_t);
+void      pool_run               (PoolTypeDef *, PoolTaskFunc, void *, uint32_t);
+void      pool_free              (PoolTypeDef *);
+
+
+
+#endif
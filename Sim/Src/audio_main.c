@@ -0,0 +1,431 @@
+/*
+ * audio_main.c
+ *
+ * Host driver of the audio spectrum (Core/Inc/led_spectrum.h). Samples are
+ * turned into 12 bit ADC codes around mid scale and fed block by block
+ * through spectrum_process() and spectrum_render(), as audio.c does with
+ * the DMA halves, onto the three default segments of main.c.
+ *
+ *   k3na_audio                          self test, exit status 1 on failure
+ *   k3na_audio -w file.wav [-m mode]    WAV input (PCM 16 bit, any rate and channels)
+ *   k3na_audio -g sweep|beat [-s sec]   synthetic input
+ *     -m bars|vu   rendering, default bars
+ *     -o file      band levels of every block as CSV
+ *     -v           print the strip of every block ('#' lit, '+' partly lit, '*' bar peak)
+ *
+ * WAV input is mixed to mono and brought to SPECTRUM_RATE by linear
+ * interpolation, without an anti-alias filter.
+ *
+ * The self test checks that the pruned twiddle tables give the same
+ * spectrum as arm_rfft_init_q15(), that a tone in the middle of each band
+ * lights that band most, and that silence goes dark; it also reports the
+ * host time per block.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "main.h"
+#include "led_spectrum.h"
+
+#define AUDIO_SEGS          3
+#define AUDIO_FS            32767.0           // Full scale of a sample
+
+typedef enum
+{
+	GEN_NONE,
+	GEN_SWEEP,                                // Log sweep over all bands
+	GEN_BEAT                                  // Kick drum, hi-hat and a chord
+} GenType;
+
+static const uint8_t ucEdge[SPECTRUM_BANDS + 1] = { 1, 2, 3, 5, 8, 13, 22, 38, 64 };
+
+static SpectrumTypeDef sSpec;
+static rgb_color       rLed[MAX_NUMB];
+static LedTypeDef      lSeg[AUDIO_SEGS];
+
+
+// ==================================================================================
+static double audio_seconds(void)
+{
+	struct timespec tNow;
+
+	clock_gettime(CLOCK_MONOTONIC, &tNow);
+	return tNow.tv_sec + tNow.tv_nsec / 1e9;
+}
+
+// ==================================================================================
+static uint16_t audio_adc(double dSample)
+{
+	long lCode = lround(2048 + dSample * 2047 / AUDIO_FS);
+
+	return lCode < 0 ? 0 : (lCode > 4095 ? 4095 : lCode);
+}
+
+// ==================================================================================
+static void audio_segments(void)
+{
+	// Same defaults as main.c
+	static const uint16_t wStart[AUDIO_SEGS] = {  0, 20, 40};
+	static const uint16_t wEnd[AUDIO_SEGS]   = { 19, 39, 79};
+	static const StateDir sDir[AUDIO_SEGS]   = {SHIFT_RIGHT, SHIFT_LEFT, SHIFT_LEFT};
+	const rgb_color rOri[AUDIO_SEGS]  = { COLOR_RED, COLOR_BLUE, COLOR_GREEN };
+	const rgb_color rFill[AUDIO_SEGS] = { COLOR_YELLOW, COLOR_BLANK, COLOR_WHITE };
+	uint8_t i;
+
+	for (i = 0; i < AUDIO_SEGS; i++)
+	{
+		lSeg[i].wPosStart  = wStart[i];
+		lSeg[i].wPosEnd    = wEnd[i];
+		lSeg[i].sDir       = sDir[i];
+		lSeg[i].rColorOri  = rOri[i];
+		lSeg[i].rColorFill = rFill[i];
+	}
+}
+
+// ==================================================================================
+static void audio_print(SpectrumMode eMode)
+{
+	char     cLine[MAX_NUMB + 1];
+	uint8_t  ucMax, k;
+	uint16_t i;
+
+	for (i = 0; i < MAX_NUMB; i++)
+	{
+		ucMax = rLed[i].red > rLed[i].green ? rLed[i].red : rLed[i].green;
+		ucMax = ucMax > rLed[i].blue ? ucMax : rLed[i].blue;
+		cLine[i] = !ucMax ? '.' : (ucMax < 0x20 ? '+' : '#');
+
+		// Bar peaks are drawn in the fill color of their segment
+		for (k = 0; eMode == SPECTRUM_BARS && k < AUDIO_SEGS; k++)
+			if (ucMax && i >= lSeg[k].wPosStart && i <= lSeg[k].wPosEnd &&
+			    !memcmp(&rLed[i], &lSeg[k].rColorFill, sizeof(rgb_color)) &&
+			    memcmp(&rLed[i], &lSeg[k].rColorOri, sizeof(rgb_color)))
+				cLine[i] = '*';
+	}
+	cLine[MAX_NUMB] = 0;
+	printf("%6u %s\n", sSpec.ulBlocks, cLine);
+}
+
+// ==================================================================================
+/**
+ * @brief  Runs one block through the firmware path
+ */
+static void audio_block(const uint16_t *wAdc, SpectrumMode eMode, FILE *fCsv, uint8_t ucVerbose)
+{
+	uint8_t i;
+
+	spectrum_process(&sSpec, wAdc);
+	spectrum_render(&sSpec, rLed, lSeg, AUDIO_SEGS, eMode);
+
+	if (fCsv)
+	{
+		fprintf(fCsv, "%u", sSpec.ulBlocks);
+		for (i = 0; i <= SPECTRUM_BANDS; i++)
+			fprintf(fCsv, ",%u,%u", sSpec.wLog[i], sSpec.ucLevel[i]);
+		fprintf(fCsv, "\n");
+	}
+	if (ucVerbose)
+		audio_print(eMode);
+}
+
+// ==================================================================================
+/**
+ * @brief  Reads a PCM 16 bit WAV file as mono samples
+ * @return Sample count, 0 on error
+ */
+static uint32_t audio_wav(const char *pName, int16_t **pOut, uint32_t *pRate)
+{
+	FILE    *f = fopen(pName, "rb");
+	uint8_t  ucHdr[12], ucChunk[8], ucFmt[16];
+	uint32_t ulLen, ulNum = 0, i;
+	uint16_t wCh = 0, wBits = 0, k;
+	int16_t *pRaw;
+	int32_t  lSum;
+
+	if (!f || fread(ucHdr, 1, 12, f) != 12 || memcmp(ucHdr, "RIFF", 4) || memcmp(&ucHdr[8], "WAVE", 4))
+	{
+		fprintf(stderr, "%s: not a WAV file\n", pName);
+		return 0;
+	}
+
+	while (fread(ucChunk, 1, 8, f) == 8)
+	{
+		ulLen = ucChunk[4] | (ucChunk[5] << 8) | (ucChunk[6] << 16) | ((uint32_t)ucChunk[7] << 24);
+		if (!memcmp(ucChunk, "fmt ", 4) && ulLen >= 16)
+		{
+			if (fread(ucFmt, 1, 16, f) != 16)
+				break;
+			wCh    = ucFmt[2] | (ucFmt[3] << 8);
+			*pRate = ucFmt[4] | (ucFmt[5] << 8) | (ucFmt[6] << 16) | ((uint32_t)ucFmt[7] << 24);
+			wBits  = ucFmt[14] | (ucFmt[15] << 8);
+			if ((ucFmt[0] | (ucFmt[1] << 8)) != 1 || wBits != 16 || !wCh)
+			{
+				fprintf(stderr, "%s: only PCM 16 bit is supported\n", pName);
+				break;
+			}
+			fseek(f, ulLen - 16 + (ulLen & 1), SEEK_CUR);
+		}
+		else if (!memcmp(ucChunk, "data", 4) && wBits == 16)
+		{
+			ulNum = ulLen / 2 / wCh;
+			pRaw  = malloc(ulLen);
+			*pOut = malloc(ulNum * sizeof(int16_t));
+			if (!pRaw || !*pOut)
+				break;
+			ulNum = fread(pRaw, 2 * wCh, ulNum, f);
+			for (i = 0; i < ulNum; i++)
+			{
+				for (lSum = 0, k = 0; k < wCh; k++)
+					lSum += pRaw[i * wCh + k];
+				(*pOut)[i] = lSum / wCh;
+			}
+			free(pRaw);
+			fclose(f);
+			return ulNum;
+		}
+		else
+		{
+			fseek(f, ulLen + (ulLen & 1), SEEK_CUR);
+		}
+	}
+	fprintf(stderr, "%s: no usable data\n", pName);
+	fclose(f);
+	return 0;
+}
+
+// ==================================================================================
+static int audio_file(const char *pName, SpectrumMode eMode, FILE *fCsv, uint8_t ucVerbose)
+{
+	uint16_t wAdc[SPECTRUM_LEN];
+	int16_t *pPcm = NULL;
+	uint32_t ulRate = 0, ulNum, ulIdx;
+	double   dPos, dStep, dFrac;
+	uint16_t n = 0;
+
+	ulNum = audio_wav(pName, &pPcm, &ulRate);
+	if (!ulNum || !ulRate)
+		return 2;
+
+	dStep = (double)ulRate / SPECTRUM_RATE;
+	for (dPos = 0; dPos < ulNum - 1; dPos += dStep)
+	{
+		ulIdx = (uint32_t)dPos;
+		dFrac = dPos - ulIdx;
+		wAdc[n++] = audio_adc(pPcm[ulIdx] * (1 - dFrac) + pPcm[ulIdx + 1] * dFrac);
+		if (n == SPECTRUM_LEN)
+		{
+			audio_block(wAdc, eMode, fCsv, ucVerbose);
+			n = 0;
+		}
+	}
+	printf("%s: %u Hz, %.1f s, %u blocks\n", pName, ulRate, (double)ulNum / ulRate, sSpec.ulBlocks);
+	free(pPcm);
+	return 0;
+}
+
+// ==================================================================================
+static double audio_gen(GenType eGen, uint32_t n, uint32_t ulTotal, uint32_t *pSeed)
+{
+	double dT = (double)n / SPECTRUM_RATE, dBeat, dOut;
+
+	if (eGen == GEN_SWEEP)                              // 62.5 Hz .. 4 kHz, 6 octaves
+		return 0.5 * AUDIO_FS * sin(2 * M_PI * 62.5 * ulTotal / SPECTRUM_RATE / 6 / M_LN2 *
+		                            (pow(64, (double)n / ulTotal) - 1));
+
+	dBeat = fmod(dT, 0.5);                              // 120 bpm
+	dOut  = 0.6 * sin(2 * M_PI * 60 * dBeat) * exp(-dBeat * 12);
+	if (fmod(dT + 0.25, 0.5) < 0.03)                    // Off-beat hi-hat, white noise
+	{
+		*pSeed = *pSeed * 1103515245 + 12345;
+		dOut += 0.2 * ((int32_t)(*pSeed >> 16 & 0x7FFF) - 16384) / 16384.0;
+	}
+	dOut += 0.1 * (sin(2 * M_PI * 440 * dT) + sin(2 * M_PI * 554 * dT) + sin(2 * M_PI * 659 * dT));
+	return dOut * AUDIO_FS;
+}
+
+// ==================================================================================
+static int audio_synth(GenType eGen, uint32_t ulSeconds, SpectrumMode eMode, FILE *fCsv, uint8_t ucVerbose)
+{
+	uint16_t wAdc[SPECTRUM_LEN];
+	uint32_t ulTotal = ulSeconds * SPECTRUM_RATE, ulSeed = 1, n;
+
+	for (n = 0; n + SPECTRUM_LEN <= ulTotal; n++)
+	{
+		wAdc[n % SPECTRUM_LEN] = audio_adc(audio_gen(eGen, n, ulTotal, &ulSeed));
+		if (n % SPECTRUM_LEN == SPECTRUM_LEN - 1)
+			audio_block(wAdc, eMode, fCsv, ucVerbose);
+	}
+	return 0;
+}
+
+// ==================================================================================
+/**
+ * @brief  Blocks of a tone, the phase runs on across blocks
+ */
+static void audio_tone(double dHz, double dAmp, uint16_t wBlocks)
+{
+	static uint32_t ulN;
+	uint16_t wAdc[SPECTRUM_LEN];
+	uint16_t i;
+
+	while (wBlocks--)
+	{
+		for (i = 0; i < SPECTRUM_LEN; i++, ulN++)
+			wAdc[i] = audio_adc(dAmp * AUDIO_FS * sin(2 * M_PI * dHz * ulN / SPECTRUM_RATE));
+		spectrum_process(&sSpec, wAdc);
+	}
+}
+
+// ==================================================================================
+static int audio_test(void)
+{
+	arm_rfft_instance_q15 fFull;
+	SpectrumTypeDef sFull;
+	uint16_t wAdc[SPECTRUM_LEN];
+	uint32_t ulSeed = 7, ulBlocks;
+	double   dHz, dStart;
+	uint8_t  b, i, ucMax, ucFail = 0;
+	uint16_t k;
+
+	// Pruned tables against the full CMSIS ones, bit for bit on random input
+	spectrum_init(&sSpec);
+	spectrum_init(&sFull);
+	arm_rfft_init_q15(&fFull, SPECTRUM_LEN, 0, 1);
+	sFull.pRfft = &fFull;
+	for (i = 0; i < 50; i++)
+	{
+		for (k = 0; k < SPECTRUM_LEN; k++)
+		{
+			ulSeed = ulSeed * 1103515245 + 12345;
+			wAdc[k] = (ulSeed >> 16) & 0x0FFF;
+		}
+		spectrum_process(&sSpec, wAdc);
+		spectrum_process(&sFull, wAdc);
+		if (memcmp(sSpec.qOut, sFull.qOut, sizeof(sSpec.qOut)))
+			break;
+	}
+	printf("tables   %s, %u random blocks match arm_rfft_init_q15()\n", i == 50 ? "PASS" : "FAIL", i);
+	ucFail |= i != 50;
+
+	// A tone at the geometric middle of each band, -6 dBFS
+	for (b = 0; b < SPECTRUM_BANDS; b++)
+	{
+		spectrum_init(&sSpec);
+		dHz = sqrt(ucEdge[b] * (ucEdge[b + 1] - 1)) * SPECTRUM_RATE / SPECTRUM_LEN;
+		audio_tone(dHz, 0.5, 20);
+
+		for (ucMax = 0, i = 1; i < SPECTRUM_BANDS; i++)
+			if (sSpec.wLog[i] > sSpec.wLog[ucMax])
+				ucMax = i;
+		printf("tone     %s, %7.1f Hz  band %u  level %3u  log2 %5.2f  next %5.2f\n",
+		       ucMax == b && sSpec.ucLevel[b] == 255 ? "PASS" : "FAIL", dHz, ucMax, sSpec.ucLevel[b],
+		       sSpec.wLog[b] / 256.0, sSpec.wLog[b ? b - 1 : 1] / 256.0);
+		ucFail |= ucMax != b || sSpec.ucLevel[b] != 255;
+	}
+
+	// Silence (mid scale and a few LSB of noise) after a loud tone
+	for (ulBlocks = 0; ulBlocks < 1000; ulBlocks++)
+	{
+		for (k = 0; k < SPECTRUM_LEN; k++)
+		{
+			ulSeed = ulSeed * 1103515245 + 12345;
+			wAdc[k] = 2048 + ((ulSeed >> 16) & 7) - 4;
+		}
+		spectrum_process(&sSpec, wAdc);
+		for (i = 0; i <= SPECTRUM_BANDS && !sSpec.ucLevel[i] && !sSpec.ucPeak[i]; i++)
+			;
+		if (i > SPECTRUM_BANDS)
+			break;
+	}
+	printf("silence  %s, dark after %u blocks (%.2f s), noise log2 %5.2f\n", ulBlocks < 1000 ? "PASS" : "FAIL",
+	       ulBlocks, ulBlocks * (double)SPECTRUM_LEN / SPECTRUM_RATE, sSpec.wLog[SPECTRUM_BANDS] / 256.0);
+	ucFail |= ulBlocks == 1000;
+
+	// Host speed of the whole block path
+	spectrum_init(&sSpec);
+	dStart = audio_seconds();
+	for (ulBlocks = 0; ulBlocks < 20000; ulBlocks++)
+	{
+		wAdc[ulBlocks % SPECTRUM_LEN] ^= 0x155;
+		spectrum_process(&sSpec, wAdc);
+		spectrum_render(&sSpec, rLed, lSeg, AUDIO_SEGS, SPECTRUM_BARS);
+	}
+	printf("speed    %.0f ns per block on the host\n", (audio_seconds() - dStart) * 1e9 / ulBlocks);
+
+	return ucFail;
+}
+
+// ==================================================================================
+int main(int argc, char **argv)
+{
+	SpectrumMode eMode = SPECTRUM_BARS;
+	GenType  eGen = GEN_NONE;
+	const char *pWav = NULL;
+	FILE    *fCsv = NULL;
+	uint32_t ulSeconds = 10;
+	uint8_t  ucVerbose = 0;
+	int      i, iRc;
+
+	for (i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-w") && i + 1 < argc)
+			pWav = argv[++i];
+		else if (!strcmp(argv[i], "-g") && i + 1 < argc)
+		{
+			i++;
+			eGen = !strcmp(argv[i], "sweep") ? GEN_SWEEP : (!strcmp(argv[i], "beat") ? GEN_BEAT : GEN_NONE);
+			if (eGen == GEN_NONE)
+				break;
+		}
+		else if (!strcmp(argv[i], "-m") && i + 1 < argc)
+		{
+			i++;
+			eMode = !strcmp(argv[i], "vu") ? SPECTRUM_VU : (!strcmp(argv[i], "bars") ? SPECTRUM_BARS : SPECTRUM_OFF);
+			if (eMode == SPECTRUM_OFF)
+				break;
+		}
+		else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+			ulSeconds = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+		{
+			if (!(fCsv = fopen(argv[++i], "w")))
+			{
+				perror(argv[i]);
+				return 2;
+			}
+		}
+		else if (!strcmp(argv[i], "-v"))
+			ucVerbose = 1;
+		else
+			break;
+	}
+	if (i < argc)
+	{
+		fprintf(stderr, "usage: %s [-w file.wav | -g sweep|beat] [-s seconds] [-m bars|vu] [-o levels.csv] [-v]\n", argv[0]);
+		return 2;
+	}
+
+	audio_segments();
+	spectrum_init(&sSpec);
+	if (fCsv)
+	{
+		fprintf(fCsv, "block");
+		for (i = 0; i <= SPECTRUM_BANDS; i++)
+			fprintf(fCsv, i < SPECTRUM_BANDS ? ",log%u,level%u" : ",log_all,level_all", i, i);
+		fprintf(fCsv, "\n");
+	}
+
+	if (pWav)
+		iRc = audio_file(pWav, eMode, fCsv, ucVerbose);
+	else if (eGen != GEN_NONE)
+		iRc = audio_synth(eGen, ulSeconds, eMode, fCsv, ucVerbose);
+	else
+		iRc = audio_test();
+
+	if (fCsv)
+		fclose(fCsv);
+	return iRc;
+}
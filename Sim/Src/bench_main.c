@@ -0,0 +1,474 @@
+/*
+ * bench_main.c
+ *
+ * Micro-benchmarks of the led_move.c primitives, the led_matrix.c bulk
+ * operations, the text ticker, the particle pool, the noise generator and
+ * the WS2812 encoder over segment lengths from BENCH_MIN_LED to
+ * BENCH_MAX_LED pixels. Matrix and text cases run on a serpentine panel
+ * BENCH_MAT_ROWS high, particle cases keep one particle per pixel alive and
+ * noise cases sample BENCH_NOISE_STEP apart (one pixel = ns_per_sample).
+ *
+ *   k3na_bench [-o file.csv]
+ *     Times every case on the host, writes "case,pixels,ns_per_pixel".
+ *
+ *   k3na_bench -r case -n pixels -i iterations
+ *     Runs one case without timing. Tools/bench_qemu.py runs this under
+ *     qemu-arm with an instruction counting plugin to get insn_per_pixel.
+ *
+ *   k3na_bench -l
+ *     Lists the case names and pixel counts.
+ *
+ * Compare a run against Sim/bench/baseline_host.csv with Tools/bench_compare.py.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "main.h"
+#include "WS2812_SPI.h"
+#include "led_matrix.h"
+#include "led_text.h"
+#include "led_particle.h"
+#include "led_noise.h"
+#include "hal_sim.h"
+
+#define BENCH_MIN_LED       8
+#define BENCH_MAX_LED       1024
+#define BENCH_SIZES         8                 // BENCH_MIN_LED << 0 .. BENCH_MAX_LED
+#define BENCH_STEP          4                 // Shift step of the main.c animation
+#define BENCH_BATCH_NS      1000000.0         // Calibrated length of one timed batch
+#define BENCH_REPEAT        15                // Passes over all cases, the fastest counts
+#define BENCH_MAT_ROWS      8
+#define BENCH_NOISE_STEP    40                // 8.8 step, about 6 pixels per noise cell
+
+typedef void (*BenchFunc)(uint16_t);
+
+typedef struct
+{
+	const char *pName;
+	BenchFunc   fRun;
+} BenchCaseDef;
+
+static rgb_color  rBench[BENCH_MAX_LED];
+static LedTypeDef lBench;
+
+static uint8_t         ucNoise[BENCH_MAX_LED];
+static uint16_t        wNoiseT;
+
+static uint16_t        wMatMap[BENCH_MAX_LED];
+static MatrixTypeDef   mBench;
+static MatrixSpriteDef sBench;
+
+
+// ==================================================================================
+static void bench_segment(uint16_t wNum, StateDir sDir)
+{
+	lBench.wPosStart  = 0;
+	lBench.wPosEnd    = wNum - 1;
+	lBench.rColorOri  = COLOR_BLUE;
+	lBench.rColorFill = COLOR_YELLOW;
+	lBench.sDir       = sDir;
+	lBench.wPosCurr   = (sDir == SHIFT_LEFT) ? 0 : wNum - 1;
+}
+
+// ==================================================================================
+static void run_color_init(uint16_t wNum)
+{
+	bench_segment(wNum, SHIFT_LEFT);
+	led_color_init(rBench, &lBench);
+}
+
+// ==================================================================================
+/**
+ * @brief  One full sweep of the running color, as main.c animates a segment
+ */
+static void run_shift_left_num(uint16_t wNum)
+{
+	bench_segment(wNum, SHIFT_LEFT);
+	while (!led_shift_left_num(rBench, &lBench, SET, BENCH_STEP))
+		;
+}
+
+// ==================================================================================
+static void run_shift_right_num(uint16_t wNum)
+{
+	bench_segment(wNum, SHIFT_RIGHT);
+	while (!led_shift_right_num(rBench, &lBench, SET, BENCH_STEP))
+		;
+}
+
+// ==================================================================================
+static void run_rotate_left(uint16_t wNum)
+{
+	bench_segment(wNum, SHIFT_LEFT);
+	led_rotate_left(rBench, &lBench);
+}
+
+// ==================================================================================
+static void run_rotate_right(uint16_t wNum)
+{
+	bench_segment(wNum, SHIFT_RIGHT);
+	led_rotate_right(rBench, &lBench);
+}
+
+// ==================================================================================
+static void run_ws2812_encode(uint16_t wNum)
+{
+	uint16_t i;
+
+	for (i = 0; i < wNum; i++)
+		ws2812_spi(rBench[i].green, rBench[i].red, rBench[i].blue);
+}
+
+// ==================================================================================
+/**
+ * @brief  Serpentine panel of wNum pixels, the table is only rebuilt on a new size
+ */
+static void bench_matrix(uint16_t wNum)
+{
+	uint8_t ucWidth = wNum >= BENCH_MAT_ROWS ? wNum / BENCH_MAT_ROWS : 1;
+
+	if (mBench.pMap && mBench.ucWidth == ucWidth)
+		return;
+
+	matrix_init(&mBench, wMatMap, ucWidth, BENCH_MAT_ROWS, MATRIX_SERPENTINE, 0);
+	sBench.ucWidth  = ucWidth;
+	sBench.ucHeight = BENCH_MAT_ROWS;
+	sBench.pData    = &rBench[0];
+	sBench.fKey     = SET;
+	sBench.rKey     = COLOR_BLANK;
+}
+
+// ==================================================================================
+static void run_matrix_fill_rect(uint16_t wNum)
+{
+	bench_matrix(wNum);
+	matrix_fill_rect(rBench, &mBench, 0, 0, mBench.ucWidth, mBench.ucHeight, COLOR_BLUE);
+}
+
+// ==================================================================================
+static void run_matrix_scroll_left(uint16_t wNum)
+{
+	bench_matrix(wNum);
+	matrix_scroll_left(rBench, &mBench, COLOR_YELLOW);
+}
+
+// ==================================================================================
+static void run_matrix_scroll_up(uint16_t wNum)
+{
+	bench_matrix(wNum);
+	matrix_scroll_up(rBench, &mBench, COLOR_YELLOW);
+}
+
+// ==================================================================================
+/**
+ * @brief  Keyed blit of a full panel sprite, every pixel is compared
+ */
+static void run_matrix_blit(uint16_t wNum)
+{
+	bench_matrix(wNum);
+	matrix_blit(rBench, &mBench, 0, 0, &sBench);
+}
+
+// ==================================================================================
+/**
+ * @brief  One ticker step with the longest message, costs the same as a short one
+ */
+static void run_text_step(uint16_t wNum)
+{
+	static const uint8_t ucMsg[TEXT_MAX] = "The quick brown fox jumps over the lazy dog 0123456789 !?#%&@$*+";
+
+	static uint8_t ucInit;
+
+	bench_matrix(wNum);
+	if (!ucInit)                                      // The ticker follows mBench through size changes
+	{
+		ucInit = 1;
+		text_init(&mBench, 0, COLOR_BLANK);
+		text_set(ucMsg, TEXT_MAX, COLOR_WHITE);
+	}
+	text_step(rBench);
+}
+
+// ==================================================================================
+/**
+ * @brief  Keeps wNum particles alive, burnt out and escaped ones are respawned
+ */
+static void bench_particles(uint16_t wNum)
+{
+	static uint16_t wLast;
+	uint16_t wRand;
+
+	if (wLast != wNum)
+	{
+		wLast = wNum;
+		particle_init();
+	}
+	while (particle_count() < wNum)
+	{
+		wRand = particle_rand();
+		particle_spawn(wRand % ((uint32_t)wNum << PARTICLE_FRAC), (int8_t)wRand >> 2,
+		               (wRand >> 8) & (SPARK_COLORS - 1), 0xFF, (wRand >> 12) + 1);
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  One step of the pool, respawns included as an emitter would do them
+ */
+static void run_particle_update(uint16_t wNum)
+{
+	bench_particles(wNum);
+	particle_update(wNum, 1);
+}
+
+// ==================================================================================
+static void run_particle_render(uint16_t wNum)
+{
+	bench_particles(wNum);
+	particle_dim(rBench, wNum, 0xC0);
+	particle_render(rBench, wNum, rSparkPal);
+}
+
+// ==================================================================================
+/**
+ * @brief  One frame of the spark effect, bursts come and go as on the strip
+ */
+static void run_particle_spark(uint16_t wNum)
+{
+	static uint16_t wLast;
+
+	if (wLast != wNum)
+	{
+		wLast = wNum;
+		particle_init();
+	}
+	particle_spark(rBench, wNum);
+}
+
+// ==================================================================================
+static void run_noise_fill_1d(uint16_t wNum)
+{
+	noise_fill_1d(ucNoise, wNum, wNoiseT += 97, BENCH_NOISE_STEP, 1);
+}
+
+// ==================================================================================
+static void run_noise_fill_2d(uint16_t wNum)
+{
+	noise_fill_2d(ucNoise, wNum, 0x1234, BENCH_NOISE_STEP, wNoiseT += 97, 1);
+}
+
+// ==================================================================================
+static void run_noise_fill_3d(uint16_t wNum)
+{
+	noise_fill_3d(ucNoise, wNum, 0x1234, BENCH_NOISE_STEP, 0x0880, wNoiseT += 97, 1);
+}
+
+// ==================================================================================
+/**
+ * @brief  Fractal 3D noise, 4 octaves per sample
+ */
+static void run_noise_fbm_3d(uint16_t wNum)
+{
+	noise_fill_3d(ucNoise, wNum, 0x1234, BENCH_NOISE_STEP, 0x0880, wNoiseT += 97, 4);
+}
+
+// ==================================================================================
+/**
+ * @brief  Same samples as noise_fill_3d one call each, shows what the fill saves
+ */
+static void run_noise_3d(uint16_t wNum)
+{
+	uint16_t x = 0x1234, i;
+
+	wNoiseT += 97;
+	for (i = 0; i < wNum; i++, x += BENCH_NOISE_STEP)
+		ucNoise[i] = noise_3d(x, 0x0880, wNoiseT);
+}
+
+static const BenchCaseDef bCase[] = {
+	{ "led_color_init",      run_color_init         },
+	{ "led_shift_left_num",  run_shift_left_num     },
+	{ "led_shift_right_num", run_shift_right_num    },
+	{ "led_rotate_left",     run_rotate_left        },
+	{ "led_rotate_right",    run_rotate_right       },
+	{ "ws2812_encode",       run_ws2812_encode      },
+	{ "matrix_fill_rect",    run_matrix_fill_rect   },
+	{ "matrix_scroll_left",  run_matrix_scroll_left },
+	{ "matrix_scroll_up",    run_matrix_scroll_up   },
+	{ "matrix_blit",         run_matrix_blit        },
+	{ "text_step",           run_text_step          },
+	{ "particle_update",     run_particle_update    },
+	{ "particle_render",     run_particle_render    },
+	{ "particle_spark",      run_particle_spark     },
+	{ "noise_fill_1d",       run_noise_fill_1d      },
+	{ "noise_fill_2d",       run_noise_fill_2d      },
+	{ "noise_fill_3d",       run_noise_fill_3d      },
+	{ "noise_fbm_3d",        run_noise_fbm_3d       },
+	{ "noise_3d",            run_noise_3d           },
+};
+
+#define BENCH_CASES         (sizeof(bCase) / sizeof(bCase[0]))
+
+
+// ==================================================================================
+static double host_ns(void)
+{
+	struct timespec tNow;
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &tNow);
+	return tNow.tv_sec * 1e9 + tNow.tv_nsec;
+}
+
+// ==================================================================================
+/**
+ * @brief  Number of runs that take at least BENCH_BATCH_NS
+ */
+static uint32_t bench_calibrate(const BenchCaseDef *bRun, uint16_t wNum)
+{
+	uint32_t ulIter = 1, i;
+	double   dStart;
+
+	for (;;)
+	{
+		dStart = host_ns();
+		for (i = 0; i < ulIter; i++)
+			bRun->fRun(wNum);
+		if (host_ns() - dStart >= BENCH_BATCH_NS || ulIter >= (1UL << 30))
+			return ulIter;
+		ulIter *= 2;
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Times one batch of ulIter runs
+ * @return ns per pixel
+ */
+static double bench_batch(const BenchCaseDef *bRun, uint16_t wNum, uint32_t ulIter)
+{
+	uint32_t i;
+	double   dStart;
+
+	dStart = host_ns();
+	for (i = 0; i < ulIter; i++)
+		bRun->fRun(wNum);
+	return (host_ns() - dStart) / ulIter / wNum;
+}
+
+// ==================================================================================
+static const BenchCaseDef *bench_find(const char *pName)
+{
+	uint8_t i;
+
+	for (i = 0; i < BENCH_CASES; i++)
+	{
+		if (!strcmp(bCase[i].pName, pName))
+			return &bCase[i];
+	}
+	return NULL;
+}
+
+// ==================================================================================
+int main(int argc, char **argv)
+{
+	const BenchCaseDef *bRun = NULL;
+	const char *pOut = NULL;
+	FILE       *fOut = stdout;
+	uint32_t    ulRuns[BENCH_CASES][BENCH_SIZES];
+	double      dBest[BENCH_CASES][BENCH_SIZES], dTime;
+	uint32_t    ulIter = 0, i, j, r;
+	uint16_t    wNum = 0;
+	int         a;
+
+	for (a = 1; a < argc; a++)
+	{
+		if (!strcmp(argv[a], "-o") && a + 1 < argc)
+			pOut = argv[++a];
+		else if (!strcmp(argv[a], "-r") && a + 1 < argc)
+		{
+			bRun = bench_find(argv[++a]);
+			if (!bRun)
+			{
+				fprintf(stderr, "unknown case %s\n", argv[a]);
+				return 2;
+			}
+		}
+		else if (!strcmp(argv[a], "-n") && a + 1 < argc)
+			wNum = strtoul(argv[++a], NULL, 0);
+		else if (!strcmp(argv[a], "-i") && a + 1 < argc)
+			ulIter = strtoul(argv[++a], NULL, 0);
+		else if (!strcmp(argv[a], "-l"))
+		{
+			for (i = 0; i < BENCH_CASES; i++)
+				printf("%s\n", bCase[i].pName);
+			printf("pixels");
+			for (wNum = BENCH_MIN_LED; wNum <= BENCH_MAX_LED; wNum *= 2)
+				printf(" %u", wNum);
+			printf("\n");
+			return 0;
+		}
+		else
+		{
+			fprintf(stderr, "usage: %s [-o file.csv] | -r case -n pixels -i iterations | -l\n", argv[0]);
+			return 2;
+		}
+	}
+
+	sim_reset();
+	sim_spi_capture(0);
+	for (i = 0; i < BENCH_MAX_LED; i++)
+		rBench[i] = (rgb_color){ i * 7, i * 13, i * 29 };
+
+	if (bRun)                                         // Single case for instruction counting
+	{
+		if (wNum < 2 || wNum > BENCH_MAX_LED)
+		{
+			fprintf(stderr, "pixels must be 2..%u\n", BENCH_MAX_LED);
+			return 2;
+		}
+		for (i = 0; i < ulIter; i++)
+			bRun->fRun(wNum);
+		return 0;
+	}
+
+	if (pOut && !(fOut = fopen(pOut, "w")))
+	{
+		perror(pOut);
+		return 1;
+	}
+
+	// Every pass times each case once and the fastest pass counts, so a slow
+	// phase of the host (frequency scaling, other load) hits all cases alike
+	// instead of a few of them.
+	for (i = 0; i < BENCH_CASES; i++)
+	{
+		for (wNum = BENCH_MIN_LED, j = 0; wNum <= BENCH_MAX_LED; wNum *= 2, j++)
+			ulRuns[i][j] = bench_calibrate(&bCase[i], wNum);
+	}
+
+	for (r = 0; r < BENCH_REPEAT; r++)
+	{
+		for (i = 0; i < BENCH_CASES; i++)
+		{
+			for (wNum = BENCH_MIN_LED, j = 0; wNum <= BENCH_MAX_LED; wNum *= 2, j++)
+			{
+				dTime = bench_batch(&bCase[i], wNum, ulRuns[i][j]);
+				if (!r || dTime < dBest[i][j])
+					dBest[i][j] = dTime;
+			}
+		}
+	}
+
+	fprintf(fOut, "case,pixels,ns_per_pixel\n");
+	for (i = 0; i < BENCH_CASES; i++)
+	{
+		for (wNum = BENCH_MIN_LED, j = 0; wNum <= BENCH_MAX_LED; wNum *= 2, j++)
+			fprintf(fOut, "%s,%u,%.3f\n", bCase[i].pName, wNum, dBest[i][j]);
+	}
+
+	if (fOut != stdout)
+		fclose(fOut);
+	return 0;
+}
@@ -0,0 +1,2075 @@
+/*
+ * dsp_main.c
+ *
+ * Checks the CMSIS-DSP kernels of the host build against the vendored C,
+ * which cmsis_dsp_ref builds under ref_ names (Sim/CMakeLists.txt), and
+ * times both. With DSP_SIMD=OFF both sides are the same code.
+ *
+ *   k3na_dsp [-t ms]    exit status 1 if a kernel fails
+ *     -t ms   time per kernel and side, 0 only checks, default 20
+ *   k3na_dsp -l         lists the cases: index, samples per call, name, size
+ *   k3na_dsp -r index [-s side] [-i iters]
+ *     runs one case iters times (default 1) on side 0 (reference) or 1
+ *     (host kernel, default) and nothing else, for Tools/bench_qemu.py --dsp
+ *
+ * Kernels dsp_x86.c keeps bit exact must match word for word; the others
+ * must stay DSP_SNR_MIN dB above their difference to the reference.
+ *
+ * The mixed radix FFTs have no vendored counterpart. They are checked
+ * against a DFT in double and timed against the power of two transform of
+ * the zero padded input, the one they save. The FFT convolutions are
+ * checked and timed against the direct form they fall back to, which
+ * shows the kernel length ARM_FFT_CONV_MIN_F32/Q15 should be, and the
+ * Q15 ones must keep the precision arm_math.h documents. The
+ * interleaved multichannel filters must match an instance per channel of
+ * the vendored C bit for bit, and are timed against it. The Goertzel and
+ * sliding DFT detectors are checked against a DFT in double and timed
+ * against the RFFT of their block, over the number of bins. The
+ * resamplers must match the vendored interpolator with the samples of the
+ * new rate picked from its output bit for bit, and are timed against it.
+ * The fixed point fast math functions are checked against double within
+ * the error they document, on every q15 input, and timed against the
+ * float libm call they replace.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+#define DSP_SNR_MIN         100.0             // dB, kernels that are not bit exact
+#define DSP_MAX             8192              // Largest buffer, floats or samples
+#define DSP_BLOCKS          3                 // Calls per filter check, the state carries over
+
+// The vendored C, renamed by the cmsis_dsp_ref build
+void       ref_arm_dot_prod_f32            (float32_t *, float32_t *, uint32_t, float32_t *);
+void       ref_arm_dot_prod_q7             (q7_t *, q7_t *, uint32_t, q31_t *);
+void       ref_arm_dot_prod_q15            (q15_t *, q15_t *, uint32_t, q63_t *);
+void       ref_arm_dot_prod_q31            (q31_t *, q31_t *, uint32_t, q63_t *);
+void       ref_arm_fir_f32                 (const arm_fir_instance_f32 *, float32_t *, float32_t *, uint32_t);
+void       ref_arm_fir_q15                 (const arm_fir_instance_q15 *, q15_t *, q15_t *, uint32_t);
+void       ref_arm_fir_q31                 (const arm_fir_instance_q31 *, q31_t *, q31_t *, uint32_t);
+void       ref_arm_biquad_cascade_df2T_f32 (const arm_biquad_cascade_df2T_instance_f32 *, float32_t *, float32_t *, uint32_t);
+void       ref_arm_biquad_cascade_df1_q15  (const arm_biquad_casd_df1_inst_q15 *, q15_t *, q15_t *, uint32_t);
+void       ref_arm_biquad_cascade_df1_q31  (const arm_biquad_casd_df1_inst_q31 *, q31_t *, q31_t *, uint32_t);
+arm_status ref_arm_mat_mult_f32            (const arm_matrix_instance_f32 *, const arm_matrix_instance_f32 *, arm_matrix_instance_f32 *);
+void       ref_arm_cfft_f32                (const arm_cfft_instance_f32 *, float32_t *, uint8_t, uint8_t);
+
+typedef struct
+{
+	const char *pName;
+	char        cSize[32];                    // Case size for the report
+	uint8_t     ucExact;                      // 1 = bit exact required
+	double      dSnrMin;                      // dB, 0 = DSP_SNR_MIN
+	uint32_t    ulSamples;                    // Per call, for ns per sample
+	void      (*pRun)(void *, uint8_t);       // Runs one call, 0 = reference, 1 = host kernel
+	void       *pArg;
+} DspCaseDef;
+
+static uint32_t ulSeed = 12345;
+static uint32_t ulTimeMs = 20;
+static uint32_t ulFail;
+static uint32_t ulCase;                           // Index of the next case
+static uint8_t  ucList;                           // -l
+static int32_t  lRunCase = -1;                    // -r, -1 = check all
+static uint8_t  ucRunSide = 1;
+static uint32_t ulRunIters = 1;
+
+static float32_t fBufA[2][DSP_MAX], fBufB[2][DSP_MAX], fBufC[2][DSP_MAX];
+static q15_t     qBufA[2][DSP_MAX], qBufB[2][DSP_MAX];
+static q31_t     lBufA[2][DSP_MAX], lBufB[2][DSP_MAX];
+
+
+// ==================================================================================
+static uint32_t dsp_rand(void)
+{
+	ulSeed = ulSeed * 1664525U + 1013904223U;
+	return ulSeed >> 8;
+}
+
+static float dsp_randf(void)
+{
+	return (float)dsp_rand() / (1 << 23) * 2.0f - 1.0f;
+}
+
+static double dsp_ns(void)
+{
+	struct timespec tNow;
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &tNow);
+	return tNow.tv_sec * 1e9 + tNow.tv_nsec;
+}
+
+// ==================================================================================
+static double dsp_snr(const float32_t *pRef, const float32_t *pOut, uint32_t ulNum)
+{
+	double dSig = 0, dErr = 0;
+	uint32_t i;
+
+	for (i = 0; i < ulNum; i++)
+	{
+		dSig += (double)pRef[i] * pRef[i];
+		dErr += ((double)pRef[i] - pOut[i]) * ((double)pRef[i] - pOut[i]);
+	}
+	if (dErr == 0)
+		return INFINITY;
+	return 10 * log10(dSig / dErr);
+}
+
+// ==================================================================================
+static double dsp_time(DspCaseDef *c, uint8_t ucSide)
+{
+	double   dStart = dsp_ns(), dNow;
+	uint32_t ulRuns = 0, ulBatch = 1, i;
+
+	// Batches grow so reading the clock stays out of the time of short calls
+	do
+	{
+		for (i = 0; i < ulBatch; i++)
+			c->pRun(c->pArg, ucSide);
+		ulRuns += ulBatch;
+		ulBatch *= 2;
+		dNow = dsp_ns();
+	} while (dNow - dStart < ulTimeMs * 1e6);
+	return (dNow - dStart) / ulRuns / c->ulSamples;
+}
+
+// ==================================================================================
+/**
+ * @brief  Reports one case
+ * @param  pRef, pOut  Results of both sides, ulBytes long
+ */
+static void dsp_report(DspCaseDef *c, const void *pRef, const void *pOut, uint32_t ulBytes)
+{
+	double   dSnr = 0, dRef, dOut;
+	int      iOk;
+	uint32_t i;
+
+	// -l and -r only count the cases; -r leaves at the one it runs
+	if (ucList)
+	{
+		printf("%u %u %s %s\n", ulCase++, c->ulSamples, c->pName, c->cSize);
+		return;
+	}
+	if (lRunCase >= 0)
+	{
+		if (ulCase++ == (uint32_t)lRunCase)
+		{
+			for (i = 0; i < ulRunIters; i++)
+				c->pRun(c->pArg, ucRunSide);
+			exit(0);
+		}
+		return;
+	}
+
+	if (c->ucExact)
+		iOk = memcmp(pRef, pOut, ulBytes) == 0;
+	else
+	{
+		dSnr = dsp_snr(pRef, pOut, ulBytes / sizeof(float32_t));
+		iOk  = dSnr >= (c->dSnrMin ? c->dSnrMin : DSP_SNR_MIN);
+	}
+	if (!iOk)
+		ulFail++;
+
+	printf("%-28s %-24s %s", c->pName, c->cSize, iOk ? "PASS" : "FAIL");
+	if (c->ucExact)
+		printf("  exact    ");
+	else
+		printf("  %5.1f dB ", dSnr);
+
+	if (ulTimeMs)
+	{
+		dRef = dsp_time(c, 0);
+		dOut = dsp_time(c, 1);
+		printf("  ref %8.2f  host %8.2f ns/sample  x%.2f", dRef, dOut, dRef / dOut);
+	}
+	printf("\n");
+}
+
+
+// ==================================================================================
+//  Dot products
+// ==================================================================================
+
+typedef struct
+{
+	uint32_t  ulNum;
+	float32_t fOut[2];
+	q63_t     llOut[2];
+	q31_t     lOut[2];
+} DotArgDef;
+
+static void run_dot_f32(void *p, uint8_t s)
+{
+	DotArgDef *d = p;
+
+	(s ? arm_dot_prod_f32 : ref_arm_dot_prod_f32)(fBufA[0], fBufB[0], d->ulNum, &d->fOut[s]);
+}
+
+static void run_dot_q15(void *p, uint8_t s)
+{
+	DotArgDef *d = p;
+
+	(s ? arm_dot_prod_q15 : ref_arm_dot_prod_q15)(qBufA[0], qBufB[0], d->ulNum, &d->llOut[s]);
+}
+
+static void run_dot_q31(void *p, uint8_t s)
+{
+	DotArgDef *d = p;
+
+	(s ? arm_dot_prod_q31 : ref_arm_dot_prod_q31)((q31_t *)fBufA[0], (q31_t *)fBufB[0], d->ulNum, &d->llOut[s]);
+}
+
+static void run_dot_q7(void *p, uint8_t s)
+{
+	DotArgDef *d = p;
+
+	(s ? arm_dot_prod_q7 : ref_arm_dot_prod_q7)((q7_t *)qBufA[0], (q7_t *)qBufB[0], d->ulNum, &d->lOut[s]);
+}
+
+// ==================================================================================
+static void dsp_dot(void)
+{
+	static const uint32_t ulSize[] = { 7, 64, 1000, 4099 };
+	DotArgDef  d;
+	DspCaseDef c = { 0 };
+	uint32_t   i, n;
+	int32_t   *pA = (int32_t *)fBufA[0], *pB = (int32_t *)fBufB[0];
+
+	for (i = 0; i < sizeof(ulSize) / sizeof(ulSize[0]); i++)
+	{
+		d.ulNum = ulSize[i];
+		c.pArg  = &d;
+		c.ulSamples = d.ulNum;
+		snprintf(c.cSize, sizeof(c.cSize), "n %u", d.ulNum);
+
+		for (n = 0; n < d.ulNum; n++)
+		{
+			fBufA[0][n] = dsp_randf();
+			fBufB[0][n] = dsp_randf();
+		}
+		c.pName = "arm_dot_prod_f32"; c.ucExact = 0; c.pRun = run_dot_f32;
+		run_dot_f32(&d, 0);
+		run_dot_f32(&d, 1);
+		dsp_report(&c, &d.fOut[0], &d.fOut[1], sizeof(float32_t));
+
+		// Full scale runs hit the pmaddwd and shift corner cases
+		for (n = 0; n < d.ulNum; n++)
+		{
+			qBufA[0][n] = (n & 8) ? -32768 : (q15_t)dsp_rand();
+			qBufB[0][n] = (n & 8) ? -32768 : (q15_t)dsp_rand();
+			pA[n] = (n & 8) ? INT32_MIN : (int32_t)(dsp_rand() << 8);
+			pB[n] = (n & 8) ? INT32_MIN : (int32_t)(dsp_rand() << 8);
+		}
+		c.pName = "arm_dot_prod_q15"; c.ucExact = 1; c.pRun = run_dot_q15;
+		run_dot_q15(&d, 0);
+		run_dot_q15(&d, 1);
+		dsp_report(&c, &d.llOut[0], &d.llOut[1], sizeof(q63_t));
+
+		c.pName = "arm_dot_prod_q31"; c.pRun = run_dot_q31;
+		run_dot_q31(&d, 0);
+		run_dot_q31(&d, 1);
+		dsp_report(&c, &d.llOut[0], &d.llOut[1], sizeof(q63_t));
+
+		c.pName = "arm_dot_prod_q7"; c.pRun = run_dot_q7;
+		run_dot_q7(&d, 0);
+		run_dot_q7(&d, 1);
+		dsp_report(&c, &d.lOut[0], &d.lOut[1], sizeof(q31_t));
+	}
+}
+
+
+// ==================================================================================
+//  FIR
+// ==================================================================================
+
+typedef struct
+{
+	uint16_t  wTaps;
+	uint32_t  ulBlock;
+	float32_t fCoef[256], fState[2][256 + DSP_MAX];
+	q15_t     qCoef[256], qState[2][256 + DSP_MAX];
+	q15_t     qCoefS[256], qStateS[2][256 + DSP_MAX];   // sum of |c| below 1
+	q31_t     lCoef[256], lState[2][256 + DSP_MAX];
+	arm_fir_instance_f32 sF32[2];
+	arm_fir_instance_q15 sQ15[2], sQ15S[2];
+	arm_fir_instance_q31 sQ31[2];
+} FirArgDef;
+
+static void run_fir_f32(void *p, uint8_t s)
+{
+	FirArgDef *f = p;
+
+	(s ? arm_fir_f32 : ref_arm_fir_f32)(&f->sF32[s], fBufA[0], fBufC[s], f->ulBlock);
+}
+
+static void run_fir_q15(void *p, uint8_t s)
+{
+	FirArgDef *f = p;
+
+	(s ? arm_fir_q15 : ref_arm_fir_q15)(&f->sQ15[s], qBufA[0], qBufB[s], f->ulBlock);
+}
+
+static void run_fir_q15s(void *p, uint8_t s)
+{
+	FirArgDef *f = p;
+
+	(s ? arm_fir_q15 : ref_arm_fir_q15)(&f->sQ15S[s], qBufA[0], qBufB[s], f->ulBlock);
+}
+
+static void run_fir_q31(void *p, uint8_t s)
+{
+	FirArgDef *f = p;
+
+	(s ? arm_fir_q31 : ref_arm_fir_q31)(&f->sQ31[s], (q31_t *)fBufA[1], (q31_t *)fBufB[s], f->ulBlock);
+}
+
+// ==================================================================================
+static void dsp_fir(void)
+{
+	static const uint16_t wTaps[]  = { 5, 32, 63 };
+	static const uint32_t ulBlock[] = { 1, 13, 64, 1000 };
+	static FirArgDef f;
+	DspCaseDef c = { 0 };
+	uint32_t   i, k, b, s, n, ulDiffF, ulDiffQ, ulDiffS, ulDiffL;
+	q31_t     *pIn = (q31_t *)fBufA[1];
+
+	for (i = 0; i < sizeof(wTaps) / sizeof(wTaps[0]); i++)
+		for (k = 0; k < sizeof(ulBlock) / sizeof(ulBlock[0]); k++)
+		{
+			f.wTaps   = wTaps[i];
+			f.ulBlock = ulBlock[k];
+			for (n = 0; n < f.wTaps; n++)
+			{
+				f.fCoef[n]  = dsp_randf() / f.wTaps;
+				f.qCoef[n]  = (n == 0) ? -32768 : (q15_t)(dsp_rand() >> 2);
+				f.qCoefS[n] = (q15_t)dsp_rand() / f.wTaps;
+				f.lCoef[n]  = (n == 0) ? INT32_MIN : (q31_t)(dsp_rand() << 8);
+			}
+			for (s = 0; s < 2; s++)
+			{
+				arm_fir_init_f32(&f.sF32[s], f.wTaps, f.fCoef, f.fState[s], f.ulBlock);
+				arm_fir_init_q15(&f.sQ15[s], f.wTaps, f.qCoef, f.qState[s], f.ulBlock);
+				arm_fir_init_q15(&f.sQ15S[s], f.wTaps, f.qCoefS, f.qStateS[s], f.ulBlock);
+				arm_fir_init_q31(&f.sQ31[s], f.wTaps, f.lCoef, f.lState[s], f.ulBlock);
+			}
+
+			// Several calls so the state handover is checked as well
+			ulDiffF = ulDiffQ = ulDiffS = ulDiffL = 0;
+			for (b = 0; b < DSP_BLOCKS; b++)
+			{
+				for (n = 0; n < f.ulBlock; n++)
+				{
+					fBufA[0][n] = dsp_randf();
+					qBufA[0][n] = (n & 4) ? -32768 : (q15_t)dsp_rand();
+					pIn[n]      = (n & 4) ? INT32_MIN : (q31_t)(dsp_rand() << 8);
+				}
+				for (s = 0; s < 2; s++)
+					run_fir_f32(&f, s);
+				ulDiffF += memcmp(fBufC[0], fBufC[1], f.ulBlock * sizeof(float32_t)) != 0;
+				for (s = 0; s < 2; s++)
+					run_fir_q15(&f, s);
+				ulDiffQ += memcmp(qBufB[0], qBufB[1], f.ulBlock * sizeof(q15_t)) != 0;
+				for (s = 0; s < 2; s++)
+					run_fir_q15s(&f, s);
+				ulDiffS += memcmp(qBufB[0], qBufB[1], f.ulBlock * sizeof(q15_t)) != 0;
+				for (s = 0; s < 2; s++)
+					run_fir_q31(&f, s);
+				ulDiffL += memcmp(fBufB[0], fBufB[1], f.ulBlock * sizeof(q31_t)) != 0;
+			}
+			ulDiffF += memcmp(f.fState[0], f.fState[1], (f.wTaps - 1) * sizeof(float32_t)) != 0;
+			ulDiffQ += memcmp(f.qState[0], f.qState[1], (f.wTaps - 1) * sizeof(q15_t)) != 0;
+			ulDiffS += memcmp(f.qStateS[0], f.qStateS[1], (f.wTaps - 1) * sizeof(q15_t)) != 0;
+			ulDiffL += memcmp(f.lState[0], f.lState[1], (f.wTaps - 1) * sizeof(q31_t)) != 0;
+
+			c.pArg = &f;
+			c.ulSamples = f.ulBlock;
+			c.ucExact = 1;
+			snprintf(c.cSize, sizeof(c.cSize), "taps %u block %u", f.wTaps, f.ulBlock);
+
+			c.pName = "arm_fir_f32"; c.pRun = run_fir_f32;
+			dsp_report(&c, &ulDiffF, &(uint32_t){0}, sizeof(uint32_t));
+			c.pName = "arm_fir_q15"; c.pRun = run_fir_q15;
+			dsp_report(&c, &ulDiffQ, &(uint32_t){0}, sizeof(uint32_t));
+			c.pName = "arm_fir_q31"; c.pRun = run_fir_q31;
+			dsp_report(&c, &ulDiffL, &(uint32_t){0}, sizeof(uint32_t));
+
+			// Gain below 1, the usual filter: the q15 sum stays in 32 bits
+			snprintf(c.cSize, sizeof(c.cSize), "taps %u block %u gain<1", f.wTaps, f.ulBlock);
+			c.pName = "arm_fir_q15"; c.pRun = run_fir_q15s;
+			dsp_report(&c, &ulDiffS, &(uint32_t){0}, sizeof(uint32_t));
+		}
+}
+
+
+// ==================================================================================
+//  Biquad cascade
+// ==================================================================================
+
+typedef struct
+{
+	uint8_t   ucStages;
+	uint32_t  ulBlock;
+	float32_t fCoef[5 * 16], fState[2][2 * 16];
+	arm_biquad_cascade_df2T_instance_f32 sIir[2];
+} IirArgDef;
+
+static void run_iir(void *p, uint8_t s)
+{
+	IirArgDef *f = p;
+
+	(s ? arm_biquad_cascade_df2T_f32 : ref_arm_biquad_cascade_df2T_f32)(&f->sIir[s], fBufA[s], fBufC[s], f->ulBlock);
+}
+
+// ==================================================================================
+static void dsp_iir(void)
+{
+	static const uint8_t  ucStages[] = { 1, 3, 4, 9 };
+	static const uint32_t ulBlock[]  = { 1, 200 };
+	static IirArgDef f;
+	DspCaseDef c = { 0 };
+	uint32_t   i, k, b, s, n, ulDiff;
+	float      fR, fW;
+
+	for (i = 0; i < sizeof(ucStages) / sizeof(ucStages[0]); i++)
+		for (k = 0; k < sizeof(ulBlock) / sizeof(ulBlock[0]); k++)
+		{
+			f.ucStages = ucStages[i];
+			f.ulBlock  = ulBlock[k];
+
+			// Stable sections: poles at radius fR, angle fW
+			for (n = 0; n < f.ucStages; n++)
+			{
+				fR = 0.5f + 0.45f * (dsp_randf() + 1) / 2;
+				fW = 3.1f * (dsp_randf() + 1) / 2;
+				f.fCoef[5 * n]     = 0.3f * dsp_randf();
+				f.fCoef[5 * n + 1] = 0.3f * dsp_randf();
+				f.fCoef[5 * n + 2] = 0.3f * dsp_randf();
+				f.fCoef[5 * n + 3] = 2 * fR * cosf(fW);
+				f.fCoef[5 * n + 4] = -fR * fR;
+			}
+			for (s = 0; s < 2; s++)
+				arm_biquad_cascade_df2T_init_f32(&f.sIir[s], f.ucStages, f.fCoef, f.fState[s]);
+
+			ulDiff = 0;
+			for (b = 0; b < DSP_BLOCKS; b++)
+			{
+				for (n = 0; n < f.ulBlock; n++)
+					fBufA[0][n] = fBufA[1][n] = dsp_randf();
+				for (s = 0; s < 2; s++)
+					run_iir(&f, s);
+				ulDiff += memcmp(fBufC[0], fBufC[1], f.ulBlock * sizeof(float32_t)) != 0;
+			}
+			ulDiff += memcmp(f.fState[0], f.fState[1], 2 * f.ucStages * sizeof(float32_t)) != 0;
+
+			c.pName = "arm_biquad_cascade_df2T_f32";
+			c.pRun = run_iir;
+			c.pArg = &f;
+			c.ulSamples = f.ulBlock;
+			c.ucExact = 1;
+			snprintf(c.cSize, sizeof(c.cSize), "stages %u block %u", f.ucStages, f.ulBlock);
+			dsp_report(&c, &ulDiff, &(uint32_t){0}, sizeof(uint32_t));
+		}
+}
+
+
+// ==================================================================================
+//  Biquad cascade, direct form I, fixed point
+// ==================================================================================
+
+typedef struct
+{
+	uint8_t   ucStages;
+	uint32_t  ulBlock;
+	q15_t     qCoef[6 * 16], qState[2][4 * 16];
+	q31_t     lCoef[5 * 16], lState[2][4 * 16];
+	arm_biquad_casd_df1_inst_q15 sQ15[2];
+	arm_biquad_casd_df1_inst_q31 sQ31[2];
+} Df1ArgDef;
+
+static void run_df1_q15(void *p, uint8_t s)
+{
+	Df1ArgDef *f = p;
+
+	(s ? arm_biquad_cascade_df1_q15 : ref_arm_biquad_cascade_df1_q15)(&f->sQ15[s], qBufA[0], qBufB[s], f->ulBlock);
+}
+
+static void run_df1_q31(void *p, uint8_t s)
+{
+	Df1ArgDef *f = p;
+
+	(s ? arm_biquad_cascade_df1_q31 : ref_arm_biquad_cascade_df1_q31)(&f->sQ31[s], (q31_t *)fBufA[0], (q31_t *)fBufC[s], f->ulBlock);
+}
+
+// ==================================================================================
+static void dsp_df1(void)
+{
+	static const uint8_t  ucStages[] = { 1, 3, 4 };
+	static const uint32_t ulBlock[]  = { 1, 13, 200 };
+	static Df1ArgDef f;
+	DspCaseDef c = { 0 };
+	uint32_t   i, k, b, s, n, ulFull, ulDiffQ, ulDiffL;
+	q31_t     *pIn = (q31_t *)fBufA[0];
+	float      fR, fW, fCoef[5];
+
+	for (i = 0; i < sizeof(ucStages) / sizeof(ucStages[0]); i++)
+		for (k = 0; k < sizeof(ulBlock) / sizeof(ulBlock[0]); k++)
+			for (ulFull = 0; ulFull < 2; ulFull++)
+			{
+				f.ucStages = ucStages[i];
+				f.ulBlock  = ulBlock[k];
+
+				// Stable sections in 2.14 and 2.30 with postShift 1, or full
+				// scale coefficients that saturate with postShift 0
+				for (n = 0; n < f.ucStages; n++)
+				{
+					fR = 0.5f + 0.45f * (dsp_randf() + 1) / 2;
+					fW = 3.1f * (dsp_randf() + 1) / 2;
+					fCoef[0] = 0.3f * dsp_randf();
+					fCoef[1] = 0.3f * dsp_randf();
+					fCoef[2] = 0.3f * dsp_randf();
+					fCoef[3] = 2 * fR * cosf(fW);
+					fCoef[4] = -fR * fR;
+					for (b = 0; b < 5; b++)
+					{
+						f.qCoef[6 * n + b + (b > 0)] = ulFull ? (q15_t)dsp_rand() : (q15_t)(fCoef[b] * 16384);
+						f.lCoef[5 * n + b] = ulFull ? (q31_t)(dsp_rand() << 8) : (q31_t)(fCoef[b] * 1073741824.0f);
+					}
+					f.qCoef[6 * n + 1] = 0;
+				}
+				for (s = 0; s < 2; s++)
+				{
+					arm_biquad_cascade_df1_init_q15(&f.sQ15[s], f.ucStages, f.qCoef, f.qState[s], !ulFull);
+					arm_biquad_cascade_df1_init_q31(&f.sQ31[s], f.ucStages, f.lCoef, f.lState[s], !ulFull);
+				}
+
+				ulDiffQ = ulDiffL = 0;
+				for (b = 0; b < DSP_BLOCKS; b++)
+				{
+					for (n = 0; n < f.ulBlock; n++)
+					{
+						qBufA[0][n] = (n & 4) ? -32768 : (q15_t)dsp_rand();
+						pIn[n]      = (n & 4) ? INT32_MIN : (q31_t)(dsp_rand() << 8);
+					}
+					for (s = 0; s < 2; s++)
+					{
+						run_df1_q15(&f, s);
+						run_df1_q31(&f, s);
+					}
+					ulDiffQ += memcmp(qBufB[0], qBufB[1], f.ulBlock * sizeof(q15_t)) != 0;
+					ulDiffL += memcmp(fBufC[0], fBufC[1], f.ulBlock * sizeof(q31_t)) != 0;
+				}
+				ulDiffQ += memcmp(f.qState[0], f.qState[1], 4 * f.ucStages * sizeof(q15_t)) != 0;
+				ulDiffL += memcmp(f.lState[0], f.lState[1], 4 * f.ucStages * sizeof(q31_t)) != 0;
+
+				c.pArg = &f;
+				c.ulSamples = f.ulBlock;
+				c.ucExact = 1;
+				snprintf(c.cSize, sizeof(c.cSize), "stages %u block %u%s", f.ucStages, f.ulBlock, ulFull ? " full" : "");
+
+				c.pName = "arm_biquad_cascade_df1_q15"; c.pRun = run_df1_q15;
+				dsp_report(&c, &ulDiffQ, &(uint32_t){0}, sizeof(uint32_t));
+				c.pName = "arm_biquad_cascade_df1_q31"; c.pRun = run_df1_q31;
+				dsp_report(&c, &ulDiffL, &(uint32_t){0}, sizeof(uint32_t));
+			}
+}
+
+
+// ==================================================================================
+//  Matrix multiply
+// ==================================================================================
+
+typedef struct
+{
+	arm_matrix_instance_f32 mA, mB, mC[2];
+} MatArgDef;
+
+static void run_mat(void *p, uint8_t s)
+{
+	MatArgDef *m = p;
+
+	(s ? arm_mat_mult_f32 : ref_arm_mat_mult_f32)(&m->mA, &m->mB, &m->mC[s]);
+}
+
+// ==================================================================================
+static void dsp_mat(void)
+{
+	static const uint16_t wDim[][3] = { {3, 5, 7}, {16, 16, 16}, {33, 40, 37}, {64, 64, 64} };
+	MatArgDef  m;
+	DspCaseDef c = { 0 };
+	uint32_t   i, n;
+
+	for (i = 0; i < sizeof(wDim) / sizeof(wDim[0]); i++)
+	{
+		arm_mat_init_f32(&m.mA, wDim[i][0], wDim[i][1], fBufA[0]);
+		arm_mat_init_f32(&m.mB, wDim[i][1], wDim[i][2], fBufB[0]);
+		arm_mat_init_f32(&m.mC[0], wDim[i][0], wDim[i][2], fBufC[0]);
+		arm_mat_init_f32(&m.mC[1], wDim[i][0], wDim[i][2], fBufC[1]);
+		for (n = 0; n < (uint32_t)wDim[i][0] * wDim[i][1]; n++)
+			fBufA[0][n] = dsp_randf();
+		for (n = 0; n < (uint32_t)wDim[i][1] * wDim[i][2]; n++)
+			fBufB[0][n] = dsp_randf();
+		run_mat(&m, 0);
+		run_mat(&m, 1);
+
+		c.pName = "arm_mat_mult_f32";
+		c.pRun = run_mat;
+		c.pArg = &m;
+		c.ulSamples = (uint32_t)wDim[i][0] * wDim[i][2];
+		c.ucExact = 1;
+		snprintf(c.cSize, sizeof(c.cSize), "%ux%u * %ux%u", wDim[i][0], wDim[i][1], wDim[i][1], wDim[i][2]);
+		dsp_report(&c, fBufC[0], fBufC[1], c.ulSamples * sizeof(float32_t));
+	}
+}
+
+
+// ==================================================================================
+//  Complex FFT
+// ==================================================================================
+
+typedef struct
+{
+	const arm_cfft_instance_f32 *pInst;
+	uint8_t ucInverse, ucBitRev;
+} FftArgDef;
+
+static void run_fft(void *p, uint8_t s)
+{
+	FftArgDef *f = p;
+
+	// From the same input on every run, repeated transforms would overflow
+	memcpy(fBufC[s], fBufA[0], 2U * f->pInst->fftLen * sizeof(float32_t));
+	(s ? arm_cfft_f32 : ref_arm_cfft_f32)(f->pInst, fBufC[s], f->ucInverse, f->ucBitRev);
+}
+
+// ==================================================================================
+static void dsp_fft(void)
+{
+	static const arm_cfft_instance_f32 *pInst[] = {
+		&arm_cfft_sR_f32_len16,  &arm_cfft_sR_f32_len32,   &arm_cfft_sR_f32_len64,
+		&arm_cfft_sR_f32_len128, &arm_cfft_sR_f32_len256,  &arm_cfft_sR_f32_len512,
+		&arm_cfft_sR_f32_len1024, &arm_cfft_sR_f32_len2048, &arm_cfft_sR_f32_len4096,
+	};
+	FftArgDef  f;
+	DspCaseDef c = { 0 };
+	uint32_t   i, k, n;
+
+	for (i = 0; i < sizeof(pInst) / sizeof(pInst[0]); i++)
+		for (k = 0; k < 3; k++)
+		{
+			f.pInst     = pInst[i];
+			f.ucInverse = k == 1;
+			f.ucBitRev  = k != 2;
+			for (n = 0; n < 2U * f.pInst->fftLen; n++)
+				fBufA[0][n] = dsp_randf();
+			run_fft(&f, 0);
+			run_fft(&f, 1);
+
+			c.pName = "arm_cfft_f32";
+			c.pRun = run_fft;
+			c.pArg = &f;
+			c.ulSamples = f.pInst->fftLen;
+			c.ucExact = 0;
+			snprintf(c.cSize, sizeof(c.cSize), "%s %u%s", f.ucInverse ? "inverse" : "forward",
+			         f.pInst->fftLen, f.ucBitRev ? "" : " no bitrev");
+			dsp_report(&c, fBufC[0], fBufC[1], 2U * f.pInst->fftLen * sizeof(float32_t));
+		}
+}
+
+
+// ==================================================================================
+//  Mixed radix FFT
+// ==================================================================================
+
+#define DSP_MIX_MAX         240               // Longest mixed radix case
+
+typedef struct
+{
+	uint16_t wLen, wPow;                      // Mixed radix length, power of two above it
+	uint8_t  ucReal, ucInverse;
+	arm_cfft_mixed_instance_f32  tCfftF32;
+	arm_cfft_mixed_instance_q15  tCfftQ15;
+	arm_cfft_mixed_instance_q31  tCfftQ31;
+	arm_rfft_mixed_instance_f32  tRfftF32;
+	arm_rfft_mixed_instance_q15  tRfftQ15;
+	arm_rfft_mixed_instance_q31  tRfftQ31;
+	arm_rfft_fast_instance_f32   tPowF32;     // The power of two side
+	arm_rfft_instance_q15        tPowQ15;
+	arm_rfft_instance_q31        tPowQ31;
+} MixArgDef;
+
+// Values per transform, real or complex, and zero padded on side 0
+#define MIX_IN(m)       ((m)->ucReal ? (m)->wLen : 2U * (m)->wLen)
+#define MIX_POW(m)      ((m)->ucReal ? (m)->wPow : 2U * (m)->wPow)
+
+static void run_mix_f32(void *p, uint8_t s)
+{
+	MixArgDef *m = p;
+
+	memcpy(fBufC[s], fBufA[0], MIX_IN(m) * sizeof(float32_t));
+	if (s)
+	{
+		if (m->ucReal)
+			arm_rfft_mixed_f32(&m->tRfftF32, fBufC[1], fBufC[1], m->ucInverse);
+		else
+			arm_cfft_mixed_f32(&m->tCfftF32, fBufC[1], m->ucInverse);
+		return;
+	}
+	memset(fBufC[0] + MIX_IN(m), 0, (MIX_POW(m) - MIX_IN(m)) * sizeof(float32_t));
+	if (m->ucReal)
+		arm_rfft_fast_f32(&m->tPowF32, fBufC[0], fBufB[0], m->ucInverse);
+	else
+		arm_cfft_f32(m->wPow == 128 ? &arm_cfft_sR_f32_len128 : &arm_cfft_sR_f32_len256,
+		             fBufC[0], m->ucInverse, 1);
+}
+
+static void run_mix_q15(void *p, uint8_t s)
+{
+	MixArgDef *m = p;
+
+	memcpy(qBufB[s], qBufA[0], MIX_IN(m) * sizeof(q15_t));
+	if (s)
+	{
+		if (m->ucReal)
+			arm_rfft_mixed_q15(&m->tRfftQ15, qBufB[1], qBufB[1], m->ucInverse);
+		else
+			arm_cfft_mixed_q15(&m->tCfftQ15, qBufB[1], m->ucInverse);
+		return;
+	}
+	memset(qBufB[0] + MIX_IN(m), 0, (MIX_POW(m) - MIX_IN(m)) * sizeof(q15_t));
+	if (m->ucReal)
+		arm_rfft_q15(&m->tPowQ15, qBufB[0], qBufA[1]);
+	else
+		arm_cfft_q15(m->wPow == 128 ? &arm_cfft_sR_q15_len128 : &arm_cfft_sR_q15_len256,
+		             qBufB[0], m->ucInverse, 1);
+}
+
+static void run_mix_q31(void *p, uint8_t s)
+{
+	MixArgDef *m = p;
+
+	memcpy(lBufB[s], lBufA[0], MIX_IN(m) * sizeof(q31_t));
+	if (s)
+	{
+		if (m->ucReal)
+			arm_rfft_mixed_q31(&m->tRfftQ31, lBufB[1], lBufB[1], m->ucInverse);
+		else
+			arm_cfft_mixed_q31(&m->tCfftQ31, lBufB[1], m->ucInverse);
+		return;
+	}
+	memset(lBufB[0] + MIX_IN(m), 0, (MIX_POW(m) - MIX_IN(m)) * sizeof(q31_t));
+	if (m->ucReal)
+		arm_rfft_q31(&m->tPowQ31, lBufB[0], lBufA[1]);
+	else
+		arm_cfft_q31(m->wPow == 128 ? &arm_cfft_sR_q31_len128 : &arm_cfft_sR_q31_len256,
+		             lBufB[0], m->ucInverse, 1);
+}
+
+// ==================================================================================
+/**
+ * @brief  DFT in double, of ulLen complex or real values
+ * @param  iSign   -1 forward, 1 inverse
+ * @note   Real input gives the packed half spectrum of arm_rfft_fast_f32
+ */
+static void dsp_dft(const float32_t *pIn, float32_t *pOut, uint32_t ulLen, uint8_t ucReal,
+                    int iSign, double dScale)
+{
+	uint32_t k, n, ulBins = ucReal ? ulLen / 2U + 1U : ulLen;
+	double   dA, dRe, dIm, dXr, dXi;
+
+	for (k = 0; k < ulBins; k++)
+	{
+		dRe = dIm = 0;
+		for (n = 0; n < ulLen; n++)
+		{
+			dA  = iSign * 2 * M_PI * (double)(n * k % ulLen) / ulLen;
+			dXr = ucReal ? pIn[n] : pIn[2 * n];
+			dXi = ucReal ? 0 : pIn[2 * n + 1];
+			dRe += dXr * cos(dA) - dXi * sin(dA);
+			dIm += dXr * sin(dA) + dXi * cos(dA);
+		}
+		if (ucReal && k == 0)
+			pOut[0] = dRe * dScale;
+		else if (ucReal && k == ulLen / 2U)
+			pOut[1] = dRe * dScale;
+		else
+		{
+			pOut[2 * k]     = dRe * dScale;
+			pOut[2 * k + 1] = dIm * dScale;
+		}
+	}
+}
+
+// ==================================================================================
+static void dsp_mixed(void)
+{
+	static const uint16_t wLen[] = { 80, 96, 120, 240 };
+	static const struct
+	{
+		const char *pName;
+		uint8_t     ucType, ucReal, ucInverse; // Type 0 f32, 1 q15, 2 q31
+		double      dSnrMin;
+	} tKind[] = {
+		{ "arm_cfft_mixed_f32", 0, 0, 0, 0 },   { "arm_cfft_mixed_f32", 0, 0, 1, 0 },
+		{ "arm_rfft_mixed_f32", 0, 1, 0, 0 },   { "arm_rfft_mixed_f32", 0, 1, 1, 0 },
+		{ "arm_cfft_mixed_q15", 1, 0, 0, 50 },  { "arm_rfft_mixed_q15", 1, 1, 0, 50 },
+		{ "arm_cfft_mixed_q31", 2, 0, 0, 120 }, { "arm_rfft_mixed_q31", 2, 1, 0, 120 },
+	};
+	static float32_t fTwid[2 * DSP_MIX_MAX];
+	static q15_t     qTwid[2 * DSP_MIX_MAX];
+	static q31_t     lTwid[2 * DSP_MIX_MAX];
+	static uint16_t  wCycles[DSP_MIX_MAX];
+	static MixArgDef m;
+	DspCaseDef c = { 0 };
+	uint32_t   i, k, n, ulIn;
+	double     dScale;
+
+	for (i = 0; i < sizeof(wLen) / sizeof(wLen[0]); i++)
+		for (k = 0; k < sizeof(tKind) / sizeof(tKind[0]); k++)
+		{
+			m.wLen      = wLen[i];
+			m.wPow      = wLen[i] > 128 ? 256 : 128;
+			m.ucReal    = tKind[k].ucReal;
+			m.ucInverse = tKind[k].ucInverse;
+			ulIn        = MIX_IN(&m);
+
+			// Fixed point transforms scale by 1/N, inverse ones are the true inverse
+			dScale = tKind[k].ucType || m.ucInverse ? 1.0 / m.wLen : 1.0;
+			for (n = 0; n < ulIn; n++)
+				fBufA[0][n] = 0.5f * dsp_randf();
+			if (tKind[k].ucType == 1)
+				for (n = 0; n < ulIn; n++)
+				{
+					qBufA[0][n] = (q15_t)lrintf(fBufA[0][n] * 32768.0f);
+					fBufA[0][n] = qBufA[0][n] / 32768.0f;
+				}
+			if (tKind[k].ucType == 2)
+				for (n = 0; n < ulIn; n++)
+				{
+					lBufA[0][n] = (q31_t)lrint(fBufA[0][n] * 2147483648.0);
+					fBufA[0][n] = lBufA[0][n] / 2147483648.0;
+				}
+
+			// The real inverse takes the spectrum of known samples
+			if (m.ucReal && m.ucInverse)
+			{
+				memcpy(fBufA[1], fBufA[0], ulIn * sizeof(float32_t));
+				dsp_dft(fBufA[1], fBufA[0], m.wLen, 1, -1, 1.0);
+			}
+			else
+				dsp_dft(fBufA[0], fBufA[1], m.wLen, m.ucReal, m.ucInverse ? 1 : -1, dScale);
+
+			switch (tKind[k].ucType)
+			{
+			case 0:
+				if (m.ucReal)
+					arm_rfft_mixed_init_f32(&m.tRfftF32, m.wLen, fTwid, wCycles);
+				else
+					arm_cfft_mixed_init_f32(&m.tCfftF32, m.wLen, fTwid, wCycles);
+				arm_rfft_fast_init_f32(&m.tPowF32, m.wPow);
+				c.pRun = run_mix_f32;
+				run_mix_f32(&m, 1);
+				memcpy(fBufB[1], fBufC[1], ulIn * sizeof(float32_t));
+				break;
+			case 1:
+				if (m.ucReal)
+					arm_rfft_mixed_init_q15(&m.tRfftQ15, m.wLen, qTwid, wCycles);
+				else
+					arm_cfft_mixed_init_q15(&m.tCfftQ15, m.wLen, qTwid, wCycles);
+				arm_rfft_init_q15(&m.tPowQ15, m.wPow, m.ucInverse, 1);
+				c.pRun = run_mix_q15;
+				run_mix_q15(&m, 1);
+				for (n = 0; n < ulIn; n++)
+					fBufB[1][n] = qBufB[1][n] / 32768.0f;
+				break;
+			default:
+				if (m.ucReal)
+					arm_rfft_mixed_init_q31(&m.tRfftQ31, m.wLen, lTwid, wCycles);
+				else
+					arm_cfft_mixed_init_q31(&m.tCfftQ31, m.wLen, lTwid, wCycles);
+				arm_rfft_init_q31(&m.tPowQ31, m.wPow, m.ucInverse, 1);
+				c.pRun = run_mix_q31;
+				run_mix_q31(&m, 1);
+				for (n = 0; n < ulIn; n++)
+					fBufB[1][n] = lBufB[1][n] / 2147483648.0;
+				break;
+			}
+
+			c.pName = tKind[k].pName;
+			c.pArg = &m;
+			c.ulSamples = m.wLen;
+			c.dSnrMin = tKind[k].dSnrMin;
+			snprintf(c.cSize, sizeof(c.cSize), "%s %u vs %u", m.ucInverse ? "inverse" : "forward",
+			         m.wLen, m.wPow);
+			dsp_report(&c, fBufA[1], fBufB[1], ulIn * sizeof(float32_t));
+		}
+}
+
+
+// ==================================================================================
+//  FFT convolution
+// ==================================================================================
+
+#define DSP_CONV_LEN        2048              // Longer sequence
+#define DSP_CONV_FFT_MAX    1024              // Largest FFT of the cases
+
+typedef struct
+{
+	uint32_t ulLenB;                          // Kernel, against DSP_CONV_LEN samples
+	uint16_t wFftLen;
+} ConvArgDef;
+
+static float32_t fConvScratch[3 * DSP_CONV_FFT_MAX];
+static q15_t     qConvScratch[4 * DSP_CONV_FFT_MAX + 2];
+
+// Side 0 the direct form, 1 the FFT
+static void run_conv_f32(void *p, uint8_t s)
+{
+	ConvArgDef *v = p;
+
+	arm_conv_fft_ols_f32(fBufB[0], 1, v->ulLenB, fBufA[0], 1, DSP_CONV_LEN, fBufC[s],
+	                     fConvScratch, v->wFftLen, !s);
+}
+
+static void run_conv_q15(void *p, uint8_t s)
+{
+	ConvArgDef *v = p;
+
+	arm_conv_fft_ols_q15(qBufB[0], 1, v->ulLenB, qBufA[0], 1, DSP_CONV_LEN, s ? qBufB[1] : qBufA[1],
+	                     qConvScratch, v->wFftLen, !s);
+}
+
+// ==================================================================================
+/**
+ * @brief  Direct form against FFT convolution over kernel lengths
+ * @note   The kernel where the FFT side gets faster than the direct one is
+ *         the crossover ARM_FFT_CONV_MIN_F32/Q15 stand for; the FFT is the
+ *         smallest power of two of four kernels. The Q15 FFT must keep
+ *         the SNR arm_math.h documents for it next to ARM_FFT_CONV_MIN_Q15.
+ */
+static void dsp_conv(void)
+{
+	static const uint16_t wKernel[] = { 16, 24, 32, 48, 64, 96, 128, 256 };
+	ConvArgDef v;
+	DspCaseDef c = { 0 };
+	uint32_t   i, k, n, ulOut;
+
+	for (i = 0; i < sizeof(wKernel) / sizeof(wKernel[0]); i++)
+		for (k = 0; k < 2; k++)
+		{
+			v.ulLenB = wKernel[i];
+			for (v.wFftLen = 32; v.wFftLen < 4 * v.ulLenB; v.wFftLen *= 2)
+				;
+			ulOut = DSP_CONV_LEN + v.ulLenB - 1;
+			for (n = 0; n < DSP_CONV_LEN; n++)
+			{
+				fBufA[0][n] = 0.5f * dsp_randf();
+				qBufA[0][n] = (q15_t)(fBufA[0][n] * 32767);
+			}
+			for (n = 0; n < v.ulLenB; n++)
+			{
+				fBufB[0][n] = dsp_randf() / sqrtf(v.ulLenB);
+				qBufB[0][n] = (q15_t)(fBufB[0][n] * 32767);
+			}
+
+			if (k == 0)
+			{
+				run_conv_f32(&v, 0);
+				run_conv_f32(&v, 1);
+				c.pName = "arm_conv_fft_f32";
+				c.pRun = run_conv_f32;
+				c.dSnrMin = 0;
+			}
+			else
+			{
+				run_conv_q15(&v, 0);
+				run_conv_q15(&v, 1);
+				for (n = 0; n < ulOut; n++)
+				{
+					fBufC[0][n] = qBufA[1][n] / 32768.0f;
+					fBufC[1][n] = qBufB[1][n] / 32768.0f;
+				}
+				c.pName = "arm_conv_fft_q15";
+				c.pRun = run_conv_q15;
+				c.dSnrMin = 42;
+				for (n = 128; n < v.wFftLen; n *= 2)
+					c.dSnrMin -= 6;
+			}
+			c.pArg = &v;
+			c.ulSamples = ulOut;
+			snprintf(c.cSize, sizeof(c.cSize), "%u * %u, fft %u", DSP_CONV_LEN, v.ulLenB, v.wFftLen);
+			dsp_report(&c, fBufC[0], fBufC[1], ulOut * sizeof(float32_t));
+		}
+}
+
+
+// ==================================================================================
+//  Interleaved multichannel filters
+// ==================================================================================
+
+#define DSP_MULTI_CH        16                // Most channels of the cases
+#define DSP_MULTI_STAGES    4
+#define DSP_MULTI_TAPS      32
+#define DSP_MULTI_BLOCK     64                // Frames per call
+
+typedef struct
+{
+	uint16_t  wChannels;
+	float32_t fIir[5 * DSP_MULTI_STAGES], fFir[DSP_MULTI_TAPS];
+	q15_t     qDf1[6 * DSP_MULTI_STAGES], qFir[DSP_MULTI_TAPS];
+	q31_t     lDf1[5 * DSP_MULTI_STAGES];
+
+	// Side 0: an instance per channel, the channels one after the other
+	float32_t fIirState[DSP_MULTI_CH][2 * DSP_MULTI_STAGES];
+	float32_t fFirState[DSP_MULTI_CH][DSP_MULTI_TAPS + DSP_MULTI_BLOCK - 1];
+	q15_t     qDf1State[DSP_MULTI_CH][4 * DSP_MULTI_STAGES];
+	q15_t     qFirState[DSP_MULTI_CH][DSP_MULTI_TAPS + DSP_MULTI_BLOCK - 1];
+	q31_t     lDf1State[DSP_MULTI_CH][4 * DSP_MULTI_STAGES];
+	arm_biquad_cascade_df2T_instance_f32 sIir[DSP_MULTI_CH];
+	arm_fir_instance_f32                 sFir[DSP_MULTI_CH];
+	arm_biquad_casd_df1_inst_q15         sDf1Q15[DSP_MULTI_CH];
+	arm_fir_instance_q15                 sFirQ15[DSP_MULTI_CH];
+	arm_biquad_casd_df1_inst_q31         sDf1Q31[DSP_MULTI_CH];
+
+	// Side 1: one instance over the interleaved frames
+	float32_t fIirStateM[2 * DSP_MULTI_STAGES * DSP_MULTI_CH];
+	float32_t fFirStateM[(DSP_MULTI_TAPS + DSP_MULTI_BLOCK - 1) * DSP_MULTI_CH];
+	q15_t     qDf1StateM[4 * DSP_MULTI_STAGES * DSP_MULTI_CH];
+	q15_t     qFirStateM[(DSP_MULTI_TAPS + DSP_MULTI_BLOCK - 1) * DSP_MULTI_CH];
+	q31_t     lDf1StateM[4 * DSP_MULTI_STAGES * DSP_MULTI_CH];
+	arm_biquad_cascade_multi_df2T_instance_f32 sIirM;
+	arm_fir_multi_instance_f32                 sFirM;
+	arm_biquad_casd_df1_multi_inst_q15         sDf1Q15M;
+	arm_fir_multi_instance_q15                 sFirQ15M;
+	arm_biquad_casd_df1_multi_inst_q31         sDf1Q31M;
+} MultiArgDef;
+
+static void run_multi_iir(void *p, uint8_t s)
+{
+	MultiArgDef *m = p;
+	uint32_t     ch;
+
+	if (s)
+		arm_biquad_cascade_multi_df2T_f32(&m->sIirM, fBufA[1], fBufC[1], DSP_MULTI_BLOCK);
+	else
+		for (ch = 0; ch < m->wChannels; ch++)
+			ref_arm_biquad_cascade_df2T_f32(&m->sIir[ch], fBufA[0] + ch * DSP_MULTI_BLOCK,
+			                                fBufC[0] + ch * DSP_MULTI_BLOCK, DSP_MULTI_BLOCK);
+}
+
+static void run_multi_fir_f32(void *p, uint8_t s)
+{
+	MultiArgDef *m = p;
+	uint32_t     ch;
+
+	if (s)
+		arm_fir_multi_f32(&m->sFirM, fBufA[1], fBufC[1], DSP_MULTI_BLOCK);
+	else
+		for (ch = 0; ch < m->wChannels; ch++)
+			ref_arm_fir_f32(&m->sFir[ch], fBufA[0] + ch * DSP_MULTI_BLOCK,
+			                fBufC[0] + ch * DSP_MULTI_BLOCK, DSP_MULTI_BLOCK);
+}
+
+static void run_multi_df1_q15(void *p, uint8_t s)
+{
+	MultiArgDef *m = p;
+	uint32_t     ch;
+
+	if (s)
+		arm_biquad_cascade_multi_df1_q15(&m->sDf1Q15M, qBufA[1], qBufB[1], DSP_MULTI_BLOCK);
+	else
+		for (ch = 0; ch < m->wChannels; ch++)
+			ref_arm_biquad_cascade_df1_q15(&m->sDf1Q15[ch], qBufA[0] + ch * DSP_MULTI_BLOCK,
+			                               qBufB[0] + ch * DSP_MULTI_BLOCK, DSP_MULTI_BLOCK);
+}
+
+static void run_multi_fir_q15(void *p, uint8_t s)
+{
+	MultiArgDef *m = p;
+	uint32_t     ch;
+
+	if (s)
+		arm_fir_multi_q15(&m->sFirQ15M, qBufA[1], qBufB[1], DSP_MULTI_BLOCK);
+	else
+		for (ch = 0; ch < m->wChannels; ch++)
+			ref_arm_fir_q15(&m->sFirQ15[ch], qBufA[0] + ch * DSP_MULTI_BLOCK,
+			                qBufB[0] + ch * DSP_MULTI_BLOCK, DSP_MULTI_BLOCK);
+}
+
+static void run_multi_df1_q31(void *p, uint8_t s)
+{
+	MultiArgDef *m = p;
+	uint32_t     ch;
+
+	if (s)
+		arm_biquad_cascade_multi_df1_q31(&m->sDf1Q31M, lBufA[1], lBufB[1], DSP_MULTI_BLOCK);
+	else
+		for (ch = 0; ch < m->wChannels; ch++)
+			ref_arm_biquad_cascade_df1_q31(&m->sDf1Q31[ch], lBufA[0] + ch * DSP_MULTI_BLOCK,
+			                               lBufB[0] + ch * DSP_MULTI_BLOCK, DSP_MULTI_BLOCK);
+}
+
+/**
+ * @brief  Compares a block of side 0, channel after channel, with the interleaved side 1
+ * @param  pPlanar: Side 0 output
+ * @param  pInter: Side 1 output
+ * @param  ulSize: Bytes per sample
+ * @param  wChannels: Number of channels
+ * @retval 1 if any sample differs
+ */
+static uint32_t dsp_multi_diff(const uint8_t *pPlanar, const uint8_t *pInter, uint32_t ulSize, uint16_t wChannels)
+{
+	uint32_t n, ch;
+
+	for (n = 0; n < DSP_MULTI_BLOCK; n++)
+		for (ch = 0; ch < wChannels; ch++)
+			if (memcmp(pPlanar + (ch * DSP_MULTI_BLOCK + n) * ulSize, pInter + (n * wChannels + ch) * ulSize, ulSize))
+				return 1;
+	return 0;
+}
+
+// ==================================================================================
+/**
+ * @brief  Interleaved multichannel filters against an instance per channel
+ * @note   Side 0 runs the vendored C once per channel on planar data, side 1
+ *         the multichannel kernel on the same samples interleaved. Every
+ *         channel must come out bit exact, over DSP_BLOCKS calls so the
+ *         state handover is checked with it.
+ */
+static void dsp_multi(void)
+{
+	static const uint16_t wChannels[] = { 4, 6, 8, 16 };
+	static MultiArgDef m;
+	DspCaseDef c = { 0 };
+	uint32_t   i, b, n, ch, k, ulDiff[5];
+	float      fR, fW, fCoef[5];
+	float32_t  fX;
+
+	for (i = 0; i < sizeof(wChannels) / sizeof(wChannels[0]); i++)
+	{
+		m.wChannels = wChannels[i];
+
+		// Stable sections, in 2.14 and 2.30 with postShift 1 for the DF1
+		for (n = 0; n < DSP_MULTI_STAGES; n++)
+		{
+			fR = 0.5f + 0.45f * (dsp_randf() + 1) / 2;
+			fW = 3.1f * (dsp_randf() + 1) / 2;
+			fCoef[0] = 0.3f * dsp_randf();
+			fCoef[1] = 0.3f * dsp_randf();
+			fCoef[2] = 0.3f * dsp_randf();
+			fCoef[3] = 2 * fR * cosf(fW);
+			fCoef[4] = -fR * fR;
+			for (k = 0; k < 5; k++)
+			{
+				m.fIir[5 * n + k] = fCoef[k];
+				m.qDf1[6 * n + k + (k > 0)] = (q15_t)(fCoef[k] * 16384);
+				m.lDf1[5 * n + k] = (q31_t)(fCoef[k] * 1073741824.0f);
+			}
+			m.qDf1[6 * n + 1] = 0;
+		}
+		for (n = 0; n < DSP_MULTI_TAPS; n++)
+		{
+			m.fFir[n] = dsp_randf() / DSP_MULTI_TAPS;
+			m.qFir[n] = (q15_t)dsp_rand() / DSP_MULTI_TAPS;
+		}
+
+		for (ch = 0; ch < m.wChannels; ch++)
+		{
+			arm_biquad_cascade_df2T_init_f32(&m.sIir[ch], DSP_MULTI_STAGES, m.fIir, m.fIirState[ch]);
+			arm_fir_init_f32(&m.sFir[ch], DSP_MULTI_TAPS, m.fFir, m.fFirState[ch], DSP_MULTI_BLOCK);
+			arm_biquad_cascade_df1_init_q15(&m.sDf1Q15[ch], DSP_MULTI_STAGES, m.qDf1, m.qDf1State[ch], 1);
+			arm_fir_init_q15(&m.sFirQ15[ch], DSP_MULTI_TAPS, m.qFir, m.qFirState[ch], DSP_MULTI_BLOCK);
+			arm_biquad_cascade_df1_init_q31(&m.sDf1Q31[ch], DSP_MULTI_STAGES, m.lDf1, m.lDf1State[ch], 1);
+		}
+		arm_biquad_cascade_multi_df2T_init_f32(&m.sIirM, DSP_MULTI_STAGES, m.wChannels, m.fIir, m.fIirStateM);
+		arm_fir_multi_init_f32(&m.sFirM, DSP_MULTI_TAPS, m.wChannels, m.fFir, m.fFirStateM, DSP_MULTI_BLOCK);
+		arm_biquad_cascade_multi_df1_init_q15(&m.sDf1Q15M, DSP_MULTI_STAGES, m.wChannels, m.qDf1, m.qDf1StateM, 1);
+		arm_fir_multi_init_q15(&m.sFirQ15M, DSP_MULTI_TAPS, m.wChannels, m.qFir, m.qFirStateM, DSP_MULTI_BLOCK);
+		arm_biquad_cascade_multi_df1_init_q31(&m.sDf1Q31M, DSP_MULTI_STAGES, m.wChannels, m.lDf1, m.lDf1StateM, 1);
+
+		memset(ulDiff, 0, sizeof(ulDiff));
+		for (b = 0; b < DSP_BLOCKS; b++)
+		{
+			// The same samples channel after channel and interleaved
+			for (n = 0; n < DSP_MULTI_BLOCK; n++)
+				for (ch = 0; ch < m.wChannels; ch++)
+				{
+					fX = dsp_randf();
+					fBufA[0][ch * DSP_MULTI_BLOCK + n] = fBufA[1][n * m.wChannels + ch] = fX;
+					qBufA[0][ch * DSP_MULTI_BLOCK + n] = qBufA[1][n * m.wChannels + ch] = (n & 4) ? -32768 : (q15_t)dsp_rand();
+					lBufA[0][ch * DSP_MULTI_BLOCK + n] = lBufA[1][n * m.wChannels + ch] = (n & 4) ? INT32_MIN : (q31_t)(dsp_rand() << 8);
+				}
+
+			run_multi_iir(&m, 0);
+			run_multi_iir(&m, 1);
+			ulDiff[0] += dsp_multi_diff((uint8_t *)fBufC[0], (uint8_t *)fBufC[1], sizeof(float32_t), m.wChannels);
+			run_multi_fir_f32(&m, 0);
+			run_multi_fir_f32(&m, 1);
+			ulDiff[1] += dsp_multi_diff((uint8_t *)fBufC[0], (uint8_t *)fBufC[1], sizeof(float32_t), m.wChannels);
+			run_multi_df1_q15(&m, 0);
+			run_multi_df1_q15(&m, 1);
+			ulDiff[2] += dsp_multi_diff((uint8_t *)qBufB[0], (uint8_t *)qBufB[1], sizeof(q15_t), m.wChannels);
+			run_multi_fir_q15(&m, 0);
+			run_multi_fir_q15(&m, 1);
+			ulDiff[3] += dsp_multi_diff((uint8_t *)qBufB[0], (uint8_t *)qBufB[1], sizeof(q15_t), m.wChannels);
+			run_multi_df1_q31(&m, 0);
+			run_multi_df1_q31(&m, 1);
+			ulDiff[4] += dsp_multi_diff((uint8_t *)lBufB[0], (uint8_t *)lBufB[1], sizeof(q31_t), m.wChannels);
+		}
+
+		c.pArg = &m;
+		c.ulSamples = DSP_MULTI_BLOCK * m.wChannels;
+		c.ucExact = 1;
+
+		snprintf(c.cSize, sizeof(c.cSize), "channels %u stages %u", m.wChannels, DSP_MULTI_STAGES);
+		c.pName = "arm_biquad_cascade_multi_df2T_f32"; c.pRun = run_multi_iir;
+		dsp_report(&c, &ulDiff[0], &(uint32_t){0}, sizeof(uint32_t));
+		c.pName = "arm_biquad_cascade_multi_df1_q15"; c.pRun = run_multi_df1_q15;
+		dsp_report(&c, &ulDiff[2], &(uint32_t){0}, sizeof(uint32_t));
+		c.pName = "arm_biquad_cascade_multi_df1_q31"; c.pRun = run_multi_df1_q31;
+		dsp_report(&c, &ulDiff[4], &(uint32_t){0}, sizeof(uint32_t));
+
+		snprintf(c.cSize, sizeof(c.cSize), "channels %u taps %u", m.wChannels, DSP_MULTI_TAPS);
+		c.pName = "arm_fir_multi_f32"; c.pRun = run_multi_fir_f32;
+		dsp_report(&c, &ulDiff[1], &(uint32_t){0}, sizeof(uint32_t));
+		c.pName = "arm_fir_multi_q15"; c.pRun = run_multi_fir_q15;
+		dsp_report(&c, &ulDiff[3], &(uint32_t){0}, sizeof(uint32_t));
+	}
+}
+
+
+// ==================================================================================
+//  Tone detectors
+// ==================================================================================
+
+#define DSP_TONE_LEN        256               // Detection block, DFT window and RFFT
+#define DSP_TONE_MAX        32                // Most bins of the cases
+#define DSP_TONE_LEAD       (DSP_TONE_LEN + 37) // Samples the sliding DFT sees before the block
+#define DSP_TONE_LONG       2048              // Longest Goertzel block of the low bin cases
+
+typedef struct
+{
+	uint8_t   ucType;                         // 0 f32, 1 q15, 2 q31
+	uint16_t  wBins;
+	uint16_t  wLen;                           // Block of the low bin cases
+	uint16_t  wBin[DSP_TONE_MAX];
+	float32_t fOut[DSP_TONE_MAX];
+	q31_t     lOut[DSP_TONE_MAX];
+
+	float32_t fFreq[DSP_TONE_MAX], fCoef[2 * DSP_TONE_MAX], fState[2 * DSP_TONE_MAX], fHist[DSP_TONE_LEN];
+	q15_t     qFreq[DSP_TONE_MAX], qCoef[4 * DSP_TONE_MAX], qHist[DSP_TONE_LEN];
+	q31_t     lFreq[DSP_TONE_MAX], lCoef[2 * DSP_TONE_MAX], lState[2 * DSP_TONE_MAX], lHist[DSP_TONE_LEN];
+	q63_t     llState[2 * DSP_TONE_MAX];
+	arm_goertzel_instance_f32  tGoeF32;
+	arm_goertzel_instance_q15  tGoeQ15;
+	arm_goertzel_instance_q31  tGoeQ31;
+	arm_sdft_instance_f32      tSdftF32;
+	arm_sdft_instance_q15      tSdftQ15;
+	arm_sdft_instance_q31      tSdftQ31;
+	arm_rfft_fast_instance_f32 tRfftF32;
+	arm_rfft_instance_q15      tRfftQ15;
+	arm_rfft_instance_q31      tRfftQ31;
+} ToneArgDef;
+
+// Side 0 the RFFT of the block, the full spectrum these detectors save
+static void run_tone_rfft(ToneArgDef *t)
+{
+	switch (t->ucType)
+	{
+	case 0:
+		memcpy(fBufC[0], fBufA[0] + DSP_TONE_LEAD, DSP_TONE_LEN * sizeof(float32_t));
+		arm_rfft_fast_f32(&t->tRfftF32, fBufC[0], fBufC[1], 0);
+		break;
+	case 1:
+		memcpy(qBufB[0], qBufA[0] + DSP_TONE_LEAD, DSP_TONE_LEN * sizeof(q15_t));
+		arm_rfft_q15(&t->tRfftQ15, qBufB[0], qBufB[1]);
+		break;
+	default:
+		memcpy(lBufB[0], lBufA[0] + DSP_TONE_LEAD, DSP_TONE_LEN * sizeof(q31_t));
+		arm_rfft_q31(&t->tRfftQ31, lBufB[0], lBufB[1]);
+		break;
+	}
+}
+
+static void run_goertzel(void *p, uint8_t s)
+{
+	ToneArgDef *t = p;
+
+	if (!s)
+		run_tone_rfft(t);
+	else if (t->ucType == 0)
+		arm_goertzel_f32(&t->tGoeF32, fBufA[0] + DSP_TONE_LEAD, DSP_TONE_LEN, t->fOut);
+	else if (t->ucType == 1)
+		arm_goertzel_q15(&t->tGoeQ15, qBufA[0] + DSP_TONE_LEAD, DSP_TONE_LEN, t->lOut);
+	else
+		arm_goertzel_q31(&t->tGoeQ31, lBufA[0] + DSP_TONE_LEAD, DSP_TONE_LEN, t->lOut);
+}
+
+// Side 0 the f32 Goertzel of the long block
+static void run_goertzel_long(void *p, uint8_t s)
+{
+	ToneArgDef *t = p;
+
+	if (!s)
+		arm_goertzel_f32(&t->tGoeF32, fBufA[1], t->wLen, t->fOut);
+	else if (t->ucType == 1)
+		arm_goertzel_q15(&t->tGoeQ15, qBufA[1], t->wLen, t->lOut);
+	else
+		arm_goertzel_q31(&t->tGoeQ31, lBufA[1], t->wLen, t->lOut);
+}
+
+static void run_sdft(void *p, uint8_t s)
+{
+	ToneArgDef *t = p;
+
+	if (!s)
+		run_tone_rfft(t);
+	else if (t->ucType == 0)
+		arm_sdft_f32(&t->tSdftF32, fBufA[0] + DSP_TONE_LEAD, DSP_TONE_LEN, t->fOut);
+	else if (t->ucType == 1)
+		arm_sdft_q15(&t->tSdftQ15, qBufA[0] + DSP_TONE_LEAD, DSP_TONE_LEN, t->lOut);
+	else
+		arm_sdft_q31(&t->tSdftQ31, lBufA[0] + DSP_TONE_LEAD, DSP_TONE_LEN, t->lOut);
+}
+
+/**
+ * @brief  Power of one bin of the last wLen samples, in double
+ * @param  pIn: The samples, wLen of them
+ * @param  wLen: Length of the DFT
+ * @param  wBin: Bin of the wLen point DFT
+ * @param  dR: Radius of the sliding DFT twiddles, 1 for the plain DFT
+ * @retval |X|^2 / wLen^2 of the window r^(m+1) for the sample m back
+ */
+static double dsp_tone_ref(const float32_t *pIn, uint16_t wLen, uint16_t wBin, double dR)
+{
+	double   dA, dW = dR, dRe = 0, dIm = 0;
+	uint32_t m;
+
+	for (m = 0; m < wLen; m++)
+	{
+		dA  = 2 * M_PI * (double)(m * wBin % wLen) / wLen;
+		dRe += dW * pIn[wLen - 1 - m] * cos(dA);
+		dIm += dW * pIn[wLen - 1 - m] * sin(dA);
+		dW  *= dR;
+	}
+	return (dRe * dRe + dIm * dIm) / ((double)wLen * wLen);
+}
+
+// ==================================================================================
+/**
+ * @brief  Goertzel and sliding DFT against the RFFT of the whole block
+ * @note   The number of bins where the detectors get slower than the RFFT
+ *         is the crossover, as timed on this machine; the ARM cross build
+ *         under Tools/bench_qemu.py --dsp gives it for the Cortex-M0. The
+ *         RFFT side includes no magnitudes, which favours it. Both detectors are fed in uneven calls first and
+ *         checked against the DFT in double; the sliding DFT sees
+ *         DSP_TONE_LEAD samples more so its history wraps. The fixed
+ *         point Goertzels then take a full-scale tone on the lowest
+ *         bins of blocks up to DSP_TONE_LONG, where a short 2cos would
+ *         detune them; their side 0 is the f32 Goertzel.
+ */
+static void dsp_tone(void)
+{
+	static const uint16_t wBins[] = { 1, 2, 4, 8, 16, 32 };
+	static const struct
+	{
+		const char *pName;
+		uint8_t     ucType, ucSliding;
+		double      dSnrMin;
+	} tKind[] = {
+		{ "arm_goertzel_f32", 0, 0, 0 },  { "arm_goertzel_q15", 1, 0, 60 }, { "arm_goertzel_q31", 2, 0, 0 },
+		{ "arm_sdft_f32",     0, 1, 80 }, { "arm_sdft_q15",     1, 1, 40 }, { "arm_sdft_q31",     2, 1, 0 },
+	};
+	static const uint32_t ulFeed[] = { 100, 1, DSP_TONE_LEN - 101 };
+	static const uint16_t wLong[] = { 512, 1024, DSP_TONE_LONG };
+	static ToneArgDef t;
+	DspCaseDef c = { 0 };
+	uint32_t   i, k, j, n, ulIn, ulBlocks;
+	double     dR;
+
+	// Two tones on bins and some noise
+	ulIn = DSP_TONE_LEAD + DSP_TONE_LEN;
+	for (n = 0; n < ulIn; n++)
+	{
+		fBufA[0][n] = 0.3f * cosf(2 * M_PI * 10 * n / DSP_TONE_LEN) +
+		              0.2f * sinf(2 * M_PI * 37 * n / DSP_TONE_LEN + 1) + 0.05f * dsp_randf();
+		qBufA[0][n] = (q15_t)lrintf(fBufA[0][n] * 32768.0f);
+		lBufA[0][n] = (q31_t)lrint(fBufA[0][n] * 2147483648.0);
+	}
+
+	for (i = 0; i < sizeof(wBins) / sizeof(wBins[0]); i++)
+		for (k = 0; k < sizeof(tKind) / sizeof(tKind[0]); k++)
+		{
+			t.ucType = tKind[k].ucType;
+			t.wBins  = wBins[i];
+			for (j = 0; j < t.wBins; j++)
+			{
+				t.wBin[j]  = j == 0 ? 10 : j == 1 ? 37 : (uint16_t)((3 + 7 * j) % (DSP_TONE_LEN / 2));
+				t.fFreq[j] = (float32_t)t.wBin[j] / DSP_TONE_LEN;
+				t.qFreq[j] = (q15_t)(t.wBin[j] * (32768 / DSP_TONE_LEN));
+				t.lFreq[j] = (q31_t)(t.wBin[j] * (2147483648U / DSP_TONE_LEN));
+			}
+			arm_rfft_fast_init_f32(&t.tRfftF32, DSP_TONE_LEN);
+			arm_rfft_init_q15(&t.tRfftQ15, DSP_TONE_LEN, 0, 1);
+			arm_rfft_init_q31(&t.tRfftQ31, DSP_TONE_LEN, 0, 1);
+
+			// The reference on the samples as the kernel sees them
+			for (n = 0; n < ulIn; n++)
+				fBufC[0][n] = t.ucType == 0 ? fBufA[0][n] :
+				              t.ucType == 1 ? qBufA[0][n] / 32768.0f : (float32_t)(lBufA[0][n] / 2147483648.0);
+			dR = !tKind[k].ucSliding ? 1.0 : t.ucType == 0 ? ARM_SDFT_DAMPING_F32 :
+			     t.ucType == 1 ? ARM_SDFT_DAMPING_Q15 / 32768.0 : ARM_SDFT_DAMPING_Q31 / 2147483648.0;
+			for (j = 0; j < t.wBins; j++)
+				fBufB[0][j] = (float32_t)dsp_tone_ref(fBufC[0] + DSP_TONE_LEAD, DSP_TONE_LEN, t.wBin[j], dR);
+
+			ulBlocks = 0;
+			if (!tKind[k].ucSliding)
+			{
+				arm_goertzel_init_f32(&t.tGoeF32, t.wBins, DSP_TONE_LEN, t.fFreq, t.fCoef, t.fState);
+				arm_goertzel_init_q15(&t.tGoeQ15, t.wBins, DSP_TONE_LEN, t.qFreq, t.qCoef, t.lState);
+				arm_goertzel_init_q31(&t.tGoeQ31, t.wBins, DSP_TONE_LEN, t.lFreq, t.lCoef, t.llState);
+				for (j = 0, n = DSP_TONE_LEAD; j < sizeof(ulFeed) / sizeof(ulFeed[0]); n += ulFeed[j++])
+					ulBlocks += t.ucType == 0 ? arm_goertzel_f32(&t.tGoeF32, fBufA[0] + n, ulFeed[j], t.fOut) :
+					            t.ucType == 1 ? arm_goertzel_q15(&t.tGoeQ15, qBufA[0] + n, ulFeed[j], t.lOut) :
+					                            arm_goertzel_q31(&t.tGoeQ31, lBufA[0] + n, ulFeed[j], t.lOut);
+				c.pRun = run_goertzel;
+			}
+			else
+			{
+				arm_sdft_init_f32(&t.tSdftF32, DSP_TONE_LEN, t.wBins, t.wBin, t.fCoef, t.fState, t.fHist);
+				arm_sdft_init_q15(&t.tSdftQ15, DSP_TONE_LEN, t.wBins, t.wBin, t.qCoef, t.lState, t.qHist);
+				arm_sdft_init_q31(&t.tSdftQ31, DSP_TONE_LEN, t.wBins, t.wBin, t.lCoef, t.lState, t.lHist);
+				for (n = 0; n < ulIn; n += j)
+				{
+					j = n == 0 ? DSP_TONE_LEAD : ulFeed[ulBlocks++ % 3];
+					if (j > ulIn - n)
+						j = ulIn - n;
+					if (t.ucType == 0)
+						arm_sdft_f32(&t.tSdftF32, fBufA[0] + n, j, t.fOut);
+					else if (t.ucType == 1)
+						arm_sdft_q15(&t.tSdftQ15, qBufA[0] + n, j, t.lOut);
+					else
+						arm_sdft_q31(&t.tSdftQ31, lBufA[0] + n, j, t.lOut);
+				}
+				ulBlocks = 1;
+				c.pRun = run_sdft;
+			}
+			for (j = 0; j < t.wBins; j++)
+				fBufB[1][j] = ulBlocks != 1 ? 0 : t.ucType == 0 ? t.fOut[j] : t.lOut[j] / 2147483648.0f;
+
+			c.pName = tKind[k].pName;
+			c.pArg = &t;
+			c.ulSamples = DSP_TONE_LEN;
+			c.dSnrMin = tKind[k].dSnrMin;
+			snprintf(c.cSize, sizeof(c.cSize), "bins %u of %u", t.wBins, DSP_TONE_LEN);
+			dsp_report(&c, fBufB[0], fBufB[1], t.wBins * sizeof(float32_t));
+		}
+
+	// A 0.999 tone on bin 1 or 2 of the long blocks, bins 1 to 3 detected
+	t.wBins = 3;
+	for (i = 0; i < sizeof(wLong) / sizeof(wLong[0]); i++)
+		for (j = 1; j <= 2; j++)
+			for (k = 1; k <= 2; k++)
+			{
+				t.ucType = (uint8_t)k;
+				t.wLen   = wLong[i];
+				for (n = 0; n < t.wLen; n++)
+				{
+					fBufA[1][n] = (float32_t)(0.999 * cos(2 * M_PI * j * n / t.wLen + 0.5));
+					qBufA[1][n] = (q15_t)lrintf(fBufA[1][n] * 32768.0f);
+					lBufA[1][n] = (q31_t)lrint(fBufA[1][n] * 2147483648.0);
+					fBufC[1][n] = k == 1 ? qBufA[1][n] / 32768.0f : (float32_t)(lBufA[1][n] / 2147483648.0);
+				}
+				for (n = 0; n < t.wBins; n++)
+				{
+					t.wBin[n]  = (uint16_t)(n + 1);
+					t.fFreq[n] = (float32_t)t.wBin[n] / t.wLen;
+					t.qFreq[n] = (q15_t)(t.wBin[n] * (32768 / t.wLen));
+					t.lFreq[n] = (q31_t)(t.wBin[n] * (2147483648U / t.wLen));
+					fBufB[0][n] = (float32_t)dsp_tone_ref(fBufC[1], t.wLen, t.wBin[n], 1.0);
+				}
+				arm_goertzel_init_f32(&t.tGoeF32, t.wBins, t.wLen, t.fFreq, t.fCoef, t.fState);
+				arm_goertzel_init_q15(&t.tGoeQ15, t.wBins, t.wLen, t.qFreq, t.qCoef, t.lState);
+				arm_goertzel_init_q31(&t.tGoeQ31, t.wBins, t.wLen, t.lFreq, t.lCoef, t.llState);
+				ulBlocks = k == 1 ? arm_goertzel_q15(&t.tGoeQ15, qBufA[1], t.wLen, t.lOut) :
+				                    arm_goertzel_q31(&t.tGoeQ31, lBufA[1], t.wLen, t.lOut);
+				for (n = 0; n < t.wBins; n++)
+					fBufB[1][n] = ulBlocks != 1 ? 0 : t.lOut[n] / 2147483648.0f;
+
+				c.pName = tKind[k].pName;
+				c.pArg = &t;
+				c.pRun = run_goertzel_long;
+				c.ulSamples = t.wLen;
+				c.dSnrMin = tKind[k].dSnrMin;
+				snprintf(c.cSize, sizeof(c.cSize), "tone %u of %u", (unsigned)j, t.wLen);
+				dsp_report(&c, fBufB[0], fBufB[1], t.wBins * sizeof(float32_t));
+			}
+}
+
+
+// ==================================================================================
+//  Resamplers
+// ==================================================================================
+
+#define DSP_RS_IN           1024              // Input samples per call
+#define DSP_RS_PART         256               // Input samples the resampler state takes at once
+#define DSP_RS_TAPS         16                // Taps per polyphase component
+#define DSP_RS_L_MAX        160               // Most components of the cases
+
+typedef struct
+{
+	uint8_t   ucFrac;                         // 0 L/M, 1 fractional
+	uint8_t   ucQ15;
+	uint16_t  wL, wM;                         // Factors, the components of the fractional in wL
+	uint32_t  ulStep;                         // Fractional, 8.24
+	uint32_t  ulPart;                         // Interpolator inputs per part, its output fits DSP_MAX
+	uint32_t  ulOut[2];                       // Outputs of the last call per side
+	uint32_t  ulSkip;                         // L/M chain, upsampled samples into the next part
+	uint64_t  ullPos;                         // Fractional chain, next output in 8.24 from the carried sample
+	float32_t fCarry;                         // Fractional chain, last upsampled sample of the previous part
+	q15_t     qCarry;
+
+	float32_t fCoef[DSP_RS_TAPS * DSP_RS_L_MAX], fState[2][DSP_RS_IN + DSP_RS_TAPS];
+	q15_t     qCoef[DSP_RS_TAPS * DSP_RS_L_MAX], qState[2][DSP_RS_IN + DSP_RS_TAPS];
+	arm_fir_interpolate_instance_f32   sIntF32;
+	arm_fir_interpolate_instance_q15   sIntQ15;
+	arm_fir_resample_instance_f32      sResF32;
+	arm_fir_resample_instance_q15      sResQ15;
+	arm_fir_resample_frac_instance_f32 sFracF32;
+	arm_fir_resample_frac_instance_q15 sFracQ15;
+} ResampleArgDef;
+
+/**
+ * @brief  Side 0, the vendored interpolator by L in parts and the outputs picked from it
+ * @param  r: The case
+ * @param  ulIn: Input samples
+ * @retval Outputs written to fBufB[0] or qBufB[0]
+ */
+static uint32_t dsp_rs_chain(ResampleArgDef *r, uint32_t ulIn)
+{
+	uint32_t n, u, ulPart, ulUp, ulOut = 0;
+	uint64_t ullStep = (uint64_t)r->ulStep * r->wL;
+	float32_t *pF = fBufC[0];
+	q15_t     *pQ = qBufA[1];
+
+	for (n = 0; n < ulIn; n += ulPart)
+	{
+		ulPart = ulIn - n < r->ulPart ? ulIn - n : r->ulPart;
+		ulUp   = ulPart * r->wL;
+		if (r->ucQ15)
+			arm_fir_interpolate_q15(&r->sIntQ15, qBufA[0] + n, pQ + 1, ulPart);
+		else
+			arm_fir_interpolate_f32(&r->sIntF32, fBufA[0] + n, pF + 1, ulPart);
+
+		if (!r->ucFrac)
+		{
+			// Every M-th upsampled sample
+			for (u = r->ulSkip; u < ulUp; u += r->wM)
+				if (r->ucQ15)
+					qBufB[0][ulOut++] = pQ[u + 1];
+				else
+					fBufB[0][ulOut++] = pF[u + 1];
+			r->ulSkip = u - ulUp;
+			continue;
+		}
+
+		// Linear between the two upsampled samples around each output, the
+		// first one may be the last of the previous part
+		pF[0] = r->fCarry;
+		pQ[0] = r->qCarry;
+		while ((r->ullPos >> 24) < ulUp)
+		{
+			u = (uint32_t)(r->ullPos >> 24);
+			if (r->ucQ15)
+				qBufB[0][ulOut++] = (q15_t)__SSAT(pQ[u] + (((pQ[u + 1] - pQ[u]) *
+				                    (q31_t)((r->ullPos & 0x00FFFFFF) >> 9)) >> 15), 16);
+			else
+				fBufB[0][ulOut++] = pF[u] + ((pF[u + 1] - pF[u]) *
+				                    ((float32_t)(r->ullPos & 0x00FFFFFF) * (1.0f / 16777216.0f)));
+			r->ullPos += ullStep;
+		}
+		r->ullPos -= (uint64_t)ulUp << 24;
+		r->fCarry  = pF[ulUp];
+		r->qCarry  = pQ[ulUp];
+	}
+	return ulOut;
+}
+
+static void run_resample(void *p, uint8_t s)
+{
+	ResampleArgDef *r = p;
+
+	if (!s)
+		r->ulOut[0] = dsp_rs_chain(r, DSP_RS_IN);
+	else if (r->ucFrac)
+		r->ulOut[1] = r->ucQ15 ? arm_fir_resample_frac_q15(&r->sFracQ15, qBufA[0], qBufB[1], DSP_RS_IN) :
+		                         arm_fir_resample_frac_f32(&r->sFracF32, fBufA[0], fBufB[1], DSP_RS_IN);
+	else
+		r->ulOut[1] = r->ucQ15 ? arm_fir_resample_q15(&r->sResQ15, qBufA[0], qBufB[1], DSP_RS_IN) :
+		                         arm_fir_resample_f32(&r->sResF32, fBufA[0], fBufB[1], DSP_RS_IN);
+}
+
+// ==================================================================================
+/**
+ * @brief  L/M and fractional resamplers against the interpolator they replace
+ * @note   Side 0 interpolates by L with the vendored C and keeps the
+ *         outputs that fall on the new rate, linearly interpolated for the
+ *         fractional ones; side 1 computes only those. The resampler is fed
+ *         in uneven calls and must come out bit exact. The fractional chain
+ *         waits for the upsampled sample after the last output, so it may
+ *         give one output less.
+ */
+static void dsp_resample(void)
+{
+	static const struct
+	{
+		uint8_t  ucFrac;
+		uint16_t wL, wM;
+		double   dRatio;                      // Fractional, input samples per output
+		const char *pRate;
+	} tRate[] = {
+		{ 0, 160, 441, 0, "44.1 to 16 kHz" }, { 0, 147, 160, 0, "48 to 44.1 kHz" },
+		{ 0, 3, 2, 0, "x 3/2" }, { 0, 1, 4, 0, "x 1/4" },
+		{ 1, 64, 0, 44100.0 / 48000.0, "44.1 to 48 kHz" }, { 1, 64, 0, 48000.0 / 44100.0, "48 to 44.1 kHz" },
+		{ 1, 64, 0, 1.0001, "drift -100 ppm" },
+	};
+	static const uint32_t ulFeed[] = { 1, 100, DSP_RS_IN - 101 };
+	static ResampleArgDef r;
+	DspCaseDef c = { 0 };
+	uint32_t   i, j, n, q, ulTaps, ulSize;
+	double     dFc, dT, dB;
+
+	// Tones and noise, clear of saturation at any gain ripple
+	for (n = 0; n < DSP_RS_IN; n++)
+	{
+		fBufA[0][n] = 0.25f * sinf(0.05f * n) + 0.15f * sinf(0.9f * n + 1) + 0.05f * dsp_randf();
+		qBufA[0][n] = (q15_t)lrintf(fBufA[0][n] * 32768.0f);
+	}
+
+	for (i = 0; i < sizeof(tRate) / sizeof(tRate[0]); i++)
+		for (q = 0; q < 2; q++)
+		{
+			memset(&r, 0, sizeof(r));
+			r.ucFrac = tRate[i].ucFrac;
+			r.ucQ15  = (uint8_t)q;
+			r.wL     = tRate[i].wL;
+			r.wM     = tRate[i].wM;
+			r.ulStep = (uint32_t)lrint(tRate[i].dRatio * ARM_RESAMPLE_STEP_ONE);
+			r.ulPart = (DSP_MAX - 1) / r.wL < DSP_RS_IN ? (DSP_MAX - 1) / r.wL : DSP_RS_IN;
+			r.ullPos = 1ULL << 24;
+
+			// Hann windowed sinc at L times the rate, gain L and b[0] = 0
+			ulTaps = DSP_RS_TAPS * r.wL;
+			dFc    = 0.45 / (r.wL > r.wM ? r.wL : r.wM);
+			for (n = 0; n < ulTaps; n++)
+			{
+				dT = n - (ulTaps - 1) / 2.0;
+				dB = r.wL * 2 * dFc * (dT == 0 ? 1 : sin(2 * M_PI * dFc * dT) / (2 * M_PI * dFc * dT));
+				dB *= 0.5 - 0.5 * cos(2 * M_PI * n / (ulTaps - 1));
+				r.fCoef[n] = (float32_t)dB;
+				r.qCoef[n] = (q15_t)__SSAT(lrint(dB * 32768.0), 16);
+			}
+
+			arm_fir_interpolate_init_f32(&r.sIntF32, (uint8_t)r.wL, (uint16_t)ulTaps, r.fCoef, r.fState[0], r.ulPart);
+			arm_fir_interpolate_init_q15(&r.sIntQ15, (uint8_t)r.wL, (uint16_t)ulTaps, r.qCoef, r.qState[0], r.ulPart);
+			if (r.ucFrac)
+			{
+				arm_fir_resample_frac_init_f32(&r.sFracF32, r.wL, (uint16_t)ulTaps, r.fCoef, r.fState[1], r.ulStep, DSP_RS_PART);
+				arm_fir_resample_frac_init_q15(&r.sFracQ15, r.wL, (uint16_t)ulTaps, r.qCoef, r.qState[1], r.ulStep, DSP_RS_PART);
+			}
+			else
+			{
+				arm_fir_resample_init_f32(&r.sResF32, r.wL, r.wM, (uint16_t)ulTaps, r.fCoef, r.fState[1], DSP_RS_PART);
+				arm_fir_resample_init_q15(&r.sResQ15, r.wL, r.wM, (uint16_t)ulTaps, r.qCoef, r.qState[1], DSP_RS_PART);
+			}
+
+			// Side 0 at once, side 1 in uneven calls
+			run_resample(&r, 0);
+			for (j = 0, n = 0, r.ulOut[1] = 0; j < sizeof(ulFeed) / sizeof(ulFeed[0]); n += ulFeed[j++])
+				r.ulOut[1] += q ? (r.ucFrac ? arm_fir_resample_frac_q15(&r.sFracQ15, qBufA[0] + n, qBufB[1] + r.ulOut[1], ulFeed[j]) :
+				                              arm_fir_resample_q15(&r.sResQ15, qBufA[0] + n, qBufB[1] + r.ulOut[1], ulFeed[j])) :
+				                  (r.ucFrac ? arm_fir_resample_frac_f32(&r.sFracF32, fBufA[0] + n, fBufB[1] + r.ulOut[1], ulFeed[j]) :
+				                              arm_fir_resample_f32(&r.sResF32, fBufA[0] + n, fBufB[1] + r.ulOut[1], ulFeed[j]));
+
+			ulSize = q ? sizeof(q15_t) : sizeof(float32_t);
+			if (r.ulOut[1] < r.ulOut[0] || r.ulOut[1] > r.ulOut[0] + r.ucFrac)
+				memset(q ? (void *)qBufB[1] : (void *)fBufB[1], 0x55, r.ulOut[0] * ulSize + 1);
+
+			c.pName = r.ucFrac ? (q ? "arm_fir_resample_frac_q15" : "arm_fir_resample_frac_f32") :
+			                     (q ? "arm_fir_resample_q15" : "arm_fir_resample_f32");
+			c.ucExact = 1;
+			c.pRun = run_resample;
+			c.pArg = &r;
+			c.ulSamples = DSP_RS_IN;
+			if (r.ucFrac)
+				snprintf(c.cSize, sizeof(c.cSize), "%s, P=%u", tRate[i].pRate, r.wL);
+			else
+				snprintf(c.cSize, sizeof(c.cSize), "%s, %u/%u", tRate[i].pRate, r.wL, r.wM);
+			dsp_report(&c, q ? (void *)qBufB[0] : (void *)fBufB[0], q ? (void *)qBufB[1] : (void *)fBufB[1],
+			           r.ulOut[0] * ulSize);
+		}
+}
+
+
+// ==================================================================================
+//  Fixed point fast math
+// ==================================================================================
+
+#define DSP_FM_BLOCK        1024              // Values per timed call
+#define DSP_FM_Q31_RUNS     32                // Random q31 chunks of DSP_MAX values checked
+
+enum { FM_RECIP, FM_ISQRT, FM_LOG2, FM_LN, FM_EXP2, FM_ATAN2 };
+
+typedef struct
+{
+	uint8_t ucFunc;                           // FM_...
+	uint8_t ucQ31;
+	int16_t wShift[DSP_MAX];
+} FastArgDef;
+
+// Side 0 the float libm call the function replaces, soft float on the target
+static void run_fastmath(void *p, uint8_t s)
+{
+	FastArgDef *f = p;
+	uint32_t    n;
+
+	if (!s)
+	{
+		for (n = 0; n < DSP_FM_BLOCK; n++)
+			switch (f->ucFunc)
+			{
+			case FM_RECIP: fBufB[0][n] = 1.0f / fBufA[0][n];                break;
+			case FM_ISQRT: fBufB[0][n] = 1.0f / sqrtf(fBufA[0][n]);         break;
+			case FM_LOG2:  fBufB[0][n] = log2f(fBufA[0][n]);                break;
+			case FM_LN:    fBufB[0][n] = logf(fBufA[0][n]);                 break;
+			case FM_EXP2:  fBufB[0][n] = exp2f(fBufA[0][n]);                break;
+			default:       fBufB[0][n] = atan2f(fBufA[1][n], fBufA[0][n]);  break;
+			}
+		return;
+	}
+
+	if (!f->ucQ31)
+		switch (f->ucFunc)
+		{
+		case FM_RECIP: arm_vreciprocal_q15(qBufA[0], qBufB[1], f->wShift, DSP_FM_BLOCK); break;
+		case FM_ISQRT: arm_vinv_sqrt_q15(qBufA[0], qBufB[1], f->wShift, DSP_FM_BLOCK);   break;
+		case FM_LOG2:  arm_vlog2_q15(qBufA[0], qBufB[1], DSP_FM_BLOCK);                  break;
+		case FM_LN:    arm_vlog_q15(qBufA[0], qBufB[1], DSP_FM_BLOCK);                   break;
+		case FM_EXP2:  arm_vexp2_q15(qBufA[0], qBufB[1], DSP_FM_BLOCK);                  break;
+		default:       arm_vatan2_q15(qBufA[1], qBufA[0], qBufB[1], DSP_FM_BLOCK);       break;
+		}
+	else
+		switch (f->ucFunc)
+		{
+		case FM_RECIP: arm_vreciprocal_q31(lBufA[0], lBufB[1], f->wShift, DSP_FM_BLOCK); break;
+		case FM_ISQRT: arm_vinv_sqrt_q31(lBufA[0], lBufB[1], f->wShift, DSP_FM_BLOCK);   break;
+		case FM_LOG2:  arm_vlog2_q31(lBufA[0], lBufB[1], DSP_FM_BLOCK);                  break;
+		case FM_LN:    arm_vlog_q31(lBufA[0], lBufB[1], DSP_FM_BLOCK);                   break;
+		case FM_EXP2:  arm_vexp2_q31(lBufA[0], lBufB[1], DSP_FM_BLOCK);                  break;
+		default:       arm_vatan2_q31(lBufA[1], lBufA[0], lBufB[1], DSP_FM_BLOCK);       break;
+		}
+}
+
+// The scalar function of a case, on x (and y for atan2)
+static arm_status dsp_fm_one(const FastArgDef *f, int32_t lX, int32_t lY, int32_t *pOut, int16_t *pShift)
+{
+	arm_status eSt;
+	q15_t      q = 0;
+
+	*pShift = 0;
+	if (f->ucQ31)
+		switch (f->ucFunc)
+		{
+		case FM_RECIP: return arm_reciprocal_q31(lX, pOut, pShift);
+		case FM_ISQRT: return arm_inv_sqrt_q31(lX, pOut, pShift);
+		case FM_LOG2:  return arm_log2_q31(lX, pOut);
+		case FM_LN:    return arm_log_q31(lX, pOut);
+		case FM_EXP2:  return arm_exp2_q31(lX, pOut);
+		default:       return arm_atan2_q31(lY, lX, pOut);
+		}
+
+	switch (f->ucFunc)
+	{
+	case FM_RECIP: eSt = arm_reciprocal_q15((q15_t)lX, &q, pShift); break;
+	case FM_ISQRT: eSt = arm_inv_sqrt_q15((q15_t)lX, &q, pShift);   break;
+	case FM_LOG2:  eSt = arm_log2_q15((q15_t)lX, &q);               break;
+	case FM_LN:    eSt = arm_log_q15((q15_t)lX, &q);                break;
+	case FM_EXP2:  eSt = arm_exp2_q15((q15_t)lX, &q);               break;
+	default:       eSt = arm_atan2_q15((q15_t)lY, (q15_t)lX, &q);   break;
+	}
+	*pOut = q;
+	return eSt;
+}
+
+/**
+ * @brief  Fills the inputs of a case, in qBufA or lBufA, [0] x and [1] y
+ * @param  lChunk: Chunk of DSP_MAX of all q15 values, -1 random ones in the domain
+ * @param  ulNum: Values to fill
+ */
+static void dsp_fm_fill(const FastArgDef *f, int32_t lChunk, uint32_t ulNum)
+{
+	uint32_t n, ulBits = f->ucQ31 ? 32 : 16;
+	int32_t  lX, lY;
+
+	for (n = 0; n < ulNum; n++)
+	{
+		if (lChunk >= 0)
+			lX = (int16_t)(lChunk * DSP_MAX + n), lY = 0;
+		else
+		{
+			// Any magnitude, down to a few LSBs
+			lX = (int32_t)(((dsp_rand() << 8) ^ dsp_rand()) << (32 - ulBits)) >> (32 - ulBits + dsp_rand() % ulBits);
+			lY = (int32_t)(((dsp_rand() << 8) ^ dsp_rand()) << (32 - ulBits)) >> (32 - ulBits + dsp_rand() % ulBits);
+			if (f->ucFunc == FM_ISQRT || f->ucFunc == FM_LOG2 || f->ucFunc == FM_LN)
+				lX = lX < 0 ? ~lX : lX;
+			else if (f->ucFunc == FM_EXP2)
+				lX = lX > 0 ? ~lX : lX;
+			if (lX == 0 && f->ucFunc != FM_EXP2 && f->ucFunc != FM_ATAN2)
+				lX = 1;
+		}
+		if (f->ucQ31)
+			lBufA[0][n] = lX, lBufA[1][n] = lY;
+		else
+			qBufA[0][n] = (q15_t)lX, qBufA[1][n] = (q15_t)lY;
+	}
+}
+
+/**
+ * @brief  Error of one output against double, in LSBs
+ * @retval -1 outside the domain of the function
+ */
+static double dsp_fm_err(const FastArgDef *f, int32_t lX, int32_t lY, int32_t lOut, int16_t wShift)
+{
+	double dFull = f->ucQ31 ? 2147483648.0 : 32768.0;
+	double dIn = dFull, dOut = dFull, dX, dY, dRef;
+
+	if (f->ucFunc == FM_EXP2)
+		dIn = f->ucQ31 ? 67108864.0 : 2048.0;
+	if (f->ucFunc == FM_LOG2 || f->ucFunc == FM_LN)
+		dOut = f->ucQ31 ? 67108864.0 : 2048.0;
+	dX = lX / dIn;
+	dY = lY / dIn;
+
+	switch (f->ucFunc)
+	{
+	case FM_RECIP:
+		if (lX == 0)
+			return -1;
+		dRef = 1 / dX;
+		break;
+	case FM_ISQRT:
+		if (lX <= 0)
+			return -1;
+		dRef = 1 / sqrt(dX);
+		break;
+	case FM_LOG2:
+	case FM_LN:
+		if (lX <= 0)
+			return -1;
+		dRef = f->ucFunc == FM_LN ? log(dX) : log2(dX);
+		break;
+	case FM_EXP2:
+		if (lX > 0)
+			return -1;
+		dRef = exp2(dX);
+		break;
+	default:
+		if (lX == 0 && lY == 0)
+			return -1;
+		dRef = atan2(dY, dX) / M_PI;
+		break;
+	}
+
+	// The mantissa of 1/x and 1/sqrt(x) is checked in its own LSBs
+	dRef = ldexp(dRef * dOut, -wShift);
+	if (dRef > dFull - 1)
+		dRef = dFull - 1;
+	if (dRef < -dFull)
+		dRef = -dFull;
+	return fabs(lOut - dRef);
+}
+
+/**
+ * @brief  Largest error of a case in LSBs, INFINITY on a wrong status
+ * @note   The vector function must match the scalar one, which must
+ *         return ARM_MATH_ARGUMENT_ERROR exactly outside the domain.
+ */
+static double dsp_fm_check(FastArgDef *f)
+{
+	static const int32_t lEdge[][2] = {
+		{ 1, 0 }, { 2, 0 }, { 3, 1 }, { -1, -1 }, { 0x7FFFFFFF, 0 }, { 0x7FFFFFFF, 0x7FFFFFFF },
+		{ 0x40000000, -0x40000000 }, { 0x3FFFFFFF, 1 }, { -0x7FFFFFFF - 1, 0 }, { 0, -0x7FFFFFFF - 1 },
+		{ -0x7FFFFFFF - 1, -0x7FFFFFFF - 1 }, { 0, 0x7FFFFFFF }, { 0, 0 },
+		{ 0x7FFFFFFF, -0x7FFFFFFF - 1 }, { -0x7FFFFFFF - 1, 0x7FFFFFFF },
+	};
+	double     dMax = 0, dErr;
+	int32_t    lChunk, lX, lY, lOut, lVec;
+	int16_t    wShift;
+	uint8_t    ucRandom;
+	uint32_t   n, ulRuns = f->ucQ31 ? DSP_FM_Q31_RUNS : 65536 / DSP_MAX;
+	arm_status eSt;
+
+	for (lChunk = 0; lChunk < (int32_t)ulRuns; lChunk++)
+	{
+		// q15 x takes all values, q15 atan2 and q31 random ones and the edges
+		ucRandom = f->ucQ31 || f->ucFunc == FM_ATAN2;
+		dsp_fm_fill(f, ucRandom ? -1 : lChunk, DSP_MAX);
+		if (ucRandom && lChunk == 0)
+			for (n = 0; n < sizeof(lEdge) / sizeof(lEdge[0]); n++)
+			{
+				if (f->ucQ31)
+					lBufA[0][n] = lEdge[n][0], lBufA[1][n] = lEdge[n][1];
+				else
+					qBufA[0][n] = (q15_t)(lEdge[n][0] >> 16), qBufA[1][n] = (q15_t)(lEdge[n][1] >> 16);
+			}
+
+		// The vector function over the whole chunk
+		if (!f->ucQ31)
+			switch (f->ucFunc)
+			{
+			case FM_RECIP: arm_vreciprocal_q15(qBufA[0], qBufB[0], f->wShift, DSP_MAX); break;
+			case FM_ISQRT: arm_vinv_sqrt_q15(qBufA[0], qBufB[0], f->wShift, DSP_MAX);   break;
+			case FM_LOG2:  arm_vlog2_q15(qBufA[0], qBufB[0], DSP_MAX);                  break;
+			case FM_LN:    arm_vlog_q15(qBufA[0], qBufB[0], DSP_MAX);                   break;
+			case FM_EXP2:  arm_vexp2_q15(qBufA[0], qBufB[0], DSP_MAX);                  break;
+			default:       arm_vatan2_q15(qBufA[1], qBufA[0], qBufB[0], DSP_MAX);       break;
+			}
+		else
+			switch (f->ucFunc)
+			{
+			case FM_RECIP: arm_vreciprocal_q31(lBufA[0], lBufB[0], f->wShift, DSP_MAX); break;
+			case FM_ISQRT: arm_vinv_sqrt_q31(lBufA[0], lBufB[0], f->wShift, DSP_MAX);   break;
+			case FM_LOG2:  arm_vlog2_q31(lBufA[0], lBufB[0], DSP_MAX);                  break;
+			case FM_LN:    arm_vlog_q31(lBufA[0], lBufB[0], DSP_MAX);                   break;
+			case FM_EXP2:  arm_vexp2_q31(lBufA[0], lBufB[0], DSP_MAX);                  break;
+			default:       arm_vatan2_q31(lBufA[1], lBufA[0], lBufB[0], DSP_MAX);       break;
+			}
+
+		for (n = 0; n < DSP_MAX; n++)
+		{
+			lX   = f->ucQ31 ? lBufA[0][n] : qBufA[0][n];
+			lY   = f->ucQ31 ? lBufA[1][n] : qBufA[1][n];
+			lVec = f->ucQ31 ? lBufB[0][n] : qBufB[0][n];
+			eSt  = dsp_fm_one(f, lX, lY, &lOut, &wShift);
+			dErr = dsp_fm_err(f, lX, lY, lOut, wShift);
+			if (lOut != lVec || wShift != ((f->ucFunc == FM_RECIP || f->ucFunc == FM_ISQRT) ? f->wShift[n] : 0) ||
+			    (eSt == ARM_MATH_SUCCESS) != (dErr >= 0))
+				return INFINITY;
+			if (dErr > dMax)
+				dMax = dErr;
+		}
+	}
+	return dMax;
+}
+
+// ==================================================================================
+/**
+ * @brief  Fixed point reciprocal, inverse square root, logarithms, exp2 and
+ *         atan2 against double
+ * @note   Every q15 input is checked, atan2 and q31 on random values of any
+ *         magnitude and the edges. The largest error must stay within the
+ *         bound the function documents. Side 0 times the float libm call
+ *         on the same values, soft float on the Cortex-M0, which
+ *         Tools/bench_qemu.py --dsp counts.
+ */
+static void dsp_fastmath(void)
+{
+	static const struct
+	{
+		const char *pName;
+		uint8_t     ucFunc, ucQ31;
+		double      dMaxLsb;                  // Documented bound
+	} tFast[] = {
+		{ "arm_reciprocal_q15",  FM_RECIP,  0, 0.6  }, { "arm_reciprocal_q31",  FM_RECIP,  1, 2    },
+		{ "arm_inv_sqrt_q15",    FM_ISQRT,  0, 0.75 }, { "arm_inv_sqrt_q31",    FM_ISQRT,  1, 2    },
+		{ "arm_log2_q15",        FM_LOG2,   0, 0.85 }, { "arm_log2_q31",        FM_LOG2,   1, 1    },
+		{ "arm_log_q15",         FM_LN,     0, 0.9  }, { "arm_log_q31",         FM_LN,     1, 1    },
+		{ "arm_exp2_q15",        FM_EXP2,   0, 1.3  }, { "arm_exp2_q31",        FM_EXP2,   1, 4    },
+		{ "arm_atan2_q15",       FM_ATAN2,  0, 1.5  }, { "arm_atan2_q31",       FM_ATAN2,  1, 5    },
+	};
+	static FastArgDef f;
+	DspCaseDef c = { 0 };
+	uint32_t   i, n, ulBad;
+	double     dMax, dIn;
+
+	for (i = 0; i < sizeof(tFast) / sizeof(tFast[0]); i++)
+	{
+		f.ucFunc = tFast[i].ucFunc;
+		f.ucQ31  = tFast[i].ucQ31;
+		dMax  = ucList || lRunCase >= 0 ? 0 : dsp_fm_check(&f);     // -l and -r skip the sweep
+		ulBad = !(dMax <= tFast[i].dMaxLsb);
+
+		// The timed block, random values in the domain as floats for side 0
+		dsp_fm_fill(&f, -1, DSP_FM_BLOCK);
+		dIn = f.ucFunc == FM_EXP2 ? (f.ucQ31 ? 67108864.0 : 2048.0) : (f.ucQ31 ? 2147483648.0 : 32768.0);
+		for (n = 0; n < DSP_FM_BLOCK; n++)
+		{
+			fBufA[0][n] = (float32_t)((f.ucQ31 ? lBufA[0][n] : qBufA[0][n]) / dIn);
+			fBufA[1][n] = (float32_t)((f.ucQ31 ? lBufA[1][n] : qBufA[1][n]) / dIn);
+		}
+
+		c.pName = tFast[i].pName;
+		c.ucExact = 1;
+		c.pRun = run_fastmath;
+		c.pArg = &f;
+		c.ulSamples = DSP_FM_BLOCK;
+		if (ucList || lRunCase >= 0)
+			snprintf(c.cSize, sizeof(c.cSize), "max %.2f LSB", tFast[i].dMaxLsb);
+		else
+			snprintf(c.cSize, sizeof(c.cSize), "max %.2f of %.2f LSB", dMax, tFast[i].dMaxLsb);
+		dsp_report(&c, &ulBad, &(uint32_t){0}, sizeof(uint32_t));
+	}
+}
+
+
+// ==================================================================================
+int main(int argc, char **argv)
+{
+	int i;
+
+	for (i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-t") && i + 1 < argc)
+			ulTimeMs = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-l"))
+			ucList = 1;
+		else if (!strcmp(argv[i], "-r") && i + 1 < argc)
+			lRunCase = strtol(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+			ucRunSide = strtoul(argv[++i], NULL, 0) != 0;
+		else if (!strcmp(argv[i], "-i") && i + 1 < argc)
+			ulRunIters = strtoul(argv[++i], NULL, 0);
+		else
+		{
+			fprintf(stderr, "usage: %s [-t ms] | -l | -r index [-s side] [-i iters]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	dsp_dot();
+	dsp_fir();
+	dsp_iir();
+	dsp_df1();
+	dsp_mat();
+	dsp_fft();
+	dsp_mixed();
+	dsp_conv();
+	dsp_multi();
+	dsp_tone();
+	dsp_resample();
+	dsp_fastmath();
+
+	if (ucList)
+		return 0;
+	if (lRunCase >= 0)
+	{
+		fprintf(stderr, "no case %d\n", lRunCase);
+		return 2;
+	}
+	printf("%u failed\n", ulFail);
+	return ulFail ? 1 : 0;
+}
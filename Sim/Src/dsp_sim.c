@@ -0,0 +1,46 @@
+/*
+ * dsp_sim.c
+ *
+ * C versions of the CMSIS-DSP routines that only exist as Cortex-M
+ * assembly (TransformFunctions/arm_bitreversal2.S), so the vendored
+ * arm_cfft_q15/q31 build on the host. They follow the ARM_MATH_CM0 branch
+ * of the assembly: every table pair holds the byte offsets of two complex
+ * samples to swap, doubled in the q15 case.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+// ==================================================================================
+void arm_bitreversal_32(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab)
+{
+	uint32_t ulTmp[2];
+	uint8_t *pA, *pB;
+	uint16_t i;
+
+	for (i = 0; i < bitRevLen; i += 2)
+	{
+		pA = (uint8_t *)pSrc + pBitRevTab[i];
+		pB = (uint8_t *)pSrc + pBitRevTab[i + 1];
+		memcpy(ulTmp, pA, 8);
+		memcpy(pA, pB, 8);
+		memcpy(pB, ulTmp, 8);
+	}
+}
+
+// ==================================================================================
+void arm_bitreversal_16(uint16_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab)
+{
+	uint32_t ulTmp;
+	uint8_t *pA, *pB;
+	uint16_t i;
+
+	for (i = 0; i < bitRevLen; i += 2)
+	{
+		pA = (uint8_t *)pSrc + (pBitRevTab[i] >> 1);
+		pB = (uint8_t *)pSrc + (pBitRevTab[i + 1] >> 1);
+		memcpy(&ulTmp, pA, 4);
+		memcpy(pA, pB, 4);
+		memcpy(pB, &ulTmp, 4);
+	}
+}
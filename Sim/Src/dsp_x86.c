@@ -0,0 +1,1187 @@
+/*
+ * dsp_x86.c
+ *
+ * SSE4.1 / AVX2 versions of the heaviest CMSIS-DSP kernels for host runs,
+ * built instead of the vendored C when the Sim build sets DSP_SIMD (see
+ * Sim/CMakeLists.txt). The arm_math.h API and the instance structures are
+ * unchanged, so code that runs on the firmware runs here as it is.
+ *
+ * Results follow the ARM_MATH_CM0 branch of the vendored sources:
+ *
+ *   arm_fir_q15, arm_dot_prod_q7/q15/q31   bit exact, the sums are integers
+ *   arm_fir_f32, arm_mat_mult_f32          bit exact, lanes hold different
+ *                                          outputs, each summed in tap order
+ *   arm_biquad_cascade_df2T_f32            bit exact, lanes hold successive
+ *                                          stages one sample apart
+ *   arm_cfft_mixed_f32                     bit exact but for the sign of a
+ *                                          zero, same operations per butterfly
+ *   arm_dot_prod_f32, arm_cfft_f32         not bit exact, summation order and
+ *                                          FFT algorithm differ (radix 4 DIF)
+ *
+ * Calls too short to fill the lanes take the vendored loops (the *_MIN
+ * lengths). Sim/Src/dsp_main.c (k3na_dsp) checks all of them against the
+ * vendored code and reports the speed up. The build must not add -mfma or
+ * -ffast-math, both change float rounding.
+ */
+
+#include <string.h>
+#include <immintrin.h>
+#include "arm_math.h"
+
+#if !defined(__SSE4_1__)
+#error "dsp_x86.c needs -msse4.1 or -mavx2"
+#endif
+
+// ============= Vector width ===============
+//  One body for both widths: VF is a float vector of VF_N lanes, VD one of
+//  VD_N doubles and VI an integer vector, all of the same size.
+#if defined(__AVX2__)
+
+#define VF_N                8
+#define VD_N                4
+typedef __m256  VF;
+typedef __m256d VD;
+typedef __m256i VI;
+
+#define vf_zero()           _mm256_setzero_ps()
+#define vf_set1(x)          _mm256_set1_ps(x)
+#define vf_load(p)          _mm256_loadu_ps(p)
+#define vf_store(p, v)      _mm256_storeu_ps((p), (v))
+#define vf_add(a, b)        _mm256_add_ps((a), (b))
+#define vf_sub(a, b)        _mm256_sub_ps((a), (b))
+#define vf_mul(a, b)        _mm256_mul_ps((a), (b))
+#define vf_blend(a, b, m)   _mm256_blendv_ps((a), (b), (m))
+#define vf_dup_even(v)      _mm256_moveldup_ps(v)
+#define vf_dup_odd(v)       _mm256_movehdup_ps(v)
+#define vf_swap_pairs(v)    _mm256_permute_ps((v), 0xB1)
+
+#define vd_zero()           _mm256_setzero_pd()
+#define vd_set1(x)          _mm256_set1_pd(x)
+#define vd_load(p)          _mm256_loadu_pd(p)
+#define vd_store(p, v)      _mm256_storeu_pd((p), (v))
+#define vd_add(a, b)        _mm256_add_pd((a), (b))
+#define vd_mul(a, b)        _mm256_mul_pd((a), (b))
+
+#define vi_zero()           _mm256_setzero_si256()
+#define vi_load(p)          _mm256_loadu_si256((const __m256i *)(p))
+#define vi_set1(x)          _mm256_set1_epi32(x)
+#define vi_add32(a, b)      _mm256_add_epi32((a), (b))
+#define vi_sub32(a, b)      _mm256_sub_epi32((a), (b))
+#define vi_add64(a, b)      _mm256_add_epi64((a), (b))
+#define vi_eq32(a, b)       _mm256_cmpeq_epi32((a), (b))
+#define vi_madd16(a, b)     _mm256_madd_epi16((a), (b))
+#define vi_mul32(a, b)      _mm256_mul_epi32((a), (b))
+#define vi_srl64(a, n)      _mm256_srli_epi64((a), (n))
+#define vi_s8to16(p)        _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(p)))
+
+// Sign extends the 32 bit lanes to two vectors of 64 bit lanes
+#define vi_widen_lo(v)      _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v))
+#define vi_widen_hi(v)      _mm256_cvtepi32_epi64(_mm256_extracti128_si256((v), 1))
+
+static inline float vf_hsum(VF v)
+{
+	__m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+
+	s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+	s = _mm_add_ss(s, _mm_movehdup_ps(s));
+	return _mm_cvtss_f32(s);
+}
+
+static inline int64_t vi_hsum64(VI v)
+{
+	__m128i s = _mm_add_epi64(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+
+	return _mm_cvtsi128_si64(s) + _mm_extract_epi64(s, 1);
+}
+
+static inline int32_t vi_hsum32(VI v)
+{
+	__m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+
+	s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+	s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+	return _mm_cvtsi128_si32(s);
+}
+
+// Lane n takes lane n - 1, lane 0 takes x
+static inline VF vf_shift_in(VF v, float x)
+{
+	v = _mm256_permutevar8x32_ps(v, _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6));
+	return _mm256_blend_ps(v, _mm256_set1_ps(x), 0x01);
+}
+
+static inline float vf_lane(VF v, uint32_t n)
+{
+	return _mm256_cvtss_f32(_mm256_permutevar8x32_ps(v, _mm256_set1_epi32(n)));
+}
+
+// Complex numbers n .. n + 3 of a twiddle table read with a stride
+static inline VF vf_twiddle(const float32_t *pTw, uint32_t ulStep)
+{
+	__m128 lo = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)pTw);
+	__m128 hi = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(pTw + 4 * ulStep));
+
+	lo = _mm_loadh_pi(lo, (const __m64 *)(pTw + 2 * ulStep));
+	hi = _mm_loadh_pi(hi, (const __m64 *)(pTw + 6 * ulStep));
+	return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+}
+
+// The other way round, complex lane n goes to p + 2 n ulStep
+static inline void vf_scatter(float32_t *p, uint32_t ulStep, VF v)
+{
+	__m128 lo = _mm256_castps256_ps128(v), hi = _mm256_extractf128_ps(v, 1);
+
+	_mm_storel_pi((__m64 *)p, lo);
+	_mm_storeh_pi((__m64 *)(p + 2 * ulStep), lo);
+	_mm_storel_pi((__m64 *)(p + 4 * ulStep), hi);
+	_mm_storeh_pi((__m64 *)(p + 6 * ulStep), hi);
+}
+
+#else
+
+#define VF_N                4
+#define VD_N                2
+typedef __m128  VF;
+typedef __m128d VD;
+typedef __m128i VI;
+
+#define vf_zero()           _mm_setzero_ps()
+#define vf_set1(x)          _mm_set1_ps(x)
+#define vf_load(p)          _mm_loadu_ps(p)
+#define vf_store(p, v)      _mm_storeu_ps((p), (v))
+#define vf_add(a, b)        _mm_add_ps((a), (b))
+#define vf_sub(a, b)        _mm_sub_ps((a), (b))
+#define vf_mul(a, b)        _mm_mul_ps((a), (b))
+#define vf_blend(a, b, m)   _mm_blendv_ps((a), (b), (m))
+#define vf_dup_even(v)      _mm_moveldup_ps(v)
+#define vf_dup_odd(v)       _mm_movehdup_ps(v)
+#define vf_swap_pairs(v)    _mm_shuffle_ps((v), (v), 0xB1)
+
+#define vd_zero()           _mm_setzero_pd()
+#define vd_set1(x)          _mm_set1_pd(x)
+#define vd_load(p)          _mm_loadu_pd(p)
+#define vd_store(p, v)      _mm_storeu_pd((p), (v))
+#define vd_add(a, b)        _mm_add_pd((a), (b))
+#define vd_mul(a, b)        _mm_mul_pd((a), (b))
+
+#define vi_zero()           _mm_setzero_si128()
+#define vi_load(p)          _mm_loadu_si128((const __m128i *)(p))
+#define vi_set1(x)          _mm_set1_epi32(x)
+#define vi_add32(a, b)      _mm_add_epi32((a), (b))
+#define vi_sub32(a, b)      _mm_sub_epi32((a), (b))
+#define vi_add64(a, b)      _mm_add_epi64((a), (b))
+#define vi_eq32(a, b)       _mm_cmpeq_epi32((a), (b))
+#define vi_madd16(a, b)     _mm_madd_epi16((a), (b))
+#define vi_mul32(a, b)      _mm_mul_epi32((a), (b))
+#define vi_srl64(a, n)      _mm_srli_epi64((a), (n))
+#define vi_s8to16(p)        _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i *)(p)))
+
+#define vi_widen_lo(v)      _mm_cvtepi32_epi64(v)
+#define vi_widen_hi(v)      _mm_cvtepi32_epi64(_mm_srli_si128((v), 8))
+
+static inline float vf_hsum(VF v)
+{
+	v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+	v = _mm_add_ss(v, _mm_movehdup_ps(v));
+	return _mm_cvtss_f32(v);
+}
+
+static inline int64_t vi_hsum64(VI v)
+{
+	return _mm_cvtsi128_si64(v) + _mm_extract_epi64(v, 1);
+}
+
+static inline int32_t vi_hsum32(VI v)
+{
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0x4E));
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0xB1));
+	return _mm_cvtsi128_si32(v);
+}
+
+static inline VF vf_shift_in(VF v, float x)
+{
+	v = _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4));
+	return _mm_move_ss(v, _mm_set_ss(x));
+}
+
+static inline float vf_lane(VF v, uint32_t n)
+{
+	return _mm_cvtss_f32(_mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(v),
+	                     _mm_set1_epi32(0x03020100 + n * 0x04040404))));
+}
+
+static inline VF vf_twiddle(const float32_t *pTw, uint32_t ulStep)
+{
+	__m128 v = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)pTw);
+
+	return _mm_loadh_pi(v, (const __m64 *)(pTw + 2 * ulStep));
+}
+
+static inline void vf_scatter(float32_t *p, uint32_t ulStep, VF v)
+{
+	_mm_storel_pi((__m64 *)p, v);
+	_mm_storeh_pi((__m64 *)(p + 2 * ulStep), v);
+}
+
+#endif
+
+#define VF_PAIRS            (VF_N / 2)        // Complex numbers per VF
+
+#define FIR_CHUNK           256               // Outputs per pass of the q15 FIR
+#define FIR_Q15_TAPS        1024              // Longest q15 FIR summed in doubles
+
+// Below these lengths the lanes lose to the vendored loops, the set up and
+// the horizontal sums outweigh the few vector steps (k3na_dsp, SSE4 and AVX2)
+#define DOT_MIN             (2 * VF_N)        // Dot product length
+#define FIR_F32_MIN         VF_N              // Outputs per call of the f32 FIR
+#define FIR_Q15_MIN         32                // Outputs per call of the q15 FIR, the taps go to doubles every call
+#define MAT_MIN             VF_N              // Columns of the result
+#define MIXED_MIN           VF_PAIRS          // Butterflies per group of a mixed radix stage
+
+
+// ==================================================================================
+//  Integer sums
+// ==================================================================================
+
+// Vectors shorter than DOT_MIN take plain loops. gcc would vectorize those
+// again, with set up that costs more than the few products save
+#pragma GCC push_options
+#pragma GCC optimize ("no-tree-vectorize")
+
+/**
+ * @brief  Sum of q15 products with a 64 bit result
+ * @details pmaddwd adds two products in 32 bits, which only wraps for
+ *          (-32768 * -32768) * 2 = 2^31; that lane reads INT32_MIN, a value
+ *          no other pair gives, so those lanes are counted and 2^32 added
+ *          back for each one.
+ */
+static inline int64_t sum_q15(const q15_t *pA, const q15_t *pB, uint32_t ulNum)
+{
+	const VI vMin = vi_set1(INT32_MIN);
+	VI       vAcc = vi_zero(), vWrap = vi_zero(), vM;
+	int64_t  llSum;
+	uint32_t i = 0;
+
+	for (; i + 2 * VF_N <= ulNum; i += 2 * VF_N)
+	{
+		vM    = vi_madd16(vi_load(pA + i), vi_load(pB + i));
+		vWrap = vi_sub32(vWrap, vi_eq32(vM, vMin));
+		vAcc  = vi_add64(vAcc, vi_add64(vi_widen_lo(vM), vi_widen_hi(vM)));
+	}
+	llSum = vi_hsum64(vAcc) + ((int64_t)vi_hsum32(vWrap) << 32);
+
+	for (; i < ulNum; i++)
+		llSum += (q31_t)pA[i] * pB[i];
+	return llSum;
+}
+
+
+// ==================================================================================
+/**
+ * @brief  sum_q15() or, below DOT_MIN, the vendored loop
+ */
+static inline int64_t dot_q15(const q15_t *pA, const q15_t *pB, uint32_t ulNum)
+{
+	int64_t  llSum = 0;
+	uint32_t i;
+
+	if (ulNum >= DOT_MIN)
+		return sum_q15(pA, pB, ulNum);
+	for (i = 0; i < ulNum; i++)
+		llSum += (q31_t)pA[i] * pB[i];
+	return llSum;
+}
+
+// ==================================================================================
+void arm_dot_prod_q15(q15_t *pSrcA, q15_t *pSrcB, uint32_t blockSize, q63_t *result)
+{
+	*result = dot_q15(pSrcA, pSrcB, blockSize);
+}
+
+// ==================================================================================
+/**
+ * @brief  Every product is shifted right by 14 before it is added (16.48)
+ * @details There is no 64 bit arithmetic shift below AVX-512, so 2^62 is
+ *          added first, making every product positive, and the 2^48 each
+ *          one carries after the shift is taken off the total again.
+ */
+void arm_dot_prod_q31(q31_t *pSrcA, q31_t *pSrcB, uint32_t blockSize, q63_t *result)
+{
+#if defined(__AVX2__)
+	const VI vBias = _mm256_set1_epi64x(1LL << 62);
+#else
+	const VI vBias = _mm_set1_epi64x(1LL << 62);
+#endif
+	VI       vAcc = vi_zero(), vA, vB;
+	uint64_t ullSum = 0;
+	uint32_t i = 0;
+
+	if (blockSize < DOT_MIN)
+	{
+		for (; i < blockSize; i++)
+			ullSum += (uint64_t)(((q63_t)pSrcA[i] * pSrcB[i]) >> 14);
+		*result = (q63_t)ullSum;
+		return;
+	}
+
+	for (; i + VF_N <= blockSize; i += VF_N)
+	{
+		vA   = vi_load(pSrcA + i);
+		vB   = vi_load(pSrcB + i);
+		vAcc = vi_add64(vAcc, vi_srl64(vi_add64(vi_mul32(vA, vB), vBias), 14));
+		vAcc = vi_add64(vAcc, vi_srl64(vi_add64(vi_mul32(vi_srl64(vA, 32), vi_srl64(vB, 32)), vBias), 14));
+	}
+	ullSum = (uint64_t)vi_hsum64(vAcc) - (uint64_t)i * (1ULL << 48);
+
+	for (; i < blockSize; i++)
+		ullSum += (uint64_t)(((q63_t)pSrcA[i] * pSrcB[i]) >> 14);
+	*result = (q63_t)ullSum;
+}
+
+// ==================================================================================
+void arm_dot_prod_q7(q7_t *pSrcA, q7_t *pSrcB, uint32_t blockSize, q31_t *result)
+{
+	VI       vAcc = vi_zero();
+	uint32_t ulSum = 0;
+	uint32_t i = 0;
+
+	if (blockSize < DOT_MIN)
+	{
+		for (; i < blockSize; i++)
+			ulSum += (uint32_t)((q15_t)pSrcA[i] * pSrcB[i]);
+		*result = (q31_t)ulSum;
+		return;
+	}
+
+	// Products of q7 fit pmaddwd without wrapping; the q31 total wraps as the C does
+	for (; i + 2 * VF_N <= blockSize; i += 2 * VF_N)
+		vAcc = vi_add32(vAcc, vi_madd16(vi_s8to16(pSrcA + i), vi_s8to16(pSrcB + i)));
+	ulSum = (uint32_t)vi_hsum32(vAcc);
+
+	for (; i < blockSize; i++)
+		ulSum += (uint32_t)((q15_t)pSrcA[i] * pSrcB[i]);
+	*result = (q31_t)ulSum;
+}
+
+// ==================================================================================
+void arm_dot_prod_f32(float32_t *pSrcA, float32_t *pSrcB, uint32_t blockSize, float32_t *result)
+{
+	VF        vAcc0 = vf_zero(), vAcc1 = vf_zero();
+	float32_t fSum = 0.0f;
+	uint32_t  i = 0;
+
+	if (blockSize < DOT_MIN)
+	{
+		for (; i < blockSize; i++)                    // The vendored order, bit exact
+			fSum += pSrcA[i] * pSrcB[i];
+		*result = fSum;
+		return;
+	}
+
+	for (; i + 2 * VF_N <= blockSize; i += 2 * VF_N)
+	{
+		vAcc0 = vf_add(vAcc0, vf_mul(vf_load(pSrcA + i), vf_load(pSrcB + i)));
+		vAcc1 = vf_add(vAcc1, vf_mul(vf_load(pSrcA + i + VF_N), vf_load(pSrcB + i + VF_N)));
+	}
+	fSum = vf_hsum(vf_add(vAcc0, vAcc1));
+
+	for (; i < blockSize; i++)
+		fSum += pSrcA[i] * pSrcB[i];
+	*result = fSum;
+}
+
+#pragma GCC pop_options
+
+
+// ==================================================================================
+//  FIR
+// ==================================================================================
+
+/**
+ * @brief  Sums of up to FIR_Q15_TAPS q15 products are exact in doubles
+ *         (2^30 * 2^10 < 2^53), so the q15 FIR runs as a double FIR across
+ *         outputs on FIR_CHUNK converted samples at a time. Longer filters
+ *         and short blocks, which would not pay back the conversion of the
+ *         taps, sum every output with pmaddwd.
+ */
+void arm_fir_q15(const arm_fir_instance_q15 *S, q15_t *pSrc, q15_t *pDst, uint32_t blockSize)
+{
+	uint32_t ulTaps = S->numTaps;
+	q15_t   *pState = S->pState;
+	double   dX[FIR_CHUNK + FIR_Q15_TAPS], dB[FIR_Q15_TAPS], dAcc[FIR_CHUNK], *px;
+	VD       vAcc0, vAcc1, vAcc2, vAcc3, vB;
+	uint32_t n, i, k, ulNum;
+
+	if (ulTaps > FIR_Q15_TAPS || blockSize < FIR_Q15_MIN)
+	{
+		if (blockSize < FIR_Q15_MIN)
+			for (n = 0; n < blockSize; n++)
+				pState[ulTaps - 1U + n] = pSrc[n];
+		else
+			memcpy(&pState[ulTaps - 1U], pSrc, blockSize * sizeof(q15_t));
+		for (n = 0; n < blockSize; n++)
+			pDst[n] = (q15_t)__SSAT((q31_t)(dot_q15(&pState[n], S->pCoeffs, ulTaps) >> 15), 16);
+		if (ulTaps < DOT_MIN)
+			for (n = 0; n + 1U < ulTaps; n++)
+				pState[n] = pState[blockSize + n];
+		else
+			memmove(pState, &pState[blockSize], (ulTaps - 1U) * sizeof(q15_t));
+		return;
+	}
+
+	memcpy(&pState[ulTaps - 1U], pSrc, blockSize * sizeof(q15_t));
+
+	for (k = 0; k < ulTaps; k++)
+		dB[k] = S->pCoeffs[k];
+
+	for (n = 0; n < blockSize; n += ulNum)
+	{
+		ulNum = blockSize - n < FIR_CHUNK ? blockSize - n : FIR_CHUNK;
+		for (i = 0; i < ulNum + ulTaps - 1U; i++)
+			dX[i] = pState[n + i];
+
+		for (i = 0; i + 4 * VD_N <= ulNum; i += 4 * VD_N)
+		{
+			px    = &dX[i];
+			vAcc0 = vAcc1 = vAcc2 = vAcc3 = vd_zero();
+			for (k = 0; k < ulTaps; k++, px++)
+			{
+				vB    = vd_set1(dB[k]);
+				vAcc0 = vd_add(vAcc0, vd_mul(vd_load(px), vB));
+				vAcc1 = vd_add(vAcc1, vd_mul(vd_load(px + VD_N), vB));
+				vAcc2 = vd_add(vAcc2, vd_mul(vd_load(px + 2 * VD_N), vB));
+				vAcc3 = vd_add(vAcc3, vd_mul(vd_load(px + 3 * VD_N), vB));
+			}
+			vd_store(&dAcc[i], vAcc0);
+			vd_store(&dAcc[i + VD_N], vAcc1);
+			vd_store(&dAcc[i + 2 * VD_N], vAcc2);
+			vd_store(&dAcc[i + 3 * VD_N], vAcc3);
+		}
+		for (; i < ulNum; i++)
+		{
+			dAcc[i] = 0;
+			for (k = 0; k < ulTaps; k++)
+				dAcc[i] += dX[i + k] * dB[k];
+		}
+
+		for (i = 0; i < ulNum; i++)
+			pDst[n + i] = (q15_t)__SSAT((q31_t)((int64_t)dAcc[i] >> 15), 16);
+	}
+
+	memmove(pState, &pState[blockSize], (ulTaps - 1U) * sizeof(q15_t));
+}
+
+// ==================================================================================
+/**
+ * @brief  The vendored loop, for blocks too short to fill a vector of
+ *         outputs; the state moves without memcpy calls as well
+ */
+static void fir_f32_block(const arm_fir_instance_f32 *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	uint32_t   ulTaps  = S->numTaps;
+	float32_t *pState  = S->pState;
+	float32_t *pCoeffs = S->pCoeffs;
+	float32_t  fAcc;
+	uint32_t   n, k;
+
+	for (n = 0; n < blockSize; n++)
+	{
+		pState[ulTaps - 1U + n] = pSrc[n];
+		fAcc = 0.0f;
+		for (k = 0; k < ulTaps; k++)
+			fAcc += pState[n + k] * pCoeffs[k];
+		pDst[n] = fAcc;
+	}
+	for (k = 0; k + 1U < ulTaps; k++)
+		pState[k] = pState[blockSize + k];
+}
+
+// ==================================================================================
+/**
+ * @brief  Four vectors of outputs at a time, every lane adds its taps in the
+ *         order of the C loop
+ */
+void arm_fir_f32(const arm_fir_instance_f32 *S, float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	uint32_t   ulTaps  = S->numTaps;
+	float32_t *pState  = S->pState;
+	float32_t *pCoeffs = S->pCoeffs;
+	VF         vAcc0, vAcc1, vAcc2, vAcc3, vB;
+	float32_t  fAcc, *px;
+	uint32_t   n = 0, k;
+
+	if (blockSize < FIR_F32_MIN)
+	{
+		fir_f32_block(S, pSrc, pDst, blockSize);
+		return;
+	}
+
+	memcpy(&pState[ulTaps - 1U], pSrc, blockSize * sizeof(float32_t));
+
+	for (; n + 4 * VF_N <= blockSize; n += 4 * VF_N)
+	{
+		px    = &pState[n];
+		vAcc0 = vAcc1 = vAcc2 = vAcc3 = vf_zero();
+		for (k = 0; k < ulTaps; k++, px++)
+		{
+			vB    = vf_set1(pCoeffs[k]);
+			vAcc0 = vf_add(vAcc0, vf_mul(vf_load(px), vB));
+			vAcc1 = vf_add(vAcc1, vf_mul(vf_load(px + VF_N), vB));
+			vAcc2 = vf_add(vAcc2, vf_mul(vf_load(px + 2 * VF_N), vB));
+			vAcc3 = vf_add(vAcc3, vf_mul(vf_load(px + 3 * VF_N), vB));
+		}
+		vf_store(&pDst[n], vAcc0);
+		vf_store(&pDst[n + VF_N], vAcc1);
+		vf_store(&pDst[n + 2 * VF_N], vAcc2);
+		vf_store(&pDst[n + 3 * VF_N], vAcc3);
+	}
+	for (; n + VF_N <= blockSize; n += VF_N)
+	{
+		px    = &pState[n];
+		vAcc0 = vf_zero();
+		for (k = 0; k < ulTaps; k++, px++)
+			vAcc0 = vf_add(vAcc0, vf_mul(vf_load(px), vf_set1(pCoeffs[k])));
+		vf_store(&pDst[n], vAcc0);
+	}
+	for (; n < blockSize; n++)
+	{
+		fAcc = 0.0f;
+		for (k = 0; k < ulTaps; k++)
+			fAcc += pState[n + k] * pCoeffs[k];
+		pDst[n] = fAcc;
+	}
+
+	memmove(pState, &pState[blockSize], (ulTaps - 1U) * sizeof(float32_t));
+}
+
+
+// ==================================================================================
+//  Biquad cascade, direct form II transposed
+// ==================================================================================
+
+#define BIQUAD_FILL         2                 // Samples per stage below which the lanes lose
+
+/**
+ * @brief  Up to VF_N stages run side by side, lane s is stage s and works on
+ *         the sample lane s - 1 finished one step before. Lanes outside
+ *         vActive keep their state, which covers the steps where the
+ *         pipeline fills and drains.
+ */
+static inline VF biquad_step(VF vIn, VF *pD1, VF *pD2, const VF *vCoef, VF vActive)
+{
+	VF vY  = vf_add(vf_mul(vCoef[0], vIn), *pD1);
+	VF vD1 = vf_add(vf_add(vf_mul(vCoef[1], vIn), vf_mul(vCoef[3], vY)), *pD2);
+	VF vD2 = vf_add(vf_mul(vCoef[2], vIn), vf_mul(vCoef[4], vY));
+
+	*pD1 = vf_blend(*pD1, vD1, vActive);
+	*pD2 = vf_blend(*pD2, vD2, vActive);
+	return vY;
+}
+
+// ==================================================================================
+/**
+ * @brief  One stage on its own, the vendored loop; a lone stage gains
+ *         nothing from the lanes, nor do short blocks, where filling and
+ *         draining the pipeline outweighs the steps it saves
+ */
+static void biquad_stage(const float32_t *pCoef, float32_t *pState, const float32_t *pIn, float32_t *pOut, uint32_t ulNum)
+{
+	float32_t fD1 = pState[0], fD2 = pState[1], fX, fY;
+	uint32_t  t;
+
+	for (t = 0; t < ulNum; t++)
+	{
+		fX = pIn[t];
+		fY = (pCoef[0] * fX) + fD1;
+		pOut[t] = fY;
+		fD1 = ((pCoef[1] * fX) + (pCoef[3] * fY)) + fD2;
+		fD2 = (pCoef[2] * fX) + (pCoef[4] * fY);
+	}
+	pState[0] = fD1;
+	pState[1] = fD2;
+}
+
+// ==================================================================================
+void arm_biquad_cascade_df2T_f32(const arm_biquad_cascade_df2T_instance_f32 *S,
+                                 float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	float32_t  fCoef[5][VF_N], fD1[VF_N], fD2[VF_N], fLane[VF_N];
+	float32_t *pIn = pSrc;
+	uint32_t   ulStage = 0, ulNum, ulLast, s, c, t;
+	VF         vCoef[5], vD1, vD2, vY, vAll, vMask;
+	int32_t    lTime;
+
+	while (ulStage < S->numStages)
+	{
+		ulNum  = S->numStages - ulStage;
+		ulNum  = ulNum > VF_N ? VF_N : ulNum;
+		ulLast = ulNum - 1U;
+		if (ulNum == 1U || blockSize < ulNum * BIQUAD_FILL)
+		{
+			for (s = 0; s < ulNum; s++, ulStage++)
+			{
+				biquad_stage(&S->pCoeffs[ulStage * 5], &S->pState[ulStage * 2], pIn, pDst, blockSize);
+				pIn = pDst;
+			}
+			continue;
+		}
+
+		memset(fCoef, 0, sizeof(fCoef));
+		memset(fD1, 0, sizeof(fD1));
+		memset(fD2, 0, sizeof(fD2));
+		for (s = 0; s < ulNum; s++)
+		{
+			for (c = 0; c < 5; c++)
+				fCoef[c][s] = S->pCoeffs[(ulStage + s) * 5 + c];
+			fD1[s] = S->pState[(ulStage + s) * 2];
+			fD2[s] = S->pState[(ulStage + s) * 2 + 1];
+		}
+		for (c = 0; c < 5; c++)
+			vCoef[c] = vf_load(fCoef[c]);
+		vD1 = vf_load(fD1);
+		vD2 = vf_load(fD2);
+
+		// Lanes past the last stage never count as active
+		for (s = 0; s < VF_N; s++)
+			fLane[s] = s < ulNum ? -0.0f : 0.0f;
+		vAll = vf_load(fLane);
+
+		vY = vf_zero();
+		for (t = 0; t < blockSize + ulLast; t++)
+		{
+			vY = vf_shift_in(vY, t < blockSize ? pIn[t] : 0.0f);
+			if (t >= ulLast && t < blockSize)
+				vMask = vAll;
+			else
+			{
+				// Stage s works on sample t - s
+				for (s = 0; s < VF_N; s++)
+				{
+					lTime    = (int32_t)t - (int32_t)s;
+					fLane[s] = (s < ulNum && lTime >= 0 && lTime < (int32_t)blockSize) ? -0.0f : 0.0f;
+				}
+				vMask = vf_load(fLane);
+			}
+			vY = biquad_step(vY, &vD1, &vD2, vCoef, vMask);
+			if (t >= ulLast)
+				pDst[t - ulLast] = vf_lane(vY, ulLast);
+		}
+
+		vf_store(fD1, vD1);
+		vf_store(fD2, vD2);
+		for (s = 0; s < ulNum; s++)
+		{
+			S->pState[(ulStage + s) * 2]     = fD1[s];
+			S->pState[(ulStage + s) * 2 + 1] = fD2[s];
+		}
+		ulStage += ulNum;
+		pIn = pDst;
+	}
+}
+
+
+// ==================================================================================
+//  Matrix multiply
+// ==================================================================================
+
+/**
+ * @brief  The vendored loop, for results narrower than a vector
+ */
+static void mat_mult_rows(const float32_t *pA, const float32_t *pB, float32_t *pC,
+                          uint32_t ulRows, uint32_t ulInner, uint32_t ulCols)
+{
+	const float32_t *pIn1, *pIn2;
+	float32_t        fSum;
+	uint32_t         i, j, k;
+
+	for (i = 0; i < ulRows; i++, pA += ulInner)
+		for (j = 0; j < ulCols; j++)
+		{
+			fSum = 0.0f;
+			pIn1 = pA;
+			pIn2 = pB + j;
+			for (k = 0; k < ulInner; k++, pIn2 += ulCols)
+				fSum += *pIn1++ * *pIn2;
+			*pC++ = fSum;
+		}
+}
+
+// ==================================================================================
+arm_status arm_mat_mult_f32(const arm_matrix_instance_f32 *pSrcA, const arm_matrix_instance_f32 *pSrcB,
+                            arm_matrix_instance_f32 *pDst)
+{
+	uint32_t   ulRows = pSrcA->numRows, ulInner = pSrcA->numCols, ulCols = pSrcB->numCols;
+	float32_t *pA, *pB = pSrcB->pData, *pC;
+	VF         vAcc0, vAcc1, vAcc2, vAcc3, vA;
+	float32_t  fSum;
+	uint32_t   i, j, k;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+	if ((pSrcA->numCols != pSrcB->numRows) ||
+	    (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+		return ARM_MATH_SIZE_MISMATCH;
+#endif
+
+	if (ulCols < MAT_MIN)
+	{
+		mat_mult_rows(pSrcA->pData, pB, pDst->pData, ulRows, ulInner, ulCols);
+		return ARM_MATH_SUCCESS;
+	}
+
+	// Lanes are columns of the result, each one sums over k in order
+	for (i = 0; i < ulRows; i++)
+	{
+		pA = &pSrcA->pData[i * ulInner];
+		pC = &pDst->pData[i * ulCols];
+
+		for (j = 0; j + 4 * VF_N <= ulCols; j += 4 * VF_N)
+		{
+			vAcc0 = vAcc1 = vAcc2 = vAcc3 = vf_zero();
+			for (k = 0; k < ulInner; k++)
+			{
+				vA    = vf_set1(pA[k]);
+				vAcc0 = vf_add(vAcc0, vf_mul(vA, vf_load(&pB[k * ulCols + j])));
+				vAcc1 = vf_add(vAcc1, vf_mul(vA, vf_load(&pB[k * ulCols + j + VF_N])));
+				vAcc2 = vf_add(vAcc2, vf_mul(vA, vf_load(&pB[k * ulCols + j + 2 * VF_N])));
+				vAcc3 = vf_add(vAcc3, vf_mul(vA, vf_load(&pB[k * ulCols + j + 3 * VF_N])));
+			}
+			vf_store(&pC[j], vAcc0);
+			vf_store(&pC[j + VF_N], vAcc1);
+			vf_store(&pC[j + 2 * VF_N], vAcc2);
+			vf_store(&pC[j + 3 * VF_N], vAcc3);
+		}
+		for (; j + VF_N <= ulCols; j += VF_N)
+		{
+			vAcc0 = vf_zero();
+			for (k = 0; k < ulInner; k++)
+				vAcc0 = vf_add(vAcc0, vf_mul(vf_set1(pA[k]), vf_load(&pB[k * ulCols + j])));
+			vf_store(&pC[j], vAcc0);
+		}
+		for (; j < ulCols; j++)
+		{
+			fSum = 0.0f;
+			for (k = 0; k < ulInner; k++)
+				fSum += pA[k] * pB[k * ulCols + j];
+			pC[j] = fSum;
+		}
+	}
+	return ARM_MATH_SUCCESS;
+}
+
+
+// ==================================================================================
+//  Complex FFT
+// ==================================================================================
+
+// (re + j im)(c -/+ j s) = (re c +/- im s) + j (im c -/+ re s), vSign picks the sign per lane
+static inline VF cfft_mul(VF vX, VF vW, VF vSign)
+{
+	return vf_add(vf_mul(vX, vf_dup_even(vW)), vf_mul(vf_swap_pairs(vX), vf_mul(vf_dup_odd(vW), vSign)));
+}
+
+// ==================================================================================
+/**
+ * @brief  Radix 2 butterflies n .. n + VF_PAIRS - 1 of a group of 2 * ulQ
+ */
+static inline void cfft_radix2(float32_t *pX, uint32_t ulQ, const float32_t *pTw, uint32_t n, uint32_t ulStep, VF vSign)
+{
+	VF vU = vf_load(pX), vV = vf_load(pX + 2 * ulQ);
+
+	vf_store(pX, vf_add(vU, vV));
+	vf_store(pX + 2 * ulQ, cfft_mul(vf_sub(vU, vV), vf_twiddle(&pTw[2 * n * ulStep], ulStep), vSign));
+}
+
+// ==================================================================================
+/**
+ * @brief  Radix 4 butterflies n .. n + VF_PAIRS - 1 of a group of 4 * ulQ
+ * @details Two radix 2 stages in one pass, the output order stays the same:
+ *          y[n] = a + c, y[n + q] = (a - c) W^2n, y[n + 2q] = (b + d) W^n,
+ *          y[n + 3q] = (b - d) W^3n with a, b = x0 +/- x2, c = x1 + x3 and
+ *          d = (x1 - x3) (-/+j). W^3n is why the tables hold 3/4 of a turn.
+ */
+static inline void cfft_radix4(float32_t *pX, uint32_t ulQ, const float32_t *pTw, uint32_t n, uint32_t ulStep, VF vSign)
+{
+	VF v0 = vf_load(pX), v1 = vf_load(pX + 2 * ulQ), v2 = vf_load(pX + 4 * ulQ), v3 = vf_load(pX + 6 * ulQ);
+	VF vA = vf_add(v0, v2), vB = vf_sub(v0, v2), vC = vf_add(v1, v3);
+	VF vD = vf_mul(vf_swap_pairs(vf_sub(v1, v3)), vSign);
+
+	vf_store(pX, vf_add(vA, vC));
+	vf_store(pX + 2 * ulQ, cfft_mul(vf_sub(vA, vC), vf_twiddle(&pTw[4 * n * ulStep], 2 * ulStep), vSign));
+	vf_store(pX + 4 * ulQ, cfft_mul(vf_add(vB, vD), vf_twiddle(&pTw[2 * n * ulStep], ulStep), vSign));
+	vf_store(pX + 6 * ulQ, cfft_mul(vf_sub(vB, vD), vf_twiddle(&pTw[6 * n * ulStep], 3 * ulStep), vSign));
+}
+
+// ==================================================================================
+/**
+ * @brief  Radix 4 butterfly of the last stage, groups of 4, every W is 1
+ */
+static inline void cfft_radix4_last(float32_t *pX, __m128 vSign)
+{
+	const __m128 vHalf = _mm_setr_ps(1.0f, 1.0f, -1.0f, -1.0f);
+	__m128 v01 = _mm_loadu_ps(pX), v23 = _mm_loadu_ps(pX + 4);
+	__m128 vAC = _mm_add_ps(v01, v23);                                // a, c
+	__m128 vBD = _mm_sub_ps(v01, v23);                                // b, x1 - x3
+
+	vBD = _mm_blend_ps(vBD, _mm_mul_ps(_mm_shuffle_ps(vBD, vBD, 0xB1), vSign), 0x0C);
+	_mm_storeu_ps(pX,     _mm_add_ps(_mm_movelh_ps(vAC, vAC), _mm_mul_ps(_mm_movehl_ps(vAC, vAC), vHalf)));
+	_mm_storeu_ps(pX + 4, _mm_add_ps(_mm_movelh_ps(vBD, vBD), _mm_mul_ps(_mm_movehl_ps(vBD, vBD), vHalf)));
+}
+
+// ==================================================================================
+/**
+ * @brief  Decimation in frequency, natural order in, bit reversed out
+ * @details Radix 4 stages, led by one radix 2 stage when the length is an
+ *          odd power of two. A group of G values reads W_G^n as table
+ *          entry n * ulLen / G.
+ */
+static void cfft_dif(float32_t *pX, uint32_t ulLen, const float32_t *pTw, uint8_t ucInverse)
+{
+	float32_t fSign[VF_N];
+	uint32_t  ulGroup = ulLen, ulStep = 1, ulQ, g, n, s;
+	VF        vSign;
+
+	for (s = 0; s < VF_N; s++)
+		fSign[s] = ((s & 1) == 0) == (ucInverse == 0) ? 1.0f : -1.0f;
+	vSign = vf_load(fSign);
+
+	if (ulLen & 0xAAAAAAAAU)
+	{
+		for (n = 0; n < ulLen / 2; n += VF_PAIRS)
+			cfft_radix2(&pX[2 * n], ulLen / 2, pTw, n, 1, vSign);
+		ulGroup = ulLen / 2;
+		ulStep  = 2;
+	}
+
+	for (; ulGroup > 4; ulGroup >>= 2, ulStep <<= 2)
+	{
+		ulQ = ulGroup / 4;
+		for (g = 0; g < ulLen; g += ulGroup)
+			for (n = 0; n < ulQ; n += VF_PAIRS)
+				cfft_radix4(&pX[2 * (g + n)], ulQ, pTw, n, ulStep, vSign);
+	}
+
+	for (g = 0; g < ulLen; g += 4)
+		cfft_radix4_last(&pX[2 * g], _mm_loadu_ps(fSign));
+}
+
+// ==================================================================================
+static void cfft_bitrev(float32_t *pX, uint32_t ulLen)
+{
+	uint64_t *pC = (uint64_t *)pX;
+	uint64_t  ullTmp;
+	uint32_t  i, j = 0, b;
+
+	for (i = 0; i < ulLen; i++)
+	{
+		if (i < j)
+		{
+			ullTmp = pC[i];
+			pC[i]  = pC[j];
+			pC[j]  = ullTmp;
+		}
+		for (b = ulLen >> 1; j & b; b >>= 1)
+			j ^= b;
+		j |= b;
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Same contract as the vendored arm_cfft_f32
+ * @details The vendored mixed radix code leaves its result in an order only
+ *          pBitRevTable knows. With bitReverseFlag = 0 the natural order
+ *          result is put into that order by running the table's swaps
+ *          backwards.
+ */
+void arm_cfft_f32(const arm_cfft_instance_f32 *S, float32_t *p1, uint8_t ifftFlag, uint8_t bitReverseFlag)
+{
+	uint32_t  ulLen = S->fftLen, n;
+	uint64_t *pC = (uint64_t *)p1, ullTmp;
+	int32_t   i;
+	VF        vScale;
+
+	cfft_dif(p1, ulLen, S->pTwiddle, ifftFlag == 1U);
+	cfft_bitrev(p1, ulLen);
+
+	if (!bitReverseFlag)
+		for (i = (int32_t)S->bitRevLength - 2; i >= 0; i -= 2)
+		{
+			ullTmp = pC[S->pBitRevTable[i] >> 3];
+			pC[S->pBitRevTable[i] >> 3]     = pC[S->pBitRevTable[i + 1] >> 3];
+			pC[S->pBitRevTable[i + 1] >> 3] = ullTmp;
+		}
+
+	if (ifftFlag == 1U)
+	{
+		vScale = vf_set1(1.0f / (float32_t)ulLen);
+		for (n = 0; n < 2 * ulLen; n += VF_N)
+			vf_store(&p1[n], vf_mul(vf_load(&p1[n]), vScale));
+	}
+}
+
+
+// ==================================================================================
+//  Mixed radix complex FFT
+// ==================================================================================
+
+extern void arm_cfft_mixed_reorder_32(uint32_t *pSrc, const uint16_t *pCycles, uint16_t cyclesLength);
+
+#define C3_F32              0.86602540378f    // sin(2 pi / 3)
+#define C51_F32             0.30901699437f    // cos(2 pi / 5)
+#define C52_F32             -0.80901699437f   // cos(4 pi / 5)
+#define S51_F32             0.95105651630f    // sin(2 pi / 5)
+#define S52_F32             0.58778525229f    // sin(4 pi / 5)
+
+#define MIXED_RADIX_MAX     5
+
+// The vendored stages: butterfly k of a group takes sample k of each of its
+// radix blocks of m samples. Here the lanes hold VF_PAIRS neighbouring k,
+// or where m is below MIXED_MIN, as in the last stage, VF_PAIRS
+// neighbouring groups with the same k. The operations are those of the vendored loops, and
+// what does not fill a vector takes those loops. Lanes of butterfly 0 are
+// multiplied by a twiddle of 1 that the vendored code skips, so a zero
+// may come out with the other sign.
+
+/**
+ * @brief  Radix butterfly of the vendored stages before the twiddles,
+ *         v[0 .. ulRadix - 1] in and out
+ */
+static inline void mixed_butterfly(VF *v, uint32_t ulRadix, VF vSign)
+{
+	VF vA0, vA1, vA2, vB0, vB1, vB2, vM1, vM2, vQ1, vQ2;
+
+	switch (ulRadix)
+	{
+	case 2U:
+		vA0  = vf_add(v[0], v[1]);
+		v[1] = vf_sub(v[0], v[1]);
+		v[0] = vA0;
+		break;
+	case 3U:
+		vA0  = vf_add(v[1], v[2]);
+		vB0  = vf_mul(vf_swap_pairs(vf_mul(vf_set1(C3_F32), vf_sub(v[1], v[2]))), vSign);    // -j d
+		vM1  = vf_sub(v[0], vf_mul(vf_set1(0.5f), vA0));
+		v[0] = vf_add(v[0], vA0);
+		v[1] = vf_add(vM1, vB0);
+		v[2] = vf_sub(vM1, vB0);
+		break;
+	case 4U:
+		vA0  = vf_add(v[0], v[2]);
+		vA1  = vf_sub(v[0], v[2]);
+		vB0  = vf_add(v[1], v[3]);
+		vB1  = vf_mul(vf_swap_pairs(vf_sub(v[1], v[3])), vSign);                          // -j b1
+		v[0] = vf_add(vA0, vB0);
+		v[1] = vf_add(vA1, vB1);
+		v[2] = vf_sub(vA0, vB0);
+		v[3] = vf_sub(vA1, vB1);
+		break;
+	default:
+		vA1  = vf_add(v[1], v[4]);
+		vB1  = vf_sub(v[1], v[4]);
+		vA2  = vf_add(v[2], v[3]);
+		vB2  = vf_sub(v[2], v[3]);
+		vM1  = vf_add(vf_add(v[0], vf_mul(vf_set1(C51_F32), vA1)), vf_mul(vf_set1(C52_F32), vA2));
+		vM2  = vf_add(vf_add(v[0], vf_mul(vf_set1(C52_F32), vA1)), vf_mul(vf_set1(C51_F32), vA2));
+		vQ1  = vf_add(vf_mul(vf_set1(S51_F32), vB1), vf_mul(vf_set1(S52_F32), vB2));
+		vQ2  = vf_sub(vf_mul(vf_set1(S52_F32), vB1), vf_mul(vf_set1(S51_F32), vB2));
+		vQ1  = vf_mul(vf_swap_pairs(vQ1), vSign);                                         // -j q1
+		vQ2  = vf_mul(vf_swap_pairs(vQ2), vSign);
+		v[0] = vf_add(v[0], vf_add(vA1, vA2));
+		v[1] = vf_add(vM1, vQ1);
+		v[2] = vf_add(vM2, vQ2);
+		v[3] = vf_sub(vM2, vQ2);
+		v[4] = vf_sub(vM1, vQ1);
+		break;
+	}
+}
+
+// ==================================================================================
+// Stores y times c - j s
+static inline void mixed_rotate(float32_t *p, float32_t fYr, float32_t fYi, float32_t fC, float32_t fS)
+{
+	p[0] = (fYr * fC) + (fYi * fS);
+	p[1] = (fYi * fC) - (fYr * fS);
+}
+
+// ==================================================================================
+/**
+ * @brief  Butterfly k of the group at p0, the vendored loop body
+ */
+static void mixed_scalar(float32_t *p0, uint32_t ulRadix, uint32_t m, uint32_t k, const float32_t *pTw, uint32_t ulStep)
+{
+	float32_t *p[MIXED_RADIX_MAX], fY[MIXED_RADIX_MAX][2];
+	float32_t  fA0r, fA0i, fA1r, fA1i, fA2r, fA2i, fB0r, fB0i, fB1r, fB1i, fB2r, fB2i;
+	float32_t  fM1r, fM1i, fM2r, fM2i, fQ1r, fQ1i, fQ2r, fQ2i;
+	uint32_t   r;
+
+	for (r = 0; r < ulRadix; r++)
+		p[r] = p0 + 2 * (r * m + k);
+
+	switch (ulRadix)
+	{
+	case 2U:
+		fY[1][0] = p[0][0] - p[1][0];
+		fY[1][1] = p[0][1] - p[1][1];
+		fY[0][0] = p[0][0] + p[1][0];
+		fY[0][1] = p[0][1] + p[1][1];
+		break;
+	case 3U:
+		fA0r = p[1][0] + p[2][0];
+		fA0i = p[1][1] + p[2][1];
+		fB0r = C3_F32 * (p[1][0] - p[2][0]);
+		fB0i = C3_F32 * (p[1][1] - p[2][1]);
+		fM1r = p[0][0] - 0.5f * fA0r;
+		fM1i = p[0][1] - 0.5f * fA0i;
+		fY[0][0] = p[0][0] + fA0r;
+		fY[0][1] = p[0][1] + fA0i;
+		fY[1][0] = fM1r + fB0i;
+		fY[1][1] = fM1i - fB0r;
+		fY[2][0] = fM1r - fB0i;
+		fY[2][1] = fM1i + fB0r;
+		break;
+	case 4U:
+		fA0r = p[0][0] + p[2][0];
+		fA0i = p[0][1] + p[2][1];
+		fA1r = p[0][0] - p[2][0];
+		fA1i = p[0][1] - p[2][1];
+		fB0r = p[1][0] + p[3][0];
+		fB0i = p[1][1] + p[3][1];
+		fB1r = p[1][0] - p[3][0];
+		fB1i = p[1][1] - p[3][1];
+		fY[0][0] = fA0r + fB0r;
+		fY[0][1] = fA0i + fB0i;
+		fY[1][0] = fA1r + fB1i;
+		fY[1][1] = fA1i - fB1r;
+		fY[2][0] = fA0r - fB0r;
+		fY[2][1] = fA0i - fB0i;
+		fY[3][0] = fA1r - fB1i;
+		fY[3][1] = fA1i + fB1r;
+		break;
+	default:
+		fA1r = p[1][0] + p[4][0];
+		fA1i = p[1][1] + p[4][1];
+		fB1r = p[1][0] - p[4][0];
+		fB1i = p[1][1] - p[4][1];
+		fA2r = p[2][0] + p[3][0];
+		fA2i = p[2][1] + p[3][1];
+		fB2r = p[2][0] - p[3][0];
+		fB2i = p[2][1] - p[3][1];
+		fM1r = p[0][0] + (C51_F32 * fA1r) + (C52_F32 * fA2r);
+		fM1i = p[0][1] + (C51_F32 * fA1i) + (C52_F32 * fA2i);
+		fM2r = p[0][0] + (C52_F32 * fA1r) + (C51_F32 * fA2r);
+		fM2i = p[0][1] + (C52_F32 * fA1i) + (C51_F32 * fA2i);
+		fQ1r = (S51_F32 * fB1r) + (S52_F32 * fB2r);
+		fQ1i = (S51_F32 * fB1i) + (S52_F32 * fB2i);
+		fQ2r = (S52_F32 * fB1r) - (S51_F32 * fB2r);
+		fQ2i = (S52_F32 * fB1i) - (S51_F32 * fB2i);
+		fY[0][0] = p[0][0] + (fA1r + fA2r);
+		fY[0][1] = p[0][1] + (fA1i + fA2i);
+		fY[1][0] = fM1r + fQ1i;
+		fY[1][1] = fM1i - fQ1r;
+		fY[2][0] = fM2r + fQ2i;
+		fY[2][1] = fM2i - fQ2r;
+		fY[3][0] = fM2r - fQ2i;
+		fY[3][1] = fM2i + fQ2r;
+		fY[4][0] = fM1r - fQ1i;
+		fY[4][1] = fM1i + fQ1r;
+		break;
+	}
+
+	p[0][0] = fY[0][0];
+	p[0][1] = fY[0][1];
+	for (r = 1; r < ulRadix; r++)
+		if (k == 0U)
+		{
+			p[r][0] = fY[r][0];
+			p[r][1] = fY[r][1];
+		}
+		else
+			mixed_rotate(p[r], fY[r][0], fY[r][1], pTw[2 * r * k * ulStep], pTw[2 * r * k * ulStep + 1]);
+}
+
+// ==================================================================================
+/**
+ * @brief  One stage of ulLen / (ulRadix * m) groups
+ */
+static void mixed_stage(float32_t *pX, uint32_t ulLen, uint32_t ulRadix, uint32_t m,
+                        const float32_t *pTw, uint32_t ulStep, VF vSign)
+{
+	uint32_t ulVec = m - m % VF_PAIRS;
+	uint32_t ulSpan, g, k, r;
+	VF       v[MIXED_RADIX_MAX];
+
+	if (m < MIXED_MIN)
+	{
+		// Lanes are groups, ulRadix m complex numbers apart, and share the twiddles of k
+		ulSpan = ulRadix * m;
+		for (g = 0; g + ulSpan * VF_PAIRS <= ulLen; g += ulSpan * VF_PAIRS)
+			for (k = 0; k < m; k++)
+			{
+				for (r = 0; r < ulRadix; r++)
+					v[r] = vf_twiddle(&pX[2 * (g + r * m + k)], ulSpan);
+				mixed_butterfly(v, ulRadix, vSign);
+				vf_scatter(&pX[2 * (g + k)], ulSpan, v[0]);
+				for (r = 1; r < ulRadix; r++)
+					vf_scatter(&pX[2 * (g + r * m + k)], ulSpan,
+					           (k == 0U) ? v[r] : cfft_mul(v[r], vf_twiddle(&pTw[2 * r * k * ulStep], 0), vSign));
+			}
+		for (; g < ulLen; g += ulSpan)
+			for (k = 0; k < m; k++)
+				mixed_scalar(&pX[2 * g], ulRadix, m, k, pTw, ulStep);
+		return;
+	}
+
+	for (g = 0; g < ulLen; g += ulRadix * m)
+	{
+		for (k = 0; k < ulVec; k += VF_PAIRS)
+		{
+			for (r = 0; r < ulRadix; r++)
+				v[r] = vf_load(&pX[2 * (g + r * m + k)]);
+			mixed_butterfly(v, ulRadix, vSign);
+			vf_store(&pX[2 * (g + k)], v[0]);
+			for (r = 1; r < ulRadix; r++)
+				vf_store(&pX[2 * (g + r * m + k)],
+				         cfft_mul(v[r], vf_twiddle(&pTw[2 * r * k * ulStep], r * ulStep), vSign));
+		}
+		for (; k < m; k++)
+			mixed_scalar(&pX[2 * g], ulRadix, m, k, pTw, ulStep);
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Same contract as the vendored arm_cfft_mixed_f32
+ */
+void arm_cfft_mixed_f32(const arm_cfft_mixed_instance_f32 *S, float32_t *p1, uint8_t ifftFlag)
+{
+	uint32_t  ulLen = S->fftLen, n = ulLen, m, l, s;
+	float32_t fSign[VF_N], fInv;
+	VF        vSign;
+
+	for (s = 0; s < VF_N; s++)
+		fSign[s] = (s & 1) ? -1.0f : 1.0f;
+	vSign = vf_load(fSign);
+
+	if (ifftFlag == 1U)
+		for (l = 0; l < ulLen; l++)
+			p1[2 * l + 1] = -p1[2 * l + 1];
+
+	for (s = 0; s < S->numStages; s++)
+	{
+		m = n / S->pFactors[s];
+		mixed_stage(p1, ulLen, S->pFactors[s], m, S->pTwiddle, (ulLen / n) * S->twidStride, vSign);
+		n = m;
+	}
+
+	arm_cfft_mixed_reorder_32((uint32_t *)p1, S->pCycles, S->cyclesLength);
+
+	if (ifftFlag == 1U)
+	{
+		fInv = 1.0f / (float32_t)ulLen;
+		for (l = 0; l < ulLen; l++)
+		{
+			p1[2 * l]     *= fInv;
+			p1[2 * l + 1]  = -p1[2 * l + 1] * fInv;
+		}
+	}
+}
@@ -0,0 +1,591 @@
+/*
+ * fleet_main.c
+ *
+ * Capacity model of a show-control server streaming to many K3NA boards.
+ * Every virtual controller owns its framebuffer, segments, timers, CRC
+ * unit and packet parser (stream_parse.c), so thousands of them run side by
+ * side on a work stealing thread pool (work_pool.c) without sharing state.
+ *
+ * The server sends each controller full frames (STREAM_TYPE_FRAME) at its
+ * own rate over its own 1 Mbaud line. A frame that comes due while the line
+ * is still busy waits; frames that come due meanwhile are skipped, the
+ * server always sends the newest. Controllers run main.c's loop in virtual
+ * time: until the first frame arrives they animate their segments, then
+ * they swap in each complete frame and spend the WS2812 write time on it.
+ *
+ * Pixel 0 of a frame carries its number, the others are a hash of the
+ * number and the controller id, so every displayed frame is checked. With
+ * -d the server sends delta packets (STREAM_TYPE_DELTA) between full frames:
+ * each names the image it patches as its BASE and rewrites pixel 0, pixel 1
+ * with the number of the full frame under it and the last pixel, so a delta
+ * shown on anything but that frame is caught. With -x a frame or delta can
+ * fail the CRC; the parser then rejects the deltas built on it, and the
+ * server, reading the controller's ulDeltaErr as telemetry would report it,
+ * sends a full frame next.
+ *
+ *   k3na_fleet [-n controllers] [-t threads] [-s seconds] [-f fps] [-p pixels]
+ *              [-j jitter us] [-x errors per million bytes] [-b batch] [-r seed]
+ *              [-d deltas per full frame] [-v]
+ *     -f, -p  upper limits, each controller draws fps and pixels in [limit / 2, limit]
+ *
+ * Latency is virtual time from the last byte of a frame on the wire to the
+ * strip latching it. Aggregate frame rates are reported in virtual time
+ * (what the fleet shows) and host time (simulator throughput).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "main.h"
+#include "stream_parse.h"
+#include "work_pool.h"
+
+#define FLEET_BYTE_NS       10000ULL                            // 10 bits at 1 Mbaud
+#define FLEET_SPI_PX_NS     38400ULL                            // 24 bits x 8 SPI bits at 5 MHz
+#define FLEET_LATCH_NS      50000ULL
+#define FLEET_TICK_NS       1000000ULL
+#define FLEET_SLICE_NS      (100 * FLEET_TICK_NS)               // Virtual time per pool run
+#define FLEET_START_NS      (1000 * FLEET_TICK_NS)              // Servers start within the first second
+#define FLEET_PKT_MAX       (2 + STREAM_HDR_LEN + STREAM_SEQ_LEN + STREAM_MAX_LED * 3 + STREAM_CRC_LEN)
+#define FLEET_DONE_RING     8
+
+typedef struct
+{
+	// Controller, what one board holds
+	StreamTypeDef     sStream;
+	StreamStatDef     sStat;
+	CRC_HandleTypeDef hCrc;
+	rgb_color         rLed[MAX_NUMB];
+	LedTypeDef        lLed[3];
+	timers            tTimer[MAX_TIMERS];
+	uint32_t          ulMs;                   // HAL tick
+	uint64_t          ullNow;                 // Main loop time, ns
+	uint64_t          ullTick;                // Next SysTick
+
+	// Server and line
+	uint8_t   ucPkt[FLEET_PKT_MAX];
+	uint16_t  wPktLen;
+	uint16_t  wPktSent;                       // Bytes handed to the parser
+	uint64_t  ullPktStart;                    // First byte on the wire
+	uint64_t  ullDue;                         // Next frame the server wants to send
+	uint64_t  ullPeriod;
+	uint16_t  wPixels;
+	uint32_t  ulSeq;
+	uint32_t  ulBase;                         // Last full frame sent, under the deltas
+	uint32_t  ulPrev;                         // Last image sent, the BASE of the next delta
+	uint32_t  ulDeltaErr;                     // Rejections seen, a new one forces a full frame
+	uint8_t   ucDeltas;                       // Delta packets after each full frame
+	uint32_t  ulSeed;
+	uint64_t  ullDone[FLEET_DONE_RING];       // Wire end of frame seq, by seq % ring
+
+	// Results
+	uint32_t  ulSent;
+	uint32_t  ulSkipped;                      // Frames the server never sent, line busy
+	uint32_t  ulShown;
+	uint32_t  ulLocal;                        // Local animation refreshes
+	uint32_t  ulBad;                          // Displayed frames with wrong content
+	uint64_t  ullLatSum;
+	uint64_t  ullLatMax;
+	uint16_t  wId;
+} FleetCtrlDef;
+
+typedef struct
+{
+	FleetCtrlDef *pCtrl;
+	uint32_t      ulNum;
+	uint16_t      wBatch;
+	uint64_t      ullEnd;                     // Run every controller up to here
+	uint32_t      ulErrPpm;
+	uint64_t      ullJitter;
+} FleetDef;
+
+
+// ==================================================================================
+static uint32_t fleet_rand(uint32_t *pSeed)
+{
+	*pSeed ^= *pSeed << 13;
+	*pSeed ^= *pSeed >> 17;
+	*pSeed ^= *pSeed << 5;
+	return *pSeed;
+}
+
+// ==================================================================================
+static rgb_color fleet_pixel(uint16_t wId, uint32_t ulSeq, uint16_t i)
+{
+	uint32_t h = ulSeq * 2654435761u ^ wId * 40503u ^ i * 2246822519u;
+
+	h ^= h >> 15;
+	return (rgb_color){ h, h >> 8, h >> 16 };
+}
+
+// ==================================================================================
+/**
+ * @brief  Packs the next frame of a controller, with the zlib CRC-32
+ * @details A full frame, or with -d a delta on the previous image: COPY of
+ *          pixels 0 and 1 (number and full frame), SEEK and COPY of the last
+ *          pixel.
+ */
+static void fleet_packet(FleetCtrlDef *c)
+{
+	uint8_t  *p = c->ucPkt;
+	uint32_t  ulCrc = 0xFFFFFFFF, k;
+	uint16_t  wLen = c->wPixels * 3, i;
+	uint8_t   ucDelta;
+	rgb_color rPix;
+
+	ucDelta = c->ucDeltas && c->ulSeq % (c->ucDeltas + 1U) && c->ulSent && c->sStat.ulDeltaErr == c->ulDeltaErr;
+	c->ulDeltaErr = c->sStat.ulDeltaErr;
+	if (!ucDelta)
+		c->ulBase = c->ulSeq;
+
+	*p++ = STREAM_SYNC0;
+	*p++ = STREAM_SYNC1;
+	if (ucDelta)
+	{
+		wLen = STREAM_DELTA_HDR + 1 + 6 + 3 + 1 + 3;
+		*p++ = STREAM_TYPE_DELTA;
+		*p++ = wLen;
+		*p++ = wLen >> 8;
+		*p++ = c->ulSeq;
+		*p++ = c->ulSeq >> 8;
+		*p++ = c->ulPrev;
+		*p++ = c->ulPrev >> 8;
+		*p++ = DELTA_OP_COPY | 1;
+	}
+	else
+	{
+		wLen += STREAM_SEQ_LEN;
+		*p++ = STREAM_TYPE_FRAME;
+		*p++ = wLen;
+		*p++ = wLen >> 8;
+		*p++ = c->ulSeq;
+		*p++ = c->ulSeq >> 8;
+	}
+	c->ulPrev = c->ulSeq;
+	*p++ = c->ulSeq;
+	*p++ = c->ulSeq >> 8;
+	*p++ = c->ulSeq >> 16;
+	for (i = 1; i < c->wPixels; i++)
+	{
+		if (ucDelta && i == 2)
+		{
+			i = c->wPixels - 1;
+			*p++ = DELTA_OP_SEEK;
+			*p++ = i;
+			*p++ = i >> 8;
+			*p++ = DELTA_OP_COPY;
+		}
+		rPix = fleet_pixel(c->wId, i == c->wPixels - 1 ? c->ulSeq : c->ulBase, i);
+		if (i == 1 && c->ucDeltas)
+			rPix = (rgb_color){ c->ulBase, c->ulBase >> 8, c->ulBase >> 16 };
+		*p++ = rPix.red;
+		*p++ = rPix.green;
+		*p++ = rPix.blue;
+	}
+
+	for (k = 2; k < (uint32_t)(p - c->ucPkt); k++)
+	{
+		ulCrc ^= c->ucPkt[k];
+		for (i = 0; i < 8; i++)
+			ulCrc = (ulCrc >> 1) ^ (0xEDB88320 & -(ulCrc & 1));
+	}
+	ulCrc = ~ulCrc;
+	*p++ = ulCrc;
+	*p++ = ulCrc >> 8;
+	*p++ = ulCrc >> 16;
+	*p++ = ulCrc >> 24;
+
+	c->wPktLen  = p - c->ucPkt;
+	c->wPktSent = 0;
+}
+
+// ==================================================================================
+/**
+ * @brief  Hands the parser every byte that is off the wire at ullAt
+ * @details Like the DMA ring, bytes are parsed in blocks; a block boundary
+ *          does not change what the parser sees.
+ */
+static void fleet_rx(FleetDef *f, FleetCtrlDef *c, uint64_t ullAt)
+{
+	uint64_t ullWire;
+	uint32_t ulAvail;
+	uint16_t i;
+
+	for (;;)
+	{
+		if (c->wPktSent == c->wPktLen)                // Line idle, next frame
+		{
+			if (c->ullDue > ullAt)
+				return;
+			ullWire = c->wPktLen ? c->ullPktStart + c->wPktLen * FLEET_BYTE_NS : 0;
+			c->ullPktStart = c->ullDue > ullWire ? c->ullDue : ullWire;
+
+			// The line was busy past further due times: those frames are skipped
+			while (c->ullDue + c->ullPeriod <= c->ullPktStart)
+			{
+				c->ullDue += c->ullPeriod;
+				c->ulSeq++;
+				c->ulSkipped++;
+			}
+			c->ullDue += c->ullPeriod + (f->ullJitter ? fleet_rand(&c->ulSeed) % f->ullJitter : 0);
+
+			fleet_packet(c);
+			c->ulSent++;
+			c->ullDone[c->ulSeq % FLEET_DONE_RING] = c->ullPktStart + c->wPktLen * FLEET_BYTE_NS;
+			c->ulSeq++;
+			if (c->ullPktStart > ullAt)
+				return;
+		}
+
+		ulAvail = (ullAt - c->ullPktStart) / FLEET_BYTE_NS;
+		if (ulAvail > c->wPktLen)
+			ulAvail = c->wPktLen;
+		if (ulAvail <= c->wPktSent)
+			return;
+
+		for (i = c->wPktSent; f->ulErrPpm && i < ulAvail; i++)
+			if (fleet_rand(&c->ulSeed) % 1000000 < f->ulErrPpm)
+				c->ucPkt[i] ^= 1 << (fleet_rand(&c->ulSeed) & 7);
+
+		stream_parse(&c->sStream, &c->ucPkt[c->wPktSent], ulAvail - c->wPktSent, c->ulMs);
+		c->wPktSent = ulAvail;
+		if (ulAvail < c->wPktLen)
+			return;
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Moves the main loop forward, running SysTick on every 1 ms boundary
+ */
+static void fleet_spend(FleetCtrlDef *c, uint64_t ullNs)
+{
+	c->ullNow += ullNs;
+	while (c->ullTick <= c->ullNow)
+	{
+		c->ulMs++;
+		update_timer_block(c->tTimer, MAX_TIMERS);
+		c->ullTick += FLEET_TICK_NS;
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Checks a displayed frame and books its latency
+ */
+static void fleet_show(FleetCtrlDef *c, const rgb_color *rFrame, uint16_t wNum)
+{
+	uint32_t ulSeq = rFrame[0].red | (rFrame[0].green << 8) | ((uint32_t)rFrame[0].blue << 16);
+	uint32_t ulBase = ulSeq;
+	uint64_t ullLat;
+	rgb_color rPix;
+	uint16_t i = 1;
+
+	// With -d pixel 1 names the full frame, the last pixel follows the number
+	if (c->ucDeltas)
+	{
+		ulBase = rFrame[1].red | (rFrame[1].green << 8) | ((uint32_t)rFrame[1].blue << 16);
+		i = 2;
+	}
+
+	c->ulShown++;
+	if (wNum != c->wPixels || ulSeq >= c->ulSeq || c->ulSeq - ulSeq > FLEET_DONE_RING || ulBase > ulSeq)
+	{
+		c->ulBad++;
+		return;
+	}
+	for (; i < wNum; i++)
+	{
+		rPix = fleet_pixel(c->wId, i == wNum - 1 ? ulSeq : ulBase, i);
+		if (memcmp(&rPix, &rFrame[i], sizeof(rPix)))
+		{
+			c->ulBad++;
+			return;
+		}
+	}
+
+	ullLat = c->ullNow + wNum * FLEET_SPI_PX_NS + FLEET_LATCH_NS - c->ullDone[ulSeq % FLEET_DONE_RING];
+	c->ullLatSum += ullLat;
+	if (ullLat > c->ullLatMax)
+		c->ullLatMax = ullLat;
+}
+
+// ==================================================================================
+/**
+ * @brief  Runs one controller's main loop up to f->ullEnd
+ */
+static void fleet_ctrl(FleetDef *f, FleetCtrlDef *c)
+{
+	rgb_color *rFrame;
+	uint16_t   wNum;
+	uint64_t   ullNext;
+	uint8_t    ucStep;
+
+	while (c->ullNow < f->ullEnd)
+	{
+		fleet_rx(f, c, c->ullNow);
+
+		if (stream_parse_active(&c->sStream, c->ulMs))
+		{
+			if (stream_parse_swap(&c->sStream))
+			{
+				rFrame = stream_parse_front(&c->sStream, &wNum);
+				fleet_show(c, rFrame, wNum);
+				fleet_spend(c, wNum * FLEET_SPI_PX_NS + FLEET_TICK_NS);   // WS2812_Send_Data()
+				continue;
+			}
+
+			// Idle until the frame on the wire is complete or the next tick
+			ullNext = c->ullTick;
+			if (c->wPktSent < c->wPktLen && c->ullPktStart + c->wPktLen * FLEET_BYTE_NS < ullNext)
+				ullNext = c->ullPktStart + c->wPktLen * FLEET_BYTE_NS;
+			fleet_spend(c, ullNext > c->ullNow ? ullNext - c->ullNow : 0);
+			continue;
+		}
+
+		// Default animation of main.c
+		ucStep = 0;
+		if (check_timer_block(c->tTimer, 0) == TIMER_TIMEOUT)
+		{
+			load_timer_block(c->tTimer, 0, 500);
+			led_shift_right_num(c->rLed, &c->lLed[0], SET, 4);
+			ucStep = 1;
+		}
+		if (check_timer_block(c->tTimer, 1) == TIMER_TIMEOUT)
+		{
+			load_timer_block(c->tTimer, 1, 500);
+			led_shift_left_num(c->rLed, &c->lLed[1], SET, 3);
+			ucStep = 1;
+		}
+		if (check_timer_block(c->tTimer, 2) == TIMER_TIMEOUT)
+		{
+			load_timer_block(c->tTimer, 2, 500);
+			led_shift_right_num(c->rLed, &c->lLed[2], SET, 4);
+			ucStep = 1;
+		}
+		if (check_timer_block(c->tTimer, 3) == TIMER_TIMEOUT)
+		{
+			load_timer_block(c->tTimer, 3, 20);
+			ucStep = 1;
+		}
+
+		if (ucStep)
+		{
+			c->ulLocal++;
+			fleet_spend(c, MAX_NUMB * FLEET_SPI_PX_NS + FLEET_TICK_NS);
+		}
+		else
+		{
+			fleet_spend(c, c->ullTick - c->ullNow);
+		}
+	}
+}
+
+// ==================================================================================
+static void fleet_task(void *pArg, uint32_t ulTask)
+{
+	FleetDef *f = pArg;
+	uint32_t  i   = ulTask * f->wBatch;
+	uint32_t  ulEnd = i + f->wBatch;
+
+	if (ulEnd > f->ulNum)
+		ulEnd = f->ulNum;
+	for (; i < ulEnd; i++)
+		fleet_ctrl(f, &f->pCtrl[i]);
+}
+
+// ==================================================================================
+static void fleet_init(FleetCtrlDef *c, uint16_t wId, uint32_t ulSeed, uint16_t wPixels, uint32_t ulFps, uint8_t ucDeltas)
+{
+	// Same segments as main.c without a config store
+	static const uint16_t  wStart[3]  = {  0,  20, 40};
+	static const uint16_t  wEnd[3]    = { 19, 39, 79};
+	static const StateDir  sDir[3]    = {SHIFT_RIGHT, SHIFT_LEFT, SHIFT_LEFT};
+	const rgb_color        rClrOri[3] = { COLOR_RED, COLOR_BLUE, COLOR_GREEN };
+	const rgb_color        rClrNew[3] = { COLOR_YELLOW, COLOR_BLANK, COLOR_WHITE};
+	uint32_t ulTime[4] = {500, 500, 500, 20};
+	uint8_t  i;
+
+	memset(c, 0, sizeof(*c));
+	c->wId    = wId;
+	c->ulSeed = ulSeed * 2654435761u + wId * 97 + 1;
+	c->ulMs   = 1;
+	c->ullTick = FLEET_TICK_NS;
+	c->ucDeltas = ucDeltas;
+
+	stream_parse_init(&c->sStream, MAX_NUMB, &c->hCrc, &c->sStat, NULL);
+
+	for (i = 0; i < 3; i++)
+	{
+		c->lLed[i].wPosStart  = wStart[i];
+		c->lLed[i].wPosEnd    = wEnd[i];
+		c->lLed[i].rColorOri  = rClrOri[i];
+		c->lLed[i].rColorFill = rClrNew[i];
+		c->lLed[i].sDir       = sDir[i];
+		c->lLed[i].wPosCurr   = sDir[i] == SHIFT_LEFT ? wStart[i] : wEnd[i];
+		led_color_init(c->rLed, &c->lLed[i]);
+	}
+	for (i = 0; i < 4; i++)
+		load_timer_block(c->tTimer, i, ulTime[i]);
+
+	c->wPixels   = wPixels / 2 + fleet_rand(&c->ulSeed) % (wPixels - wPixels / 2 + 1);
+	if (c->wPixels < 1)
+		c->wPixels = 1;
+	ulFps        = ulFps / 2 + fleet_rand(&c->ulSeed) % (ulFps - ulFps / 2 + 1);
+	c->ullPeriod = 1000000000ULL / (ulFps ? ulFps : 1);
+	c->ullDue    = fleet_rand(&c->ulSeed) % FLEET_START_NS;
+}
+
+// ==================================================================================
+static double host_seconds(void)
+{
+	struct timespec tNow;
+
+	clock_gettime(CLOCK_MONOTONIC, &tNow);
+	return tNow.tv_sec + tNow.tv_nsec / 1e9;
+}
+
+// ==================================================================================
+static int fleet_cmp(const void *a, const void *b)
+{
+	double d = *(const double *)a - *(const double *)b;
+
+	return (d > 0) - (d < 0);
+}
+
+// ==================================================================================
+static double fleet_pct(const double *pSorted, uint32_t ulNum, uint32_t ulPct)
+{
+	return pSorted[(uint64_t)(ulNum - 1) * ulPct / 100];
+}
+
+// ==================================================================================
+int main(int argc, char **argv)
+{
+	FleetDef     f = { 0 };
+	PoolTypeDef  p;
+	FleetCtrlDef *c;
+	uint32_t ulNum = 1000, ulFps = 40, ulSeed = 1, ulPixels = STREAM_MAX_LED, ulThreads = 0;
+	uint32_t ulSeconds = 10, ulJitterUs = 500, ulShown = 0, ulBad = 0, ulSent = 0, ulSkip = 0, ulCrc = 0, ulDrop = 0;
+	uint32_t ulDeltas = 0, ulDeltaShown = 0, ulDeltaErr = 0;
+	uint64_t ullEnd;
+	uint8_t  ucVerbose = 0;
+	double   dHost, *dMean, *dMax, dAll = 0;
+	uint32_t i;
+
+	f.wBatch = 8;
+	for (i = 1; i < (uint32_t)argc; i++)
+	{
+		if (!strcmp(argv[i], "-n") && i + 1 < (uint32_t)argc)
+			ulNum = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-t") && i + 1 < (uint32_t)argc)
+			ulThreads = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-s") && i + 1 < (uint32_t)argc)
+			ulSeconds = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-f") && i + 1 < (uint32_t)argc)
+			ulFps = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-p") && i + 1 < (uint32_t)argc)
+			ulPixels = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-j") && i + 1 < (uint32_t)argc)
+			ulJitterUs = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-x") && i + 1 < (uint32_t)argc)
+			f.ulErrPpm = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-b") && i + 1 < (uint32_t)argc)
+			f.wBatch = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-r") && i + 1 < (uint32_t)argc)
+			ulSeed = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-d") && i + 1 < (uint32_t)argc)
+			ulDeltas = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-v"))
+			ucVerbose = 1;
+		else
+		{
+			fprintf(stderr, "usage: %s [-n controllers] [-t threads] [-s seconds] [-f fps] [-p pixels]\n"
+			                "       [-j jitter us] [-x errors per million bytes] [-b batch] [-r seed]\n"
+			                "       [-d deltas per full frame] [-v]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (!ulNum || ulNum > 0xFFFF || !ulPixels || ulPixels > STREAM_MAX_LED || !f.wBatch || !ulFps || ulDeltas > 255 ||
+	    (ulDeltas && ulPixels < 6))
+	{
+		fprintf(stderr, "controllers 1..65535, pixels 1..%u (6.. with -d), deltas 0..255, batch and fps > 0\n", STREAM_MAX_LED);
+		return 2;
+	}
+	if (!ulThreads)
+		ulThreads = sysconf(_SC_NPROCESSORS_ONLN);
+
+	c     = calloc(ulNum, sizeof(*c));
+	dMean = calloc(ulNum, sizeof(double));
+	dMax  = calloc(ulNum, sizeof(double));
+	if (!c || !dMean || !dMax || pool_init(&p, ulThreads))
+	{
+		fprintf(stderr, "out of memory\n");
+		return 2;
+	}
+	for (i = 0; i < ulNum; i++)
+		fleet_init(&c[i], i, ulSeed, ulPixels, ulFps, (uint8_t)ulDeltas);
+
+	f.pCtrl     = c;
+	f.ulNum     = ulNum;
+	f.ullJitter = ulJitterUs * 1000ULL;
+
+	// Controllers only meet at slice ends, a slice is one pool run
+	dHost  = host_seconds();
+	ullEnd = ulSeconds * 1000000000ULL;
+	for (f.ullEnd = FLEET_SLICE_NS; ; f.ullEnd += FLEET_SLICE_NS)
+	{
+		if (f.ullEnd > ullEnd)
+			f.ullEnd = ullEnd;
+		pool_run(&p, fleet_task, &f, (ulNum + f.wBatch - 1) / f.wBatch);
+		if (f.ullEnd == ullEnd)
+			break;
+	}
+	dHost = host_seconds() - dHost;
+
+	for (i = 0; i < ulNum; i++)
+	{
+		ulShown += c[i].ulShown;
+		ulBad   += c[i].ulBad;
+		ulSent  += c[i].ulSent;
+		ulSkip  += c[i].ulSkipped;
+		ulCrc   += c[i].sStat.ulCrcErr;
+		ulDrop  += c[i].sStat.ulDropped;
+		ulDeltaShown += c[i].sStat.ulDeltaFrames;
+		ulDeltaErr   += c[i].sStat.ulDeltaErr;
+		dMean[i] = c[i].ulShown > c[i].ulBad ? c[i].ullLatSum / 1e6 / (c[i].ulShown - c[i].ulBad) : 0;
+		dMax[i]  = c[i].ullLatMax / 1e6;
+		dAll    += c[i].ullLatSum / 1e6;
+
+		if (ucVerbose)
+			printf("ctrl %5u  %3u px %5.1f fps  sent %6u skipped %5u shown %6u bad %3u crc %3u  latency mean %6.2f max %6.2f ms\n",
+			       i, c[i].wPixels, 1e9 / c[i].ullPeriod, c[i].ulSent, c[i].ulSkipped, c[i].ulShown, c[i].ulBad,
+			       c[i].sStat.ulCrcErr, dMean[i], dMax[i]);
+	}
+	qsort(dMean, ulNum, sizeof(double), fleet_cmp);
+	qsort(dMax, ulNum, sizeof(double), fleet_cmp);
+
+	printf("controllers      %10u on %u threads, %u per task\n", ulNum, ulThreads, f.wBatch);
+	printf("virtual time     %10u s\n", ulSeconds);
+	printf("frames sent      %10u, %u skipped on busy lines\n", ulSent, ulSkip);
+	printf("frames shown     %10u, %u with wrong content\n", ulShown, ulBad);
+	printf("crc errors       %10u, %u frames overwritten before shown\n", ulCrc, ulDrop);
+	printf("deltas applied   %10u, %u rejected for a lost base or bad ops\n", ulDeltaShown, ulDeltaErr);
+	printf("fleet fps        %10.0f (virtual)\n", ulShown / (double)ulSeconds);
+	printf("host fps         %10.0f, %.1f x real time\n", dHost > 0 ? ulShown / dHost : 0, dHost > 0 ? ulSeconds / dHost : 0);
+	printf("latency mean     %10.2f ms\n", ulShown > ulBad ? dAll / (ulShown - ulBad) : 0);
+	printf("per controller   %10s  p50 %6.2f  p99 %6.2f  max %6.2f ms (mean)\n", "",
+	       fleet_pct(dMean, ulNum, 50), fleet_pct(dMean, ulNum, 99), dMean[ulNum - 1]);
+	printf("                 %10s  p50 %6.2f  p99 %6.2f  max %6.2f ms (worst frame)\n", "",
+	       fleet_pct(dMax, ulNum, 50), fleet_pct(dMax, ulNum, 99), dMax[ulNum - 1]);
+	for (i = 0; i < ulThreads; i++)
+		printf("worker %2u        %10u tasks, %u stolen\n", i, p.pQueue[i].ulRun, p.pQueue[i].ulStolen);
+
+	pool_free(&p);
+	free(c);
+	free(dMean);
+	free(dMax);
+	return ulBad != 0 && !f.ulErrPpm;
+}
@@ -0,0 +1,228 @@
+#include <string.h>
+#include "main.h"
+#include "hal_sim.h"
+
+#define SIM_RAW_SIZE        (SIM_MAX_LED * 24)
+
+// What main.c provides on the target
+rgb_color         rLed_Data[MAX_NUMB];
+int               brightness = 30;
+SPI_HandleTypeDef hspi1;
+SysTick_Type      sSimSysTick;
+
+static uint64_t     ullNow;                           // Virtual time
+static uint64_t     ullNextTick;                      // Next SysTick
+static uint32_t     ulTick;                           // HAL tick
+
+static uint8_t      ucRaw[SIM_RAW_SIZE];              // SPI bytes since the last latch
+static uint32_t     ulRaw;
+static uint32_t     ulRawLost;
+static SimFrameDef  sFrame;
+static SimFrameFunc fOnFrame;
+static uint8_t      ucCapture = 1;                    // Record SPI bytes for decoding
+
+SimStatDef sSimStat;
+
+
+// ==================================================================================
+/**
+ * @brief  Moves virtual time forward, running SysTick on each 1 ms boundary
+ */
+static void sim_clock(uint64_t ullNs)
+{
+	ullNow += ullNs;
+	while (ullNow >= ullNextTick)
+	{
+		ullNextTick += SIM_TICK_NS;
+		update_timers();
+		ulTick++;
+	}
+}
+
+// ==================================================================================
+void sim_reset(void)
+{
+	ullNow = 0;
+	ullNextTick = SIM_TICK_NS;
+	ulTick = 0;
+	ulRaw = ulRawLost = 0;
+	memset(&sSimStat, 0, sizeof(sSimStat));
+}
+
+// ==================================================================================
+/**
+ * @brief  Registers the function called for every latched frame
+ */
+void sim_on_frame(SimFrameFunc fFunc)
+{
+	fOnFrame = fFunc;
+}
+
+// ==================================================================================
+/**
+ * @brief  Turns SPI recording on or off
+ * @note   With recording off HAL_SPI_Transmit only counts bytes and spends
+ *         their wire time, so benchmarks measure the encoder alone.
+ */
+void sim_spi_capture(uint8_t ucOn)
+{
+	ucCapture = ucOn;
+}
+
+// ==================================================================================
+/**
+ * @brief  Spends time with the data line low (CPU work, delays)
+ * @note   A gap of SIM_LATCH_NS or more latches the pending bytes.
+ */
+void sim_spend_ns(uint64_t ullNs)
+{
+	if (ullNs >= SIM_LATCH_NS)
+		sim_latch();
+	sim_clock(ullNs);
+}
+
+// ==================================================================================
+/**
+ * @brief  Waits for the next SysTick, the host side of a busy main loop
+ */
+void sim_idle(void)
+{
+	sim_spend_ns(ullNextTick - ullNow);
+}
+
+// ==================================================================================
+uint64_t sim_time_ns(void)
+{
+	return ullNow;
+}
+
+// ==================================================================================
+/**
+ * @brief  Decodes the recorded bytes into a frame and hands it out
+ */
+void sim_latch(void)
+{
+	if (!ulRaw && !ulRawLost)
+		return;
+
+	sFrame.ulBytes    = ulRaw + ulRawLost;
+	sFrame.pRaw       = ucRaw;
+	sFrame.ulRaw      = ulRaw;
+	sFrame.wNum       = sim_decode(ucRaw, ulRaw, sFrame.rPixel, SIM_MAX_LED, &sFrame.ulBadCodes);
+	sFrame.ullLatchNs = ullNow;
+
+	sSimStat.ulFrames++;
+	sSimStat.ulBadCodes += sFrame.ulBadCodes;
+	if (ulRawLost)
+		sSimStat.ulOverflow++;
+
+	ulRaw = ulRawLost = 0;
+	if (fOnFrame)
+		fOnFrame(&sFrame);
+}
+
+// ==================================================================================
+/**
+ * @brief  Decodes WS2812 SPI bytes (one byte per bit, GRB, MSB first) to pixels
+ * @details A byte that is neither SIM_CODE_0 nor SIM_CODE_1 is counted in
+ *          pulBad and read as the code it shares more set bits with.
+ *
+ * @return Number of whole pixels decoded
+ */
+uint16_t sim_decode(const uint8_t *pSpi, uint32_t ulNum, rgb_color *pOut, uint16_t wMax, uint32_t *pulBad)
+{
+	uint32_t ulBits, ulBad = 0, i;
+	uint16_t wPix = 0;
+	uint8_t  ucBit, ucCode, ucOnes, j;
+
+	for (i = 0; i + 24 <= ulNum && wPix < wMax; i += 24)
+	{
+		ulBits = 0;
+		for (j = 0; j < 24; j++)
+		{
+			ucCode = pSpi[i + j];
+			if (ucCode == SIM_CODE_1)
+				ucBit = 1;
+			else if (ucCode == SIM_CODE_0)
+				ucBit = 0;
+			else
+			{
+				ulBad++;
+				for (ucOnes = 0; ucCode; ucCode &= ucCode - 1)
+					ucOnes++;
+				ucBit = ucOnes > 3;
+			}
+			ulBits = (ulBits << 1) | ucBit;
+		}
+		pOut[wPix].green = ulBits >> 16;
+		pOut[wPix].red   = ulBits >> 8;
+		pOut[wPix].blue  = ulBits;
+		wPix++;
+	}
+
+	if (pulBad)
+		*pulBad = ulBad + (ulNum - i);            // Trailing partial pixel counts as bad
+	return wPix;
+}
+
+// ==================================================================================
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	uint32_t ulCopy = Size;
+
+	(void)hspi; (void)Timeout;
+
+	sSimStat.ullSpiBytes += Size;
+	sim_clock(Size * 8 * SIM_SPI_BIT_NS);
+	if (!ucCapture)
+		return HAL_OK;
+
+	if (ulCopy > SIM_RAW_SIZE - ulRaw)
+		ulCopy = SIM_RAW_SIZE - ulRaw;
+	memcpy(&ucRaw[ulRaw], pData, ulCopy);
+	ulRaw     += ulCopy;
+	ulRawLost += Size - ulCopy;
+	return HAL_OK;
+}
+
+// ==================================================================================
+void HAL_Delay(uint32_t Delay)
+{
+	sim_spend_ns(Delay * SIM_TICK_NS);
+}
+
+// ==================================================================================
+uint32_t HAL_GetTick(void)
+{
+	return ulTick;
+}
+
+// ==================================================================================
+/**
+ * @brief  Continues the CRC of a handle over ulNum bytes, reflected, 4 bits per step
+ */
+uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t *pBuffer, uint32_t ulNum)
+{
+	static const uint32_t ulNibble[16] = {
+		0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+		0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+	};
+	const uint8_t *pData = (const uint8_t *)pBuffer;
+	uint32_t ulCrc = hcrc->ulCrc;
+
+	while (ulNum--)
+	{
+		ulCrc ^= *pData++;
+		ulCrc = (ulCrc >> 4) ^ ulNibble[ulCrc & 0x0F];
+		ulCrc = (ulCrc >> 4) ^ ulNibble[ulCrc & 0x0F];
+	}
+	hcrc->ulCrc = ulCrc;
+	return ulCrc;
+}
+
+// ==================================================================================
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t *pBuffer, uint32_t ulNum)
+{
+	hcrc->ulCrc = 0xFFFFFFFF;
+	return HAL_CRC_Accumulate(hcrc, pBuffer, ulNum);
+}
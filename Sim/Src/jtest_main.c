@@ -0,0 +1,505 @@
+/*
+ * jtest_main.c
+ *
+ * Host port of the JTest framework of Drivers/CMSIS/DSP/DSP_Lib_TestSuite.
+ * On the target the suite reports through the Keil debugger: the trigger
+ * functions of jtest_trigger_action.c are breakpoints that dump
+ * JTEST_FW.str_buffer, and jtest_cycle.c prints SysTick counts. Here the
+ * same triggers read the dumped strings directly, Inc/jtest_host.h turns
+ * the SysTick macros into a nanosecond clock, and every group of
+ * Common/src/all_tests.c runs natively against the RefLibs.
+ *
+ *   k3na_jtest [-r runs] [-o file.csv] [-v]    exit status 1 if a test fails
+ *     -r runs  passes over all groups, the fastest call counts, default 10
+ *     -o file  machine readable results, default jtest.csv
+ *     -v       echo the raw JTest output as the debugger would log it
+ *
+ * One result is kept per test and parameter set (the "Block Size: ...",
+ * "Matrix Dimensions: ..." lines of the tests): the time of the calls of
+ * the function under test for that set, the lowest SNR the test computed
+ * against the reference and whether it passed. Tests that compare word
+ * for word have no SNR. ns_per_sample divides by the first parameter, the
+ * block size or FFT length, or by rows times columns for matrices.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "jtest.h"
+#include "all_tests.h"
+#include "arm_math.h"
+
+#define JTEST_RUNS          10                // Default passes over the suite
+#define JTEST_DEPTH         8                 // Nested groups followed for the report
+#define JTEST_PARAM_LEN     96
+#define JTEST_CAL_LOOPS     1000              // Clock reads to find the clock overhead
+
+typedef struct
+{
+	const char *pGroup;
+	const char *pTest;
+	const char *pFut;
+	char        cParam[JTEST_PARAM_LEN];      // "Block Size=32;Number of Taps=4"
+	char        cShort[JTEST_PARAM_LEN];      // "32/4"
+	uint32_t    ulSamples;
+	uint32_t    ulSets;                       // Parameter sets seen over all runs
+	uint64_t    ullBest;                      // ns of the fastest set
+	float       fSnr;                         // Lowest SNR, NAN if none computed
+	uint8_t     ucFail;
+} JTestResDef;
+
+typedef enum
+{
+	JTEST_NEXT_NONE,
+	JTEST_NEXT_GROUP,
+	JTEST_NEXT_TEST,
+	JTEST_NEXT_FUT
+} JTestNext;
+
+// JTest/src/jtest_cycle.c, the host counts nanoseconds
+const char *JTEST_CYCLE_STRF = "Time: %" PRIu32 " ns\n";
+
+static JTestResDef *rRes;
+static uint32_t     ulResNum, ulResMax;
+
+static JTestNext    nNext;
+static const char  *pGroup[JTEST_DEPTH];
+static uint8_t      ucDepth;
+static const char  *pTest, *pFut;
+static uint32_t     ulTestFirst;              // First result of the current test
+static uint8_t      ucVerbose;
+
+// Open parameter set, closed by the next set or the end of the test
+static uint8_t      ucSetOpen;
+static char         cSetParam[JTEST_PARAM_LEN], cSetShort[JTEST_PARAM_LEN];
+static uint32_t     ulSetSamples;
+static uint64_t     ullSetNs;
+static float        fSetSnr;
+
+static struct timespec tStart;
+static uint32_t     ulClockCal;
+static uint32_t     ulTestPass, ulTestFail;   // Tests of the current run
+
+// Common/src/math_helper.c, renamed by the k3na_jtest build
+float  jtest_snr_f32_ref       (float *, float *, uint32_t);
+double jtest_snr_f64_ref       (double *, double *, uint32_t);
+
+
+// ==================================================================================
+//  Clock behind JTEST_COUNT_CYCLES()
+// ==================================================================================
+
+void jtest_clock_start(void)
+{
+	clock_gettime(CLOCK_MONOTONIC, &tStart);
+}
+
+// ==================================================================================
+uint32_t jtest_clock_value(void)
+{
+	struct timespec t;
+	int64_t llNs;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	llNs = (int64_t)(t.tv_sec - tStart.tv_sec) * 1000000000 + (t.tv_nsec - tStart.tv_nsec);
+	llNs -= ulClockCal;
+	if (llNs < 0)
+		llNs = 0;
+	if (llNs > JTEST_SYSTICK_INITIAL_VALUE)
+		llNs = JTEST_SYSTICK_INITIAL_VALUE;
+	return JTEST_SYSTICK_INITIAL_VALUE - (uint32_t)llNs;
+}
+
+// ==================================================================================
+static void jtest_clock_cal(void)
+{
+	uint32_t i, ulNs, ulMin = UINT32_MAX;
+
+	for (i = 0; i < JTEST_CAL_LOOPS; i++)
+	{
+		jtest_clock_start();
+		ulNs = JTEST_SYSTICK_INITIAL_VALUE - jtest_clock_value();
+		if (ulNs < ulMin)
+			ulMin = ulNs;
+	}
+	ulClockCal = ulMin;
+}
+
+
+// ==================================================================================
+//  Results
+// ==================================================================================
+
+//  First line of a dumped name, kept once for all runs
+static const char *jtest_name(const char *pStr)
+{
+	static char   **pName;
+	static uint32_t ulNum, ulMax;
+	size_t          n = strcspn(pStr, "\n");
+	uint32_t        i;
+
+	for (i = 0; i < ulNum; i++)
+	{
+		if (!strncmp(pName[i], pStr, n) && !pName[i][n])
+			return pName[i];
+	}
+
+	if (ulNum == ulMax)
+	{
+		ulMax = ulMax ? ulMax * 2 : 256;
+		pName = realloc(pName, ulMax * sizeof(char *));
+	}
+	if (!pName || !(pName[ulNum] = malloc(n + 1)))
+	{
+		perror("k3na_jtest");
+		exit(2);
+	}
+	memcpy(pName[ulNum], pStr, n);
+	pName[ulNum][n] = 0;
+	return pName[ulNum++];
+}
+
+// ==================================================================================
+static JTestResDef *jtest_result(const char *pParam)
+{
+	JTestResDef *r;
+	uint32_t i;
+
+	for (i = ulTestFirst; i < ulResNum; i++)
+	{
+		if (rRes[i].pTest == pTest && !strcmp(rRes[i].cParam, pParam))
+			return &rRes[i];
+	}
+
+	if (ulResNum == ulResMax)
+	{
+		ulResMax = ulResMax ? ulResMax * 2 : 256;
+		rRes = realloc(rRes, ulResMax * sizeof(JTestResDef));
+		if (!rRes)
+		{
+			perror("k3na_jtest");
+			exit(2);
+		}
+	}
+
+	r = &rRes[ulResNum++];
+	memset(r, 0, sizeof(*r));
+	r->pGroup = ucDepth > 1 ? pGroup[1] : ucDepth ? pGroup[0] : "";
+	r->pTest  = pTest;
+	r->pFut   = pFut;
+	r->fSnr   = NAN;
+	r->ulSamples = 1;
+	snprintf(r->cParam, sizeof(r->cParam), "%s", pParam);
+	return r;
+}
+
+// ==================================================================================
+static void jtest_set_close(uint8_t ucFail)
+{
+	JTestResDef *r;
+
+	if (!ucSetOpen)
+		return;
+	ucSetOpen = 0;
+
+	r = jtest_result(cSetParam);
+	snprintf(r->cShort, sizeof(r->cShort), "%s", cSetShort);
+	r->ulSamples = ulSetSamples;
+	if (!r->ulSets || ullSetNs < r->ullBest)
+		r->ullBest = ullSetNs;
+	r->ulSets++;
+	if (!isnan(fSetSnr) && (isnan(r->fSnr) || fSetSnr < r->fSnr))
+		r->fSnr = fSetSnr;
+	r->ucFail |= ucFail;
+}
+
+// ==================================================================================
+static void jtest_set_open(const char *pParam, const char *pShort, uint32_t ulSamples)
+{
+	jtest_set_close(0);
+	snprintf(cSetParam, sizeof(cSetParam), "%s", pParam);
+	snprintf(cSetShort, sizeof(cSetShort), "%s", pShort);
+	ulSetSamples = ulSamples ? ulSamples : 1;
+	ullSetNs = 0;
+	fSetSnr = NAN;
+	ucSetOpen = 1;
+}
+
+// ==================================================================================
+//  "Block Size: 32\nNumber of Taps: 4\n" becomes "Block Size=32;Number of Taps=4"
+//  and "32/4", the samples are 32. "Matrix Dimensions: 4x8" has 32 samples.
+// ==================================================================================
+static void jtest_param(const char *pStr)
+{
+	char        cParam[JTEST_PARAM_LEN] = "", cShort[JTEST_PARAM_LEN] = "";
+	const char *pVal, *pEnd;
+	size_t      n, ulP = 0, ulS = 0;
+	uint32_t    ulSamples = 0, a, b;
+
+	while (*pStr)
+	{
+		pEnd = pStr + strcspn(pStr, "\n");
+		pVal = memchr(pStr, ':', pEnd - pStr);
+		if (pVal)
+		{
+			n = pVal - pStr;
+			for (pVal++; *pVal == ' '; pVal++);
+			if (!ulSamples)
+			{
+				if (sscanf(pVal, "%ux%u", &a, &b) == 2 || sscanf(pVal, "A %ux%u", &a, &b) == 2)
+					ulSamples = a * b;
+				else if (sscanf(pVal, "%u", &a) == 1)
+					ulSamples = a;
+			}
+			ulP += snprintf(cParam + ulP, ulP < sizeof(cParam) ? sizeof(cParam) - ulP : 0, "%s%.*s=%.*s",
+			                ulP ? ";" : "", (int)n, pStr, (int)(pEnd - pVal), pVal);
+			ulS += snprintf(cShort + ulS, ulS < sizeof(cShort) ? sizeof(cShort) - ulS : 0, "%s%.*s",
+			                ulS ? "/" : "", (int)(pEnd - pVal), pVal);
+		}
+		pStr = *pEnd ? pEnd + 1 : pEnd;
+	}
+	jtest_set_open(cParam, cShort, ulSamples);
+}
+
+// ==================================================================================
+static void jtest_test_end(uint8_t ucFail)
+{
+	// A test without any timed call still gets its line
+	if (!ucSetOpen && ulTestFirst == ulResNum)
+		jtest_set_open("", "", 1);
+	if (!ucSetOpen && ucFail)
+		jtest_result("")->ucFail = 1;
+	jtest_set_close(ucFail);
+
+	if (ucFail)
+		ulTestFail++;
+	else
+		ulTestPass++;
+}
+
+
+// ==================================================================================
+//  JTest/src/jtest_trigger_action.c and jtest_dump_str_segments.c
+// ==================================================================================
+
+void test_start(void)
+{
+	JTEST_FW.test_start++;
+}
+
+void test_end(void)
+{
+	JTEST_FW.test_end++;
+}
+
+void group_start(void)
+{
+	JTEST_FW.group_start++;
+	if (ucDepth < JTEST_DEPTH)
+		pGroup[ucDepth] = "";
+	ucDepth++;
+}
+
+void group_end(void)
+{
+	JTEST_FW.group_end++;
+	if (ucDepth)
+		ucDepth--;
+}
+
+void dump_data(void)
+{
+	JTEST_FW.dump_data++;
+}
+
+void exit_fw(void)
+{
+	JTEST_FW.exit_fw++;
+}
+
+// ==================================================================================
+void dump_str(void)
+{
+	const char *s = JTEST_FW.str_buffer;
+	uint32_t    ulNs;
+	float       fSnr;
+
+	JTEST_FW.dump_str++;
+	if (ucVerbose)
+		fputs(s, stdout);
+
+	switch (nNext)
+	{
+	case JTEST_NEXT_GROUP:
+		nNext = JTEST_NEXT_NONE;
+		if (ucDepth && ucDepth <= JTEST_DEPTH)
+			pGroup[ucDepth - 1] = jtest_name(s);
+		return;
+
+	case JTEST_NEXT_TEST:
+		nNext = JTEST_NEXT_NONE;
+		pTest = jtest_name(s);
+		for (ulTestFirst = 0; ulTestFirst < ulResNum; ulTestFirst++)
+		{
+			if (rRes[ulTestFirst].pTest == pTest)
+				break;
+		}
+		return;
+
+	case JTEST_NEXT_FUT:
+		nNext = JTEST_NEXT_NONE;
+		pFut = jtest_name(s);
+		return;
+
+	default:
+		break;
+	}
+
+	if (!strcmp(s, "Group Name:\n"))
+		nNext = JTEST_NEXT_GROUP;
+	else if (!strcmp(s, "Test Name:\n"))
+	{
+		nNext = JTEST_NEXT_TEST;
+		ucSetOpen = 0;
+	}
+	else if (!strcmp(s, "Function Under Test:\n"))
+		nNext = JTEST_NEXT_FUT;
+	else if (!strcmp(s, "Test Passed\n"))
+		jtest_test_end(0);
+	else if (!strcmp(s, "Test Failed\n"))
+		jtest_test_end(1);
+	else if (sscanf(s, "Time: %u ns", &ulNs) == 1)
+	{
+		if (!ucSetOpen)
+			jtest_set_open("", "", 1);
+		ullSetNs += ulNs;
+	}
+	else if (sscanf(s, "SNR: %f", &fSnr) == 1)
+	{
+		// Already taken by arm_snr_f32(), printed again on failure
+	}
+	else if (!strncmp(s, "Block Size:", 11) || !strncmp(s, "Matrix Dimensions:", 18) ||
+	         !strncmp(s, "Input A Length:", 15))
+		jtest_param(s);
+}
+
+// ==================================================================================
+void jtest_dump_str_segments(void)
+{
+	// No debugger window to fit, the whole buffer goes at once
+	JTEST_TRIGGER_ACTION(dump_str);
+}
+
+
+// ==================================================================================
+//  SNR of the compare interfaces, every value is kept, not only failures
+// ==================================================================================
+
+float arm_snr_f32(float *pRef, float *pTest, uint32_t ulNum)
+{
+	float fSnr = jtest_snr_f32_ref(pRef, pTest, ulNum);
+
+	if (ucSetOpen && (isnan(fSetSnr) || fSnr < fSetSnr))
+		fSetSnr = fSnr;
+	return fSnr;
+}
+
+// ==================================================================================
+double arm_snr_f64(double *pRef, double *pTest, uint32_t ulNum)
+{
+	double dSnr = jtest_snr_f64_ref(pRef, pTest, ulNum);
+
+	if (ucSetOpen && (isnan(fSetSnr) || dSnr < fSetSnr))
+		fSetSnr = dSnr;
+	return dSnr;
+}
+
+
+// ==================================================================================
+static void jtest_report(FILE *fOut)
+{
+	JTestResDef *r;
+	uint32_t     i;
+	double       dNs;
+
+	printf("%-34s %-22s result  SNR       time\n", "test", "params");
+	fprintf(fOut, "group,test,fut,params,samples,sets,ns_per_call,ns_per_sample,snr_db,result\n");
+	for (i = 0; i < ulResNum; i++)
+	{
+		r = &rRes[i];
+		dNs = (double)r->ullBest / r->ulSamples;
+
+		printf("%-34s %-22s %s", r->pTest, r->cShort, r->ucFail ? "FAIL" : "PASS");
+		if (isnan(r->fSnr))
+			printf("           ");
+		else if (isinf(r->fSnr))
+			printf("    inf dB ");
+		else
+			printf("  %5.1f dB ", r->fSnr);
+		if (r->ulSets)
+			printf("  %10.2f ns/sample", dNs);
+		printf("\n");
+
+		fprintf(fOut, "%s,%s,%s,%s,%u,%u,%llu,%.3f,", r->pGroup, r->pTest, r->pFut,
+		        r->cParam, r->ulSamples, r->ulSets, (unsigned long long)r->ullBest, dNs);
+		if (!isnan(r->fSnr))
+			fprintf(fOut, "%.2f", r->fSnr);
+		fprintf(fOut, ",%s\n", r->ucFail ? "FAIL" : "PASS");
+	}
+}
+
+
+// ==================================================================================
+int main(int argc, char **argv)
+{
+	const char *pOut = "jtest.csv";
+	FILE       *fOut;
+	uint32_t    ulRuns = JTEST_RUNS, ulTests = 0, ulFail = 0, r;
+	int         a;
+
+	for (a = 1; a < argc; a++)
+	{
+		if (!strcmp(argv[a], "-r") && a + 1 < argc)
+			ulRuns = strtoul(argv[++a], NULL, 0);
+		else if (!strcmp(argv[a], "-o") && a + 1 < argc)
+			pOut = argv[++a];
+		else if (!strcmp(argv[a], "-v"))
+			ucVerbose = 1;
+		else
+		{
+			fprintf(stderr, "usage: %s [-r runs] [-o file.csv] [-v]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (!ulRuns)
+		ulRuns = 1;
+
+	if (!(fOut = fopen(pOut, "w")))
+	{
+		perror(pOut);
+		return 2;
+	}
+
+	jtest_clock_cal();
+	JTEST_INIT();
+
+	// Every run repeats all groups, the inputs and states are set up again by
+	// each test. Only the first run counts tests, failures of any run stick.
+	for (r = 0; r < ulRuns; r++)
+	{
+		ulTestPass = ulTestFail = 0;
+		JTEST_GROUP_CALL(all_tests);
+		if (!r)
+			ulTests = ulTestPass + ulTestFail;
+		ulFail += ulTestFail;
+	}
+	JTEST_ACT_EXIT_FW();
+
+	jtest_report(fOut);
+	fclose(fOut);
+
+	printf("%u tests, %u failed over %u runs, results in %s\n", ulTests, ulFail, ulRuns, pOut);
+	return ulFail ? 1 : 0;
+}
@@ -0,0 +1,213 @@
+/*
+ * sim_main.c
+ *
+ * Runs the default animation of main.c on the host against the HAL stand-in,
+ * decodes every frame the strip would latch and reports frame rates. Every
+ * frame is also rebuilt as a line waveform and timing-checked (wave_check.c).
+ *
+ *   k3na_sim [-s seconds] [-v] [-c ws2812|sk6812] [-g ns]
+ *     -s  virtual seconds to run (default 10)
+ *     -v  print every latched frame as a row of colored cells
+ *     -c  timing windows to check against (default ws2812)
+ *     -g  random idle of 0..ns after each SPI byte, models late data
+ *         register refills while interrupts load the core
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "main.h"
+#include "WS2812_SPI.h"
+#include "hal_sim.h"
+#include "wave_check.h"
+
+#define ZERO 0
+#define ONE 1
+#define TWO 2
+
+static uint8_t  ucVerbose;
+static uint32_t ulShort;                              // Frames with fewer pixels than MAX_NUMB
+static uint32_t ulMismatch;                           // Frames the waveform decodes differently
+
+static WaveCheckDef wCheck;
+static rgb_color    rWave[SIM_MAX_LED];
+static uint16_t     wWaveNum;
+static uint32_t     ulGapNs;
+
+
+// ==================================================================================
+static void wave_frame(const rgb_color *rPixel, uint16_t wNum, void *pArg)
+{
+	(void)rPixel; (void)pArg;
+	wWaveNum = wNum;
+}
+
+// ==================================================================================
+/**
+ * @brief  Rebuilds the line waveform of a frame and compares its pixels
+ */
+static void sim_wave(const SimFrameDef *sFrame)
+{
+	uint64_t ullBit = wave_spi_bit_ps(SIM_CORE_HZ, SIM_SPI_PRESCALER);
+	uint32_t i;
+
+	wWaveNum = 0;
+	for (i = 0; i < sFrame->ulRaw; i++)
+		wave_spi(&wCheck, &sFrame->pRaw[i], 1, ullBit, ulGapNs ? (uint64_t)(rand() % (ulGapNs + 1)) * 1000 : 0);
+	wave_end(&wCheck);
+
+	if (wWaveNum != sFrame->wNum || memcmp(rWave, sFrame->rPixel, sFrame->wNum * sizeof(rgb_color)))
+		ulMismatch++;
+}
+
+
+// ==================================================================================
+static void sim_frame(const SimFrameDef *sFrame)
+{
+	uint16_t i;
+
+	if (sFrame->wNum < MAX_NUMB)
+		ulShort++;
+	sim_wave(sFrame);
+
+	if (!ucVerbose)
+		return;
+
+	printf("%9.3f ", sFrame->ullLatchNs / 1e9);
+	for (i = 0; i < sFrame->wNum; i++)
+	{
+		printf("\x1b[48;2;%u;%u;%um ", sFrame->rPixel[i].red * 4 > 255 ? 255 : sFrame->rPixel[i].red * 4,
+		       sFrame->rPixel[i].green * 4 > 255 ? 255 : sFrame->rPixel[i].green * 4,
+		       sFrame->rPixel[i].blue * 4 > 255 ? 255 : sFrame->rPixel[i].blue * 4);
+	}
+	printf("\x1b[0m\n");
+}
+
+// ==================================================================================
+static double host_seconds(void)
+{
+	struct timespec tNow;
+
+	clock_gettime(CLOCK_MONOTONIC, &tNow);
+	return tNow.tv_sec + tNow.tv_nsec / 1e9;
+}
+
+// ==================================================================================
+int main(int argc, char **argv)
+{
+	LedTypeDef lLed_Data[3];
+
+	// Same segments and periods as main.c without a config store
+	uint16_t  wStart[3]  = {  0,  20, 40};
+	uint16_t  wEnd[3]    = { 19, 39, 79};
+	uint32_t  ulTime[]   = {500, 500, 500, 20};
+	StateDir  sDir[3]    = {SHIFT_RIGHT, SHIFT_LEFT, SHIFT_LEFT};
+	rgb_color rClrOri[3] = { COLOR_RED, COLOR_BLUE, COLOR_GREEN };
+	rgb_color rClrNew[3] = { COLOR_YELLOW, COLOR_BLANK, COLOR_WHITE};
+
+	WaveChipType eChip = WAVE_WS2812;
+	WaveStatDef *sWave = &wCheck.sStat;
+	uint32_t ulSeconds = 10;
+	uint64_t ullEnd;
+	double   dHost;
+	int      i;
+
+	for (i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-s") && i + 1 < argc)
+			ulSeconds = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-v"))
+			ucVerbose = 1;
+		else if (!strcmp(argv[i], "-c") && i + 1 < argc)
+			eChip = strcmp(argv[++i], "sk6812") ? WAVE_WS2812 : WAVE_SK6812;
+		else if (!strcmp(argv[i], "-g") && i + 1 < argc)
+			ulGapNs = strtoul(argv[++i], NULL, 0);
+		else
+		{
+			fprintf(stderr, "usage: %s [-s seconds] [-v] [-c ws2812|sk6812] [-g ns]\n", argv[0]);
+			return 2;
+		}
+	}
+	wave_init(&wCheck, eChip, rWave, SIM_MAX_LED, wave_frame, NULL);
+
+	sim_reset();
+	sim_on_frame(sim_frame);
+	dHost = host_seconds();
+
+	for (i = 0; i < MAX_NUMB; i++)
+		rLed_Data[i] = COLOR_BLANK;
+	WS2812_Send();
+	HAL_Delay(50);
+	WS2812_Send();
+
+	for (i = 0; i < 3; i++)
+	{
+		lLed_Data[i].wPosStart  = wStart[i];
+		lLed_Data[i].wPosEnd    = wEnd[i];
+		lLed_Data[i].rColorOri  = rClrOri[i];
+		lLed_Data[i].rColorFill = rClrNew[i];
+		lLed_Data[i].sDir       = sDir[i];
+		lLed_Data[i].wPosCurr   = (sDir[i] == SHIFT_LEFT) ? wStart[i] : wEnd[i];
+		led_color_init(rLed_Data, &lLed_Data[i]);
+	}
+
+	for (i = 0; i < 4; i++)
+		load_timer(i, ulTime[i]);
+
+	ullEnd = (uint64_t)ulSeconds * 1000000000ULL;
+	while (sim_time_ns() < ullEnd)
+	{
+		if (check_timer(0) == TIMER_TIMEOUT)
+		{
+			load_timer(0, ulTime[0]);
+			led_shift_right_num(rLed_Data, &lLed_Data[ZERO], SET, 4);
+		}
+
+		if (check_timer(1) == TIMER_TIMEOUT)
+		{
+			load_timer(1, ulTime[1]);
+			led_shift_left_num(rLed_Data, &lLed_Data[ONE], SET, 3);
+		}
+
+		if (check_timer(2) == TIMER_TIMEOUT)
+		{
+			load_timer(2, ulTime[2]);
+			led_shift_right_num(rLed_Data, &lLed_Data[TWO], SET, 4);
+		}
+
+		if (check_timer(3) == TIMER_TIMEOUT)
+		{
+			load_timer(3, 20);
+			WS2812_Send();
+		}
+		else
+		{
+			sim_idle();
+		}
+	}
+	sim_latch();
+	dHost = host_seconds() - dHost;
+
+	printf("virtual time   %10.3f s\n", sim_time_ns() / 1e9);
+	printf("frames         %10u\n", sSimStat.ulFrames);
+	printf("target fps     %10.1f\n", sSimStat.ulFrames / (sim_time_ns() / 1e9));
+	printf("host time      %10.3f s\n", dHost);
+	printf("host fps       %10.0f\n", dHost > 0 ? sSimStat.ulFrames / dHost : 0.0);
+	printf("spi bytes      %10llu\n", (unsigned long long)sSimStat.ullSpiBytes);
+	printf("bad codes      %10u\n", sSimStat.ulBadCodes);
+	printf("short frames   %10u\n", ulShort);
+	printf("%s timing check\n", wCheck.pTiming->pName);
+	printf("  bits         %10u\n", sWave->ulBits);
+	printf("  T0H          %6u..%u ns\n", sWave->ulHigh0Min, sWave->ulHigh0Max);
+	printf("  T1H          %6u..%u ns\n", sWave->ulHigh1Min, sWave->ulHigh1Max);
+	printf("  TL           %6u..%u ns\n", sWave->ulLowMin, sWave->ulLowMax);
+	printf("  high errors  %10u\n", sWave->ulHighErr);
+	printf("  low errors   %10u\n", sWave->ulLowErr);
+	if (sWave->ulFirstErr != WAVE_NO_ERR)
+		printf("  first error  %10u (bit)\n", sWave->ulFirstErr);
+	printf("  mismatches   %10u\n", ulMismatch);
+
+	return (sSimStat.ulBadCodes || sSimStat.ulOverflow || ulShort ||
+	        sWave->ulHighErr || sWave->ulLowErr || sWave->ulPartial || ulMismatch) ? 1 : 0;
+}
@@ -0,0 +1,233 @@
+/*
+ * sync_main.c
+ *
+ * Host stand-in for a chain of boards sharing the USART1 time sync
+ * (Core/Inc/sync.h). Every board runs sync_clock.c on its own simulated
+ * core clock: the HSI is off by up to -e per mille and wanders slowly with
+ * temperature, SysTick ticks last ulNextLen of those clocks. Board 0 is the
+ * master; its timestamps reach the followers after the wire time plus
+ * random jitter, and some are lost.
+ *
+ * After the settle time the network us of every follower is compared with
+ * the master's every 10 ms. Exit status 1 if any offset exceeds the limit.
+ *
+ *   k3na_sync [-n boards] [-s seconds] [-l loss %] [-j jitter us] [-e per mille]
+ *             [-w wander ppm] [-t settle s] [-m limit us] [-r seed] [-v]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "main.h"
+#include "sync_clock.h"
+
+#define SYNC_SIM_CLK_MS     40000             // 40 MHz core, SysTick LOAD + 1
+#define SYNC_SIM_BOARDS     16
+#define SYNC_SIM_WIRE_US    150               // Packet on the wire, see SYNC_LATENCY_US
+#define SYNC_SIM_LATENCY_US 180               // What the follower adds, as sync.h
+#define SYNC_SIM_TX_WAIT_US 2000              // Master waits up to this for an idle telemetry DMA
+#define SYNC_SIM_WANDER_S   97.0              // Period of the temperature wander
+
+typedef struct
+{
+	SyncClockDef c;
+	double  dHz0;                             // Core clock at start
+	double  dPhase;                           // Wander phase
+	double  dTickStart;                       // True time the running tick started, s
+	double  dTickEnd;
+	double  dRx;                              // True time a timestamp arrives, < 0 = none
+	uint32_t ulRxMs;
+	int32_t  lRxUs;
+} SimBoardDef;
+
+static SimBoardDef bBoard[SYNC_SIM_BOARDS];
+static uint16_t    wBoards   = 4;
+static double      dWander   = 200;           // ppm, peak
+static double      dErr      = 10;            // per mille, HSI trim error range
+
+
+// ==================================================================================
+static double sim_rand(void)
+{
+	return rand() / (RAND_MAX + 1.0);
+}
+
+// ==================================================================================
+static double sim_hz(const SimBoardDef *b, double dT)
+{
+	return b->dHz0 * (1.0 + dWander * 1e-6 * sin(2 * M_PI * dT / SYNC_SIM_WANDER_S + b->dPhase));
+}
+
+// ==================================================================================
+/**
+ * @brief  Network time of a board at true time dT, as sync.c reads it
+ */
+static void sim_read(const SimBoardDef *b, double dT, uint32_t *pMs, int32_t *pUs)
+{
+	uint32_t ulElapsed = (uint32_t)((dT - b->dTickStart) * sim_hz(b, dT));
+
+	if (ulElapsed >= b->c.ulCurLen)
+		ulElapsed = b->c.ulCurLen - 1;
+	*pMs = b->c.ulMs;
+	*pUs = ulElapsed * 1000 / b->c.ulCurLen;
+}
+
+// ==================================================================================
+static double sim_offset(const SimBoardDef *b, double dT)
+{
+	uint32_t ulMs0, ulMs;
+	int32_t  lUs0, lUs;
+
+	sim_read(&bBoard[0], dT, &ulMs0, &lUs0);
+	sim_read(b, dT, &ulMs, &lUs);
+	return (int32_t)(ulMs - ulMs0) * 1000.0 + lUs - lUs0;
+}
+
+// ==================================================================================
+int main(int argc, char **argv)
+{
+	double   dSeconds = 120, dLoss = 5, dJitter = 50, dSettle = 10, dLimit = 1000;
+	double   dT, dNext, dSample = 0, dSend = -1, dOff, dMax = 0, dSum = 0;
+	uint32_t ulN = 0, ulSeed = 1, ulMs;
+	uint8_t  ucVerbose = 0;
+	int32_t  lUs;
+	uint16_t b, bNext;
+	int      i;
+
+	for (i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-n") && i + 1 < argc)
+			wBoards = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+			dSeconds = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-l") && i + 1 < argc)
+			dLoss = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-j") && i + 1 < argc)
+			dJitter = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-e") && i + 1 < argc)
+			dErr = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-w") && i + 1 < argc)
+			dWander = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-t") && i + 1 < argc)
+			dSettle = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-m") && i + 1 < argc)
+			dLimit = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-r") && i + 1 < argc)
+			ulSeed = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-v"))
+			ucVerbose = 1;
+		else
+		{
+			fprintf(stderr, "usage: %s [-n boards] [-s seconds] [-l loss %%] [-j jitter us] [-e per mille]\n"
+			                "       [-w wander ppm] [-t settle s] [-m limit us] [-r seed] [-v]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (wBoards < 2 || wBoards > SYNC_SIM_BOARDS)
+	{
+		fprintf(stderr, "boards: 2..%u\n", SYNC_SIM_BOARDS);
+		return 2;
+	}
+	srand(ulSeed);
+
+	// Boards power up within 2 s of each other with their own HSI error
+	for (b = 0; b < wBoards; b++)
+	{
+		sync_clock_init(&bBoard[b].c, SYNC_SIM_CLK_MS);
+		bBoard[b].dHz0       = SYNC_SIM_CLK_MS * 1000.0 * (1.0 + (2 * sim_rand() - 1) * dErr * 1e-3);
+		bBoard[b].dPhase     = 2 * M_PI * sim_rand();
+		bBoard[b].dTickStart = 2 * sim_rand();
+		bBoard[b].dTickEnd   = bBoard[b].dTickStart + SYNC_SIM_CLK_MS / sim_hz(&bBoard[b], bBoard[b].dTickStart);
+		bBoard[b].dRx        = -1;
+	}
+
+	for (dT = 0; dT < dSeconds; )
+	{
+		// Next event: a tick, a timestamp arriving, the master sending or a measurement
+		dNext = dSample;
+		bNext = 0xFFFF;
+		for (b = 0; b < wBoards; b++)
+		{
+			if (bBoard[b].dTickEnd < dNext)
+			{
+				dNext = bBoard[b].dTickEnd;
+				bNext = b;
+			}
+			if (bBoard[b].dRx >= 0 && bBoard[b].dRx < dNext)
+			{
+				dNext = bBoard[b].dRx;
+				bNext = b | 0x8000;
+			}
+		}
+		if (dSend >= 0 && dSend < dNext)
+		{
+			dNext = dSend;
+			bNext = 0x4000;
+		}
+		dT = dNext;
+
+		if (bNext == 0xFFFF)                          // Measurement
+		{
+			dSample += 0.010;
+			if (dT < dSettle)
+				continue;
+			for (b = 1; b < wBoards; b++)
+			{
+				dOff  = sim_offset(&bBoard[b], dT);
+				dSum += dOff * dOff;
+				ulN++;
+				if (fabs(dOff) > dMax)
+					dMax = fabs(dOff);
+			}
+			if (ucVerbose && fmod(dT + 1e-9, 1.0) < 0.010)
+			{
+				printf("%8.2f", dT);
+				for (b = 1; b < wBoards; b++)
+					printf(" %8.1f%c", sim_offset(&bBoard[b], dT), "FAL"[bBoard[b].c.sState]);
+				printf("\n");
+			}
+		}
+		else if (bNext == 0x4000)                     // Master stamps and sends
+		{
+			dSend = -1;
+			sim_read(&bBoard[0], dT, &ulMs, &lUs);
+			for (b = 1; b < wBoards; b++)
+			{
+				if (sim_rand() * 100 < dLoss)
+					continue;
+				bBoard[b].ulRxMs = ulMs;
+				bBoard[b].lRxUs  = lUs;
+				bBoard[b].dRx    = dT + (SYNC_SIM_WIRE_US + sim_rand() * dJitter) * 1e-6;
+			}
+		}
+		else if (bNext & 0x8000)                      // Follower takes a timestamp
+		{
+			b = bNext & 0x7FFF;
+			bBoard[b].dRx = -1;
+			sim_read(&bBoard[b], dT, &ulMs, &lUs);
+			sync_clock_sample(&bBoard[b].c, bBoard[b].ulRxMs, bBoard[b].lRxUs + SYNC_SIM_LATENCY_US, ulMs, lUs);
+		}
+		else                                          // SysTick
+		{
+			b = bNext;
+			bBoard[b].dTickStart = dT;
+			sync_clock_tick(&bBoard[b].c);
+			bBoard[b].dTickEnd = dT + bBoard[b].c.ulCurLen / sim_hz(&bBoard[b], dT);
+			if (b == 0 && bBoard[0].c.ulMs % SYNC_PERIOD_MS == 0)
+				dSend = dT + sim_rand() * SYNC_SIM_TX_WAIT_US * 1e-6;
+		}
+	}
+
+	printf("boards %u, %.0f s, loss %.0f %%, jitter %.0f us, HSI +-%.0f per mille, wander %.0f ppm\n",
+	       wBoards, dSeconds, dLoss, dJitter, dErr, dWander);
+	for (b = 1; b < wBoards; b++)
+		printf("  board %2u  HSI %+7.0f ppm  trim %+6d ppm  %s  steps %u  outliers %u\n", b,
+		       (bBoard[b].dHz0 / (SYNC_SIM_CLK_MS * 1000.0) - 1) * 1e6, sync_clock_ppm(&bBoard[b].c),
+		       bBoard[b].c.sState == SYNC_LOCKED ? "locked " : bBoard[b].c.sState == SYNC_ACQUIRE ? "acquire" : "free   ",
+		       bBoard[b].c.ulSteps, bBoard[b].c.ulOutliers);
+	printf("offset after %.0f s: rms %.1f us, max %.1f us, limit %.0f us\n",
+	       dSettle, ulN ? sqrt(dSum / ulN) : 0, dMax, dLimit);
+
+	return dMax > dLimit;
+}
@@ -0,0 +1,235 @@
+#include <string.h>
+#include "main.h"
+#include "wave_check.h"
+
+/*
+ * WS2812B datasheet: T0H 0.40 us, T1H 0.80 us, T0L 0.85 us, T1L 0.45 us, each
+ * +-150 ns, reset >= 50 us. SK6812: T0H 0.30 us, T1H 0.60 us, T0L 0.90 us,
+ * T1L 0.60 us, each +-150 ns, reset >= 80 us. Both accept low times well past
+ * the datasheet value; TL max is the longest low the parts are known to treat
+ * as a bit gap rather than a reset.
+ */
+const WaveTimingDef kWaveTiming[2] = {
+	{ "WS2812", 250, 550, 650, 950, 300, 5000, 50000 },
+	{ "SK6812", 150, 450, 451, 750, 300, 5000, 80000 },
+};
+
+
+// ==================================================================================
+static void wave_minmax(uint32_t ulNs, uint32_t *pMin, uint32_t *pMax)
+{
+	if (ulNs < *pMin)
+		*pMin = ulNs;
+	if (ulNs > *pMax)
+		*pMax = ulNs;
+}
+
+// ==================================================================================
+static void wave_error(WaveCheckDef *wCheck, uint32_t *pCount)
+{
+	(*pCount)++;
+	if (wCheck->sStat.ulFirstErr == WAVE_NO_ERR)
+		wCheck->sStat.ulFirstErr = wCheck->sStat.ulBits - 1;
+}
+
+// ==================================================================================
+/**
+ * @brief  Ends the frame being decoded and hands it out
+ */
+static void wave_latch(WaveCheckDef *wCheck)
+{
+	if (!wCheck->wNum && !wCheck->ucBitCnt)
+		return;
+
+	wCheck->sStat.ulFrames++;
+	if (wCheck->ucBitCnt)
+		wCheck->sStat.ulPartial++;
+
+	if (wCheck->fFrame)
+		wCheck->fFrame(wCheck->pPixel, wCheck->wNum, wCheck->pArg);
+
+	wCheck->wNum     = 0;
+	wCheck->ucBitCnt = 0;
+	wCheck->ulShift  = 0;
+}
+
+// ==================================================================================
+/**
+ * @brief  Classifies the pending high pulse and checks the low time after it
+ */
+static void wave_bit(WaveCheckDef *wCheck, uint32_t ulLow)
+{
+	const WaveTimingDef *wTime = wCheck->pTiming;
+	WaveStatDef *sStat = &wCheck->sStat;
+	uint32_t ulHigh = wCheck->ulHigh;
+	uint8_t  ucBit;
+
+	sStat->ulBits++;
+	if (ulHigh >= wTime->wT0HMin && ulHigh <= wTime->wT0HMax)
+	{
+		ucBit = 0;
+		wave_minmax(ulHigh, &sStat->ulHigh0Min, &sStat->ulHigh0Max);
+	}
+	else if (ulHigh >= wTime->wT1HMin && ulHigh <= wTime->wT1HMax)
+	{
+		ucBit = 1;
+		wave_minmax(ulHigh, &sStat->ulHigh1Min, &sStat->ulHigh1Max);
+	}
+	else
+	{
+		ucBit = ulHigh * 2 > wTime->wT0HMax + wTime->wT1HMin;   // Closer window, for decoding only
+		wave_minmax(ulHigh, ucBit ? &sStat->ulHigh1Min : &sStat->ulHigh0Min,
+		                    ucBit ? &sStat->ulHigh1Max : &sStat->ulHigh0Max);
+		wave_error(wCheck, &sStat->ulHighErr);
+	}
+
+	if (ulLow < wTime->ulReset)
+	{
+		wave_minmax(ulLow, &sStat->ulLowMin, &sStat->ulLowMax);
+		if (ulLow < wTime->wTLMin || ulLow > wTime->wTLMax)
+			wave_error(wCheck, &sStat->ulLowErr);
+	}
+
+	wCheck->ulShift = (wCheck->ulShift << 1) | ucBit;
+	if (++wCheck->ucBitCnt == 24)
+	{
+		if (wCheck->wNum < wCheck->wMax)
+		{
+			wCheck->pPixel[wCheck->wNum].green = wCheck->ulShift >> 16;
+			wCheck->pPixel[wCheck->wNum].red   = wCheck->ulShift >> 8;
+			wCheck->pPixel[wCheck->wNum].blue  = wCheck->ulShift;
+		}
+		wCheck->wNum++;
+		wCheck->ucBitCnt = 0;
+		wCheck->ulShift  = 0;
+	}
+
+	if (ulLow >= wTime->ulReset)
+		wave_latch(wCheck);
+}
+
+// ==================================================================================
+/**
+ * @brief  Closes the current run of the line
+ */
+static void wave_run_end(WaveCheckDef *wCheck)
+{
+	uint32_t ulNs = (wCheck->ullRun + 500) / 1000;
+
+	if (wCheck->ucLevel)
+	{
+		wCheck->ulHigh  = ulNs;
+		wCheck->ucPulse = 1;
+	}
+	else if (wCheck->ucPulse)
+	{
+		wCheck->ucPulse = 0;
+		wave_bit(wCheck, ulNs);
+	}
+	else if (ulNs >= wCheck->pTiming->ulReset)        // Idle line before the first pulse
+	{
+		wave_latch(wCheck);
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Starts a check, the line is assumed idle (low)
+ *
+ * @param  eChip   Timing windows to check against
+ * @param  pPixel  Buffer for the decoded pixels of one frame
+ * @param  wMax    Size of pPixel, longer frames are counted but not stored
+ * @param  fFrame  Called with the pixels of every latched frame, may be NULL
+ */
+void wave_init(WaveCheckDef *wCheck, WaveChipType eChip, rgb_color *pPixel, uint16_t wMax, WaveFrameFunc fFrame, void *pArg)
+{
+	memset(wCheck, 0, sizeof(*wCheck));
+	wCheck->pTiming = &kWaveTiming[eChip];
+	wCheck->pPixel  = pPixel;
+	wCheck->wMax    = wMax;
+	wCheck->fFrame  = fFrame;
+	wCheck->pArg    = pArg;
+
+	wCheck->sStat.ulFirstErr = WAVE_NO_ERR;
+	wCheck->sStat.ulHigh0Min = wCheck->sStat.ulHigh1Min = wCheck->sStat.ulLowMin = 0xFFFFFFFF;
+}
+
+// ==================================================================================
+/**
+ * @brief  Feeds a run of the line at one level
+ * @param  ullPs  Run length in ps
+ */
+void wave_level(WaveCheckDef *wCheck, uint8_t ucLevel, uint64_t ullPs)
+{
+	if (!ullPs)                                       // A 0 % duty PWM slot has no high edge
+		return;
+
+	ucLevel = !!ucLevel;
+	if (ucLevel != wCheck->ucLevel)
+	{
+		wave_run_end(wCheck);
+		wCheck->ucLevel = ucLevel;
+		wCheck->ullRun  = 0;
+	}
+	wCheck->ullRun += ullPs;
+}
+
+// ==================================================================================
+/**
+ * @brief  Feeds SPI MOSI bytes, MSB first
+ * @param  ullBitPs  SPI bit time, see wave_spi_bit_ps()
+ * @param  ullGapPs  Idle time after each byte (late refills of the data
+ *                   register), MOSI keeps the level of the last bit
+ */
+void wave_spi(WaveCheckDef *wCheck, const uint8_t *pData, uint32_t ulNum, uint64_t ullBitPs, uint64_t ullGapPs)
+{
+	uint32_t i;
+	uint8_t  j;
+
+	for (i = 0; i < ulNum; i++)
+	{
+		for (j = 0; j < 8; j++)
+			wave_level(wCheck, (pData[i] << j) & 0x80, ullBitPs);
+		if (ullGapPs)
+			wave_level(wCheck, pData[i] & 0x01, ullGapPs);
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Feeds timer compare values, one per bit (PWM mode 1)
+ * @param  wPeriod   Timer period in ticks (ARR + 1)
+ * @param  ullTickPs Timer tick in ps
+ */
+void wave_pwm(WaveCheckDef *wCheck, const uint16_t *pCompare, uint32_t ulNum, uint16_t wPeriod, uint64_t ullTickPs)
+{
+	uint32_t i;
+	uint16_t wHigh;
+
+	for (i = 0; i < ulNum; i++)
+	{
+		wHigh = pCompare[i] < wPeriod ? pCompare[i] : wPeriod;
+		wave_level(wCheck, 1, wHigh * ullTickPs);
+		wave_level(wCheck, 0, (wPeriod - wHigh) * ullTickPs);
+	}
+}
+
+// ==================================================================================
+/**
+ * @brief  Line goes idle for good, latches whatever is pending
+ */
+void wave_end(WaveCheckDef *wCheck)
+{
+	wave_level(wCheck, 0, (uint64_t)wCheck->pTiming->ulReset * 1000);
+	wave_run_end(wCheck);
+	wCheck->ullRun = 0;
+}
+
+// ==================================================================================
+/**
+ * @brief  SPI bit time for a core clock and SPI_BAUDRATEPRESCALER_x divider
+ */
+uint64_t wave_spi_bit_ps(uint32_t ulCoreHz, uint32_t ulPrescaler)
+{
+	return 1000000000000ULL * ulPrescaler / ulCoreHz;
+}
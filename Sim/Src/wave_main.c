@@ -0,0 +1,137 @@
+/*
+ * wave_main.c
+ *
+ * Timing-checks and decodes a captured WS2812 data stream.
+ *
+ *   k3na_wave [options] capture.bin
+ *     -c ws2812|sk6812   timing windows (default ws2812)
+ *     -f hz              core clock (default 40000000, SystemClock_Config)
+ *     -p div             SPI prescaler (default 8, MX_SPI1_Init)
+ *     -g ns              idle after each SPI byte (default 0)
+ *     -t period tick_ns  capture holds u16 little endian timer compare
+ *                        values, one per bit, instead of SPI bytes
+ *     -v                 print the pixels of every frame
+ *
+ * Exit status 1 on a timing violation or a frame that ends inside a pixel.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "main.h"
+#include "wave_check.h"
+
+#define WAVE_MAX_LED        4096
+
+static rgb_color rPixel[WAVE_MAX_LED];
+static uint8_t   ucVerbose;
+
+
+// ==================================================================================
+static void wave_frame(const rgb_color *rLed, uint16_t wNum, void *pArg)
+{
+	uint32_t *pFrame = pArg;
+	uint16_t  i;
+
+	if (ucVerbose)
+	{
+		printf("frame %u, %u pixels\n", (*pFrame)++, wNum);
+		for (i = 0; i < wNum && i < WAVE_MAX_LED; i++)
+			printf("%02X%02X%02X%c", rLed[i].red, rLed[i].green, rLed[i].blue, (i % 16 == 15) ? '\n' : ' ');
+		if (i % 16)
+			printf("\n");
+	}
+}
+
+// ==================================================================================
+int main(int argc, char **argv)
+{
+	WaveCheckDef  wCheck;
+	WaveStatDef  *sStat = &wCheck.sStat;
+	WaveChipType  eChip = WAVE_WS2812;
+	uint32_t      ulCoreHz = 40000000, ulPrescaler = 8, ulGapNs = 0, ulFrame = 0;
+	uint32_t      ulPeriod = 0, ulTickNs = 0, ulNum, i;
+	const char   *pFile = NULL;
+	uint8_t      *pData;
+	uint16_t     *pCompare;
+	FILE         *fIn;
+	long          lSize;
+	int           a;
+
+	for (a = 1; a < argc; a++)
+	{
+		if (!strcmp(argv[a], "-c") && a + 1 < argc)
+			eChip = strcmp(argv[++a], "sk6812") ? WAVE_WS2812 : WAVE_SK6812;
+		else if (!strcmp(argv[a], "-f") && a + 1 < argc)
+			ulCoreHz = strtoul(argv[++a], NULL, 0);
+		else if (!strcmp(argv[a], "-p") && a + 1 < argc)
+			ulPrescaler = strtoul(argv[++a], NULL, 0);
+		else if (!strcmp(argv[a], "-g") && a + 1 < argc)
+			ulGapNs = strtoul(argv[++a], NULL, 0);
+		else if (!strcmp(argv[a], "-t") && a + 2 < argc)
+		{
+			ulPeriod = strtoul(argv[++a], NULL, 0);
+			ulTickNs = strtoul(argv[++a], NULL, 0);
+		}
+		else if (!strcmp(argv[a], "-v"))
+			ucVerbose = 1;
+		else if (argv[a][0] != '-' && !pFile)
+			pFile = argv[a];
+		else
+			pFile = NULL, a = argc;
+	}
+
+	if (!pFile || !ulCoreHz || !ulPrescaler || (ulPeriod && !ulTickNs))
+	{
+		fprintf(stderr, "usage: %s [-c ws2812|sk6812] [-f hz] [-p div] [-g ns] [-t period tick_ns] [-v] capture.bin\n", argv[0]);
+		return 2;
+	}
+
+	if (!(fIn = fopen(pFile, "rb")) || fseek(fIn, 0, SEEK_END) || (lSize = ftell(fIn)) < 0)
+	{
+		perror(pFile);
+		return 2;
+	}
+	rewind(fIn);
+	pData = malloc(lSize + 1);
+	if (!pData || fread(pData, 1, lSize, fIn) != (size_t)lSize)
+	{
+		perror(pFile);
+		return 2;
+	}
+	fclose(fIn);
+
+	wave_init(&wCheck, eChip, rPixel, WAVE_MAX_LED, wave_frame, &ulFrame);
+	if (ulPeriod)
+	{
+		ulNum = lSize / 2;
+		pCompare = malloc(ulNum * sizeof(uint16_t) + 1);
+		for (i = 0; i < ulNum; i++)
+			pCompare[i] = pData[2 * i] | (pData[2 * i + 1] << 8);
+		wave_pwm(&wCheck, pCompare, ulNum, ulPeriod, (uint64_t)ulTickNs * 1000);
+		free(pCompare);
+	}
+	else
+	{
+		wave_spi(&wCheck, pData, lSize, wave_spi_bit_ps(ulCoreHz, ulPrescaler), (uint64_t)ulGapNs * 1000);
+	}
+	wave_end(&wCheck);
+	free(pData);
+
+	printf("%s timing check of %s\n", wCheck.pTiming->pName, pFile);
+	printf("  frames       %10u\n", sStat->ulFrames);
+	printf("  bits         %10u\n", sStat->ulBits);
+	if (sStat->ulHigh0Max)
+		printf("  T0H          %6u..%u ns (%u..%u)\n", sStat->ulHigh0Min, sStat->ulHigh0Max, wCheck.pTiming->wT0HMin, wCheck.pTiming->wT0HMax);
+	if (sStat->ulHigh1Max)
+		printf("  T1H          %6u..%u ns (%u..%u)\n", sStat->ulHigh1Min, sStat->ulHigh1Max, wCheck.pTiming->wT1HMin, wCheck.pTiming->wT1HMax);
+	if (sStat->ulLowMax)
+		printf("  TL           %6u..%u ns (%u..%u)\n", sStat->ulLowMin, sStat->ulLowMax, wCheck.pTiming->wTLMin, wCheck.pTiming->wTLMax);
+	printf("  high errors  %10u\n", sStat->ulHighErr);
+	printf("  low errors   %10u\n", sStat->ulLowErr);
+	printf("  partial      %10u\n", sStat->ulPartial);
+	if (sStat->ulFirstErr != WAVE_NO_ERR)
+		printf("  first error  %10u (bit)\n", sStat->ulFirstErr);
+
+	return (sStat->ulHighErr || sStat->ulLowErr || sStat->ulPartial) ? 1 : 0;
+}
@@ -0,0 +1,203 @@
+#include <stdlib.h>
+#include "work_pool.h"
+
+typedef struct
+{
+	PoolTypeDef *p;
+	uint16_t     wId;
+} PoolWorkerDef;
+
+
+// ==================================================================================
+/**
+ * @brief  Takes a task from the back of a worker's own range
+ */
+static int pool_pop(PoolQueueDef *q, uint32_t *pTask)
+{
+	int iOk = 0;
+
+	pthread_mutex_lock(&q->mLock);
+	if (q->ulHead < q->ulTail)
+	{
+		*pTask = --q->ulTail;
+		iOk = 1;
+	}
+	pthread_mutex_unlock(&q->mLock);
+	return iOk;
+}
+
+// ==================================================================================
+/**
+ * @brief  Takes a task from the front of another worker's range
+ */
+static int pool_steal(PoolQueueDef *q, uint32_t *pTask)
+{
+	int iOk = 0;
+
+	pthread_mutex_lock(&q->mLock);
+	if (q->ulHead < q->ulTail)
+	{
+		*pTask = q->ulHead++;
+		iOk = 1;
+	}
+	pthread_mutex_unlock(&q->mLock);
+	return iOk;
+}
+
+// ==================================================================================
+/**
+ * @brief  Runs tasks until every queue is empty
+ * @details Tasks never create tasks, so one pass over all queues that finds
+ *          nothing means the run is complete for this worker.
+ */
+static void pool_work(PoolTypeDef *p, uint16_t wId)
+{
+	PoolQueueDef *q = &p->pQueue[wId];
+	uint32_t ulTask = 0;
+	uint16_t k;
+
+	for (;;)
+	{
+		if (pool_pop(q, &ulTask))
+		{
+			p->fTask(p->pArg, ulTask);
+			q->ulRun++;
+			continue;
+		}
+
+		for (k = 1; k < p->wWorkers; k++)
+		{
+			if (pool_steal(&p->pQueue[(wId + k) % p->wWorkers], &ulTask))
+				break;
+		}
+		if (k == p->wWorkers)
+			return;
+
+		p->fTask(p->pArg, ulTask);
+		q->ulRun++;
+		q->ulStolen++;
+	}
+}
+
+// ==================================================================================
+static void *pool_thread(void *pArg)
+{
+	PoolWorkerDef *w = pArg;
+	PoolTypeDef   *p = w->p;
+	uint32_t       ulSeen = 0;
+
+	for (;;)
+	{
+		pthread_mutex_lock(&p->mLock);
+		while (p->ulGen == ulSeen && !p->ucQuit)
+			pthread_cond_wait(&p->cStart, &p->mLock);
+		if (p->ucQuit)
+		{
+			pthread_mutex_unlock(&p->mLock);
+			break;
+		}
+		ulSeen = p->ulGen;
+		pthread_mutex_unlock(&p->mLock);
+
+		pool_work(p, w->wId);
+
+		pthread_mutex_lock(&p->mLock);
+		if (!--p->wBusy)
+			pthread_cond_signal(&p->cDone);
+		pthread_mutex_unlock(&p->mLock);
+	}
+	free(w);
+	return NULL;
+}
+
+// ==================================================================================
+/**
+ * @brief  Starts wWorkers - 1 helper threads
+ * @return 0 on success
+ */
+int pool_init(PoolTypeDef *p, uint16_t wWorkers)
+{
+	PoolWorkerDef *w;
+	uint16_t i;
+
+	if (!wWorkers)
+		wWorkers = 1;
+
+	p->wWorkers = wWorkers;
+	p->ulGen    = 0;
+	p->wBusy    = 0;
+	p->ucQuit   = 0;
+	p->pThread  = calloc(wWorkers, sizeof(pthread_t));
+	p->pQueue   = calloc(wWorkers, sizeof(PoolQueueDef));
+	if (!p->pThread || !p->pQueue)
+		return -1;
+
+	pthread_mutex_init(&p->mLock, NULL);
+	pthread_cond_init(&p->cStart, NULL);
+	pthread_cond_init(&p->cDone, NULL);
+	for (i = 0; i < wWorkers; i++)
+		pthread_mutex_init(&p->pQueue[i].mLock, NULL);
+
+	for (i = 1; i < wWorkers; i++)
+	{
+		w = malloc(sizeof(*w));
+		if (!w)
+			return -1;
+		w->p   = p;
+		w->wId = i;
+		if (pthread_create(&p->pThread[i], NULL, pool_thread, w))
+			return -1;
+	}
+	return 0;
+}
+
+// ==================================================================================
+/**
+ * @brief  Runs fTask(pArg, 0 .. ulTasks - 1) on all workers and waits for them
+ */
+void pool_run(PoolTypeDef *p, PoolTaskFunc fTask, void *pArg, uint32_t ulTasks)
+{
+	uint16_t i;
+
+	for (i = 0; i < p->wWorkers; i++)
+	{
+		p->pQueue[i].ulHead = (uint64_t)ulTasks * i / p->wWorkers;
+		p->pQueue[i].ulTail = (uint64_t)ulTasks * (i + 1) / p->wWorkers;
+	}
+
+	pthread_mutex_lock(&p->mLock);
+	p->fTask = fTask;
+	p->pArg  = pArg;
+	p->wBusy = p->wWorkers - 1;
+	p->ulGen++;
+	pthread_cond_broadcast(&p->cStart);
+	pthread_mutex_unlock(&p->mLock);
+
+	pool_work(p, 0);
+
+	pthread_mutex_lock(&p->mLock);
+	while (p->wBusy)
+		pthread_cond_wait(&p->cDone, &p->mLock);
+	pthread_mutex_unlock(&p->mLock);
+}
+
+// ==================================================================================
+void pool_free(PoolTypeDef *p)
+{
+	uint16_t i;
+
+	pthread_mutex_lock(&p->mLock);
+	p->ucQuit = 1;
+	pthread_cond_broadcast(&p->cStart);
+	pthread_mutex_unlock(&p->mLock);
+
+	for (i = 1; i < p->wWorkers; i++)
+		pthread_join(p->pThread[i], NULL);
+	for (i = 0; i < p->wWorkers; i++)
+		pthread_mutex_destroy(&p->pQueue[i].mLock);
+	pthread_mutex_destroy(&p->mLock);
+	pthread_cond_destroy(&p->cStart);
+	pthread_cond_destroy(&p->cDone);
+	free(p->pThread);
+	free(p->pQueue);
+}
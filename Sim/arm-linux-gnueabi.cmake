@@ -0,0 +1,14 @@
+# Builds the simulator as a static ARM Linux binary for qemu-arm. The engine
+# is compiled as Thumb-1 for ARMv6-M, so instruction counts track what the
+# Cortex-M0 executes; libc and the host harness are not part of a case.
+
+set(CMAKE_SYSTEM_NAME Linux)
+set(CMAKE_SYSTEM_PROCESSOR arm)
+
+set(CMAKE_C_COMPILER arm-linux-gnueabi-gcc)
+set(CMAKE_C_FLAGS_INIT "-mthumb -march=armv6-m -mfloat-abi=soft")
+set(CMAKE_EXE_LINKER_FLAGS_INIT "-static")
+
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""Compare a k3na_bench run against a stored baseline.
+
+Both files are "case,pixels,<metric>" CSV as written by k3na_bench
+(ns_per_pixel) or Tools/bench_qemu.py (insn_per_pixel). A case is a
+regression when it is slower than the baseline by more than the tolerance.
+
+k3na_jtest results (ns_per_sample per test and parameter set) compare the
+same way. A test that fails now, or lost more than SNR_DROP dB against
+the baseline and sits below SNR_EXACT (float32 rounding, a changed order
+of summation), is a regression too. Calls shorter than JTEST_MIN_NS are
+not timed reliably by a single clock read and only count for accuracy.
+
+Usage:
+    bench_compare.py baseline.csv current.csv [--tolerance 0.30]
+
+Default tolerance is 0.30 for ns_per_pixel (host timing noise) and 0.02 for
+insn_per_pixel (instruction counts are deterministic). Exit status 1 on a
+regression or a metric mismatch.
+"""
+import argparse
+import csv
+import sys
+
+TOLERANCE = {"ns_per_pixel": 0.30, "insn_per_pixel": 0.02, "ns_per_sample": 0.30}
+SNR_DROP = 1.0
+SNR_EXACT = 120.0
+JTEST_MIN_NS = 500
+
+
+def load(path):
+    """Returns the metric, {key: value} and {key: (result, snr, ns_per_call)} for k3na_jtest."""
+    with open(path, newline="") as f:
+        rows = list(csv.reader(f))
+    if rows and rows[0][:2] == ["group", "test"]:
+        col = {name: i for i, name in enumerate(rows[0])}
+        val, acc = {}, {}
+        for r in rows[1:]:
+            if not r:
+                continue
+            key = (r[col["test"]], r[col["params"]])
+            val[key] = float(r[col["ns_per_sample"]])
+            snr = r[col["snr_db"]]
+            acc[key] = (r[col["result"]], float(snr) if snr else None, float(r[col["ns_per_call"]]))
+        return "ns_per_sample", val, acc
+    if not rows or len(rows[0]) != 3:
+        sys.exit("%s: not a k3na_bench CSV" % path)
+    metric = rows[0][2]
+    return metric, {(r[0], int(r[1])): float(r[2]) for r in rows[1:] if r}, {}
+
+
+def accuracy(base, cur):
+    """Why a k3na_jtest result got worse, or an empty string."""
+    if cur[0] != "PASS":
+        return "FAIL"
+    if base[1] is not None and cur[1] is not None and cur[1] < min(base[1] - SNR_DROP, SNR_EXACT):
+        return "SNR %.1f dB" % cur[1]
+    return ""
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("baseline")
+    ap.add_argument("current")
+    ap.add_argument("--tolerance", type=float)
+    args = ap.parse_args()
+
+    base_metric, base, base_acc = load(args.baseline)
+    cur_metric, cur, cur_acc = load(args.current)
+    if base_metric != cur_metric:
+        sys.exit("metric mismatch: baseline %s, current %s" % (base_metric, cur_metric))
+    tol = args.tolerance if args.tolerance is not None else TOLERANCE.get(cur_metric, 0.30)
+
+    bad = 0
+    size = "params" if cur_acc else "pixels"
+    print("%-22s %6s %10s %10s %7s" % ("case", size, "baseline", "current", "ratio"))
+    for key in sorted(cur):
+        if key not in base:
+            print("%-22s %6s %10s %10.3f %7s  new" % (key[0], key[1], "-", cur[key], "-"))
+            continue
+        ratio = cur[key] / base[key] if base[key] else 1.0
+        flag = ""
+        timed = key not in cur_acc or min(cur_acc[key][2], base_acc[key][2]) >= JTEST_MIN_NS
+        if timed and ratio > 1.0 + tol:
+            flag = "  REGRESSION"
+        if key in cur_acc and accuracy(base_acc[key], cur_acc[key]):
+            flag += "  " + accuracy(base_acc[key], cur_acc[key])
+        if flag:
+            bad += 1
+        print("%-22s %6s %10.3f %10.3f %7.2f%s" % (key[0], key[1], base[key], cur[key], ratio, flag))
+    for key in sorted(set(base) - set(cur)):
+        print("%-22s %6s %10.3f %10s %7s  missing" % (key[0], key[1], base[key], "-", "-"))
+
+    print("%u regression(s), tolerance %.0f%% on %s" % (bad, tol * 100, cur_metric))
+    sys.exit(1 if bad else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""Count instructions per pixel of every k3na_bench case under qemu-arm.
+
+Needs the ARM build of k3na_bench (Sim/arm-linux-gnueabi.cmake) and the
+instruction counting plugin that ships with QEMU (contrib/plugins or
+tests/plugin, libinsn.so). Each case runs twice, with ITER iterations and
+with none, so start-up code cancels out:
+
+    insn_per_pixel = (insns(ITER) - insns(0)) / (ITER * pixels)
+
+With --dsp the binary is k3na_dsp instead and every case is counted on
+both sides, the reference (ref: the vendored C, or what a new kernel
+replaces, such as the direct form convolution) and the kernel, per sample
+of one call:
+
+    case,size,ref_insn_per_sample,insn_per_sample,gain
+
+Usage:
+    bench_qemu.py BENCH PLUGIN [-i ITER] [-o out.csv] [--qemu qemu-arm] [--cpu CPU]
+    bench_qemu.py --dsp K3NA_DSP PLUGIN [-i ITER] [-o out.csv]
+"""
+import argparse
+import re
+import subprocess
+import sys
+import tempfile
+
+
+def count(args, cmd):
+    with tempfile.NamedTemporaryFile(mode="r", suffix=".log") as log:
+        subprocess.run(qemu(args) + ["-plugin", args.plugin, "-d", "plugin",
+                                     "-D", log.name] + cmd, check=True)
+        m = re.search(r"insns:\s*(\d+)", log.read())
+    if not m:
+        sys.exit("no instruction count from %s, is it libinsn.so?" % args.plugin)
+    return int(m.group(1))
+
+
+def qemu(args):
+    return [args.qemu] + (["-cpu", args.cpu] if args.cpu else [])
+
+
+def listing(args):
+    return subprocess.run(qemu(args) + [args.bench, "-l"], check=True,
+                          capture_output=True, text=True).stdout.split("\n")
+
+
+def bench_cases(args, out):
+    lines = listing(args)
+    cases = [l for l in lines if l and not l.startswith("pixels")]
+    pixels = [int(n) for l in lines if l.startswith("pixels") for n in l.split()[1:]]
+
+    out.write("case,pixels,insn_per_pixel\n")
+    for case in cases:
+        for n in pixels:
+            run = [args.bench, "-r", case, "-n", str(n), "-i"]
+            full = count(args, run + [str(args.iterations)])
+            empty = count(args, run + ["0"])
+            out.write("%s,%u,%.3f\n" % (case, n, (full - empty) / (args.iterations * n)))
+            out.flush()
+
+
+def dsp_cases(args, out):
+    out.write("case,size,ref_insn_per_sample,insn_per_sample,gain\n")
+    for line in listing(args):
+        if not line:
+            continue
+        index, samples, name, size = line.split(" ", 3)
+        per_sample = []
+        for side in ("0", "1"):
+            run = [args.bench, "-r", index, "-s", side, "-i"]
+            full = count(args, run + [str(args.iterations)])
+            empty = count(args, run + ["0"])
+            per_sample.append((full - empty) / (args.iterations * int(samples)))
+        out.write("%s,%s,%.3f,%.3f,%.2f\n" % (name, size, per_sample[0], per_sample[1],
+                                              per_sample[0] / per_sample[1]))
+        out.flush()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("bench", help="ARM build of k3na_bench, or of k3na_dsp with --dsp")
+    ap.add_argument("plugin", help="path to QEMU libinsn.so")
+    ap.add_argument("-i", "--iterations", type=int, default=20)
+    ap.add_argument("-o", "--output")
+    ap.add_argument("--qemu", default="qemu-arm")
+    ap.add_argument("--cpu", help="qemu-arm -cpu, e.g. cortex-m0 for a bare metal build")
+    ap.add_argument("--dsp", action="store_true", help="count the k3na_dsp cases")
+    args = ap.parse_args()
+
+    out = open(args.output, "w") if args.output else sys.stdout
+    if args.dsp:
+        dsp_cases(args, out)
+    else:
+        bench_cases(args, out)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""Write the tables of the fixed-point fast math functions.
+
+The q15 functions interpolate linearly between the entries of a uniform
+table, scaled so that 32768 is 1.0 (uint16_t, 1.0 itself fits). The q31
+functions evaluate a cubic per segment,
+
+    f(i + s) = c0 + s * (c1 + s * (c2 + s * c3))    s in [0, 1) as 1.31
+
+with the four coefficients of segment i in 1.31 next to each other. The
+cubic interpolates f at the four Chebyshev nodes of the segment, which is
+within a few percent of the minimax error.
+
+    Tools/fastmath_tables.py [-o Drivers/CMSIS/DSP/Source/CommonTables/arm_fast_math_tables.c]
+"""
+
+import argparse
+import math
+import os
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+OUT = os.path.join(ROOT, 'Drivers', 'CMSIS', 'DSP', 'Source', 'CommonTables', 'arm_fast_math_tables.c')
+
+# name, entries, f(k), description; f(k) in units of 1.0
+LINEAR = [
+    ('reciprocalTable_q15', 33, lambda k: 1 / (2 * (0.5 + k / 64)),
+     '1 / (2a) for a = 0.5 + k/64'),
+    ('invSqrtTable_q15', 49, lambda k: 1 / (2 * math.sqrt((16 + k) / 64)),
+     '1 / (2 sqrt(a)) for a = (16 + k) / 64'),
+    ('log2Table_q15', 33, lambda k: math.log2(1 + k / 32),
+     'log2(1 + k/32)'),
+    ('exp2Table_q15', 65, lambda k: 2 ** (k / 64) / 2,
+     '2^(k/64) / 2'),
+    ('atanTable_q15', 65, lambda k: math.atan(k / 64) / math.pi,
+     'atan(k/64) / pi'),
+]
+
+# name, segments, f(t) for t in [0, 1), description
+CUBIC = [
+    ('log2Table_q31', 32, lambda t: math.log2(1 + t), 'log2(1 + t)'),
+    ('exp2Table_q31', 32, lambda t: 2 ** t / 2, '2^t / 2'),
+    ('atanTable_q31', 64, lambda t: math.atan(t) / math.pi, 'atan(t) / pi'),
+]
+
+
+def cubic(f, a, b):
+    """Power basis coefficients in s of the cubic through f at the Chebyshev nodes of [a, b]."""
+    nodes = [(1 - math.cos((2 * k + 1) * math.pi / 8)) / 2 for k in range(4)]
+    rows = [[s ** j for j in range(4)] + [f(a + (b - a) * s)] for s in nodes]
+    for c in range(4):
+        p = max(range(c, 4), key=lambda r: abs(rows[r][c]))
+        rows[c], rows[p] = rows[p], rows[c]
+        for r in range(4):
+            if r != c:
+                m = rows[r][c] / rows[c][c]
+                rows[r] = [x - m * y for x, y in zip(rows[r], rows[c])]
+    return [rows[c][4] / rows[c][c] for c in range(4)]
+
+
+def block(ctype, name, size, values, per_line, doc):
+    out = ['/**', ' * @brief  %s' % doc, ' */',
+           'const %s %s[%u] = {' % (ctype, name, size)]
+    for i in range(0, len(values), per_line):
+        out.append('\t' + ', '.join(values[i:i + per_line]) + ',')
+    out.append('};')
+    out.append('')
+    return out
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('-o', '--output', default=OUT)
+    args = ap.parse_args()
+
+    out = ['/* Generated by Tools/fastmath_tables.py, do not edit */', '',
+           '#include "arm_math.h"', '#include "arm_common_tables.h"', '']
+    for name, size, f, doc in LINEAR:
+        values = ['%u' % round(32768 * f(k)) for k in range(size)]
+        out += block('uint16_t', name, size, values, 12,
+                     '%s, k = 0 to %u, 32768 = 1.0' % (doc, size - 1))
+    for name, segs, f, doc in CUBIC:
+        values = []
+        for i in range(segs):
+            for c in cubic(f, i / segs, (i + 1) / segs):
+                values.append('(q31_t)0x%08X' % (round(c * 2 ** 31) & 0xFFFFFFFF))
+        out += block('q31_t', name, 4 * segs, values, 4,
+                     '%s in %u segments of t, c0 to c3 of each in 1.31' % (doc, segs))
+    with open(args.output, 'w') as fh:
+        fh.write('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()
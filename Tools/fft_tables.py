@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""Cut the CMSIS-DSP FFT tables down to the transforms a build uses.
+
+arm_common_tables.c holds the twiddle and bit reversal tables of every
+length from 16 to 4096 in f32, q31 and q15; arm_const_structs.c and the
+arm_*fft_init_*() functions reference all of them, and the q15/q31 real
+FFTs read 8192 entry coefficient tables with a stride. Together that is
+far more flash than the STM32F030 has. Given the transforms and lengths an
+application calls, this copies out just the entries they read, value for
+value from the vendored sources, and writes ready const instances:
+
+    cfft_q15:N  cfft_q31:N  cfft_f32:N     arm_cfft_instance_*     fft_cfft_<type>_lenN
+    rfft_q15:N  rfft_q31:N                 arm_rfft_instance_*     fft_rfft_<type>_lenN,
+                                                                   fft_rifft_<type>_lenN (inverse)
+    rfft_fast_f32:N                        arm_rfft_fast_instance  fft_rfft_fast_f32_lenN (in RAM)
+
+A real FFT brings the instance of its N / 2 point CFFT along, tables are
+shared where two transforms read the same one. The instances take the
+place of arm_const_structs.h and of the init functions; the library's
+transform functions are unchanged.
+
+    Tools/fft_tables.py rfft_q15:128
+    Tools/fft_tables.py -c out.c -i out.h cfft_q15:64 rfft_fast_f32:256
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+DSP = os.path.join(ROOT, 'Drivers', 'CMSIS', 'DSP', 'Source')
+COMMON = 'CommonTables/arm_common_tables.c'
+
+CFFT_LENGTHS = [16 << i for i in range(9)]                # 16 .. 4096
+RFFT_LENGTHS = [32 << i for i in range(9)]                # 32 .. 8192
+FAST_LENGTHS = [32 << i for i in range(8)]                # 32 .. 4096
+
+# ctype, table prefix, values per line
+FORMAT = {
+    'q15': ('q15_t', 'q', 8),
+    'q31': ('q31_t', 'l', 4),
+    'f32': ('float32_t', 'f', 4),
+    'u16': ('uint16_t', 'w', 12),
+}
+
+_sources = {}
+
+
+def table(path, name):
+    """Values of a vendored table: ints for the fixed point ones, the literal text for floats."""
+    if path not in _sources:
+        _sources[path] = open(os.path.join(DSP, path)).read()
+    m = re.search(r'\b%s\s*\[[^\]]*\]\s*=\s*\{(.*?)\};' % re.escape(name), _sources[path], re.S)
+    if not m:
+        sys.exit('%s not found in %s' % (name, path))
+    body = re.sub(r'/\*.*?\*/', '', m.group(1), flags=re.S)
+    body = re.sub(r'\((q15_t|q31_t)\)', '', body)
+    return [v.strip() for v in body.replace('\n', ' ').split(',') if v.strip()]
+
+
+class Tables:
+    def __init__(self):
+        self.tables = {}           # name -> (kind, values), in order of first use
+        self.instances = []        # (ctype, name, initializer), ctype without const in RAM
+        self.names = set()
+
+    def add(self, kind, name, values):
+        if name not in self.tables:
+            self.tables[name] = (kind, values)
+        return name
+
+    def instance(self, ctype, name, init, const=True):
+        ctype = ('const ' if const else '') + ctype
+        if name not in self.names:
+            self.names.add(name)
+            self.instances.append((ctype, name, init))
+        return name
+
+    # ------------------------------------------------------------------
+    def cfft(self, kind, n):
+        if n not in CFFT_LENGTHS:
+            sys.exit('cfft length must be a power of two, 16..4096')
+        ctype = FORMAT[kind][0]
+        if kind == 'f32':
+            tw = self.add('f32', 'fTwiddle%d' % n, table(COMMON, 'twiddleCoef_%d' % n))
+            br = self.add('u16', 'wBitRev%d' % n, table(COMMON, 'armBitRevIndexTable%d' % n))
+        else:
+            tw = self.add(kind, '%sTwiddle%d' % (FORMAT[kind][1], n),
+                          table(COMMON, 'twiddleCoef_%d_%s' % (n, kind)))
+            br = self.add('u16', 'wBitRevFixed%d' % n,
+                          table(COMMON, 'armBitRevIndexTable_fixed_%d' % n))
+        nbr = len(self.tables[br][1])
+        return self.instance('arm_cfft_instance_%s' % kind, 'fft_cfft_%s_len%d' % (kind, n),
+                             '%d, %s, %s, %d' % (n, tw, br, nbr))
+
+    def rfft(self, kind, n):
+        if n not in RFFT_LENGTHS:
+            sys.exit('rfft length must be a power of two, 32..8192')
+        half = n // 2
+        step = 8192 // n
+        cfft = self.cfft(kind, half)
+        src = 'TransformFunctions/arm_rfft_init_%s.c' % kind
+        suffix = kind.upper()
+
+        # The split steps read pair i at 2 * i * step, i < N / 2
+        pick = lambda t: [t[2 * i * step + k] for i in range(half) for k in (0, 1)]
+        pre = FORMAT[kind][1]
+        a = self.add(kind, '%sRealA%d' % (pre, n), pick(table(src, 'realCoefA' + suffix)))
+        b = self.add(kind, '%sRealB%d' % (pre, n), pick(table(src, 'realCoefB' + suffix)))
+        ctype = FORMAT[kind][0]
+        for name, inverse in (('rfft', 0), ('rifft', 1)):
+            self.instance('arm_rfft_instance_%s' % kind, 'fft_%s_%s_len%d' % (name, kind, n),
+                          '%d, %d, 1, 1, (%s *)%s, (%s *)%s, &%s'
+                          % (n, inverse, ctype, a, ctype, b, cfft))
+
+    def rfft_fast(self, kind, n):
+        if kind != 'f32' or n not in FAST_LENGTHS:
+            sys.exit('rfft_fast is f32 only, length a power of two, 32..4096')
+        half = n // 2
+        tw = self.add('f32', 'fTwiddle%d' % half, table(COMMON, 'twiddleCoef_%d' % half))
+        br = self.add('u16', 'wBitRev%d' % half, table(COMMON, 'armBitRevIndexTable%d' % half))
+        rt = self.add('f32', 'fTwiddleR%d' % n, table(COMMON, 'twiddleCoef_rfft_%d' % n))
+        nbr = len(self.tables[br][1])
+        # Not const: arm_rfft_fast_f32() stores Sint.fftLen on every call
+        self.instance('arm_rfft_fast_instance_f32', 'fft_rfft_fast_f32_len%d' % n,
+                      '{ %d, %s, %s, %d }, %d, (float32_t *)%s' % (half, tw, br, nbr, n, rt),
+                      const=False)
+
+    # ------------------------------------------------------------------
+    def source(self, header, command):
+        out = ['// Generated by %s, do not edit' % command, '',
+               '#include "%s"' % header, '']
+        for name, (kind, values) in self.tables.items():
+            ctype, _, per = FORMAT[kind]
+            out.append('static const %s %s[%d] = {' % (ctype, name, len(values)))
+            for i in range(0, len(values), per):
+                row = values[i:i + per]
+                if kind in ('q15', 'q31'):
+                    digits = 4 if kind == 'q15' else 8
+                    mask = (1 << (4 * digits)) - 1
+                    cells = ['(%s)0x%0*X' % (ctype, digits, int(v, 0) & mask) for v in row]
+                else:
+                    cells = row
+                out.append('\t' + ', '.join(cells) + ',')
+            out.append('};')
+            out.append('')
+        for ctype, name, init in self.instances:
+            out.append('%s %s = {' % (ctype, name))
+            out.append('\t' + init)
+            out.append('};')
+            out.append('')
+        return '\n'.join(out)
+
+    def header(self, command):
+        out = ['// Generated by %s, do not edit' % command, '',
+               '#ifndef _FFT_TABLES_H_', '#define _FFT_TABLES_H_', '',
+               '#include "arm_math.h"', '']
+        width = max(len(ctype) for ctype, _, _ in self.instances)
+        for ctype, name, _ in self.instances:
+            out.append('extern %-*s %s;' % (width, ctype, name))
+        out += ['', '#endif', '']
+        return '\n'.join(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('transforms', nargs='+', metavar='type:N',
+                    help='cfft_q15, cfft_q31, cfft_f32, rfft_q15, rfft_q31 or rfft_fast_f32, and a length')
+    ap.add_argument('-c', '--source', default=os.path.join(ROOT, 'Core', 'Src', 'fft_tables.c'))
+    ap.add_argument('-i', '--header', default=os.path.join(ROOT, 'Core', 'Inc', 'fft_tables.h'))
+    args = ap.parse_args()
+
+    t = Tables()
+    for spec in args.transforms:
+        m = re.match(r'^(cfft|rfft|rfft_fast)_(q15|q31|f32):(\d+)$', spec)
+        if not m or (m.group(1) == 'rfft' and m.group(2) == 'f32'):
+            sys.exit('unknown transform %s' % spec)
+        getattr(t, m.group(1))(m.group(2), int(m.group(3)))
+
+    command = 'Tools/fft_tables.py ' + ' '.join(args.transforms)
+    with open(args.source, 'w') as f:
+        f.write(t.source(os.path.basename(args.header), command))
+    with open(args.header, 'w') as f:
+        f.write(t.header(command))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""Decode K3NA telemetry records (Core/Inc/tlog.h) from USART1.
+
+Record:  C3 ID LEN TS_L TS_H DATA[LEN] SUM   (SUM = 8 bit sum of ID..DATA)
+Raw packets between records (time sync) keep the stream framing,
+A5 5A TYPE LEN_L LEN_H PAYLOAD CRC[4], and are stepped over by length.
+
+Usage:
+    tlog_decode.py /dev/ttyUSB0 [baud]     read a serial port (needs pyserial)
+    tlog_decode.py capture.bin             decode a raw capture file
+"""
+import struct
+import sys
+
+TLOG_SYNC = 0xC3
+TLOG_MAX_DATA = 16
+RAW_SYNC = b"\xa5\x5a"
+RAW_MAX = 64
+
+KEY_NAME = {0: "MODE", 1: "GASO"}
+KEY_EVENT = {0: "press", 1: "release", 2: "long"}
+SYNC_STATE = {0: "free running", 1: "acquiring", 2: "locked"}
+
+
+def fmt_drop(d):
+    return "lost %u records" % struct.unpack("<I", d)[0]
+
+
+def fmt_boot(d):
+    return "boot, core clock %u Hz" % struct.unpack("<I", d)[0]
+
+
+def fmt_key(d):
+    return "key %s %s, mode %u" % (KEY_NAME.get(d[0], d[0]), KEY_EVENT.get(d[1], d[1]), d[2])
+
+
+def fmt_stream(d):
+    return "stream packets %u, crc errors %u, dropped %u" % struct.unpack("<III", d)
+
+
+def fmt_cfg(d):
+    return "config compacted, page seq %u, %u bytes used" % struct.unpack("<HH", d)
+
+
+def fmt_sync(d):
+    state, offset, ppm = struct.unpack("<Bii", d)
+    return "time sync %s, offset %d us, rate trim %d ppm" % (SYNC_STATE.get(state, state), offset, ppm)
+
+
+def fmt_audio(d):
+    return "audio blocks %u, overruns %u, worst %u clocks" % struct.unpack("<III", d)
+
+
+def fmt_spark(d):
+    return "spark frames %u, last %u clocks, worst %u clocks" % struct.unpack("<III", d)
+
+
+FORMAT = {0x00: fmt_drop, 0x01: fmt_boot, 0x02: fmt_key, 0x03: fmt_stream, 0x04: fmt_cfg, 0x05: fmt_sync,
+          0x06: fmt_audio, 0x07: fmt_spark}
+
+
+def records(chunks):
+    """Yields (timestamp ms, id, data) from an iterable of byte chunks."""
+    buf = bytearray()
+    t_hi, t_last = 0, None
+    for chunk in chunks:
+        buf += chunk
+        while True:
+            start = buf.find(TLOG_SYNC)
+            raw = buf.find(RAW_SYNC)
+            if raw >= 0 and (start < 0 or raw < start):
+                del buf[:raw]
+                if len(buf) < 5:
+                    break
+                n = buf[3] | buf[4] << 8
+                if n > RAW_MAX:
+                    del buf[:1]
+                    continue
+                if len(buf) < n + 9:
+                    break
+                del buf[: n + 9]
+                continue
+            if start < 0:
+                buf[:] = buf[-1:] if buf[-1:] == RAW_SYNC[:1] else b""
+                break
+            del buf[:start]
+            if len(buf) < 3:
+                break
+            rid, n = buf[1], buf[2]
+            if n > TLOG_MAX_DATA:
+                del buf[:1]
+                continue
+            if len(buf) < n + 6:
+                break
+            rec = bytes(buf[: n + 6])
+            if sum(rec[1:-1]) & 0xFF != rec[-1]:
+                del buf[:1]
+                continue
+            del buf[: n + 6]
+            ts = rec[3] | rec[4] << 8
+            if t_last is not None and ts < t_last:
+                t_hi += 0x10000
+            t_last = ts
+            yield t_hi + ts, rid, rec[5:-1]
+
+
+def source(arg, baud):
+    if arg.startswith("/dev/") or arg.upper().startswith("COM"):
+        import serial
+
+        port = serial.Serial(arg, baud, timeout=0.1)
+        while True:
+            yield port.read(256)
+    else:
+        with open(arg, "rb") as f:
+            yield f.read()
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    baud = int(sys.argv[2]) if len(sys.argv) > 2 else 1000000
+    for ts, rid, data in records(source(sys.argv[1], baud)):
+        fmt = FORMAT.get(rid)
+        try:
+            text = fmt(data) if fmt else "id 0x%02X %s" % (rid, data.hex())
+        except (struct.error, IndexError):
+            text = "id 0x%02X malformed %s" % (rid, data.hex())
+        print("%10.3f  %s" % (ts / 1000.0, text))
+
+
+if __name__ == "__main__":
+    main()